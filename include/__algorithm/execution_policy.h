@@ -0,0 +1,46 @@
+#ifndef LLVM_MSTL_EXECUTION_POLICY_H
+#define LLVM_MSTL_EXECUTION_POLICY_H
+
+#include "__config.h"
+
+#include <cstddef>
+#include <type_traits>
+
+LLVM_MSTL_BEGIN_NAMESPACE_STD
+
+/**
+ * @brief The execution policies of the parallel algorithms of the library.
+ *
+ * `core::execution` needs a backend (TBB for libstdc++) and takes no thread count, so the algorithms here take
+ * these tags, which run on the threads of @ref __parallel_chunks.
+ *
+ * @code{.cc}
+ * nya::sort( nya::execution::par, __v.begin(), __v.end() );
+ * nya::sort( nya::execution::par.with_jobs( 8 ), __v.begin(), __v.end() );
+ * @endcode
+ */
+namespace execution {
+
+	struct sequenced_policy {
+		explicit sequenced_policy() = default;
+	};
+
+	struct parallel_policy {
+		size_t __jobs = 0;//<--- 0 means one per hardware thread
+
+		LLVM_MSTL_CONSTEXPR auto with_jobs( size_t __n ) const LLVM_MSTL_NOEXCEPT->parallel_policy { return parallel_policy{ __n }; }
+		LLVM_MSTL_CONSTEXPR auto jobs() const LLVM_MSTL_NOEXCEPT->size_t { return __jobs; }
+	};
+
+	inline LLVM_MSTL_CONSTEXPR sequenced_policy seq{};
+	inline LLVM_MSTL_CONSTEXPR parallel_policy  par{};
+
+}// namespace execution
+
+template < typename _Tp >
+inline LLVM_MSTL_CONSTEXPR bool is_execution_policy_v =
+	std::is_same_v< std::remove_cvref_t< _Tp >, execution::sequenced_policy > || std::is_same_v< std::remove_cvref_t< _Tp >, execution::parallel_policy >;
+
+LLVM_MSTL_END_NAMESPACE_STD
+
+#endif//LLVM_MSTL_EXECUTION_POLICY_H
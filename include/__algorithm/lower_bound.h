@@ -0,0 +1,65 @@
+#ifndef LLVM_MSTL_LOWER_BOUND_H
+#define LLVM_MSTL_LOWER_BOUND_H
+
+#include "__config.h"
+
+#include <iterator>
+#include <type_traits>
+
+LLVM_MSTL_BEGIN_NAMESPACE_STD
+LLVM_MSTL_CORE_STD
+
+/**
+ * @brief Binary search without a data dependent branch, returns the first element not less than `__value`.
+ *
+ * `core::lower_bound` branches on every comparison and the branch is taken at random, so on large tables
+ * every other probe is a misprediction. Here the half that remains is selected with a conditional move,
+ * the loop runs exactly `log2( n )` times whatever the data, and the next probe address is known early
+ * enough for the hardware prefetcher to follow.
+ *
+ * @tparam _RandomAccessIterator The iterator type.
+ * @tparam _Tp The type of the searched value.
+ * @tparam _Compare The strict weak ordering.
+ * @param __first The beginning of the sorted range.
+ * @param __last The end of the sorted range.
+ * @param __value The searched value.
+ * @param __comp The ordering the range is sorted by.
+ * @return The first iterator `__i` such that `!__comp( *__i, __value )`, `__last` if there is none.
+ */
+template < typename _RandomAccessIterator, typename _Tp, typename _Compare >
+LLVM_MSTL_CONSTEXPR_SINCE_CXX20 auto __branchless_lower_bound(
+	_RandomAccessIterator __first, _RandomAccessIterator __last, const _Tp& __value, _Compare& __comp ) -> _RandomAccessIterator {
+	using difference_type = typename core::iterator_traits< _RandomAccessIterator >::difference_type;
+	difference_type __len = __last - __first;
+	if ( __len == 0 ) return __first;
+	while ( __len > 1 ) {
+		const difference_type __half = __len / 2;
+		//<--- both candidates are computed, the compiler emits a cmov instead of a branch
+		__first += static_cast< bool >( __comp( __first[ __half ], __value ) ) ? __half : difference_type( 0 );
+		__len -= __half;
+	}
+	return __first + static_cast< difference_type >( static_cast< bool >( __comp( *__first, __value ) ) );
+}
+
+/**
+ * @brief The branchless counterpart of `core::upper_bound`, see @ref __branchless_lower_bound.
+ *
+ * @return The first iterator `__i` such that `__comp( __value, *__i )`, `__last` if there is none.
+ */
+template < typename _RandomAccessIterator, typename _Tp, typename _Compare >
+LLVM_MSTL_CONSTEXPR_SINCE_CXX20 auto __branchless_upper_bound(
+	_RandomAccessIterator __first, _RandomAccessIterator __last, const _Tp& __value, _Compare& __comp ) -> _RandomAccessIterator {
+	using difference_type = typename core::iterator_traits< _RandomAccessIterator >::difference_type;
+	difference_type __len = __last - __first;
+	if ( __len == 0 ) return __first;
+	while ( __len > 1 ) {
+		const difference_type __half = __len / 2;
+		__first += !static_cast< bool >( __comp( __value, __first[ __half ] ) ) ? __half : difference_type( 0 );
+		__len -= __half;
+	}
+	return __first + static_cast< difference_type >( !static_cast< bool >( __comp( __value, *__first ) ) );
+}
+
+LLVM_MSTL_END_NAMESPACE_STD
+
+#endif//LLVM_MSTL_LOWER_BOUND_H
@@ -0,0 +1,164 @@
+#ifndef LLVM_MSTL_PARALLEL_SORT_H
+#define LLVM_MSTL_PARALLEL_SORT_H
+
+#include "__algorithm/execution_policy.h"
+#include "__algorithm/lower_bound.h"
+#include "__config.h"
+#include "__memory/scratch_buffer.h"
+#include "__utility/exception_guard.h"
+#include "__utility/parallel_chunks.h"
+#include "vector.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <type_traits>
+
+LLVM_MSTL_BEGIN_NAMESPACE_STD
+LLVM_MSTL_CORE_STD
+
+//<--- the fewest elements worth a thread of their own
+inline LLVM_MSTL_CONSTEXPR size_t __parallel_sort_min_chunk = 1 << 13;
+//<--- the samples drawn per bucket, more of them even out the buckets
+inline LLVM_MSTL_CONSTEXPR size_t __parallel_sort_oversample = 32;
+
+/**
+ * @brief Sample sort of `[__first, __last)` on `__jobs` threads, see @ref sort.
+ *
+ * 1. `__jobs * __parallel_sort_oversample` evenly spaced elements are sorted, every `__parallel_sort_oversample`-th
+ *    of them splits the values into `__jobs` buckets.
+ * 2. Each thread counts the buckets of its chunk of the range; the prefix sums of the counts, bucket major, give
+ *    every chunk its slots in every bucket.
+ * 3. Each thread moves its chunk to those slots of a scratch buffer, then sorts one bucket there.
+ * 4. Each thread moves its chunk of the buffer back.
+ *
+ * The range is read twice and the elements moved twice, all of it in parallel, against the `log2( n )` passes
+ * of a merge sort.
+ */
+template < typename _RandomAccessIterator, typename _Compare, typename _Alloc >
+auto __parallel_sort( _RandomAccessIterator __first, _RandomAccessIterator __last, _Compare& __comp, size_t __jobs, const _Alloc& __alloc )
+	-> void {
+	using value_type  = core::iter_value_t< _RandomAccessIterator >;
+	using __diff_type = core::iter_difference_t< _RandomAccessIterator >;
+	using __buffer    = __scratch_buffer< value_type, _Alloc >;
+	using __sizes     = vector< size_t, core::allocator< size_t > >;
+
+	const auto __n = static_cast< size_t >( __last - __first );
+	__jobs         = __parallel_jobs( __jobs, __n / __parallel_sort_min_chunk );
+	if constexpr ( !core::is_copy_constructible_v< value_type > ) __jobs = 1;//<--- the splitters are copies
+	if ( __jobs == 1 ) {
+		core::sort( __first, __last, __comp );
+		return;
+	}
+	const auto __at = [ & ]( size_t __i ) -> decltype( auto ) { return __first[ static_cast< __diff_type >( __i ) ]; };
+
+	//<--- 1. the splitters
+	vector< value_type, core::allocator< value_type > > __splitters;
+	{
+		const size_t __samples = __jobs * __parallel_sort_oversample;
+		vector< value_type, core::allocator< value_type > > __sample;
+		__sample.reserve( __samples );
+		for ( size_t __s = 0; __s != __samples; ++__s ) __sample.push_back( __at( __s * __n / __samples ) );
+		core::sort( __sample.begin(), __sample.end(), __comp );
+		__splitters.reserve( __jobs - 1 );
+		for ( size_t __b = 1; __b != __jobs; ++__b ) __splitters.push_back( __sample[ __b * __parallel_sort_oversample ] );
+	}
+	const auto __bucket_of = [ & ]( const value_type& __x ) -> size_t {
+		const value_type* __s = __splitters.data();
+		return static_cast< size_t >( __branchless_upper_bound( __s, __s + __splitters.size(), __x, __comp ) - __s );
+	};
+
+	//<--- 2. the slots of chunk `__job` in bucket `__b` start at `__offsets[ __job * __jobs + __b ]`
+	__sizes __offsets( __jobs * __jobs, 0 );
+	__parallel_chunks( __jobs, __n, [ & ]( size_t __job, size_t __lo, size_t __hi ) {
+		size_t* __count = __offsets.data() + __job * __jobs;
+		for ( size_t __i = __lo; __i != __hi; ++__i ) ++__count[ __bucket_of( __at( __i ) ) ];
+	} );
+	__sizes __bounds( __jobs + 1, 0 );
+	size_t  __sum = 0;
+	for ( size_t __b = 0; __b != __jobs; ++__b ) {
+		__bounds[ __b ] = __sum;
+		for ( size_t __job = 0; __job != __jobs; ++__job ) __sum += core::exchange( __offsets[ __job * __jobs + __b ], __sum );
+	}
+	__bounds[ __jobs ] = __n;
+
+	//<--- 3. the scatter, the slots filled are `[__start, __offsets)` of each chunk and bucket until it is done
+	__buffer    __scratch( __alloc, __n );
+	value_type* __buf = __scratch.data();
+	{
+		const __sizes __start( __offsets );
+		auto          __guard = __make_exception_guard( [ & ] {
+			for ( size_t __i = 0; __i != __start.size(); ++__i ) __alloctor_destroy( __scratch.__a, __buf + __start[ __i ], __buf + __offsets[ __i ] );
+		} );
+		__parallel_chunks( __jobs, __n, [ & ]( size_t __job, size_t __lo, size_t __hi ) {
+			size_t* __slot = __offsets.data() + __job * __jobs;
+			for ( size_t __i = __lo; __i != __hi; ++__i ) {
+				const size_t __b = __bucket_of( __at( __i ) );
+				core::allocator_traits< typename __buffer::allocator_type >::construct( __scratch.__a, __buf + __slot[ __b ], core::move( __at( __i ) ) );
+				++__slot[ __b ];
+			}
+		} );
+		__guard.__complete();
+		__scratch.__mark_constructed();
+	}
+	__parallel_chunks( __jobs, __jobs, [ & ]( size_t, size_t __lo, size_t __hi ) {
+		for ( size_t __b = __lo; __b != __hi; ++__b ) core::sort( __buf + __bounds[ __b ], __buf + __bounds[ __b + 1 ], __comp );
+	} );
+
+	//<--- 4. back to the range
+	__parallel_chunks( __jobs, __n, [ & ]( size_t, size_t __lo, size_t __hi ) {
+		core::move( __buf + __lo, __buf + __hi, __first + static_cast< __diff_type >( __lo ) );
+	} );
+}
+
+/**
+ * @brief Sorts `[__first, __last)` by `__comp` on the calling thread, as `core::sort`.
+ */
+template < core::random_access_iterator _RandomAccessIterator, typename _Compare = core::less<> >
+auto sort( execution::sequenced_policy, _RandomAccessIterator __first, _RandomAccessIterator __last, _Compare __comp = _Compare() )
+	-> void {
+	core::sort( __first, __last, __comp );
+}
+
+/**
+ * @brief Sorts `[__first, __last)` by `__comp` on `__policy.jobs()` threads.
+ *
+ * A sample sort over @ref __parallel_chunks: the range is split into one bucket of values per thread, each
+ * thread sorts one of them. Below `__parallel_sort_min_chunk` elements per thread, or for elements that cannot
+ * be copied, it is `core::sort`. The sort is not stable and needs a scratch buffer of `n` elements from
+ * `__alloc`; `__comp` is called from all the threads at once.
+ *
+ * @code{.cc}
+ * nya::sort( nya::execution::par, __v );
+ * nya::sort( nya::execution::par.with_jobs( 4 ), __v.begin(), __v.end(), core::greater<>() );
+ * @endcode
+ *
+ * @throws Whatever `__comp` or the copies of the splitters throw, the range is then valid but unspecified.
+ */
+template < core::random_access_iterator _RandomAccessIterator, typename _Compare = core::less<>,
+           typename _Alloc = core::allocator< core::iter_value_t< _RandomAccessIterator > > >
+auto sort( execution::parallel_policy __policy, _RandomAccessIterator __first, _RandomAccessIterator __last, _Compare __comp = _Compare(),
+           const _Alloc& __alloc = _Alloc() ) -> void {
+	using value_type = core::iter_value_t< _RandomAccessIterator >;
+	static_assert( core::is_nothrow_move_constructible_v< value_type > && core::is_nothrow_move_assignable_v< value_type >,
+	               "sort: the elements are moved through a scratch buffer, a throwing move would lose some of them" );
+	__parallel_sort( __first, __last, __comp, __policy.jobs(), __alloc );
+}
+
+/**
+ * @brief Sorts the vector, with the scratch buffer of a parallel sort from its allocator.
+ */
+template < typename _ExecutionPolicy, typename _Tp, typename _Allocator, typename _Compare = core::less<> >
+	requires is_execution_policy_v< _ExecutionPolicy >
+auto sort( _ExecutionPolicy&& __policy, vector< _Tp, _Allocator >& __v, _Compare __comp = _Compare() ) -> void {
+	if constexpr ( core::is_same_v< core::remove_cvref_t< _ExecutionPolicy >, execution::parallel_policy > )
+		nya::sort( __policy, __v.data(), __v.data() + __v.size(), core::move( __comp ), __v.get_allocator() );
+	else
+		nya::sort( __policy, __v.data(), __v.data() + __v.size(), core::move( __comp ) );
+}
+
+LLVM_MSTL_END_NAMESPACE_STD
+
+#endif//LLVM_MSTL_PARALLEL_SORT_H
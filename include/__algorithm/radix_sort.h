@@ -0,0 +1,192 @@
+#ifndef LLVM_MSTL_RADIX_SORT_H
+#define LLVM_MSTL_RADIX_SORT_H
+
+#include "__config.h"
+#include "__memory/scratch_buffer.h"
+#include "__utility/exception_guard.h"
+#include "vector.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+LLVM_MSTL_BEGIN_NAMESPACE_STD
+LLVM_MSTL_CORE_STD
+
+/**
+ * @brief The unsigned integer of the size of `_Kp`.
+ */
+template < typename _Kp >
+using __radix_bits_t = core::conditional_t<
+	sizeof( _Kp ) == 1, uint8_t,
+	core::conditional_t< sizeof( _Kp ) == 2, uint16_t, core::conditional_t< sizeof( _Kp ) == 4, uint32_t, uint64_t > > >;
+
+template < typename _Kp >
+concept __radix_key = ( core::is_integral_v< _Kp > && !core::is_same_v< _Kp, bool > ) || core::is_enum_v< _Kp > ||
+                      ( core::is_floating_point_v< _Kp > && core::numeric_limits< _Kp >::is_iec559 && ( sizeof( _Kp ) == 4 || sizeof( _Kp ) == 8 ) );
+
+/**
+ * @brief Maps a key to an unsigned integer of the same size that orders the same way.
+ *
+ * Signed integers have their sign bit flipped, so the negatives come first. An IEEE float orders as its
+ * sign-magnitude bits: a positive one has its sign bit set, a negative one all its bits flipped, so the greater
+ * magnitudes of the negatives come first. NaNs go to the ends by their sign.
+ */
+template < __radix_key _Kp >
+LLVM_MSTL_CONSTEXPR auto __radix_bits( _Kp __k ) LLVM_MSTL_NOEXCEPT->__radix_bits_t< _Kp > {
+	using _Up                      = __radix_bits_t< _Kp >;
+	LLVM_MSTL_CONSTEXPR _Up __sign = _Up( 1 ) << ( sizeof( _Up ) * 8 - 1 );
+	if constexpr ( core::is_enum_v< _Kp > ) {
+		return __radix_bits( static_cast< core::underlying_type_t< _Kp > >( __k ) );
+	} else if constexpr ( core::is_floating_point_v< _Kp > ) {
+		const auto __u = core::bit_cast< _Up >( __k );
+		return ( __u & __sign ) ? static_cast< _Up >( ~__u ) : static_cast< _Up >( __u | __sign );
+	} else if constexpr ( core::is_signed_v< _Kp > ) {
+		return static_cast< _Up >( static_cast< _Up >( __k ) ^ __sign );
+	} else {
+		return static_cast< _Up >( __k );
+	}
+}
+
+//<--- below this size an insertion sort beats the histogram and the passes
+inline LLVM_MSTL_CONSTEXPR size_t __radix_sort_insertion_limit = 64;
+
+/**
+ * @brief Moves the elements from `__src` to `__dst`, each to the next free slot of the bucket of its digit.
+ *
+ * The buckets are filled from their start in order, so on an exception in a construct pass the constructed
+ * slots are the prefixes `[__start, __offsets)` of the buckets, which the guard destroys.
+ *
+ * @param __offsets The first slot of each bucket, advanced past the slots filled.
+ * @param __construct Whether `__dst` is raw storage, constructed into, or holds elements, assigned to.
+ */
+template < typename _Src, typename _Dst, typename _Alloc, typename _Digit >
+auto __radix_scatter( _Src __src, _Dst __dst, size_t __n, size_t* __offsets, size_t __radix, bool __construct, _Alloc& __alloc,
+                      const _Digit& __digit ) -> void {
+	using __diff_type = core::iter_difference_t< _Src >;
+	if ( !__construct ) {
+		for ( size_t __i = 0; __i != __n; ++__i ) {
+			auto& __x = __src[ static_cast< __diff_type >( __i ) ];
+			__dst[ static_cast< core::iter_difference_t< _Dst > >( __offsets[ __digit( __x ) ]++ ) ] = core::move( __x );
+		}
+		return;
+	}
+
+	vector< size_t, core::allocator< size_t > > __start( __offsets, __offsets + __radix );
+	auto __guard = __make_exception_guard( [ & ] {
+		for ( size_t __b = 0; __b != __radix; ++__b ) __alloctor_destroy( __alloc, __dst + __start[ __b ], __dst + __offsets[ __b ] );
+	} );
+	for ( size_t __i = 0; __i != __n; ++__i ) {
+		auto&        __x = __src[ static_cast< __diff_type >( __i ) ];
+		const size_t __b = __digit( __x );
+		core::allocator_traits< _Alloc >::construct( __alloc, core::to_address( __dst + __offsets[ __b ] ), core::move( __x ) );
+		++__offsets[ __b ];
+	}
+	__guard.__complete();
+}
+
+/**
+ * @brief Sorts `[__first, __last)` by the integer or floating point key `__key` of the elements, least significant digit first.
+ *
+ * @ref https://en.wikipedia.org/wiki/Radix_sort#Least_significant_digit
+ *
+ * A comparison sort spends `log2( n )` unpredictable branches per element; here each pass of `_DigitBits` bits reads
+ * the keys once and moves every element once, with no comparison at all, so `sizeof( key ) * 8 / _DigitBits`
+ * passes sort any `n`. One read pass builds the histograms of all the digits, and a digit every key has in
+ * common costs no pass: small keys in a wide type, or presorted high bits, are cheap.
+ *
+ * The passes move the elements between the range and a scratch buffer of `n` elements from `__alloc`, so the sort
+ * is not in place; it is stable. The moves must not throw; a throwing `__key` leaves the range valid but
+ * unspecified.
+ *
+ * @code{.cc}
+ * nya::radix_sort( __v );                                                            //<--- integers or floats
+ * nya::radix_sort< 16 >( __records.begin(), __records.end(), &record::timestamp );   //<--- by a member
+ * @endcode
+ *
+ * @tparam _DigitBits The bits of a digit: 8 keeps the histogram in L1, 11 sorts 32-bit keys in 3 passes, 16 in 2.
+ * @param __key The key of an element, an integer, enum or IEEE float; a projection as in `core::ranges`.
+ * @param __alloc The allocator of the scratch buffer.
+ */
+template < size_t _DigitBits = 8, core::random_access_iterator _RandomAccessIterator, typename _Key = core::identity,
+           typename _Alloc = core::allocator< core::iter_value_t< _RandomAccessIterator > > >
+	requires __radix_key< core::remove_cvref_t< core::invoke_result_t< _Key&, const core::iter_value_t< _RandomAccessIterator >& > > >
+auto radix_sort( _RandomAccessIterator __first, _RandomAccessIterator __last, _Key __key = _Key(), const _Alloc& __alloc = _Alloc() )
+	-> void {
+	static_assert( _DigitBits >= 1 && _DigitBits <= 16, "radix_sort: a digit is 1 to 16 bits" );
+	using value_type  = core::iter_value_t< _RandomAccessIterator >;
+	using __key_type  = core::remove_cvref_t< core::invoke_result_t< _Key&, const value_type& > >;
+	using _Up         = __radix_bits_t< __key_type >;
+	using __buffer    = __scratch_buffer< value_type, _Alloc >;
+	using __diff_type = core::iter_difference_t< _RandomAccessIterator >;
+	static_assert( core::is_nothrow_move_constructible_v< value_type > && core::is_nothrow_move_assignable_v< value_type >,
+	               "radix_sort: the elements are moved between the passes, a throwing move would lose some of them" );
+
+	LLVM_MSTL_CONSTEXPR size_t __radix  = size_t( 1 ) << _DigitBits;
+	LLVM_MSTL_CONSTEXPR size_t __passes = ( sizeof( _Up ) * 8 + _DigitBits - 1 ) / _DigitBits;
+	const auto                 __n      = static_cast< size_t >( __last - __first );
+
+	const auto __bits_of = [ & ]( const value_type& __x ) -> _Up { return __radix_bits( static_cast< __key_type >( core::invoke( __key, __x ) ) ); };
+	if ( __n < 2 ) return;
+	if ( __n < __radix_sort_insertion_limit ) {
+		for ( size_t __i = 1; __i != __n; ++__i ) {
+			const _Up  __bits = __bits_of( __first[ static_cast< __diff_type >( __i ) ] );
+			value_type __x    = core::move( __first[ static_cast< __diff_type >( __i ) ] );
+			size_t     __j    = __i;
+			for ( ; __j != 0 && __bits < __bits_of( __first[ static_cast< __diff_type >( __j - 1 ) ] ); --__j )
+				__first[ static_cast< __diff_type >( __j ) ] = core::move( __first[ static_cast< __diff_type >( __j - 1 ) ] );
+			__first[ static_cast< __diff_type >( __j ) ] = core::move( __x );
+		}
+		return;
+	}
+
+	//<--- the histograms of all the digits in one read pass
+	vector< size_t, core::allocator< size_t > > __counts( __passes * __radix, 0 );
+	for ( size_t __i = 0; __i != __n; ++__i ) {
+		const _Up __bits = __bits_of( __first[ static_cast< __diff_type >( __i ) ] );
+		for ( size_t __p = 0; __p != __passes; ++__p ) ++__counts[ __p * __radix + ( ( __bits >> ( __p * _DigitBits ) ) & ( __radix - 1 ) ) ];
+	}
+
+	__buffer    __scratch( __alloc, __n );
+	value_type* __buf       = __scratch.data();
+	bool        __in_buffer = false;
+	for ( size_t __p = 0; __p != __passes; ++__p ) {
+		size_t*      __offsets = __counts.data() + __p * __radix;
+		const size_t __shift   = __p * _DigitBits;
+		//<--- every key has the same digit here, the pass would move the elements in place
+		if ( core::find( __offsets, __offsets + __radix, __n ) != __offsets + __radix ) continue;
+
+		size_t __sum = 0;
+		for ( size_t __d = 0; __d != __radix; ++__d ) __sum += core::exchange( __offsets[ __d ], __sum );
+		const auto __digit = [ & ]( const value_type& __x ) -> size_t { return static_cast< size_t >( ( __bits_of( __x ) >> __shift ) & ( __radix - 1 ) ); };
+
+		if ( __in_buffer ) {
+			__radix_scatter( __buf, __first, __n, __offsets, __radix, false, __scratch.__a, __digit );
+		} else {
+			__radix_scatter( __first, __buf, __n, __offsets, __radix, !__scratch.__constructed, __scratch.__a, __digit );
+			__scratch.__mark_constructed();
+		}
+		__in_buffer = !__in_buffer;
+	}
+	if ( __in_buffer ) core::move( __buf, __buf + __n, __first );
+}
+
+/**
+ * @brief Sorts the vector by `__key`, with the scratch buffer from its allocator.
+ */
+template < size_t _DigitBits = 8, typename _Tp, typename _Allocator, typename _Key = core::identity >
+	requires __radix_key< core::remove_cvref_t< core::invoke_result_t< _Key&, const _Tp& > > >
+auto radix_sort( vector< _Tp, _Allocator >& __v, _Key __key = _Key() ) -> void {
+	radix_sort< _DigitBits >( __v.data(), __v.data() + __v.size(), core::move( __key ), __v.get_allocator() );
+}
+
+LLVM_MSTL_END_NAMESPACE_STD
+
+#endif//LLVM_MSTL_RADIX_SORT_H
@@ -0,0 +1,66 @@
+#ifndef LLVM_MSTL_REMOVE_IF_H
+#define LLVM_MSTL_REMOVE_IF_H
+
+#include "__config.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <type_traits>
+
+LLVM_MSTL_BEGIN_NAMESPACE_STD
+LLVM_MSTL_CORE_STD
+
+/**
+ * @brief Removes the elements of [__first, __last) satisfying `__pred` and returns the new logical end.
+ *
+ * This is the generic version, it simply forwards to `core::remove_if`.
+ * The elements in [return value, __last) are left in a valid but unspecified (moved-from) state.
+ *
+ * @tparam _ForwardIterator The iterator type.
+ * @tparam _Predicate The unary predicate type.
+ * @param __first The beginning of the range.
+ * @param __last The end of the range.
+ * @param __pred The predicate, `true` means the element is removed.
+ * @return The new logical end of the range.
+ */
+template < typename _ForwardIterator, typename _Predicate >
+LLVM_MSTL_CONSTEXPR_SINCE_CXX20 auto __remove_if( _ForwardIterator __first, _ForwardIterator __last, _Predicate& __pred )
+	-> _ForwardIterator {
+	return core::remove_if( __first, __last, __pred );
+}
+
+/**
+ * @brief Stream compaction for contiguous ranges of trivially copyable elements.
+ *
+ * `core::remove_if` branches on every element, which is mispredicted all the time when a scattered
+ * few percent of the elements are removed. For trivially copyable types the copy is cheap, so every
+ * surviving candidate is copied unconditionally and the write cursor only advances when the element is kept.
+ * The loop has no data dependent branch and the compiler is free to vectorize the copy.
+ *
+ * @tparam _Tp The trivially copyable element type.
+ * @tparam _Predicate The unary predicate type.
+ * @param __first The beginning of the range.
+ * @param __last The end of the range.
+ * @param __pred The predicate, `true` means the element is removed.
+ * @return The new logical end of the range.
+ */
+template <
+	typename _Tp,
+	typename _Predicate,
+	core::enable_if_t< core::is_trivially_copyable_v< _Tp >, int > = 0 >
+LLVM_MSTL_CONSTEXPR_SINCE_CXX20 auto __remove_if( _Tp* __first, _Tp* __last, _Predicate& __pred ) -> _Tp* {
+	//<--- the prefix in front of the first removed element is already in place
+	__first = core::find_if( __first, __last, __pred );
+	if ( __first == __last ) return __first;
+	_Tp* __w = __first;
+	for ( _Tp* __r = __first + 1; __r != __last; ++__r ) {
+		const bool __keep = !static_cast< bool >( __pred( *__r ) );
+		*__w              = *__r;
+		__w += static_cast< core::ptrdiff_t >( __keep );
+	}
+	return __w;
+}
+
+LLVM_MSTL_END_NAMESPACE_STD
+
+#endif//LLVM_MSTL_REMOVE_IF_H
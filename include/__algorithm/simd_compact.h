@@ -0,0 +1,70 @@
+#ifndef LLVM_MSTL_SIMD_COMPACT_H
+#define LLVM_MSTL_SIMD_COMPACT_H
+
+#include "__algorithm/simd_dispatch.h"
+#include "__algorithm/simd_search.h"
+#include "__config.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+
+LLVM_MSTL_BEGIN_NAMESPACE_STD
+LLVM_MSTL_CORE_STD
+
+/**
+ * @brief Copies the elements `__i` of `[__first, __first + __n)` whose bit `__i` is set in `__keep` to `__out`, in
+ * order; returns their number.
+ *
+ * `__out` may lie anywhere up to `__first` in the same array: every element is stored and the write cursor only
+ * advances past the kept ones, so the stores stay behind the loads and the loop has no data dependent branch. A
+ * compress of whole vector registers needs instructions the compiler does not emit for this loop: an ISA tag of
+ * the library may carry one, see @ref __simd_kernels_of.
+ */
+template < __simd_scalar _Tp, typename _Isa = __simd_native >
+auto __simd_compact( _Tp* __out, const _Tp* __first, size_t __n, const uint64_t* __keep ) LLVM_MSTL_NOEXCEPT->size_t {
+	size_t __w = 0;
+	for ( size_t __i = 0; __i != __n; ++__i ) {
+		__out[ __w ] = __first[ __i ];
+		__w += static_cast< size_t >( ( __keep[ __i / 64 ] >> ( __i % 64 ) ) & 1 );
+	}
+	return __w;
+}
+
+//<--- the elements are moved as bits, so `float` and `double` take the kernels of their width too
+template < __simd_scalar _Tp >
+auto __simd_dispatch_compact( _Tp* __out, const _Tp* __first, size_t __n, const uint64_t* __keep ) LLVM_MSTL_NOEXCEPT->size_t {
+	if constexpr ( __simd_dispatched && sizeof( _Tp ) <= 8 )
+		return __simd_kernels().__compact[ __simd_width_index< _Tp > ]( __out, __first, __n, __keep );
+	else
+		return __simd_compact( __out, __first, __n, __keep );
+}
+
+//<--- the elements of one mask of `__simd_compact_blocks`, small enough for the stack and the L1 cache
+inline LLVM_MSTL_CONSTEXPR size_t __simd_compact_block = 4096;
+
+/**
+ * @brief @ref __simd_compact of `[__first, __first + __n)` to `__out <= __first`, a block of
+ * @ref __simd_compact_block elements at a time.
+ *
+ * `__mask( __base, __len, __keep )` sets the bit `__i` of `__keep` when the element `__base + __i` is kept, for the
+ * `__len` elements of the block, before the block is compacted. It may throw: the elements are then left in
+ * place or duplicated, all of them valid.
+ *
+ * @return The number of kept elements.
+ */
+template < __simd_scalar _Tp, typename _Mask >
+auto __simd_compact_blocks( _Tp* __out, const _Tp* __first, size_t __n, _Mask& __mask ) -> size_t {
+	uint64_t __keep[ __simd_compact_block / 64 ];
+	size_t   __w = 0;
+	for ( size_t __i = 0; __i < __n; __i += __simd_compact_block ) {
+		const size_t __len = core::min( __simd_compact_block, __n - __i );
+		__mask( __i, __len, __keep );
+		__w += __simd_dispatch_compact( __out + __w, __first + __i, __len, __keep );
+	}
+	return __w;
+}
+
+LLVM_MSTL_END_NAMESPACE_STD
+
+#endif//LLVM_MSTL_SIMD_COMPACT_H
@@ -0,0 +1,123 @@
+#ifndef LLVM_MSTL_SIMD_DISPATCH_H
+#define LLVM_MSTL_SIMD_DISPATCH_H
+
+#include "__config.h"
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+
+LLVM_MSTL_BEGIN_NAMESPACE_STD
+LLVM_MSTL_CORE_STD
+
+/**
+ * @brief The instruction sets the kernels of the mstl library are built for.
+ *
+ * The library carries one copy of each kernel per ISA and binds the best one the host supports at startup, from
+ * CPUID (and the OS support of the wider registers). `LLVM_MSTL_FORCE_ISA=baseline|avx2|avx512` in the
+ * environment caps the choice, for testing and to rule the kernels out when chasing a bug; an ISA the host lacks
+ * falls back to the best one below it.
+ *
+ * On other architectures than x86-64 only `baseline` is built.
+ *
+ * The kernels live in the mstl library, which a program using the containers then links. With
+ * `LLVM_MSTL_HEADER_ONLY` defined, in every translation unit of the program, the headers call their own kernels
+ * instead, for the ISA the program is built for.
+ */
+enum class simd_isa : uint8_t {
+	baseline,//<--- the flags of the library build: SSE2 on x86-64
+	avx2,
+	avx512,//<--- AVX-512 F, BW and VL
+};
+
+//<--- the operations of `__simd_kernel_set::__combine_words`
+enum class __simd_word_op : uint8_t {
+	__and,
+	__or,
+	__xor,
+	__andnot,//<--- `__dst & ~__src`
+};
+
+/**
+ * @brief The kernels of one ISA, by element type.
+ *
+ * - The searches take the integers of 1, 2, 4 and 8 bytes, of either signedness, then `float` and `double`. The
+ *   equality of integers is that of their bits.
+ * - The stores take the element widths 1, 2, 4 and 8 bytes, for any type of that width.
+ * - The orders take the unsigned integers of 1, 2, 4 and 8 bytes, then the signed ones.
+ * - The word kernels take the 64-bit words of the bitsets.
+ *
+ * The elements are passed untyped and a value by its bits, zero-extended.
+ */
+struct __simd_kernel_set {
+	using __find_type     = size_t ( * )( const void* __first, size_t __n, uint64_t __v ) LLVM_MSTL_NOEXCEPT;
+	using __mismatch_type = size_t ( * )( const void* __first1, const void* __first2, size_t __n ) LLVM_MSTL_NOEXCEPT;
+	using __fill_type     = void ( * )( void* __first, size_t __n, uint64_t __v ) LLVM_MSTL_NOEXCEPT;
+	using __compact_type  = size_t ( * )( void* __out, const void* __first, size_t __n, const uint64_t* __keep ) LLVM_MSTL_NOEXCEPT;
+	using __element_type  = size_t ( * )( const void* __first, size_t __n ) LLVM_MSTL_NOEXCEPT;
+	using __minmax_type   = core::pair< size_t, size_t > ( * )( const void* __first, size_t __n ) LLVM_MSTL_NOEXCEPT;
+	using __popcount_type = size_t ( * )( const uint64_t* __p, size_t __n, uint64_t __flip ) LLVM_MSTL_NOEXCEPT;
+	using __words_type    = void ( * )( uint64_t* __dst, const uint64_t* __src, size_t __n ) LLVM_MSTL_NOEXCEPT;
+
+	simd_isa        __isa;
+	__find_type     __find[ 6 ];          //<--- the index of the first element equal to `__v`, `__n` if none
+	__find_type     __count[ 6 ];         //<--- the number of elements equal to `__v`
+	__mismatch_type __mismatch[ 6 ];      //<--- the index of the first element that differs, `__n` if none
+	__fill_type     __fill[ 4 ];          //<--- stores `__v` to the `__n` elements
+	__compact_type  __compact[ 4 ];       //<--- copies the elements whose bit is set in `__keep` to `__out <= __first`, returns their number
+	__element_type  __min_element[ 8 ];   //<--- the index of the first least element, `__n` if none
+	__element_type  __max_element[ 8 ];   //<--- the index of the first greatest element, `__n` if none
+	__minmax_type   __minmax_element[ 8 ];//<--- the indices of the first least and the last greatest elements
+	__popcount_type __popcount;           //<--- the number of set bits of the words XORed with `__flip`
+	__words_type    __combine_words[ 4 ]; //<--- `__dst op= __src` word by word, by @ref __simd_word_op
+};
+
+#ifndef LLVM_MSTL_HEADER_ONLY
+//<--- whether the kernels of the library are called, see `LLVM_MSTL_HEADER_ONLY`
+inline LLVM_MSTL_CONSTEXPR bool __simd_dispatched = true;
+
+/**
+ * @brief The kernels bound to the host.
+ *
+ * A dispatched call costs a relaxed atomic load of this pointer and an indirect call, which the compiler cannot
+ * inline; a short range may be faster through the kernels of the headers. An `ifunc` or `target_clones` would
+ * save the load, but not the indirect call, and could not be rebound by @ref simd_select_isa.
+ *
+ * Until the library resolves it at startup, it holds stubs which resolve it on their first call.
+ */
+extern core::atomic< const __simd_kernel_set* > __simd_active_kernels;
+
+inline auto __simd_kernels() LLVM_MSTL_NOEXCEPT->const __simd_kernel_set& { return *__simd_active_kernels.load( core::memory_order_relaxed ); }
+#else
+/**
+ * Without the library, the algorithms run the `__simd_native` kernels of the headers, built with the flags of the
+ * including translation unit, and nothing refers to `__simd_active_kernels`. The `simd_*` functions below still
+ * need the library.
+ */
+inline LLVM_MSTL_CONSTEXPR bool __simd_dispatched = false;
+
+auto __simd_kernels() LLVM_MSTL_NOEXCEPT->const __simd_kernel_set&;//<--- only named in discarded branches
+#endif
+
+/**
+ * @brief Whether the library has the kernels of `__isa` and the host can run them.
+ */
+auto simd_isa_supported( simd_isa __isa ) LLVM_MSTL_NOEXCEPT->bool;
+
+/**
+ * @brief The ISA of the kernels in use.
+ */
+auto simd_active_isa() LLVM_MSTL_NOEXCEPT->simd_isa;
+
+/**
+ * @brief Binds the kernels of `__isa`, for the tests of every variant; not to be called while kernels run.
+ * @return `false`, and nothing changes, if `__isa` is not supported.
+ */
+auto simd_select_isa( simd_isa __isa ) LLVM_MSTL_NOEXCEPT->bool;
+
+auto simd_isa_name( simd_isa __isa ) LLVM_MSTL_NOEXCEPT->const char*;
+
+LLVM_MSTL_END_NAMESPACE_STD
+
+#endif//LLVM_MSTL_SIMD_DISPATCH_H
@@ -0,0 +1,78 @@
+#ifndef LLVM_MSTL_SIMD_FILL_H
+#define LLVM_MSTL_SIMD_FILL_H
+
+#include "__algorithm/simd_dispatch.h"
+#include "__algorithm/simd_search.h"
+#include "__config.h"
+
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+LLVM_MSTL_BEGIN_NAMESPACE_STD
+LLVM_MSTL_CORE_STD
+
+/**
+ * @brief The types a fill writes as the unsigned integer of their width: one broadcast register, stored per block.
+ *
+ * The alignment has to be that of the integer too, the kernels store whole lanes.
+ */
+template < typename _Tp >
+concept __simd_fillable = core::is_trivially_copyable_v< _Tp > &&
+													( sizeof( _Tp ) == 1 || sizeof( _Tp ) == 2 || sizeof( _Tp ) == 4 || sizeof( _Tp ) == 8 ) &&
+													alignof( _Tp ) == sizeof( _Tp );
+
+/**
+ * @brief Stores `__v` to the `__n` elements from `__first`.
+ *
+ * A store per element in blocks of a fixed length, which the compiler turns into a broadcast and a few vector
+ * stores per block. Bytes go to `memset`.
+ */
+template < typename _Up, typename _Isa = __simd_native >
+	requires core::is_unsigned_v< _Up >
+auto __simd_fill( _Up* __first, size_t __n, _Up __v ) LLVM_MSTL_NOEXCEPT->void {
+	if constexpr ( sizeof( _Up ) == 1 ) {
+		if ( __n != 0 ) core::memset( __first, __v, __n );
+	} else {
+		LLVM_MSTL_CONSTEXPR size_t __lanes = __simd_lanes< _Up >;
+		size_t                     __i     = 0;
+		for ( ; __n - __i >= __lanes; __i += __lanes ) {
+			for ( size_t __j = 0; __j != __lanes; ++__j ) __first[ __i + __j ] = __v;
+		}
+		for ( ; __i != __n; ++__i ) __first[ __i ] = __v;
+	}
+}
+
+//<--- through the kernels bound to the host, see @ref simd_isa; the elements may be uninitialized
+template < __simd_fillable _Tp >
+auto __simd_dispatch_fill( _Tp* __first, size_t __n, const _Tp& __x ) LLVM_MSTL_NOEXCEPT->void {
+	using _Up = core::conditional_t<
+		sizeof( _Tp ) == 1, uint8_t, core::conditional_t< sizeof( _Tp ) == 2, uint16_t, core::conditional_t< sizeof( _Tp ) == 4, uint32_t, uint64_t > > >;
+	const auto __bits = core::bit_cast< _Up >( __x );
+	if constexpr ( sizeof( _Tp ) == 1 || !__simd_dispatched )
+		__simd_fill( reinterpret_cast< _Up* >( __first ), __n, __bits );//<--- `memset`, or a header-only build: no dispatch
+	else
+		__simd_kernels().__fill[ __simd_width_index< _Tp > ]( __first, __n, __bits );
+}
+
+/**
+ * @brief As `core::fill_n`: over the elements of a pointer of a @ref __simd_fillable type, the kernels store `__x`.
+ */
+template < typename _OutIter, typename _Size, typename _Tp >
+LLVM_MSTL_CONSTEXPR_SINCE_CXX20 auto __fill_n( _OutIter __first, _Size __n, const _Tp& __x ) -> _OutIter {
+	if constexpr ( core::is_pointer_v< _OutIter > && core::is_same_v< core::remove_pointer_t< _OutIter >, _Tp > && __simd_fillable< _Tp > ) {
+		if ( !core::is_constant_evaluated() ) {
+			if ( __n <= 0 ) return __first;
+			__simd_dispatch_fill( __first, static_cast< size_t >( __n ), _Tp( __x ) );
+			return __first + __n;
+		}
+	}
+	return core::fill_n( __first, __n, __x );
+}
+
+LLVM_MSTL_END_NAMESPACE_STD
+
+#endif//LLVM_MSTL_SIMD_FILL_H
@@ -0,0 +1,427 @@
+#ifndef LLVM_MSTL_SIMD_SEARCH_H
+#define LLVM_MSTL_SIMD_SEARCH_H
+
+#include "__algorithm/simd_dispatch.h"
+#include "__config.h"
+
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <iterator>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+LLVM_MSTL_BEGIN_NAMESPACE_STD
+LLVM_MSTL_CORE_STD
+
+/**
+ * @brief The element types of the kernels: arithmetic, so `==` and `<` are one vector instruction per lane.
+ */
+template < typename _Tp >
+concept __simd_scalar = core::is_arithmetic_v< _Tp > && !core::is_same_v< _Tp, bool >;
+
+/**
+ * @brief The types whose `==` is the equality of their bytes: not the floats, where `-0.0 == 0.0` and `NaN != NaN`.
+ */
+template < typename _Tp >
+concept __bitwise_equality = core::is_integral_v< _Tp > || core::is_enum_v< _Tp > || core::is_pointer_v< _Tp >;
+
+/**
+ * @brief The ISA tag of the kernels compiled with the flags of the including translation unit.
+ *
+ * The library instantiates the kernels once more per ISA with a tag of its own, in a translation unit built for
+ * that ISA, see @ref simd_isa: the tag keeps those instantiations from merging with these at link time.
+ */
+struct __simd_native {};
+
+//<--- a block is scanned without an early exit, the lanes of one or two vector registers
+inline LLVM_MSTL_CONSTEXPR size_t __simd_block_bytes = 64;
+template < typename _Tp >
+inline LLVM_MSTL_CONSTEXPR size_t __simd_lanes = __simd_block_bytes / sizeof( _Tp );
+
+/**
+ * @brief The first element equal to `__v` in `[__first, __last)`, `__last` if there is none.
+ *
+ * A loop with an exit per element does not vectorize. Here each block only ORs its comparisons, which the
+ * compiler turns into a few vector compares and one test, and the element is located in the block that hit.
+ * Bytes go to `memchr`.
+ */
+template < __simd_scalar _Tp, typename _Isa = __simd_native >
+auto __simd_find( const _Tp* __first, const _Tp* __last, _Tp __v ) LLVM_MSTL_NOEXCEPT->const _Tp* {
+	if constexpr ( sizeof( _Tp ) == 1 && core::is_integral_v< _Tp > ) {
+		if ( __first == __last ) return __last;
+		const void* __p = core::memchr( __first, static_cast< unsigned char >( __v ), static_cast< size_t >( __last - __first ) );
+		return __p ? static_cast< const _Tp* >( __p ) : __last;
+	} else {
+		LLVM_MSTL_CONSTEXPR size_t __lanes = __simd_lanes< _Tp >;
+		for ( ; static_cast< size_t >( __last - __first ) >= __lanes; __first += __lanes ) {
+			bool __hit = false;
+			for ( size_t __j = 0; __j != __lanes; ++__j ) __hit |= __first[ __j ] == __v;
+			if ( __hit ) break;
+		}
+		while ( __first != __last && !( *__first == __v ) ) ++__first;
+		return __first;
+	}
+}
+
+/**
+ * @brief The last element equal to `__v` in `[__first, __last)`, `__last` if there is none.
+ */
+template < __simd_scalar _Tp, typename _Isa = __simd_native >
+auto __simd_find_last( const _Tp* __first, const _Tp* __last, _Tp __v ) LLVM_MSTL_NOEXCEPT->const _Tp* {
+	LLVM_MSTL_CONSTEXPR size_t __lanes = __simd_lanes< _Tp >;
+	const _Tp*                 __end   = __last;
+	for ( ; static_cast< size_t >( __end - __first ) >= __lanes; __end -= __lanes ) {
+		bool __hit = false;
+		for ( size_t __j = 1; __j <= __lanes; ++__j ) __hit |= __end[ -static_cast< core::ptrdiff_t >( __j ) ] == __v;
+		if ( __hit ) break;
+	}
+	while ( __end != __first ) {
+		if ( *--__end == __v ) return __end;
+	}
+	return __last;
+}
+
+/**
+ * @brief The number of elements equal to `__v`.
+ *
+ * The matches of a block are summed in lanes of the width of the element, which cannot overflow on a block,
+ * then widened once per block.
+ */
+template < __simd_scalar _Tp, typename _Isa = __simd_native >
+auto __simd_count( const _Tp* __first, const _Tp* __last, _Tp __v ) LLVM_MSTL_NOEXCEPT->size_t {
+	using _Up                          = core::make_unsigned_t< core::conditional_t<
+		sizeof( _Tp ) == 1, int8_t, core::conditional_t< sizeof( _Tp ) == 2, int16_t, core::conditional_t< sizeof( _Tp ) == 4, int32_t, int64_t > > > >;
+	LLVM_MSTL_CONSTEXPR size_t __lanes = __simd_lanes< _Tp >;
+	size_t                     __n     = 0;
+	for ( ; static_cast< size_t >( __last - __first ) >= __lanes; __first += __lanes ) {
+		_Up __block = 0;
+		for ( size_t __j = 0; __j != __lanes; ++__j ) __block = static_cast< _Up >( __block + ( __first[ __j ] == __v ) );
+		__n += __block;
+	}
+	for ( ; __first != __last; ++__first ) __n += static_cast< size_t >( *__first == __v );
+	return __n;
+}
+
+/**
+ * @brief The first least element: a min reduction the compiler vectorizes, then a find of the minimum.
+ *
+ * Only for integers: with a NaN the result of `core::min_element` depends on the order of the scan.
+ */
+template < __simd_scalar _Tp, typename _Isa = __simd_native >
+	requires core::is_integral_v< _Tp >
+auto __simd_min_element( const _Tp* __first, const _Tp* __last ) LLVM_MSTL_NOEXCEPT->const _Tp* {
+	if ( __first == __last ) return __last;
+	_Tp __m = *__first;
+	for ( const _Tp* __p = __first; __p != __last; ++__p ) __m = *__p < __m ? *__p : __m;
+	return __simd_find< _Tp, _Isa >( __first, __last, __m );
+}
+
+template < __simd_scalar _Tp, typename _Isa = __simd_native >
+	requires core::is_integral_v< _Tp >
+auto __simd_max_element( const _Tp* __first, const _Tp* __last ) LLVM_MSTL_NOEXCEPT->const _Tp* {
+	if ( __first == __last ) return __last;
+	_Tp __m = *__first;
+	for ( const _Tp* __p = __first; __p != __last; ++__p ) __m = __m < *__p ? *__p : __m;
+	return __simd_find< _Tp, _Isa >( __first, __last, __m );
+}
+
+//<--- as `core::minmax_element`: the first least and the last greatest element
+template < __simd_scalar _Tp, typename _Isa = __simd_native >
+	requires core::is_integral_v< _Tp >
+auto __simd_minmax_element( const _Tp* __first, const _Tp* __last ) LLVM_MSTL_NOEXCEPT->core::pair< const _Tp*, const _Tp* > {
+	if ( __first == __last ) return { __last, __last };
+	_Tp __lo = *__first, __hi = *__first;
+	for ( const _Tp* __p = __first; __p != __last; ++__p ) {
+		__lo = *__p < __lo ? *__p : __lo;
+		__hi = __hi < *__p ? *__p : __hi;
+	}
+	return { __simd_find< _Tp, _Isa >( __first, __last, __lo ), __simd_find_last< _Tp, _Isa >( __first, __last, __hi ) };
+}
+
+/**
+ * @brief The index of the first position where the ranges of `__n` elements from `__first1` and `__first2` differ, `__n` if none.
+ */
+template < __simd_scalar _Tp, typename _Isa = __simd_native >
+auto __simd_mismatch_index( const _Tp* __first1, const _Tp* __first2, size_t __n ) LLVM_MSTL_NOEXCEPT->size_t {
+	LLVM_MSTL_CONSTEXPR size_t __lanes = __simd_lanes< _Tp >;
+	size_t                     __i     = 0;
+	for ( ; __n - __i >= __lanes; __i += __lanes ) {
+		bool __differ = false;
+		for ( size_t __j = 0; __j != __lanes; ++__j ) __differ |= !( __first1[ __i + __j ] == __first2[ __i + __j ] );
+		if ( __differ ) break;
+	}
+	while ( __i != __n && __first1[ __i ] == __first2[ __i ] ) ++__i;
+	return __i;
+}
+
+/*************************************************************************************
+ *                                                                                   *
+ *																 DISPATCH BEGIN                                    *
+ *                                                                                   *
+ *************************************************************************************/
+
+//<--- the kernels run the copy of the library built for the host, see @ref simd_isa, or the native ones in a header-only build
+template < typename _Tp >
+inline LLVM_MSTL_CONSTEXPR size_t __simd_width_index = sizeof( _Tp ) == 1 ? 0 : sizeof( _Tp ) == 2 ? 1 : sizeof( _Tp ) == 4 ? 2 : 3;
+
+//<--- the types of the searches of @ref __simd_kernel_set: the integers, `float` and `double`; not `long double`
+template < typename _Tp >
+concept __simd_searched = __simd_scalar< _Tp > && ( core::is_integral_v< _Tp > || core::is_same_v< _Tp, float > || core::is_same_v< _Tp, double > );
+
+template < typename _Tp >
+inline LLVM_MSTL_CONSTEXPR size_t __simd_search_index = core::is_same_v< _Tp, float > ? 4 : core::is_same_v< _Tp, double > ? 5 : __simd_width_index< _Tp >;
+
+template < typename _Tp >
+inline LLVM_MSTL_CONSTEXPR size_t __simd_order_index = __simd_width_index< _Tp > + ( core::is_signed_v< _Tp > ? 4 : 0 );
+
+//<--- a value as the bits of its type, zero-extended, and back
+template < typename _Tp >
+LLVM_MSTL_CONSTEXPR auto __simd_bits( _Tp __v ) LLVM_MSTL_NOEXCEPT->uint64_t {
+	if constexpr ( core::is_floating_point_v< _Tp > )
+		return static_cast< uint64_t >( core::bit_cast< core::conditional_t< sizeof( _Tp ) == 4, uint32_t, uint64_t > >( __v ) );
+	else
+		return static_cast< uint64_t >( static_cast< core::make_unsigned_t< _Tp > >( __v ) );
+}
+
+template < typename _Tp >
+LLVM_MSTL_CONSTEXPR auto __simd_from_bits( uint64_t __v ) LLVM_MSTL_NOEXCEPT->_Tp {
+	if constexpr ( core::is_floating_point_v< _Tp > )
+		return core::bit_cast< _Tp >( static_cast< core::conditional_t< sizeof( _Tp ) == 4, uint32_t, uint64_t > >( __v ) );
+	else
+		return static_cast< _Tp >( __v );
+}
+
+template < __simd_scalar _Tp >
+auto __simd_dispatch_find( const _Tp* __first, const _Tp* __last, _Tp __v ) LLVM_MSTL_NOEXCEPT->const _Tp* {
+	if constexpr ( __simd_searched< _Tp > && __simd_dispatched )
+		return __first + __simd_kernels().__find[ __simd_search_index< _Tp > ]( __first, static_cast< size_t >( __last - __first ), __simd_bits( __v ) );
+	else
+		return __simd_find( __first, __last, __v );
+}
+
+template < __simd_scalar _Tp >
+auto __simd_dispatch_count( const _Tp* __first, const _Tp* __last, _Tp __v ) LLVM_MSTL_NOEXCEPT->size_t {
+	if constexpr ( __simd_searched< _Tp > && __simd_dispatched )
+		return __simd_kernels().__count[ __simd_search_index< _Tp > ]( __first, static_cast< size_t >( __last - __first ), __simd_bits( __v ) );
+	else
+		return __simd_count( __first, __last, __v );
+}
+
+//<--- as `core::mismatch`
+template < __simd_scalar _Tp >
+auto __simd_mismatch( const _Tp* __first1, const _Tp* __last1, const _Tp* __first2 ) LLVM_MSTL_NOEXCEPT->core::pair< const _Tp*, const _Tp* > {
+	const auto __n = static_cast< size_t >( __last1 - __first1 );
+	size_t     __i;
+	if constexpr ( __simd_searched< _Tp > && __simd_dispatched )
+		__i = __simd_kernels().__mismatch[ __simd_search_index< _Tp > ]( __first1, __first2, __n );
+	else
+		__i = __simd_mismatch_index( __first1, __first2, __n );
+	return { __first1 + __i, __first2 + __i };
+}
+
+//<--- the reductions and the find of their result both run in the kernel of the host
+template < __simd_scalar _Tp >
+	requires core::is_integral_v< _Tp >
+auto __simd_dispatch_min_element( const _Tp* __first, const _Tp* __last ) LLVM_MSTL_NOEXCEPT->const _Tp* {
+	if constexpr ( __simd_dispatched )
+		return __first + __simd_kernels().__min_element[ __simd_order_index< _Tp > ]( __first, static_cast< size_t >( __last - __first ) );
+	else
+		return __simd_min_element( __first, __last );
+}
+
+template < __simd_scalar _Tp >
+	requires core::is_integral_v< _Tp >
+auto __simd_dispatch_max_element( const _Tp* __first, const _Tp* __last ) LLVM_MSTL_NOEXCEPT->const _Tp* {
+	if constexpr ( __simd_dispatched )
+		return __first + __simd_kernels().__max_element[ __simd_order_index< _Tp > ]( __first, static_cast< size_t >( __last - __first ) );
+	else
+		return __simd_max_element( __first, __last );
+}
+
+template < __simd_scalar _Tp >
+	requires core::is_integral_v< _Tp >
+auto __simd_dispatch_minmax_element( const _Tp* __first, const _Tp* __last ) LLVM_MSTL_NOEXCEPT->core::pair< const _Tp*, const _Tp* > {
+	if constexpr ( __simd_dispatched ) {
+		const auto [ __lo, __hi ] = __simd_kernels().__minmax_element[ __simd_order_index< _Tp > ]( __first, static_cast< size_t >( __last - __first ) );
+		return { __first + __lo, __first + __hi };
+	} else {
+		return __simd_minmax_element( __first, __last );
+	}
+}
+
+/*************************************************************************************
+ *                                                                                   *
+ *																	DISPATCH END                                     *
+ *                                                                                   *
+ *************************************************************************************/
+
+
+//<--- `memcmp` where `==` compares the bytes, `__simd_mismatch` for the floats
+template < typename _Tp >
+	requires __simd_scalar< _Tp > || __bitwise_equality< _Tp >
+auto __simd_equal( const _Tp* __first1, const _Tp* __last1, const _Tp* __first2 ) LLVM_MSTL_NOEXCEPT->bool {
+	if ( __first1 == __last1 ) return true;
+	if constexpr ( __bitwise_equality< _Tp > )
+		return core::memcmp( __first1, __first2, static_cast< size_t >( __last1 - __first1 ) * sizeof( _Tp ) ) == 0;
+	else
+		return __simd_mismatch( __first1, __last1, __first2 ).first == __last1;
+}
+
+/**
+ * @brief Whether `[__first1, __last1)` is lexicographically less than `[__first2, __last2)`.
+ *
+ * `memcmp` compares unsigned bytes, which is the order of an unsigned one-byte type; the others compare at the
+ * mismatches.
+ */
+template < __simd_scalar _Tp >
+auto __simd_lexicographical_compare( const _Tp* __first1, const _Tp* __last1, const _Tp* __first2, const _Tp* __last2 ) LLVM_MSTL_NOEXCEPT
+	->bool {
+	const auto __n1 = static_cast< size_t >( __last1 - __first1 );
+	const auto __n2 = static_cast< size_t >( __last2 - __first2 );
+	const auto __n  = core::min( __n1, __n2 );
+	if constexpr ( sizeof( _Tp ) == 1 && core::is_unsigned_v< _Tp > ) {
+		const int __r = __n == 0 ? 0 : core::memcmp( __first1, __first2, __n );
+		return __r != 0 ? __r < 0 : __n1 < __n2;
+	} else {
+		//<--- two floats that are neither equal nor ordered, a NaN, are equivalent: the compare goes on past them
+		const _Tp* __end = __first1 + __n;
+		for ( auto [ __p, __q ] = __simd_mismatch( __first1, __end, __first2 ); __p != __end; ) {
+			if ( *__p < *__q ) return true;
+			if ( *__q < *__p ) return false;
+			const auto __next = __simd_mismatch( __p + 1, __end, __q + 1 );
+			__p               = __next.first;
+			__q               = __next.second;
+		}
+		return __n1 < __n2;
+	}
+}
+
+/*************************************************************************************
+ *                                                                                   *
+ *																PUBLIC ALGORITHMS BEGIN                            *
+ *                                                                                   *
+ *************************************************************************************/
+
+/**
+ * @brief Whether the kernels apply to `_Iter`: contiguous iterators over `__simd_scalar` elements.
+ */
+template < typename _Iter >
+concept __simd_iterator = core::contiguous_iterator< _Iter > && __simd_scalar< core::iter_value_t< _Iter > >;
+
+template < typename _Iter >
+LLVM_MSTL_CONSTEXPR auto __simd_rewrap( _Iter __first, const core::iter_value_t< _Iter >* __p ) -> _Iter {
+	return __first + static_cast< core::iter_difference_t< _Iter > >( __p - core::to_address( __first ) );
+}
+
+/**
+ * @brief `core::find`, vectorized over contiguous ranges of arithmetic elements searched for a value of their type.
+ *
+ * The kernels keep the semantics of `==` and `<`: `-0.0` finds `0.0`, a NaN finds nothing. In a constant
+ * expression they are the `core` algorithms.
+ */
+template < core::input_iterator _InputIterator, typename _Tp >
+LLVM_MSTL_CONSTEXPR_SINCE_CXX20 auto find( _InputIterator __first, _InputIterator __last, const _Tp& __value ) -> _InputIterator {
+	if constexpr ( __simd_iterator< _InputIterator > && core::is_same_v< core::iter_value_t< _InputIterator >, _Tp > ) {
+		if ( !core::is_constant_evaluated() )
+			return __simd_rewrap( __first, __simd_dispatch_find( core::to_address( __first ), core::to_address( __last ), __value ) );
+	}
+	return core::find( __first, __last, __value );
+}
+
+template < core::input_iterator _InputIterator, typename _Tp >
+LLVM_MSTL_CONSTEXPR_SINCE_CXX20 auto count( _InputIterator __first, _InputIterator __last, const _Tp& __value )
+	-> core::iter_difference_t< _InputIterator > {
+	if constexpr ( __simd_iterator< _InputIterator > && core::is_same_v< core::iter_value_t< _InputIterator >, _Tp > ) {
+		if ( !core::is_constant_evaluated() )
+			return static_cast< core::iter_difference_t< _InputIterator > >( __simd_dispatch_count( core::to_address( __first ), core::to_address( __last ), __value ) );
+	}
+	return core::count( __first, __last, __value );
+}
+
+template < core::forward_iterator _ForwardIterator >
+LLVM_MSTL_CONSTEXPR_SINCE_CXX20 auto min_element( _ForwardIterator __first, _ForwardIterator __last ) -> _ForwardIterator {
+	if constexpr ( __simd_iterator< _ForwardIterator > && core::is_integral_v< core::iter_value_t< _ForwardIterator > > ) {
+		if ( !core::is_constant_evaluated() ) return __simd_rewrap( __first, __simd_dispatch_min_element( core::to_address( __first ), core::to_address( __last ) ) );
+	}
+	return core::min_element( __first, __last );
+}
+
+template < core::forward_iterator _ForwardIterator >
+LLVM_MSTL_CONSTEXPR_SINCE_CXX20 auto max_element( _ForwardIterator __first, _ForwardIterator __last ) -> _ForwardIterator {
+	if constexpr ( __simd_iterator< _ForwardIterator > && core::is_integral_v< core::iter_value_t< _ForwardIterator > > ) {
+		if ( !core::is_constant_evaluated() ) return __simd_rewrap( __first, __simd_dispatch_max_element( core::to_address( __first ), core::to_address( __last ) ) );
+	}
+	return core::max_element( __first, __last );
+}
+
+template < core::forward_iterator _ForwardIterator >
+LLVM_MSTL_CONSTEXPR_SINCE_CXX20 auto minmax_element( _ForwardIterator __first, _ForwardIterator __last )
+	-> core::pair< _ForwardIterator, _ForwardIterator > {
+	if constexpr ( __simd_iterator< _ForwardIterator > && core::is_integral_v< core::iter_value_t< _ForwardIterator > > ) {
+		if ( !core::is_constant_evaluated() ) {
+			const auto [ __lo, __hi ] = __simd_dispatch_minmax_element( core::to_address( __first ), core::to_address( __last ) );
+			return { __simd_rewrap( __first, __lo ), __simd_rewrap( __first, __hi ) };
+		}
+	}
+	return core::minmax_element( __first, __last );
+}
+
+template < core::input_iterator _InputIterator1, core::input_iterator _InputIterator2 >
+LLVM_MSTL_CONSTEXPR_SINCE_CXX20 auto mismatch( _InputIterator1 __first1, _InputIterator1 __last1, _InputIterator2 __first2 )
+	-> core::pair< _InputIterator1, _InputIterator2 > {
+	if constexpr ( __simd_iterator< _InputIterator1 > && __simd_iterator< _InputIterator2 > &&
+	               core::is_same_v< core::iter_value_t< _InputIterator1 >, core::iter_value_t< _InputIterator2 > > ) {
+		if ( !core::is_constant_evaluated() ) {
+			const auto [ __p, __q ] = __simd_mismatch( core::to_address( __first1 ), core::to_address( __last1 ), core::to_address( __first2 ) );
+			return { __simd_rewrap( __first1, __p ), __simd_rewrap( __first2, __q ) };
+		}
+	}
+	return core::mismatch( __first1, __last1, __first2 );
+}
+
+template < core::input_iterator _InputIterator1, core::input_iterator _InputIterator2 >
+LLVM_MSTL_CONSTEXPR_SINCE_CXX20 auto equal( _InputIterator1 __first1, _InputIterator1 __last1, _InputIterator2 __first2 ) -> bool {
+	using _Tp = core::iter_value_t< _InputIterator1 >;
+	if constexpr ( core::contiguous_iterator< _InputIterator1 > && core::contiguous_iterator< _InputIterator2 > &&
+	               core::is_same_v< _Tp, core::iter_value_t< _InputIterator2 > > && ( __simd_scalar< _Tp > || __bitwise_equality< _Tp > ) ) {
+		if ( !core::is_constant_evaluated() ) return __simd_equal( core::to_address( __first1 ), core::to_address( __last1 ), core::to_address( __first2 ) );
+	}
+	return core::equal( __first1, __last1, __first2 );
+}
+
+template < core::input_iterator _InputIterator1, core::input_iterator _InputIterator2 >
+LLVM_MSTL_CONSTEXPR_SINCE_CXX20 auto equal( _InputIterator1 __first1, _InputIterator1 __last1, _InputIterator2 __first2, _InputIterator2 __last2 )
+	-> bool {
+	if constexpr ( core::sized_sentinel_for< _InputIterator1, _InputIterator1 > && core::sized_sentinel_for< _InputIterator2, _InputIterator2 > ) {
+		if ( __last1 - __first1 != __last2 - __first2 ) return false;
+		return nya::equal( __first1, __last1, __first2 );
+	} else {
+		return core::equal( __first1, __last1, __first2, __last2 );
+	}
+}
+
+template < core::input_iterator _InputIterator1, core::input_iterator _InputIterator2 >
+LLVM_MSTL_CONSTEXPR_SINCE_CXX20 auto lexicographical_compare( _InputIterator1 __first1, _InputIterator1 __last1, _InputIterator2 __first2,
+                                                              _InputIterator2 __last2 ) -> bool {
+	if constexpr ( __simd_iterator< _InputIterator1 > && __simd_iterator< _InputIterator2 > &&
+	               core::is_same_v< core::iter_value_t< _InputIterator1 >, core::iter_value_t< _InputIterator2 > > ) {
+		if ( !core::is_constant_evaluated() )
+			return __simd_lexicographical_compare(
+				core::to_address( __first1 ), core::to_address( __last1 ), core::to_address( __first2 ), core::to_address( __last2 ) );
+	}
+	return core::lexicographical_compare( __first1, __last1, __first2, __last2 );
+}
+
+/*************************************************************************************
+ *                                                                                   *
+ *																 PUBLIC ALGORITHMS END                             *
+ *                                                                                   *
+ *************************************************************************************/
+
+LLVM_MSTL_END_NAMESPACE_STD
+
+#endif//LLVM_MSTL_SIMD_SEARCH_H
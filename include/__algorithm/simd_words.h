@@ -0,0 +1,58 @@
+#ifndef LLVM_MSTL_SIMD_WORDS_H
+#define LLVM_MSTL_SIMD_WORDS_H
+
+#include "__algorithm/simd_dispatch.h"
+#include "__algorithm/simd_search.h"
+#include "__config.h"
+
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+
+LLVM_MSTL_BEGIN_NAMESPACE_STD
+LLVM_MSTL_CORE_STD
+
+/**
+ * @brief The number of set bits of the `__n` words from `__p`, each XORed with `__flip` first: `~0` counts the zeros.
+ *
+ * Without a popcount instruction in the flags, `core::popcount` is a few shifts and masks per word. An ISA tag of
+ * the library may carry a kernel counting a vector register at a time, see @ref __simd_kernels_of.
+ */
+template < typename _Isa = __simd_native >
+auto __simd_popcount( const uint64_t* __p, size_t __n, uint64_t __flip ) LLVM_MSTL_NOEXCEPT->size_t {
+	size_t __r = 0;
+	for ( size_t __i = 0; __i != __n; ++__i ) __r += static_cast< size_t >( core::popcount( __p[ __i ] ^ __flip ) );
+	return __r;
+}
+
+/**
+ * @brief `__dst[ __i ] = __dst[ __i ] op __src[ __i ]` over `__n` words, a loop the compiler vectorizes to the registers of the ISA.
+ */
+template < __simd_word_op _Op, typename _Isa = __simd_native >
+auto __simd_combine_words( uint64_t* __dst, const uint64_t* __src, size_t __n ) LLVM_MSTL_NOEXCEPT->void {
+	for ( size_t __i = 0; __i != __n; ++__i ) {
+		if constexpr ( _Op == __simd_word_op::__and ) __dst[ __i ] &= __src[ __i ];
+		else if constexpr ( _Op == __simd_word_op::__or ) __dst[ __i ] |= __src[ __i ];
+		else if constexpr ( _Op == __simd_word_op::__xor ) __dst[ __i ] ^= __src[ __i ];
+		else __dst[ __i ] &= ~__src[ __i ];
+	}
+}
+
+inline auto __simd_dispatch_popcount( const uint64_t* __p, size_t __n, uint64_t __flip ) LLVM_MSTL_NOEXCEPT->size_t {
+	if constexpr ( __simd_dispatched )
+		return __simd_kernels().__popcount( __p, __n, __flip );
+	else
+		return __simd_popcount( __p, __n, __flip );
+}
+
+template < __simd_word_op _Op >
+auto __simd_dispatch_combine_words( uint64_t* __dst, const uint64_t* __src, size_t __n ) LLVM_MSTL_NOEXCEPT->void {
+	if constexpr ( __simd_dispatched )
+		__simd_kernels().__combine_words[ static_cast< size_t >( _Op ) ]( __dst, __src, __n );
+	else
+		__simd_combine_words< _Op >( __dst, __src, __n );
+}
+
+LLVM_MSTL_END_NAMESPACE_STD
+
+#endif//LLVM_MSTL_SIMD_WORDS_H
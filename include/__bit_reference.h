@@ -0,0 +1,524 @@
+#ifndef LLVM_MSTL_BIT_REFERENCE_H
+#define LLVM_MSTL_BIT_REFERENCE_H
+
+#include "__algorithm/simd_words.h"
+#include "__config.h"
+
+#include <algorithm>
+#include <bit>
+#include <compare>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <type_traits>
+
+LLVM_MSTL_BEGIN_NAMESPACE_STD
+
+LLVM_MSTL_CORE_STD
+
+/**
+ * @file __bit_reference.h
+ * @brief Proxy reference, iterator and word-at-a-time algorithms for bit-packed containers.
+ *
+ * A bit container `_Cp` (e.g. `vector< bool, _Allocator >`) stores its bits in words of `_Cp::__storage_type`,
+ * the least significant bit of a word being the first one. A bit is addressed by its word (`__seg`) and its
+ * position inside that word (`__ctz`, the count of trailing zeros of the mask).
+ *
+ * The algorithms below (`count`, `find`, `fill`, `fill_n`, `copy`, `copy_backward` and `equal`) are overloaded
+ * on `__bit_iterator`, so a call found by ADL works on whole words (popcount, count trailing zeros, word
+ * masks) instead of one proxy at a time.
+ */
+
+template < typename _Cp, bool _IsConst >
+class __bit_iterator;
+
+/**
+ * @brief Proxy reference to a single bit of a bit container.
+ *
+ * @tparam _Cp The bit container.
+ */
+template < typename _Cp >
+class __bit_reference {
+	using __storage_type    = typename _Cp::__storage_type;
+	using __storage_pointer = typename _Cp::__storage_pointer;
+
+	__storage_pointer __seg;
+	__storage_type    __mask;
+
+	friend typename _Cp::__self;
+	friend class __bit_iterator< _Cp, false >;
+
+public:
+	using __container = typename _Cp::__self;
+
+	LLVM_MSTL_CONSTEXPR_SINCE_CXX20 __bit_reference( const __bit_reference& ) = default;
+
+	LLVM_MSTL_CONSTEXPR_SINCE_CXX20 operator bool() const LLVM_MSTL_NOEXCEPT {
+		return static_cast< bool >( *__seg & __mask );
+	}
+
+	LLVM_MSTL_CONSTEXPR_SINCE_CXX20 auto operator~() const LLVM_MSTL_NOEXCEPT->bool {
+		return !static_cast< bool >( *this );
+	}
+
+	LLVM_MSTL_CONSTEXPR_SINCE_CXX20 auto operator=( bool __x ) LLVM_MSTL_NOEXCEPT->__bit_reference& {
+		if ( __x )
+			*__seg |= __mask;
+		else
+			*__seg &= ~__mask;
+		return *this;
+	}
+
+	//<--- a proxy is assigned through, this is what makes `__bit_iterator` an `indirectly_writable` iterator
+	LLVM_MSTL_CONSTEXPR_SINCE_CXX20 auto operator=( bool __x ) const LLVM_MSTL_NOEXCEPT->const __bit_reference& {
+		if ( __x )
+			*__seg |= __mask;
+		else
+			*__seg &= ~__mask;
+		return *this;
+	}
+
+	LLVM_MSTL_CONSTEXPR_SINCE_CXX20 auto operator=( const __bit_reference& __x ) LLVM_MSTL_NOEXCEPT->__bit_reference& {
+		return operator=( static_cast< bool >( __x ) );
+	}
+
+	LLVM_MSTL_CONSTEXPR_SINCE_CXX20 auto flip() LLVM_MSTL_NOEXCEPT->void { *__seg ^= __mask; }
+
+	LLVM_MSTL_CONSTEXPR_SINCE_CXX20 auto operator&() const LLVM_MSTL_NOEXCEPT->__bit_iterator< _Cp, false > {
+		return __bit_iterator< _Cp, false >( __seg, static_cast< unsigned >( core::countr_zero( __mask ) ) );
+	}
+
+private:
+	LLVM_MSTL_CONSTEXPR_SINCE_CXX20 explicit __bit_reference( __storage_pointer __s, __storage_type __m ) LLVM_MSTL_NOEXCEPT
+			: __seg( __s )
+			, __mask( __m ) {}
+};
+
+template < typename _Cp >
+LLVM_MSTL_CONSTEXPR_SINCE_CXX20 auto swap( __bit_reference< _Cp > __x, __bit_reference< _Cp > __y ) LLVM_MSTL_NOEXCEPT->void {
+	bool __t = __x;
+	__x      = __y;
+	__y      = __t;
+}
+
+template < typename _Cp >
+LLVM_MSTL_CONSTEXPR_SINCE_CXX20 auto swap( __bit_reference< _Cp > __x, bool& __y ) LLVM_MSTL_NOEXCEPT->void {
+	bool __t = __x;
+	__x      = __y;
+	__y      = __t;
+}
+
+template < typename _Cp >
+LLVM_MSTL_CONSTEXPR_SINCE_CXX20 auto swap( bool& __x, __bit_reference< _Cp > __y ) LLVM_MSTL_NOEXCEPT->void {
+	bool __t = __x;
+	__x      = __y;
+	__y      = __t;
+}
+
+/**
+ * @brief Random access iterator over the bits of a bit container.
+ *
+ * Dereferencing a mutable iterator yields a `__bit_reference`, a const iterator yields a plain `bool`.
+ *
+ * @tparam _Cp The bit container.
+ * @tparam _IsConst `true` for the const iterator.
+ */
+template < typename _Cp, bool _IsConst >
+class __bit_iterator {
+public:
+	using difference_type   = typename _Cp::difference_type;
+	using value_type        = bool;
+	using pointer           = __bit_iterator;
+	using reference         = core::conditional_t< _IsConst, bool, __bit_reference< _Cp > >;
+	using iterator_category = core::random_access_iterator_tag;
+
+	using __storage_type    = typename _Cp::__storage_type;
+	using __storage_pointer = core::conditional_t<
+		_IsConst, typename _Cp::__const_storage_pointer, typename _Cp::__storage_pointer >;
+
+	static LLVM_MSTL_CONSTEXPR unsigned __bits_per_word = _Cp::__bits_per_word;
+
+	__storage_pointer __seg = nullptr;//<--- the word holding the bit
+	unsigned          __ctz = 0;      //<--- the position of the bit inside `*__seg`
+
+	LLVM_MSTL_CONSTEXPR_SINCE_CXX20 __bit_iterator() LLVM_MSTL_NOEXCEPT = default;
+
+	LLVM_MSTL_CONSTEXPR_SINCE_CXX20 explicit __bit_iterator( __storage_pointer __s, unsigned __c ) LLVM_MSTL_NOEXCEPT
+			: __seg( __s )
+			, __ctz( __c ) {}
+
+	//<--- iterator -> const_iterator
+	template < bool _OtherConst, core::enable_if_t< _IsConst && !_OtherConst, int > = 0 >
+	LLVM_MSTL_CONSTEXPR_SINCE_CXX20 __bit_iterator( const __bit_iterator< _Cp, _OtherConst >& __it ) LLVM_MSTL_NOEXCEPT
+			: __seg( __it.__seg )
+			, __ctz( __it.__ctz ) {}
+
+	LLVM_MSTL_CONSTEXPR_SINCE_CXX20 auto operator*() const LLVM_MSTL_NOEXCEPT->reference {
+		if constexpr ( _IsConst ) {
+			return static_cast< bool >( ( *__seg >> __ctz ) & __storage_type( 1 ) );
+		} else {
+			return __bit_reference< _Cp >( __seg, __storage_type( 1 ) << __ctz );
+		}
+	}
+
+	LLVM_MSTL_CONSTEXPR_SINCE_CXX20 auto operator++() LLVM_MSTL_NOEXCEPT->__bit_iterator& {
+		if ( __ctz != __bits_per_word - 1 ) {
+			++__ctz;
+		} else {
+			__ctz = 0;
+			++__seg;
+		}
+		return *this;
+	}
+
+	LLVM_MSTL_CONSTEXPR_SINCE_CXX20 auto operator++( int ) LLVM_MSTL_NOEXCEPT->__bit_iterator {
+		__bit_iterator __tmp = *this;
+		++( *this );
+		return __tmp;
+	}
+
+	LLVM_MSTL_CONSTEXPR_SINCE_CXX20 auto operator--() LLVM_MSTL_NOEXCEPT->__bit_iterator& {
+		if ( __ctz != 0 ) {
+			--__ctz;
+		} else {
+			__ctz = __bits_per_word - 1;
+			--__seg;
+		}
+		return *this;
+	}
+
+	LLVM_MSTL_CONSTEXPR_SINCE_CXX20 auto operator--( int ) LLVM_MSTL_NOEXCEPT->__bit_iterator {
+		__bit_iterator __tmp = *this;
+		--( *this );
+		return __tmp;
+	}
+
+	LLVM_MSTL_CONSTEXPR_SINCE_CXX20 auto operator+=( difference_type __n ) LLVM_MSTL_NOEXCEPT->__bit_iterator& {
+		//<--- the bit index relative to `__seg`, floor division to find the word
+		const difference_type __bpw = static_cast< difference_type >( __bits_per_word );
+		const difference_type __pos = __n + static_cast< difference_type >( __ctz );
+		difference_type       __q   = __pos / __bpw;
+		difference_type       __r   = __pos % __bpw;
+		if ( __r < 0 ) {
+			--__q;
+			__r += __bpw;
+		}
+		__seg += __q;
+		__ctz = static_cast< unsigned >( __r );
+		return *this;
+	}
+
+	LLVM_MSTL_CONSTEXPR_SINCE_CXX20 auto operator-=( difference_type __n ) LLVM_MSTL_NOEXCEPT->__bit_iterator& {
+		return *this += -__n;
+	}
+
+	LLVM_MSTL_CONSTEXPR_SINCE_CXX20 auto operator+( difference_type __n ) const LLVM_MSTL_NOEXCEPT->__bit_iterator {
+		__bit_iterator __t( *this );
+		__t += __n;
+		return __t;
+	}
+
+	LLVM_MSTL_CONSTEXPR_SINCE_CXX20 auto operator-( difference_type __n ) const LLVM_MSTL_NOEXCEPT->__bit_iterator {
+		__bit_iterator __t( *this );
+		__t -= __n;
+		return __t;
+	}
+
+	friend LLVM_MSTL_CONSTEXPR_SINCE_CXX20 auto operator+( difference_type __n, const __bit_iterator& __it ) LLVM_MSTL_NOEXCEPT->__bit_iterator {
+		return __it + __n;
+	}
+
+	friend LLVM_MSTL_CONSTEXPR_SINCE_CXX20 auto operator-( const __bit_iterator& __x, const __bit_iterator& __y ) LLVM_MSTL_NOEXCEPT->difference_type {
+		return ( __x.__seg - __y.__seg ) * static_cast< difference_type >( __bits_per_word ) +
+					 static_cast< difference_type >( __x.__ctz ) - static_cast< difference_type >( __y.__ctz );
+	}
+
+	LLVM_MSTL_CONSTEXPR_SINCE_CXX20 auto operator[]( difference_type __n ) const LLVM_MSTL_NOEXCEPT->reference {
+		return *( *this + __n );
+	}
+
+	friend LLVM_MSTL_CONSTEXPR_SINCE_CXX20 auto operator==( const __bit_iterator& __x, const __bit_iterator& __y ) LLVM_MSTL_NOEXCEPT->bool {
+		return __x.__seg == __y.__seg && __x.__ctz == __y.__ctz;
+	}
+
+	friend LLVM_MSTL_CONSTEXPR_SINCE_CXX20 auto operator<=>( const __bit_iterator& __x, const __bit_iterator& __y ) LLVM_MSTL_NOEXCEPT->core::strong_ordering {
+		if ( __x.__seg != __y.__seg ) return __x.__seg < __y.__seg ? core::strong_ordering::less : core::strong_ordering::greater;
+		return __x.__ctz <=> __y.__ctz;
+	}
+};
+
+/*************************************************************************************
+ *                                                                                   *
+ *															WORD HELPERS BEGIN		               	                 *
+ *                                                                                   *
+ *************************************************************************************/
+
+/**
+ * @brief A word with the `__n` lowest bits set, `__n` in [0, bits of `_Word`].
+ */
+template < typename _Word >
+LLVM_MSTL_CONSTEXPR auto __low_bits_mask( unsigned __n ) LLVM_MSTL_NOEXCEPT->_Word {
+	constexpr unsigned __bpw = core::numeric_limits< _Word >::digits;
+	return __n >= __bpw ? static_cast< _Word >( ~_Word( 0 ) ) : static_cast< _Word >( ( _Word( 1 ) << __n ) - 1 );
+}
+
+/**
+ * @brief Reads `__n` (1 to bits per word) consecutive bits starting at bit `__ctz` of `*__seg`.
+ *
+ * The bits may straddle two words, `__seg[ 1 ]` is only read when they do. The result is right aligned.
+ */
+template < typename _Word, typename _Pointer >
+LLVM_MSTL_CONSTEXPR_SINCE_CXX20 auto __read_bits( _Pointer __seg, unsigned __ctz, unsigned __n ) LLVM_MSTL_NOEXCEPT->_Word {
+	constexpr unsigned __bpw   = core::numeric_limits< _Word >::digits;
+	_Word              __r     = static_cast< _Word >( *__seg >> __ctz );
+	const unsigned     __avail = __bpw - __ctz;
+	if ( __n > __avail ) __r |= static_cast< _Word >( __seg[ 1 ] << __avail );
+	return static_cast< _Word >( __r & __low_bits_mask< _Word >( __n ) );
+}
+
+/**
+ * @brief Overwrites `__n` bits starting at bit `__ctz` of `*__seg` with the low bits of `__bits`, `__ctz + __n` must not exceed a word.
+ */
+template < typename _Word, typename _Pointer >
+LLVM_MSTL_CONSTEXPR_SINCE_CXX20 auto __write_bits( _Pointer __seg, unsigned __ctz, unsigned __n, _Word __bits ) LLVM_MSTL_NOEXCEPT->void {
+	const _Word __m = static_cast< _Word >( __low_bits_mask< _Word >( __n ) << __ctz );
+	*__seg          = static_cast< _Word >( ( *__seg & ~__m ) | ( static_cast< _Word >( __bits << __ctz ) & __m ) );
+}
+
+/*************************************************************************************
+ *                                                                                   *
+ *															WORD HELPERS END		               	                   *
+ *                                                                                   *
+ *************************************************************************************/
+
+/*************************************************************************************
+ *                                                                                   *
+ *															ALGORITHMS BEGIN		               	                   *
+ *                                                                                   *
+ *************************************************************************************/
+
+/**
+ * @brief Counts the bits equal to `_Value` in [__first, __first + __n), one popcount per word.
+ *
+ * The whole words of a `uint64_t` storage go to the dispatched popcount kernel outside of constant evaluation.
+ */
+template < bool _Value, typename _Cp, bool _IsConst >
+LLVM_MSTL_CONSTEXPR_SINCE_CXX20 auto __count_bool( __bit_iterator< _Cp, _IsConst > __first, typename _Cp::size_type __n )
+	-> typename _Cp::difference_type {
+	using _It             = __bit_iterator< _Cp, _IsConst >;
+	using __storage_type  = typename _It::__storage_type;
+	using difference_type = typename _Cp::difference_type;
+	constexpr unsigned __bpw = _It::__bits_per_word;
+
+	//<--- flip the words when counting zeros, so that popcount always counts ones
+	auto __word = []( __storage_type __w ) { return _Value ? __w : static_cast< __storage_type >( ~__w ); };
+
+	difference_type __r = 0;
+	if ( __first.__ctz != 0 ) {
+		//<--- leading partial word
+		const unsigned       __dn = static_cast< unsigned >( core::min< typename _Cp::size_type >( __bpw - __first.__ctz, __n ) );
+		const __storage_type __m  = static_cast< __storage_type >( __low_bits_mask< __storage_type >( __dn ) << __first.__ctz );
+		__r += core::popcount( static_cast< __storage_type >( __word( *__first.__seg ) & __m ) );
+		__n -= __dn;
+		++__first.__seg;
+	}
+	if constexpr ( core::is_same_v< core::remove_cv_t< __storage_type >, uint64_t > ) {
+		if ( !core::is_constant_evaluated() && __n >= __bpw ) {
+			const typename _Cp::size_type __words = __n / __bpw;
+			__r += static_cast< difference_type >(
+				__simd_dispatch_popcount( core::to_address( __first.__seg ), __words, _Value ? uint64_t( 0 ) : ~uint64_t( 0 ) ) );
+			__first.__seg += __words;
+			__n -= __words * __bpw;
+		}
+	}
+	for ( ; __n >= __bpw; ++__first.__seg, __n -= __bpw ) {
+		__r += core::popcount( __word( *__first.__seg ) );
+	}
+	if ( __n > 0 ) {
+		//<--- trailing partial word
+		const __storage_type __m = __low_bits_mask< __storage_type >( static_cast< unsigned >( __n ) );
+		__r += core::popcount( static_cast< __storage_type >( __word( *__first.__seg ) & __m ) );
+	}
+	return __r;
+}
+
+template < typename _Cp, bool _IsConst, typename _Tp >
+LLVM_MSTL_CONSTEXPR_SINCE_CXX20 auto count( __bit_iterator< _Cp, _IsConst > __first, __bit_iterator< _Cp, _IsConst > __last, const _Tp& __value )
+	-> typename _Cp::difference_type {
+	const auto __n = static_cast< typename _Cp::size_type >( __last - __first );
+	if ( static_cast< bool >( __value ) ) return __count_bool< true >( __first, __n );
+	return __count_bool< false >( __first, __n );
+}
+
+/**
+ * @brief Finds the first bit equal to `_Value` in [__first, __first + __n), one count-trailing-zeros per word.
+ */
+template < bool _Value, typename _Cp, bool _IsConst >
+LLVM_MSTL_CONSTEXPR_SINCE_CXX20 auto __find_bool( __bit_iterator< _Cp, _IsConst > __first, typename _Cp::size_type __n )
+	-> __bit_iterator< _Cp, _IsConst > {
+	using _It            = __bit_iterator< _Cp, _IsConst >;
+	using __storage_type = typename _It::__storage_type;
+	constexpr unsigned __bpw = _It::__bits_per_word;
+
+	auto __word = []( __storage_type __w ) { return _Value ? __w : static_cast< __storage_type >( ~__w ); };
+
+	if ( __first.__ctz != 0 ) {
+		const unsigned       __dn = static_cast< unsigned >( core::min< typename _Cp::size_type >( __bpw - __first.__ctz, __n ) );
+		const __storage_type __m  = static_cast< __storage_type >( __low_bits_mask< __storage_type >( __dn ) << __first.__ctz );
+		const __storage_type __b  = static_cast< __storage_type >( __word( *__first.__seg ) & __m );
+		if ( __b ) return _It( __first.__seg, static_cast< unsigned >( core::countr_zero( __b ) ) );
+		if ( __n == __dn ) return __first + static_cast< typename _Cp::difference_type >( __n );
+		__n -= __dn;
+		++__first.__seg;
+	}
+	for ( ; __n >= __bpw; ++__first.__seg, __n -= __bpw ) {
+		const __storage_type __b = __word( *__first.__seg );
+		if ( __b ) return _It( __first.__seg, static_cast< unsigned >( core::countr_zero( __b ) ) );
+	}
+	if ( __n > 0 ) {
+		const __storage_type __m = __low_bits_mask< __storage_type >( static_cast< unsigned >( __n ) );
+		const __storage_type __b = static_cast< __storage_type >( __word( *__first.__seg ) & __m );
+		if ( __b ) return _It( __first.__seg, static_cast< unsigned >( core::countr_zero( __b ) ) );
+	}
+	return _It( __first.__seg, static_cast< unsigned >( __n ) );
+}
+
+template < typename _Cp, bool _IsConst, typename _Tp >
+LLVM_MSTL_CONSTEXPR_SINCE_CXX20 auto find( __bit_iterator< _Cp, _IsConst > __first, __bit_iterator< _Cp, _IsConst > __last, const _Tp& __value )
+	-> __bit_iterator< _Cp, _IsConst > {
+	const auto __n = static_cast< typename _Cp::size_type >( __last - __first );
+	if ( static_cast< bool >( __value ) ) return __find_bool< true >( __first, __n );
+	return __find_bool< false >( __first, __n );
+}
+
+/**
+ * @brief Sets the bits in [__first, __first + __n) to `__value`, whole words are stored at once.
+ */
+template < typename _Cp >
+LLVM_MSTL_CONSTEXPR_SINCE_CXX20 auto __fill_n_bool( __bit_iterator< _Cp, false > __first, typename _Cp::size_type __n, bool __value )
+	-> __bit_iterator< _Cp, false > {
+	using _It            = __bit_iterator< _Cp, false >;
+	using __storage_type = typename _It::__storage_type;
+	constexpr unsigned __bpw = _It::__bits_per_word;
+
+	const __storage_type __fill = __value ? static_cast< __storage_type >( ~__storage_type( 0 ) ) : __storage_type( 0 );
+	if ( __first.__ctz != 0 ) {
+		const unsigned __dn = static_cast< unsigned >( core::min< typename _Cp::size_type >( __bpw - __first.__ctz, __n ) );
+		__write_bits( __first.__seg, __first.__ctz, __dn, __fill );
+		__n -= __dn;
+		__first.__ctz += __dn;
+		if ( __first.__ctz != __bpw ) return __first;
+		__first.__ctz = 0;
+		++__first.__seg;
+	}
+	const typename _Cp::size_type __nw = __n / __bpw;
+	core::fill_n( core::to_address( __first.__seg ), __nw, __fill );
+	__first.__seg += static_cast< typename _Cp::difference_type >( __nw );
+	__n -= __nw * __bpw;
+	if ( __n > 0 ) {
+		__write_bits( __first.__seg, 0, static_cast< unsigned >( __n ), __fill );
+		__first.__ctz = static_cast< unsigned >( __n );
+	}
+	return __first;
+}
+
+template < typename _Cp, typename _Size, typename _Tp >
+LLVM_MSTL_CONSTEXPR_SINCE_CXX20 auto fill_n( __bit_iterator< _Cp, false > __first, _Size __n, const _Tp& __value )
+	-> __bit_iterator< _Cp, false > {
+	if ( __n <= 0 ) return __first;
+	return __fill_n_bool( __first, static_cast< typename _Cp::size_type >( __n ), static_cast< bool >( __value ) );
+}
+
+template < typename _Cp, typename _Tp >
+LLVM_MSTL_CONSTEXPR_SINCE_CXX20 auto fill( __bit_iterator< _Cp, false > __first, __bit_iterator< _Cp, false > __last, const _Tp& __value ) -> void {
+	nya::fill_n( __first, __last - __first, __value );
+}
+
+/**
+ * @brief Copies [__first, __last) to `__result`, front to back.
+ *
+ * Every step fills the rest of one destination word with bits gathered from (at most) two source words, so
+ * aligned and unaligned copies both run a word at a time. The ranges may overlap when `__result` < `__first`.
+ */
+template < typename _Cp, bool _IsConst >
+LLVM_MSTL_CONSTEXPR_SINCE_CXX20 auto copy( __bit_iterator< _Cp, _IsConst > __first, __bit_iterator< _Cp, _IsConst > __last, __bit_iterator< _Cp, false > __result )
+	-> __bit_iterator< _Cp, false > {
+	using _It            = __bit_iterator< _Cp, false >;
+	using __storage_type = typename _It::__storage_type;
+	constexpr unsigned __bpw = _It::__bits_per_word;
+
+	auto __n = static_cast< typename _Cp::size_type >( __last - __first );
+	while ( __n > 0 ) {
+		const unsigned __w    = static_cast< unsigned >( core::min< typename _Cp::size_type >( __n, __bpw - __result.__ctz ) );
+		__storage_type __bits = __read_bits< __storage_type >( __first.__seg, __first.__ctz, __w );
+		__write_bits( __result.__seg, __result.__ctz, __w, __bits );
+		__first += static_cast< typename _Cp::difference_type >( __w );
+		__result += static_cast< typename _Cp::difference_type >( __w );
+		__n -= __w;
+	}
+	return __result;
+}
+
+/**
+ * @brief Copies [__first, __last) to the bits ending at `__result`, back to front.
+ *
+ * The ranges may overlap when `__result` > `__last`.
+ */
+template < typename _Cp, bool _IsConst >
+LLVM_MSTL_CONSTEXPR_SINCE_CXX20 auto copy_backward( __bit_iterator< _Cp, _IsConst > __first, __bit_iterator< _Cp, _IsConst > __last, __bit_iterator< _Cp, false > __result )
+	-> __bit_iterator< _Cp, false > {
+	using _It            = __bit_iterator< _Cp, false >;
+	using __storage_type = typename _It::__storage_type;
+	constexpr unsigned __bpw = _It::__bits_per_word;
+
+	auto __n = static_cast< typename _Cp::size_type >( __last - __first );
+	while ( __n > 0 ) {
+		//<--- the bits of the destination word in front of `__result`
+		const unsigned __room = __result.__ctz == 0 ? __bpw : __result.__ctz;
+		const unsigned __w    = static_cast< unsigned >( core::min< typename _Cp::size_type >( __n, __room ) );
+		__last -= static_cast< typename _Cp::difference_type >( __w );
+		__result -= static_cast< typename _Cp::difference_type >( __w );
+		__storage_type __bits = __read_bits< __storage_type >( __last.__seg, __last.__ctz, __w );
+		__write_bits( __result.__seg, __result.__ctz, __w, __bits );
+		__n -= __w;
+	}
+	return __result;
+}
+
+/**
+ * @brief Compares [__first1, __last1) with the bits starting at `__first2`, a word at a time.
+ */
+template < typename _Cp, bool _IsConst1, bool _IsConst2 >
+LLVM_MSTL_CONSTEXPR_SINCE_CXX20 auto equal( __bit_iterator< _Cp, _IsConst1 > __first1, __bit_iterator< _Cp, _IsConst1 > __last1, __bit_iterator< _Cp, _IsConst2 > __first2 ) -> bool {
+	using _It            = __bit_iterator< _Cp, _IsConst1 >;
+	using __storage_type = typename _It::__storage_type;
+	constexpr unsigned __bpw = _It::__bits_per_word;
+
+	auto __n = static_cast< typename _Cp::size_type >( __last1 - __first1 );
+	if ( __first1.__ctz == 0 && __first2.__ctz == 0 ) {
+		//<--- both aligned, compare the whole words directly
+		for ( ; __n >= __bpw; ++__first1.__seg, ++__first2.__seg, __n -= __bpw ) {
+			if ( *__first1.__seg != *__first2.__seg ) return false;
+		}
+	}
+	while ( __n > 0 ) {
+		const unsigned       __w = static_cast< unsigned >( core::min< typename _Cp::size_type >( __n, __bpw - __first1.__ctz ) );
+		const __storage_type __a = __read_bits< __storage_type >( __first1.__seg, __first1.__ctz, __w );
+		const __storage_type __b = __read_bits< __storage_type >( __first2.__seg, __first2.__ctz, __w );
+		if ( __a != __b ) return false;
+		__first1 += static_cast< typename _Cp::difference_type >( __w );
+		__first2 += static_cast< typename _Cp::difference_type >( __w );
+		__n -= __w;
+	}
+	return true;
+}
+
+/*************************************************************************************
+ *                                                                                   *
+ *																ALGORITHMS END		               	                   *
+ *                                                                                   *
+ *************************************************************************************/
+
+LLVM_MSTL_END_NAMESPACE_STD
+
+#endif//LLVM_MSTL_BIT_REFERENCE_H
@@ -50,6 +50,13 @@
 #define LLVM_MSTL_NOEXCEPT        noexcept
 #define LLVM_MSTL_NOEXCEPT_V( x ) noexcept( x )
 
+// a read hint, never faults: the address may be past the end of the object
+#if defined( __GNUC__ ) || defined( __clang__ )
+#define LLVM_MSTL_PREFETCH( __addr ) __builtin_prefetch( ( __addr ) )
+#else
+#define LLVM_MSTL_PREFETCH( __addr ) ( (void) ( __addr ) )
+#endif
+
 #if LLVM_MSTL_STD_VERSION >= 17
 /**
  * @brief CTAD（Class Template Argument Deduction）是C++17引入的一项特性，用于在实例化类模板时自动推导模板参数。在C++之前，实例化类模板时必须显式提供所有模板参数，而CTAD使得在某些情况下可以省略模板参数的显式指定。
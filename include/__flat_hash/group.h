@@ -0,0 +1,95 @@
+#ifndef LLVM_MSTL_FLAT_HASH_GROUP_H
+#define LLVM_MSTL_FLAT_HASH_GROUP_H
+
+#include "__config.h"
+
+#include <bit>
+#include <cstring>
+#include <stddef.h>
+#include <stdint.h>
+
+LLVM_MSTL_BEGIN_NAMESPACE_STD
+LLVM_MSTL_CORE_STD
+
+/**
+ * @brief The control byte of a slot of the flat hash tables.
+ *
+ * A full slot stores the low 7 bits of the hash of its key (`__h2`), an empty slot stores `__ctrl_empty`,
+ * so the high bit alone tells empty from full. There is no tombstone, erasure shifts the cluster back.
+ */
+using __ctrl_t = int8_t;
+
+inline LLVM_MSTL_CONSTEXPR __ctrl_t __ctrl_empty = static_cast< __ctrl_t >( -128 );
+
+/**
+ * @brief The set bits of a group match, one `0x80` per matching byte.
+ */
+class __group_mask {
+public:
+	LLVM_MSTL_CONSTEXPR explicit __group_mask( uint64_t __m ) LLVM_MSTL_NOEXCEPT : __mask( __m ) {}
+
+	LLVM_MSTL_CONSTEXPR explicit operator bool() const LLVM_MSTL_NOEXCEPT { return __mask != 0; }
+
+	//<--- index of the first matching byte
+	LLVM_MSTL_CONSTEXPR auto __lowest() const LLVM_MSTL_NOEXCEPT->size_t {
+		return static_cast< size_t >( core::countr_zero( __mask ) ) >> 3;
+	}
+
+	LLVM_MSTL_CONSTEXPR auto __pop() LLVM_MSTL_NOEXCEPT->void { __mask &= __mask - 1; }
+
+private:
+	uint64_t __mask;
+};
+
+/**
+ * @brief Eight control bytes probed at once in a 64-bit word (SWAR), with no SSE2 or NEON dependency.
+ *
+ * The bytes are loaded unaligned from any position of the control array, which carries a copy of its
+ * first `__width - 1` bytes past the end so a group never has to wrap around.
+ */
+class __group {
+	static LLVM_MSTL_CONSTEXPR uint64_t __lsbs = 0x0101010101010101ULL;
+	static LLVM_MSTL_CONSTEXPR uint64_t __msbs = 0x8080808080808080ULL;
+
+public:
+	static LLVM_MSTL_CONSTEXPR size_t __width = 8;
+
+	explicit __group( const __ctrl_t* __p ) LLVM_MSTL_NOEXCEPT {
+		core::memcpy( &__ctrl, __p, sizeof( __ctrl ) );
+		if constexpr ( core::endian::native == core::endian::big ) __ctrl = __builtin_bswap64( __ctrl );
+	}
+
+	/**
+	* @brief The bytes equal to `__h2`.
+	*
+	* The zero byte test `( x - 0x01.. ) & ~x & 0x80..` may also flag a byte right above a true match
+	* (the borrow propagates), which costs one extra key comparison and never a wrong answer.
+	* An empty byte can not match, its high bit is set.
+	*/
+	auto __match( uint8_t __h2 ) const LLVM_MSTL_NOEXCEPT->__group_mask {
+		const uint64_t __x = __ctrl ^ ( __lsbs * __h2 );
+		return __group_mask( ( __x - __lsbs ) & ~__x & __msbs );
+	}
+
+	auto __match_empty() const LLVM_MSTL_NOEXCEPT->__group_mask { return __group_mask( __ctrl & __msbs ); }
+
+	auto __match_full() const LLVM_MSTL_NOEXCEPT->__group_mask { return __group_mask( ~__ctrl & __msbs ); }
+
+private:
+	uint64_t __ctrl;
+};
+
+/**
+ * @brief Spreads the entropy of a user hash over all 64 bits.
+ *
+ * `core::hash` of an integer is the identity, whose low bits alone would pick both the probe start and
+ * the 7-bit tag. The multiply moves the entropy up, the fold brings it back down.
+ */
+LLVM_MSTL_CONSTEXPR auto __mix_hash( size_t __h ) LLVM_MSTL_NOEXCEPT->uint64_t {
+	const uint64_t __m = static_cast< uint64_t >( __h ) * 0x9E3779B97F4A7C15ULL;
+	return __m ^ ( __m >> 32 );
+}
+
+LLVM_MSTL_END_NAMESPACE_STD
+
+#endif//LLVM_MSTL_FLAT_HASH_GROUP_H
@@ -0,0 +1,766 @@
+#ifndef LLVM_MSTL_RAW_HASH_SET_H
+#define LLVM_MSTL_RAW_HASH_SET_H
+
+#include "__config.h"
+#include "__flat_hash/group.h"
+#include "__memory/compress_pair.h"
+#include "__memory/swap_allocator.h"
+#include "__memory/temp_value.h"
+#include "__utility/exception_guard.h"
+
+#include <algorithm>
+#include <bit>
+#include <cstring>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+LLVM_MSTL_BEGIN_NAMESPACE_STD
+LLVM_MSTL_CORE_STD
+
+/**
+ * @brief The forward iterator of the flat hash tables, skips the empty slots a group at a time.
+ *
+ * @tparam _Table The table type.
+ * @tparam _IsConst Whether the elements are read only.
+ */
+template < typename _Table, bool _IsConst >
+class __raw_hash_iterator {
+	template < typename, bool >
+	friend class __raw_hash_iterator;
+	friend _Table;
+
+	using __slot_pointer = typename _Table::__slot_pointer;
+
+public:
+	using iterator_category = core::forward_iterator_tag;
+	using value_type        = typename _Table::value_type;
+	using difference_type   = typename _Table::difference_type;
+	using reference         = core::conditional_t< _IsConst, const value_type&, value_type& >;
+	using pointer           = core::conditional_t< _IsConst, const value_type*, value_type* >;
+
+	__raw_hash_iterator() = default;
+
+	//<--- iterator to const_iterator
+	template < bool _OtherConst >
+		requires( _IsConst && !_OtherConst )
+	__raw_hash_iterator( const __raw_hash_iterator< _Table, _OtherConst >& __x ) LLVM_MSTL_NOEXCEPT
+			: __ctrl( __x.__ctrl ),
+				__slot( __x.__slot ),
+				__end( __x.__end ) {}
+
+	auto operator*() const LLVM_MSTL_NOEXCEPT->reference { return _Table::__value_of( *__slot ); }
+	auto operator->() const LLVM_MSTL_NOEXCEPT->pointer { return core::addressof( **this ); }
+
+	auto operator++() LLVM_MSTL_NOEXCEPT->__raw_hash_iterator& {
+		++__ctrl;
+		++__slot;
+		__skip_empty();
+		return *this;
+	}
+
+	auto operator++( int ) LLVM_MSTL_NOEXCEPT->__raw_hash_iterator {
+		__raw_hash_iterator __tmp( *this );
+		++*this;
+		return __tmp;
+	}
+
+	friend auto operator==( const __raw_hash_iterator& __x, const __raw_hash_iterator& __y ) LLVM_MSTL_NOEXCEPT->bool {
+		return __x.__ctrl == __y.__ctrl;
+	}
+
+private:
+	__raw_hash_iterator( const __ctrl_t* __c, __slot_pointer __s, const __ctrl_t* __e ) LLVM_MSTL_NOEXCEPT
+			: __ctrl( __c ),
+				__slot( __s ),
+				__end( __e ) {}
+
+	//<--- moves to the first full slot at or after the current one, or to the end
+	auto __skip_empty() LLVM_MSTL_NOEXCEPT->void {
+		while ( __ctrl != __end ) {
+			const auto   __full = __group( __ctrl ).__match_full();
+			const size_t __left = static_cast< size_t >( __end - __ctrl );
+			//<--- a full byte past the end is a cloned control byte, stop at the end instead
+			const size_t __step = core::min( __full ? __full.__lowest() : __group::__width, __left );
+			__ctrl += __step;
+			__slot += static_cast< difference_type >( __step );
+			if ( __full ) return;
+		}
+	}
+
+	const __ctrl_t* __ctrl = nullptr;//<--- control byte of the current slot
+	__slot_pointer  __slot = nullptr;//<--- the current slot
+	const __ctrl_t* __end  = nullptr;//<--- one past the last control byte of the table
+};
+
+/**
+ * @brief The open addressing table behind `flat_hash_set` and `flat_hash_map`.
+ *
+ * The elements live in one array of slots, next to an array of one control byte per slot (see @ref __ctrl_t).
+ * A key hashes to a home slot and a 7-bit tag; a lookup scans the control bytes from the home slot eight at a
+ * time (see @ref __group) and compares only the keys whose tag matches, stopping at the first group holding an
+ * empty slot. The capacity is a power of two not less than a group, the table grows when 7/8 of it is full.
+ *
+ * The probing is linear, so erasure needs no tombstone: the following slots of the cluster are shifted back
+ * into the hole when that does not move them before their home slot. Lookups never wade through deleted
+ * slots and erase-heavy churn never forces a rehash.
+ *
+ * The storage is allocated through `allocator_traits` as in `vector`; the allocator, the hasher and the key
+ * equality are kept in `__compressed_pair`s so that empty ones take no space.
+ *
+ * @tparam _Policy Describes the slots: `key_type`, `value_type`, the `__slot_type` the elements are stored as and
+ * the `value_type&` it is seen through (`__value`), `__key` of a slot or a value, and whether the iterators are
+ * constant.
+ * @tparam _Hash The hash function.
+ * @tparam _Eq The key equality.
+ * @tparam _Alloc The allocator of `value_type`.
+ */
+template < typename _Policy, typename _Hash, typename _Eq, typename _Alloc >
+class __raw_hash_set {
+public:
+	using key_type        = typename _Policy::key_type;
+	using value_type      = typename _Policy::value_type;
+	using hasher          = _Hash;
+	using key_equal       = _Eq;
+	using allocator_type  = _Alloc;
+	using __alloc_traits  = core::allocator_traits< allocator_type >;
+	using reference       = value_type&;
+	using const_reference = const value_type&;
+	using size_type       = typename __alloc_traits::size_type;
+	using difference_type = typename __alloc_traits::difference_type;
+	using pointer         = typename __alloc_traits::pointer;
+	using const_pointer   = typename __alloc_traits::const_pointer;
+	using iterator        = __raw_hash_iterator< __raw_hash_set, _Policy::__constant_iterators >;
+	using const_iterator  = __raw_hash_iterator< __raw_hash_set, true >;
+
+	static_assert( core::is_same_v< typename allocator_type::value_type, value_type >, "Allocator::value_type must be same type as value_type" );
+
+	using __slot_type      = typename _Policy::__slot_type;
+	using __slot_allocator = typename __alloc_traits::template rebind_alloc< __slot_type >;
+	using __slot_traits    = core::allocator_traits< __slot_allocator >;
+	using __slot_pointer   = typename __slot_traits::pointer;
+
+	static auto __value_of( __slot_type& __s ) LLVM_MSTL_NOEXCEPT->value_type& { return _Policy::__value( __s ); }
+	static auto __value_of( const __slot_type& __s ) LLVM_MSTL_NOEXCEPT->const value_type& { return _Policy::__value( __s ); }
+
+private:
+	using __ctrl_allocator = typename __alloc_traits::template rebind_alloc< __ctrl_t >;
+	using __ctrl_traits    = core::allocator_traits< __ctrl_allocator >;
+
+	static LLVM_MSTL_CONSTEXPR size_type __npos = static_cast< size_type >( -1 );
+
+public:
+	/*************************************************************************************
+	 *                                                                                   *
+	 *															CONSTRUCTOR BEGIN		                                 *
+	 *                                                                                   *
+	 *************************************************************************************/
+
+	__raw_hash_set()
+			: __raw_hash_set( 0 ) {}
+
+	explicit __raw_hash_set(
+		size_type             __bucket_count,
+		const hasher&         __hf = hasher(),
+		const key_equal&      __keq = key_equal(),
+		const allocator_type& __a  = allocator_type() )
+			: __growth_left_alloc( size_type( 0 ), __a )
+			, __hash_eq( __hf, __keq ) {
+		reserve( __bucket_count );
+	}
+
+	explicit __raw_hash_set( const allocator_type& __a )
+			: __raw_hash_set( 0, hasher(), key_equal(), __a ) {}
+
+	template < typename _InputIterator >
+		requires core::input_iterator< _InputIterator >
+	__raw_hash_set(
+		_InputIterator        __first,
+		_InputIterator        __last,
+		size_type             __bucket_count = 0,
+		const hasher&         __hf           = hasher(),
+		const key_equal&      __keq           = key_equal(),
+		const allocator_type& __a            = allocator_type() )
+			: __raw_hash_set( __bucket_count, __hf, __keq, __a ) {
+		insert( __first, __last );
+	}
+
+	__raw_hash_set(
+		core::initializer_list< value_type > __il,
+		size_type                            __bucket_count = 0,
+		const hasher&                        __hf           = hasher(),
+		const key_equal&                     __keq           = key_equal(),
+		const allocator_type&                __a            = allocator_type() )
+			: __raw_hash_set( __il.begin(), __il.end(), __bucket_count, __hf, __keq, __a ) {}
+
+	__raw_hash_set( const __raw_hash_set& __x )
+			: __raw_hash_set( __x, __alloc_traits::select_on_container_copy_construction( __x.__alloc() ) ) {}
+
+	//<--- delegates, so that the destructor releases what is built if an element throws
+	__raw_hash_set( const __raw_hash_set& __x, const allocator_type& __a )
+			: __raw_hash_set( 0, __x.__hash(), __x.__eq(), __a ) {
+		reserve( __x.size() );
+		for ( const auto& __v : __x ) __insert_unique( __v );
+	}
+
+	__raw_hash_set( __raw_hash_set&& __x ) LLVM_MSTL_NOEXCEPT
+			: __growth_left_alloc( size_type( 0 ), core::move( __x.__alloc() ) )
+			, __hash_eq( core::move( __x.__hash_eq ) ) {
+		__steal( __x );
+	}
+
+	__raw_hash_set( __raw_hash_set&& __x, const allocator_type& __a )
+			: __raw_hash_set( 0, __x.__hash(), __x.__eq(), __a ) {
+		if ( __a == __x.__alloc() ) {
+			__steal( __x );
+		} else {
+			reserve( __x.size() );
+			__insert_moved( __x );
+			__x.clear();
+		}
+	}
+
+	auto operator=( const __raw_hash_set& __x ) -> __raw_hash_set&;
+	auto operator=( __raw_hash_set&& __x ) LLVM_MSTL_NOEXCEPT_V(
+		__alloc_traits::propagate_on_container_move_assignment::value || __alloc_traits::is_always_equal::value ) -> __raw_hash_set&;
+
+	auto operator=( core::initializer_list< value_type > __il ) -> __raw_hash_set& {
+		clear();
+		insert( __il );
+		return *this;
+	}
+
+	~__raw_hash_set() {
+		__destroy_slots();
+		__deallocate( __ctrl, __slots, __capacity );
+	}
+
+	/*************************************************************************************
+	 *                                                                                   *
+	 *																CONSTRUCTOR END			                               *
+	 *                                                                                   *
+	 *************************************************************************************/
+
+	auto begin() LLVM_MSTL_NOEXCEPT->iterator { return __iterator_at_or_after( 0 ); }
+	auto begin() const LLVM_MSTL_NOEXCEPT->const_iterator { return __iterator_at_or_after( 0 ); }
+	auto end() LLVM_MSTL_NOEXCEPT->iterator { return iterator( __ctrl + __capacity, __slots + __capacity, __ctrl + __capacity ); }
+	auto end() const LLVM_MSTL_NOEXCEPT->const_iterator {
+		return const_iterator( __ctrl + __capacity, __slots + __capacity, __ctrl + __capacity );
+	}
+	auto cbegin() const LLVM_MSTL_NOEXCEPT->const_iterator { return begin(); }
+	auto cend() const LLVM_MSTL_NOEXCEPT->const_iterator { return end(); }
+
+	LLVM_MSTL_NODISCARD auto empty() const LLVM_MSTL_NOEXCEPT->bool { return __size == 0; }
+	auto size() const LLVM_MSTL_NOEXCEPT->size_type { return __size; }
+	auto max_size() const LLVM_MSTL_NOEXCEPT->size_type { return __alloc_traits::max_size( __alloc() ); }
+
+	/*************************************************************************************
+	 *                                                                                   *
+	 *															 	MODIFIERS BEGIN			               	               *
+	 *                                                                                   *
+	 *************************************************************************************/
+
+	/**
+	* @brief Destroys the elements, keeps the capacity.
+	*/
+	auto clear() LLVM_MSTL_NOEXCEPT->void {
+		__destroy_slots();
+		if ( __capacity != 0 ) core::memset( __ctrl, __ctrl_empty, __capacity + __group::__width - 1 );
+		__size          = 0;
+		__growth_left() = __growth_for( __capacity );
+	}
+
+	auto insert( const value_type& __v ) -> core::pair< iterator, bool > { return __insert_value( __v ); }
+	auto insert( value_type&& __v ) -> core::pair< iterator, bool > { return __insert_value( core::move( __v ) ); }
+	auto insert( const_iterator, const value_type& __v ) -> iterator { return insert( __v ).first; }
+	auto insert( const_iterator, value_type&& __v ) -> iterator { return insert( core::move( __v ) ).first; }
+
+	/**
+	* @brief Inserts a batch, reserving the room for all of it up front when its length is known.
+	*/
+	template < typename _InputIterator >
+		requires core::input_iterator< _InputIterator >
+	auto insert( _InputIterator __first, _InputIterator __last ) -> void {
+		if constexpr ( core::forward_iterator< _InputIterator > ) {
+			reserve( __size + static_cast< size_type >( core::distance( __first, __last ) ) );
+		}
+		for ( ; __first != __last; ++__first ) emplace( *__first );
+	}
+
+	auto insert( core::initializer_list< value_type > __il ) -> void { insert( __il.begin(), __il.end() ); }
+
+	/**
+	* @brief Constructs the element aside, looks its key up, and moves it into the table if the key is new.
+	*/
+	template < typename... _Args >
+	auto emplace( _Args&&... __args ) -> core::pair< iterator, bool > {
+		if constexpr ( sizeof...( _Args ) == 1 && ( core::is_same_v< core::remove_cvref_t< _Args >, value_type > && ... ) ) {
+			return __insert_value( core::forward< _Args >( __args )... );
+		} else {
+			__temp_value< value_type, allocator_type > __tmp( __alloc(), core::forward< _Args >( __args )... );
+			return __insert_value( core::move( __tmp.get() ) );
+		}
+	}
+
+	template < typename... _Args >
+	auto emplace_hint( const_iterator, _Args&&... __args ) -> iterator {
+		return emplace( core::forward< _Args >( __args )... ).first;
+	}
+
+	/**
+	* @brief Erases the element at `__position`, returns the iterator to the element that follows it.
+	*
+	* The following elements of the cluster may be shifted back into the freed slot, the returned iterator
+	* accounts for that. An element shifted back across the end of the table is visited a second time by
+	* an iteration that continues from the returned iterator.
+	*/
+	auto erase( const_iterator __position ) -> iterator {
+		const size_type __i = static_cast< size_type >( __position.__slot - __slots );
+		__erase_at( __i );
+		return __iterator_at_or_after( __i );
+	}
+
+	auto erase( const key_type& __k ) -> size_type {
+		const size_type __i = __find_index( __k );
+		if ( __i == __npos ) return 0;
+		__erase_at( __i );
+		return 1;
+	}
+
+	auto swap( __raw_hash_set& __x ) LLVM_MSTL_NOEXCEPT->void {
+		core::swap( __ctrl, __x.__ctrl );
+		core::swap( __slots, __x.__slots );
+		core::swap( __size, __x.__size );
+		core::swap( __capacity, __x.__capacity );
+		core::swap( __growth_left(), __x.__growth_left() );
+		core::swap( __hash_eq, __x.__hash_eq );
+		__swap_allocator( __alloc(), __x.__alloc() );
+	}
+
+	/*************************************************************************************
+	 *                                                                                   *
+	 *															 		MODIFIERS END			               	               *
+	 *                                                                                   *
+	 *************************************************************************************/
+
+	/*************************************************************************************
+	 *                                                                                   *
+	 *															 	LOOKUP BEGIN			               	                 *
+	 *                                                                                   *
+	 *************************************************************************************/
+
+	auto find( const key_type& __k ) -> iterator { return __iterator_or_end( __find_index( __k ) ); }
+	auto find( const key_type& __k ) const -> const_iterator { return __iterator_or_end( __find_index( __k ) ); }
+	auto contains( const key_type& __k ) const -> bool { return __find_index( __k ) != __npos; }
+	auto count( const key_type& __k ) const -> size_type { return contains( __k ) ? 1 : 0; }
+
+	/*************************************************************************************
+	 *                                                                                   *
+	 *															 		LOOKUP END			               	                   *
+	 *                                                                                   *
+	 *************************************************************************************/
+
+	/*************************************************************************************
+	 *                                                                                   *
+	 *															 	HASH POLICY BEGIN			               	             *
+	 *                                                                                   *
+	 *************************************************************************************/
+
+	auto bucket_count() const LLVM_MSTL_NOEXCEPT->size_type { return __capacity; }
+	auto load_factor() const LLVM_MSTL_NOEXCEPT->float {
+		return __capacity == 0 ? 0.0f : static_cast< float >( __size ) / static_cast< float >( __capacity );
+	}
+	auto max_load_factor() const LLVM_MSTL_NOEXCEPT->float { return 0.875f; }
+
+	/**
+	* @brief Makes room for `__n` elements in total, so that inserting them does not rehash.
+	*/
+	auto reserve( size_type __n ) -> void {
+		if ( __n > __growth_for( __capacity ) ) __resize( __capacity_for( __n ) );
+	}
+
+	/**
+	* @brief Resizes to at least `__n` slots and at least as many as the elements need, which may shrink the table.
+	*/
+	auto rehash( size_type __n ) -> void {
+		size_type __cap = __capacity_for( __size );
+		if ( __n > __cap ) __cap = core::bit_ceil( core::max< size_type >( __n, __group::__width ) );
+		if ( __cap != __capacity ) __resize( __cap );
+	}
+
+	auto hash_function() const -> hasher { return __hash(); }
+	auto key_eq() const -> key_equal { return __eq(); }
+	auto get_allocator() const LLVM_MSTL_NOEXCEPT->allocator_type { return __alloc(); }
+
+	/*************************************************************************************
+	 *                                                                                   *
+	 *															 		HASH POLICY END			               	               *
+	 *                                                                                   *
+	 *************************************************************************************/
+
+	friend auto operator==( const __raw_hash_set& __x, const __raw_hash_set& __y ) -> bool {
+		if ( __x.size() != __y.size() ) return false;
+		for ( const auto& __v : __x ) {
+			const size_type __i = __y.__find_index( _Policy::__key( __v ) );
+			if ( __i == __npos || !( __y.__slot_at( __i ) == __v ) ) return false;
+		}
+		return true;
+	}
+
+	friend auto swap( __raw_hash_set& __x, __raw_hash_set& __y ) LLVM_MSTL_NOEXCEPT->void { __x.swap( __y ); }
+
+protected:
+	auto __alloc() LLVM_MSTL_NOEXCEPT->allocator_type& { return __growth_left_alloc.second(); }
+	auto __alloc() const LLVM_MSTL_NOEXCEPT->const allocator_type& { return __growth_left_alloc.second(); }
+
+	template < typename _Kp >
+	auto __find_index( const _Kp& __k ) const -> size_type;
+
+	/**
+	* @brief Finds `__k`, or claims the slot where it goes.
+	*
+	* @return The index of the slot and `true` if the slot was claimed, in which case the caller constructs the
+	* element with @ref __construct_at.
+	*/
+	template < typename _Kp >
+	auto __find_or_prepare_insert( const _Kp& __k ) -> core::pair< size_type, bool >;
+
+	/**
+	* @brief Constructs the element of a slot claimed by @ref __find_or_prepare_insert, releases the slot on failure.
+	*/
+	template < typename... _Args >
+	auto __construct_at( size_type __i, _Args&&... __args ) -> void {
+		auto __guard = __make_exception_guard( [ this, __i ]() { __release( __i ); } );
+		__alloc_traits::construct( __alloc(), core::to_address( __slots + __i ), core::forward< _Args >( __args )... );
+		__guard.__complete();
+	}
+
+	auto __slot_at( size_type __i ) LLVM_MSTL_NOEXCEPT->reference { return _Policy::__value( __slots[ __i ] ); }
+	auto __slot_at( size_type __i ) const LLVM_MSTL_NOEXCEPT->const_reference { return _Policy::__value( __slots[ __i ] ); }
+
+	auto __iterator_at( size_type __i ) LLVM_MSTL_NOEXCEPT->iterator {
+		return iterator( __ctrl + __i, __slots + __i, __ctrl + __capacity );
+	}
+
+	auto __iterator_at( size_type __i ) const LLVM_MSTL_NOEXCEPT->const_iterator {
+		return const_iterator( __ctrl + __i, __slots + __i, __ctrl + __capacity );
+	}
+
+	static LLVM_MSTL_CONSTEXPR auto __not_found() LLVM_MSTL_NOEXCEPT->size_type { return __npos; }
+
+	/**
+	* @brief Erases the element of slot `__i` and closes the hole by shifting the cluster back.
+	*/
+	auto __erase_at( size_type __i ) -> void;
+
+private:
+	auto __growth_left() LLVM_MSTL_NOEXCEPT->size_type& { return __growth_left_alloc.first(); }
+	auto __hash() const LLVM_MSTL_NOEXCEPT->const hasher& { return __hash_eq.first(); }
+	auto __eq() const LLVM_MSTL_NOEXCEPT->const key_equal& { return __hash_eq.second(); }
+
+	template < typename _Kp >
+	auto __hash_of( const _Kp& __k ) const -> uint64_t {
+		return __mix_hash( __hash()( __k ) );
+	}
+
+	static LLVM_MSTL_CONSTEXPR auto __h1( uint64_t __h ) LLVM_MSTL_NOEXCEPT->size_type { return static_cast< size_type >( __h >> 7 ); }
+	static LLVM_MSTL_CONSTEXPR auto __h2( uint64_t __h ) LLVM_MSTL_NOEXCEPT->__ctrl_t { return static_cast< __ctrl_t >( __h & 0x7f ); }
+
+	//<--- the number of elements a table of `__cap` slots holds before it grows, 7/8 of it
+	static LLVM_MSTL_CONSTEXPR auto __growth_for( size_type __cap ) LLVM_MSTL_NOEXCEPT->size_type { return __cap - __cap / 8; }
+
+	static LLVM_MSTL_CONSTEXPR auto __capacity_for( size_type __n ) LLVM_MSTL_NOEXCEPT->size_type {
+		if ( __n == 0 ) return 0;
+		size_type __cap = __group::__width;
+		while ( __growth_for( __cap ) < __n ) __cap *= 2;
+		return __cap;
+	}
+
+	//<--- writes a control byte and its clone past the end
+	auto __set_ctrl( size_type __i, __ctrl_t __c ) LLVM_MSTL_NOEXCEPT->void {
+		__ctrl[ __i ] = __c;
+		if ( __i < __group::__width - 1 ) __ctrl[ __capacity + __i ] = __c;
+	}
+
+	auto __iterator_at_or_after( size_type __i ) const LLVM_MSTL_NOEXCEPT->iterator {
+		iterator __it( __ctrl + __i, __slots + __i, __ctrl + __capacity );
+		__it.__skip_empty();
+		return __it;
+	}
+
+	auto __iterator_or_end( size_type __i ) const LLVM_MSTL_NOEXCEPT->iterator {
+		const size_type __at = __i == __npos ? __capacity : __i;
+		return iterator( __ctrl + __at, __slots + __at, __ctrl + __capacity );
+	}
+
+	//<--- the first empty slot probed from the home slot of `__h`, there is always one
+	auto __find_empty( uint64_t __h ) const LLVM_MSTL_NOEXCEPT->size_type {
+		const size_type __mask = __capacity - 1;
+		for ( size_type __pos = __h1( __h ) & __mask;; __pos = ( __pos + __group::__width ) & __mask ) {
+			const auto __empty = __group( __ctrl + __pos ).__match_empty();
+			if ( __empty ) return ( __pos + __empty.__lowest() ) & __mask;
+		}
+	}
+
+	template < typename _Vp >
+	auto __insert_value( _Vp&& __v ) -> core::pair< iterator, bool > {
+		const auto [ __i, __inserted ] = __find_or_prepare_insert( _Policy::__key( __v ) );
+		if ( __inserted ) __construct_at( __i, core::forward< _Vp >( __v ) );
+		return { __iterator_at( __i ), __inserted };
+	}
+
+	//<--- inserts an element whose key is known to be absent, the room is reserved
+	template < typename _Vp >
+	auto __insert_unique( _Vp&& __v ) -> void {
+		const uint64_t  __h = __hash_of( _Policy::__key( __v ) );
+		const size_type __i = __find_empty( __h );
+		__claim( __i, __h2( __h ) );
+		__construct_at( __i, core::forward< _Vp >( __v ) );
+	}
+
+	//<--- moves the elements of `__x` over its slots, so that the keys are moved too; the room is reserved
+	auto __insert_moved( __raw_hash_set& __x ) -> void {
+		for ( size_type __i = 0; __i < __x.__capacity; ++__i ) {
+			if ( __x.__ctrl[ __i ] != __ctrl_empty ) __insert_unique( core::move( __x.__slots[ __i ] ) );
+		}
+	}
+
+	auto __claim( size_type __i, __ctrl_t __h2 ) LLVM_MSTL_NOEXCEPT->void {
+		__set_ctrl( __i, __h2 );
+		++__size;
+		--__growth_left();
+	}
+
+	auto __release( size_type __i ) LLVM_MSTL_NOEXCEPT->void {
+		__set_ctrl( __i, __ctrl_empty );
+		--__size;
+		++__growth_left();
+	}
+
+	/**
+	 * @brief Moves the elements into `__new_capacity` slots.
+	 *
+	 * The elements are moved with `move_if_noexcept`, and the old ones are destroyed only once all of them are
+	 * across. If an element throws, the new arrays are released and the table is left as it was. If the hash
+	 * function throws after elements were moved out, the table is emptied.
+	 */
+	auto __resize( size_type __new_capacity ) -> void;
+
+	auto __allocate( size_type __cap ) -> void {
+		__ctrl_allocator __ca( __alloc() );
+		__slot_allocator __sa( __alloc() );
+		__ctrl_t* const  __c = core::to_address( __ctrl_traits::allocate( __ca, __cap + __group::__width - 1 ) );
+		auto __guard = __make_exception_guard( [ & ]() { __ctrl_traits::deallocate( __ca, __c, __cap + __group::__width - 1 ); } );
+		__slots = __slot_traits::allocate( __sa, __cap );
+		__guard.__complete();
+		__ctrl = __c;
+		core::memset( __ctrl, __ctrl_empty, __cap + __group::__width - 1 );
+		__capacity      = __cap;
+		__growth_left() = __growth_for( __cap ) - __size;
+	}
+
+	auto __deallocate( __ctrl_t* __c, __slot_pointer __s, size_type __cap ) LLVM_MSTL_NOEXCEPT->void {
+		if ( __cap == 0 ) return;
+		__ctrl_allocator __ca( __alloc() );
+		__slot_allocator __sa( __alloc() );
+		__ctrl_traits::deallocate( __ca, __c, __cap + __group::__width - 1 );
+		__slot_traits::deallocate( __sa, __s, __cap );
+	}
+
+	auto __destroy_slots() LLVM_MSTL_NOEXCEPT->void {
+		if constexpr ( !core::is_trivially_destructible_v< __slot_type > ) {
+			for ( size_type __i = 0; __i < __capacity; ++__i ) {
+				if ( __ctrl[ __i ] != __ctrl_empty ) __alloc_traits::destroy( __alloc(), core::to_address( __slots + __i ) );
+			}
+		}
+	}
+
+	auto __steal( __raw_hash_set& __x ) LLVM_MSTL_NOEXCEPT->void {
+		__ctrl            = core::exchange( __x.__ctrl, nullptr );
+		__slots           = core::exchange( __x.__slots, nullptr );
+		__size            = core::exchange( __x.__size, 0 );
+		__capacity        = core::exchange( __x.__capacity, 0 );
+		__growth_left()   = core::exchange( __x.__growth_left(), 0 );
+	}
+
+private:
+	__ctrl_t*                                      __ctrl     = nullptr;//<--- one byte per slot, then the clones of the first group
+	__slot_pointer                                 __slots    = nullptr;//<--- the elements
+	size_type                                      __size     = 0;      //<--- the number of elements
+	size_type                                      __capacity = 0;      //<--- the number of slots, 0 or a power of two not less than a group
+	__compressed_pair< size_type, allocator_type > __growth_left_alloc; //<--- the elements that fit before the next growth, the allocator
+	__compressed_pair< hasher, key_equal >         __hash_eq;           //<--- the hash function and the key equality
+};
+
+template < typename _Policy, typename _Hash, typename _Eq, typename _Alloc >
+auto __raw_hash_set< _Policy, _Hash, _Eq, _Alloc >::operator=( const __raw_hash_set& __x ) -> __raw_hash_set& {
+	if ( this == core::addressof( __x ) ) return *this;
+	clear();
+	if constexpr ( __alloc_traits::propagate_on_container_copy_assignment::value ) {
+		if ( __alloc() != __x.__alloc() ) {
+			__deallocate( __ctrl, __slots, __capacity );
+			__ctrl     = nullptr;
+			__slots    = nullptr;
+			__capacity = 0;
+			__growth_left() = 0;
+		}
+		__alloc() = __x.__alloc();
+	}
+	__hash_eq = __x.__hash_eq;
+	reserve( __x.size() );
+	for ( const auto& __v : __x ) __insert_unique( __v );
+	return *this;
+}
+
+template < typename _Policy, typename _Hash, typename _Eq, typename _Alloc >
+auto __raw_hash_set< _Policy, _Hash, _Eq, _Alloc >::operator=( __raw_hash_set&& __x ) LLVM_MSTL_NOEXCEPT_V(
+	__alloc_traits::propagate_on_container_move_assignment::value || __alloc_traits::is_always_equal::value ) -> __raw_hash_set& {
+	if ( this == core::addressof( __x ) ) return *this;
+	__hash_eq = core::move( __x.__hash_eq );
+	if ( __alloc_traits::propagate_on_container_move_assignment::value || __alloc() == __x.__alloc() ) {
+		__destroy_slots();
+		__deallocate( __ctrl, __slots, __capacity );
+		if constexpr ( __alloc_traits::propagate_on_container_move_assignment::value ) __alloc() = core::move( __x.__alloc() );
+		__steal( __x );
+	} else {
+		//<--- the storage can not change hands, move the elements one by one
+		clear();
+		reserve( __x.size() );
+		__insert_moved( __x );
+		__x.clear();
+	}
+	return *this;
+}
+
+template < typename _Policy, typename _Hash, typename _Eq, typename _Alloc >
+template < typename _Kp >
+auto __raw_hash_set< _Policy, _Hash, _Eq, _Alloc >::__find_index( const _Kp& __k ) const -> size_type {
+	if ( __capacity == 0 ) return __npos;
+	const uint64_t  __h    = __hash_of( __k );
+	const size_type __mask = __capacity - 1;
+	const auto      __tag  = static_cast< uint8_t >( __h2( __h ) );
+	for ( size_type __pos = __h1( __h ) & __mask;; __pos = ( __pos + __group::__width ) & __mask ) {
+		const __group __g( __ctrl + __pos );
+		for ( auto __m = __g.__match( __tag ); __m; __m.__pop() ) {
+			const size_type __i = ( __pos + __m.__lowest() ) & __mask;
+			if ( __eq()( _Policy::__key( __slots[ __i ] ), __k ) ) return __i;
+		}
+		if ( __g.__match_empty() ) return __npos;//<--- an absent key would have been stored in this empty slot
+	}
+}
+
+template < typename _Policy, typename _Hash, typename _Eq, typename _Alloc >
+template < typename _Kp >
+auto __raw_hash_set< _Policy, _Hash, _Eq, _Alloc >::__find_or_prepare_insert( const _Kp& __k ) -> core::pair< size_type, bool > {
+	const uint64_t __h   = __hash_of( __k );
+	const auto     __tag = static_cast< uint8_t >( __h2( __h ) );
+	if ( __capacity != 0 ) {
+		const size_type __mask = __capacity - 1;
+		for ( size_type __pos = __h1( __h ) & __mask;; __pos = ( __pos + __group::__width ) & __mask ) {
+			const __group __g( __ctrl + __pos );
+			for ( auto __m = __g.__match( __tag ); __m; __m.__pop() ) {
+				const size_type __i = ( __pos + __m.__lowest() ) & __mask;
+				if ( __eq()( _Policy::__key( __slots[ __i ] ), __k ) ) return { __i, false };
+			}
+			const auto __empty = __g.__match_empty();
+			if ( __empty ) {
+				//<--- the first empty slot of the probe sequence is where the key goes, unless the table must grow
+				if ( __growth_left() != 0 ) {
+					const size_type __i = ( __pos + __empty.__lowest() ) & __mask;
+					__claim( __i, __h2( __h ) );
+					return { __i, true };
+				}
+				break;
+			}
+		}
+	}
+	__resize( __capacity == 0 ? __group::__width : __capacity * 2 );
+	const size_type __i = __find_empty( __h );
+	__claim( __i, __h2( __h ) );
+	return { __i, true };
+}
+
+template < typename _Policy, typename _Hash, typename _Eq, typename _Alloc >
+auto __raw_hash_set< _Policy, _Hash, _Eq, _Alloc >::__erase_at( size_type __i ) -> void {
+	__alloc_traits::destroy( __alloc(), core::to_address( __slots + __i ) );
+	const size_type __mask = __capacity - 1;
+	//<--- backward shift: an element may fill the hole if the hole lies between its home slot and its slot
+	for ( size_type __j = ( __i + 1 ) & __mask; __ctrl[ __j ] != __ctrl_empty; __j = ( __j + 1 ) & __mask ) {
+		const size_type __home = __h1( __hash_of( _Policy::__key( __slots[ __j ] ) ) ) & __mask;
+		if ( ( ( __j - __i ) & __mask ) <= ( ( __j - __home ) & __mask ) ) {
+			_Policy::__relocate( __alloc(), core::to_address( __slots + __i ), core::to_address( __slots + __j ) );
+			__set_ctrl( __i, __ctrl[ __j ] );
+			__i = __j;
+		}
+	}
+	__release( __i );
+}
+
+template < typename _Policy, typename _Hash, typename _Eq, typename _Alloc >
+auto __raw_hash_set< _Policy, _Hash, _Eq, _Alloc >::__resize( size_type __new_capacity ) -> void {
+	//<--- whether `move_if_noexcept` moves, so that the old elements can not be kept when something throws
+	constexpr bool __moves = core::is_nothrow_move_constructible_v< __slot_type > || !core::is_copy_constructible_v< __slot_type >;
+
+	__ctrl_t* const      __old_ctrl     = __ctrl;
+	const __slot_pointer __old_slots    = __slots;
+	const size_type      __old_capacity = __capacity;
+	if ( __new_capacity == 0 ) {
+		__ctrl          = nullptr;
+		__slots         = nullptr;
+		__capacity      = 0;
+		__growth_left() = 0;
+	} else {
+		__allocate( __new_capacity );
+		size_type __moved = 0;
+		auto      __guard = __make_exception_guard( [ & ]() {
+			__destroy_slots();
+			__deallocate( __ctrl, __slots, __capacity );
+			__ctrl          = __old_ctrl;
+			__slots         = __old_slots;
+			__capacity      = __old_capacity;
+			__growth_left() = __growth_for( __old_capacity ) - __size;
+			if ( __moves && __moved != 0 ) clear();
+		} );
+		for ( size_type __i = 0; __i < __old_capacity; ++__i ) {
+			if ( __old_ctrl[ __i ] == __ctrl_empty ) continue;
+			const uint64_t  __h = __hash_of( _Policy::__key( __old_slots[ __i ] ) );
+			const size_type __j = __find_empty( __h );
+			__alloc_traits::construct( __alloc(), core::to_address( __slots + __j ), core::move_if_noexcept( __old_slots[ __i ] ) );
+			__set_ctrl( __j, __h2( __h ) );
+			++__moved;
+		}
+		__guard.__complete();
+		if constexpr ( !core::is_trivially_destructible_v< __slot_type > ) {
+			for ( size_type __i = 0; __i < __old_capacity; ++__i ) {
+				if ( __old_ctrl[ __i ] != __ctrl_empty ) __alloc_traits::destroy( __alloc(), core::to_address( __old_slots + __i ) );
+			}
+		}
+	}
+	__deallocate( __old_ctrl, __old_slots, __old_capacity );
+}
+
+/**
+ * @brief Erases every element satisfying `__pred`, in one pass over the slots.
+ *
+ * A slot is examined again after an erasure, since the backward shift may have moved a following element into it.
+ *
+ * @return The number of erased elements.
+ */
+template < typename _Table, typename _Predicate >
+auto __erase_if_hash( _Table& __c, _Predicate& __pred ) -> typename _Table::size_type {
+	using size_type            = typename _Table::size_type;
+	const size_type __old_size = __c.size();
+	for ( auto __it = __c.begin(); __it != __c.end(); ) {
+		if ( __pred( *__it ) )
+			__it = __c.erase( __it );
+		else
+			++__it;
+	}
+	return __old_size - __c.size();
+}
+
+LLVM_MSTL_END_NAMESPACE_STD
+
+#endif//LLVM_MSTL_RAW_HASH_SET_H
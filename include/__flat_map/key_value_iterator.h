@@ -0,0 +1,120 @@
+#ifndef LLVM_MSTL_KEY_VALUE_ITERATOR_H
+#define LLVM_MSTL_KEY_VALUE_ITERATOR_H
+
+#include "__config.h"
+
+#include <compare>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+
+LLVM_MSTL_BEGIN_NAMESPACE_STD
+LLVM_MSTL_CORE_STD
+
+/**
+ * @brief The iterator of `flat_map`, walks the key and the mapped column in lock step.
+ *
+ * There is no `pair` in memory to point to, so dereferencing yields a `pair` of references,
+ * and `operator->` returns a proxy holding that pair.
+ *
+ * @tparam _KeyIter The iterator over the keys, always a const iterator.
+ * @tparam _MappedIter The iterator over the mapped values.
+ */
+template < typename _KeyIter, typename _MappedIter >
+class __key_value_iterator {
+	using __key_reference    = core::iter_reference_t< _KeyIter >;
+	using __mapped_reference = core::iter_reference_t< _MappedIter >;
+
+	template < typename, typename >
+	friend class __key_value_iterator;
+
+public:
+	using iterator_concept  = core::random_access_iterator_tag;
+	using iterator_category = core::input_iterator_tag;//<--- the reference is a prvalue
+	using value_type        = core::pair< core::iter_value_t< _KeyIter >, core::iter_value_t< _MappedIter > >;
+	using reference         = core::pair< __key_reference, __mapped_reference >;
+	using difference_type   = core::iter_difference_t< _KeyIter >;
+
+	struct __arrow_proxy {
+		reference __ref;
+		auto      operator->() -> reference* { return core::addressof( __ref ); }
+	};
+
+	using pointer = __arrow_proxy;
+
+	__key_value_iterator() = default;
+
+	LLVM_MSTL_CONSTEXPR __key_value_iterator( _KeyIter __k, _MappedIter __m )
+			: __key_iter( __k )
+			, __mapped_iter( __m ) {}
+
+	//<--- iterator to const_iterator
+	template < typename _OtherMappedIter >
+		requires( !core::is_same_v< _OtherMappedIter, _MappedIter > && core::is_convertible_v< _OtherMappedIter, _MappedIter > )
+	LLVM_MSTL_CONSTEXPR __key_value_iterator( const __key_value_iterator< _KeyIter, _OtherMappedIter >& __x )
+			: __key_iter( __x.__key_iter )
+			, __mapped_iter( __x.__mapped_iter ) {}
+
+	LLVM_MSTL_CONSTEXPR auto operator*() const -> reference { return reference( *__key_iter, *__mapped_iter ); }
+	LLVM_MSTL_CONSTEXPR auto operator->() const -> pointer { return pointer{ **this }; }
+	LLVM_MSTL_CONSTEXPR auto operator[]( difference_type __n ) const -> reference { return *( *this + __n ); }
+
+	LLVM_MSTL_CONSTEXPR auto operator++() -> __key_value_iterator& {
+		++__key_iter;
+		++__mapped_iter;
+		return *this;
+	}
+
+	LLVM_MSTL_CONSTEXPR auto operator++( int ) -> __key_value_iterator {
+		__key_value_iterator __tmp( *this );
+		++*this;
+		return __tmp;
+	}
+
+	LLVM_MSTL_CONSTEXPR auto operator--() -> __key_value_iterator& {
+		--__key_iter;
+		--__mapped_iter;
+		return *this;
+	}
+
+	LLVM_MSTL_CONSTEXPR auto operator--( int ) -> __key_value_iterator {
+		__key_value_iterator __tmp( *this );
+		--*this;
+		return __tmp;
+	}
+
+	LLVM_MSTL_CONSTEXPR auto operator+=( difference_type __n ) -> __key_value_iterator& {
+		__key_iter += __n;
+		__mapped_iter += __n;
+		return *this;
+	}
+
+	LLVM_MSTL_CONSTEXPR auto operator-=( difference_type __n ) -> __key_value_iterator& { return *this += -__n; }
+
+	friend LLVM_MSTL_CONSTEXPR auto operator+( __key_value_iterator __x, difference_type __n ) -> __key_value_iterator { return __x += __n; }
+	friend LLVM_MSTL_CONSTEXPR auto operator+( difference_type __n, __key_value_iterator __x ) -> __key_value_iterator { return __x += __n; }
+	friend LLVM_MSTL_CONSTEXPR auto operator-( __key_value_iterator __x, difference_type __n ) -> __key_value_iterator { return __x -= __n; }
+
+	friend LLVM_MSTL_CONSTEXPR auto operator-( const __key_value_iterator& __x, const __key_value_iterator& __y ) -> difference_type {
+		return __x.__key_iter - __y.__key_iter;
+	}
+
+	friend LLVM_MSTL_CONSTEXPR auto operator==( const __key_value_iterator& __x, const __key_value_iterator& __y ) -> bool {
+		return __x.__key_iter == __y.__key_iter;
+	}
+
+	friend LLVM_MSTL_CONSTEXPR auto operator<=>( const __key_value_iterator& __x, const __key_value_iterator& __y ) -> core::strong_ordering {
+		return ( __x.__key_iter - __y.__key_iter ) <=> 0;
+	}
+
+	LLVM_MSTL_CONSTEXPR auto __key() const -> _KeyIter { return __key_iter; }
+	LLVM_MSTL_CONSTEXPR auto __mapped() const -> _MappedIter { return __mapped_iter; }
+
+private:
+	_KeyIter    __key_iter{};   //<--- position in the key column
+	_MappedIter __mapped_iter{};//<--- position in the mapped column
+};
+
+LLVM_MSTL_END_NAMESPACE_STD
+
+#endif//LLVM_MSTL_KEY_VALUE_ITERATOR_H
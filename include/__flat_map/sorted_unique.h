@@ -0,0 +1,27 @@
+#ifndef LLVM_MSTL_SORTED_UNIQUE_H
+#define LLVM_MSTL_SORTED_UNIQUE_H
+
+#include "__config.h"
+
+LLVM_MSTL_BEGIN_NAMESPACE_STD
+
+/**
+ * @brief Disambiguation tag telling a flat container that the input is already sorted and free of duplicates.
+ *
+ * @ref https://en.cppreference.com/w/cpp/container/flat_map/sorted_unique
+ *
+ * The C++23 `core::sorted_unique_t` is not available in C++20, so the flat containers of the library use this one.
+ *
+ * @code{cc}
+ * nya::flat_set< int > __s( nya::sorted_unique, { 1, 2, 3 } );
+ * @endcode
+ */
+struct sorted_unique_t {
+	explicit sorted_unique_t() = default;
+};
+
+inline LLVM_MSTL_CONSTEXPR sorted_unique_t sorted_unique{};
+
+LLVM_MSTL_END_NAMESPACE_STD
+
+#endif//LLVM_MSTL_SORTED_UNIQUE_H
@@ -77,6 +77,9 @@ struct __has_iterator_category_convertible_to< _Tp, _Up, false > : core::false_t
 template < typename _Tp >
 struct __is_cpp17_forward_iterator : public __has_iterator_category_convertible_to< _Tp, core::forward_iterator_tag > {};
 
+template < typename _Tp >
+struct __is_cpp17_bidirectional_iterator : public __has_iterator_category_convertible_to< _Tp, core::bidirectional_iterator_tag > {};
+
 /**
  * @brief Determines if a type is exactly a C++17 input iterator.
  * 
@@ -24,6 +24,8 @@ public:
 	using pointer           = typename core::iterator_traits< iterator_type >::pointer;
 	using reference         = typename core::iterator_traits< iterator_type >::reference;
 	using iterator_category = typename core::iterator_traits< iterator_type >::iterator_category;
+	//<--- over a pointer the elements are contiguous: `core::to_address` of the iterator is their address
+	using iterator_concept = core::conditional_t< core::is_pointer_v< iterator_type >, core::contiguous_iterator_tag, iterator_category >;
 
 private:
 	iterator_type __it;
@@ -40,6 +42,8 @@ private:
 	friend class basic_string;
 	template < class _Tp, class _Alloc >
 	friend class vector;
+	template < class _Tp, class _Alloc, class _Growth >
+	friend class devector;
 	template < class _Tp, size_t >
 	friend class span;
 
@@ -199,8 +203,7 @@ LLVM_MSTL_CONSTEXPR __wrap_iter< _Iter1 > operator+(
 	typename __wrap_iter< _Iter1 >::difference_type __n,
 	const __wrap_iter< _Iter1 >&                    __x )
 	LLVM_MSTL_NOEXCEPT {
-	__x += __n;
-	return __x;
+	return __x + __n;
 }
 
 LLVM_MSTL_END_NAMESPACE_STD
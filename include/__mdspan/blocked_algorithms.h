@@ -0,0 +1,108 @@
+#ifndef LLVM_MSTL_BLOCKED_ALGORITHMS_H
+#define LLVM_MSTL_BLOCKED_ALGORITHMS_H
+
+#include "__config.h"
+#include "__mdspan/mdspan.h"
+#include "stdexcept.h"
+
+#include "spdlog/spdlog.h"
+
+#include <algorithm>
+#include <cstddef>
+
+LLVM_MSTL_BEGIN_NAMESPACE_STD
+LLVM_MSTL_CORE_STD
+
+//<--- the block edge of the blocked loops: the tile of a tiled layout, else 32 (a few KiB of doubles per block)
+template < typename _Layout >
+inline LLVM_MSTL_CONSTEXPR size_t __block_rows = 32;
+
+template < typename _Layout >
+inline LLVM_MSTL_CONSTEXPR size_t __block_cols = 32;
+
+template < size_t _TileRows, size_t _TileCols >
+inline LLVM_MSTL_CONSTEXPR size_t __block_rows< layout_tiled< _TileRows, _TileCols > > = _TileRows;
+
+template < size_t _TileRows, size_t _TileCols >
+inline LLVM_MSTL_CONSTEXPR size_t __block_cols< layout_tiled< _TileRows, _TileCols > > = _TileCols;
+
+/**
+ * @brief `__dst( j, i ) = __src( i, j )`, block by block so that both sides stay in cache.
+ *
+ * The blocks follow the tiles of `__src` when it is tiled, so each block is read from one contiguous tile.
+ *
+ * @throws length_error If the extents of `__dst` are not those of `__src` swapped.
+ */
+template < typename _Tp, typename _Ext1, typename _Layout1, typename _Up, typename _Ext2, typename _Layout2 >
+auto transpose( mdspan< _Tp, _Ext1, _Layout1 > __src, mdspan< _Up, _Ext2, _Layout2 > __dst ) -> void {
+	static_assert( _Ext1::rank() == 2 && _Ext2::rank() == 2, "transpose needs matrices" );
+	const auto __rows = static_cast< size_t >( __src.extent( 0 ) );
+	const auto __cols = static_cast< size_t >( __src.extent( 1 ) );
+	if ( static_cast< size_t >( __dst.extent( 0 ) ) != __cols || static_cast< size_t >( __dst.extent( 1 ) ) != __rows ) {
+		spdlog::error( "transpose extents mismatch, src[{}x{}] dst[{}x{}]", __rows, __cols, __dst.extent( 0 ), __dst.extent( 1 ) );
+		nya::__throw_length_error( "transpose" );
+	}
+	constexpr size_t __br = __block_rows< _Layout1 >;
+	constexpr size_t __bc = __block_cols< _Layout1 >;
+	for ( size_t __i0 = 0; __i0 < __rows; __i0 += __br ) {
+		const size_t __i1 = core::min( __rows, __i0 + __br );
+		for ( size_t __j0 = 0; __j0 < __cols; __j0 += __bc ) {
+			const size_t __j1 = core::min( __cols, __j0 + __bc );
+			for ( size_t __i = __i0; __i < __i1; ++__i ) {
+				for ( size_t __j = __j0; __j < __j1; ++__j ) __dst( __j, __i ) = __src( __i, __j );
+			}
+		}
+	}
+}
+
+/**
+ * @brief `__c = __a * __b`, blocked over all three loops.
+ *
+ * The innermost loop walks a row of `__b` and of `__c`, contiguous in the row-major and tiled layouts, and
+ * the blocks of `__b` and `__c` it touches are reused across a block of rows of `__a`.
+ *
+ * @throws length_error If the extents do not chain, `( m x k ) * ( k x n ) = ( m x n )`.
+ */
+template <
+	typename _Tp, typename _Ext1, typename _Layout1,
+	typename _Up, typename _Ext2, typename _Layout2,
+	typename _Vp, typename _Ext3, typename _Layout3 >
+auto matrix_product( mdspan< _Tp, _Ext1, _Layout1 > __a, mdspan< _Up, _Ext2, _Layout2 > __b, mdspan< _Vp, _Ext3, _Layout3 > __c ) -> void {
+	static_assert( _Ext1::rank() == 2 && _Ext2::rank() == 2 && _Ext3::rank() == 2, "matrix_product needs matrices" );
+	const auto __m = static_cast< size_t >( __a.extent( 0 ) );
+	const auto __k = static_cast< size_t >( __a.extent( 1 ) );
+	const auto __n = static_cast< size_t >( __b.extent( 1 ) );
+	if ( static_cast< size_t >( __b.extent( 0 ) ) != __k || static_cast< size_t >( __c.extent( 0 ) ) != __m ||
+			 static_cast< size_t >( __c.extent( 1 ) ) != __n ) {
+		spdlog::error(
+			"matrix_product extents mismatch, a[{}x{}] b[{}x{}] c[{}x{}]",
+			__m, __k, __b.extent( 0 ), __n, __c.extent( 0 ), __c.extent( 1 ) );
+		nya::__throw_length_error( "matrix_product" );
+	}
+	using __value = core::remove_cv_t< _Vp >;
+	for ( size_t __i = 0; __i < __m; ++__i ) {
+		for ( size_t __j = 0; __j < __n; ++__j ) __c( __i, __j ) = __value();
+	}
+	constexpr size_t __bi = __block_rows< _Layout3 >;
+	constexpr size_t __bj = __block_cols< _Layout3 >;
+	constexpr size_t __bk = __block_cols< _Layout1 >;
+	for ( size_t __i0 = 0; __i0 < __m; __i0 += __bi ) {
+		const size_t __i1 = core::min( __m, __i0 + __bi );
+		for ( size_t __k0 = 0; __k0 < __k; __k0 += __bk ) {
+			const size_t __k1 = core::min( __k, __k0 + __bk );
+			for ( size_t __j0 = 0; __j0 < __n; __j0 += __bj ) {
+				const size_t __j1 = core::min( __n, __j0 + __bj );
+				for ( size_t __i = __i0; __i < __i1; ++__i ) {
+					for ( size_t __kk = __k0; __kk < __k1; ++__kk ) {
+						const __value __aik = __a( __i, __kk );
+						for ( size_t __j = __j0; __j < __j1; ++__j ) __c( __i, __j ) += __aik * __b( __kk, __j );
+					}
+				}
+			}
+		}
+	}
+}
+
+LLVM_MSTL_END_NAMESPACE_STD
+
+#endif//LLVM_MSTL_BLOCKED_ALGORITHMS_H
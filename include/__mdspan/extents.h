@@ -0,0 +1,120 @@
+#ifndef LLVM_MSTL_EXTENTS_H
+#define LLVM_MSTL_EXTENTS_H
+
+#include "__config.h"
+#include "__tuple_dir/tuple_indices.h"
+
+#include <array>
+#include <concepts>
+#include <cstddef>
+#include <span>
+#include <type_traits>
+
+LLVM_MSTL_BEGIN_NAMESPACE_STD
+LLVM_MSTL_CORE_STD
+
+inline LLVM_MSTL_CONSTEXPR size_t dynamic_extent = core::dynamic_extent;
+
+/**
+ * @brief The shape of a multidimensional index space, the C++23 `core::extents`.
+ *
+ * @ref https://en.cppreference.com/w/cpp/container/mdspan/extents
+ *
+ * Every extent is stored, the static ones included, which keeps `extent( r )` a plain load.
+ *
+ * @tparam _IndexType The integer type of the indices.
+ * @tparam _Extents The extent of each rank, `dynamic_extent` for the ones known at run time.
+ */
+template < typename _IndexType, size_t... _Extents >
+class LLVM_MSTL_TEMPLATE_VIS extents {
+	static_assert( core::is_integral_v< _IndexType > && !core::is_same_v< _IndexType, bool > );
+
+public:
+	using index_type = _IndexType;
+	using size_type  = core::make_unsigned_t< index_type >;
+	using rank_type  = size_t;
+
+	static LLVM_MSTL_CONSTEXPR auto rank() LLVM_MSTL_NOEXCEPT->rank_type { return sizeof...( _Extents ); }
+	static LLVM_MSTL_CONSTEXPR auto rank_dynamic() LLVM_MSTL_NOEXCEPT->rank_type { return ( rank_type( _Extents == dynamic_extent ) + ... + 0 ); }
+
+	static LLVM_MSTL_CONSTEXPR auto static_extent( rank_type __r ) LLVM_MSTL_NOEXCEPT->size_t { return __static_extents[ __r ]; }
+
+	//<--- the dynamic extents are 0
+	LLVM_MSTL_CONSTEXPR extents() LLVM_MSTL_NOEXCEPT {
+		for ( rank_type __r = 0; __r < rank(); ++__r ) {
+			__ext[ __r ] = static_extent( __r ) == dynamic_extent ? 0 : static_cast< index_type >( static_extent( __r ) );
+		}
+	}
+
+	/**
+	* @brief From the dynamic extents only, or from all of them.
+	*/
+	template < typename... _Ints >
+		requires( ( core::is_convertible_v< _Ints, index_type > && ... ) &&
+							( sizeof...( _Ints ) == rank_dynamic() || sizeof...( _Ints ) == rank() ) && sizeof...( _Ints ) != 0 )
+	LLVM_MSTL_CONSTEXPR explicit extents( _Ints... __exts ) LLVM_MSTL_NOEXCEPT
+			: extents( core::array< index_type, sizeof...( _Ints ) >{ static_cast< index_type >( __exts )... } ) {}
+
+	template < typename _OtherIndexType, size_t _Np >
+		requires( core::is_convertible_v< const _OtherIndexType&, index_type > && ( _Np == rank_dynamic() || _Np == rank() ) )
+	LLVM_MSTL_CONSTEXPR explicit( _Np != rank_dynamic() ) extents( const core::array< _OtherIndexType, _Np >& __exts ) LLVM_MSTL_NOEXCEPT {
+		rank_type __d = 0;
+		for ( rank_type __r = 0; __r < rank(); ++__r ) {
+			if constexpr ( _Np == rank() ) {
+				__ext[ __r ] = static_cast< index_type >( __exts[ __r ] );
+			} else if ( static_extent( __r ) == dynamic_extent ) {
+				__ext[ __r ] = static_cast< index_type >( __exts[ __d++ ] );
+			} else {
+				__ext[ __r ] = static_cast< index_type >( static_extent( __r ) );
+			}
+		}
+	}
+
+	LLVM_MSTL_CONSTEXPR auto extent( rank_type __r ) const LLVM_MSTL_NOEXCEPT->index_type { return __ext[ __r ]; }
+
+	//<--- the product of the extents of the ranks `[__first, __last)`
+	LLVM_MSTL_CONSTEXPR auto __product( rank_type __first, rank_type __last ) const LLVM_MSTL_NOEXCEPT->index_type {
+		index_type __p = 1;
+		for ( rank_type __r = __first; __r < __last; ++__r ) __p = static_cast< index_type >( __p * __ext[ __r ] );
+		return __p;
+	}
+
+	template < typename _OtherIndexType, size_t... _OtherExtents >
+	friend LLVM_MSTL_CONSTEXPR auto operator==( const extents& __x, const extents< _OtherIndexType, _OtherExtents... >& __y ) LLVM_MSTL_NOEXCEPT->bool {
+		if constexpr ( sizeof...( _OtherExtents ) != rank() ) {
+			return false;
+		} else {
+			for ( rank_type __r = 0; __r < rank(); ++__r ) {
+				if ( static_cast< size_t >( __x.extent( __r ) ) != static_cast< size_t >( __y.extent( __r ) ) ) return false;
+			}
+			return true;
+		}
+	}
+
+private:
+	static LLVM_MSTL_CONSTEXPR core::array< size_t, sizeof...( _Extents ) > __static_extents{ _Extents... };
+
+	core::array< index_type, sizeof...( _Extents ) > __ext{};
+};
+
+template < typename _IndexType, typename _Indices >
+struct __make_dextents;
+
+template < typename _IndexType, size_t... _Is >
+struct __make_dextents< _IndexType, __tuple_indices< _Is... > > {
+	using type = extents< _IndexType, ( (void) _Is, dynamic_extent )... >;
+};
+
+/**
+ * @brief The extents of rank `_Rank`, all dynamic.
+ */
+template < typename _IndexType, size_t _Rank >
+using dextents = typename __make_dextents< _IndexType, typename __make_tuple_indices< _Rank >::type >::type;
+
+template < typename... _Ints >
+	requires( core::is_convertible_v< _Ints, size_t > && ... )
+extents( _Ints... ) -> extents< size_t, ( (void) sizeof( _Ints ), dynamic_extent )... >;
+
+LLVM_MSTL_END_NAMESPACE_STD
+
+#endif//LLVM_MSTL_EXTENTS_H
@@ -0,0 +1,249 @@
+#ifndef LLVM_MSTL_LAYOUTS_H
+#define LLVM_MSTL_LAYOUTS_H
+
+#include "__config.h"
+#include "__mdspan/extents.h"
+
+#include <array>
+#include <cstddef>
+#include <type_traits>
+
+LLVM_MSTL_BEGIN_NAMESPACE_STD
+LLVM_MSTL_CORE_STD
+
+/**
+ * @brief Row-major: the last index is contiguous, the C++23 `core::layout_right`.
+ *
+ * @ref https://en.cppreference.com/w/cpp/container/mdspan/layout_right
+ */
+struct layout_right {
+	template < typename _Extents >
+	class mapping {
+	public:
+		using extents_type = _Extents;
+		using index_type   = typename extents_type::index_type;
+		using size_type    = typename extents_type::size_type;
+		using rank_type    = typename extents_type::rank_type;
+		using layout_type  = layout_right;
+
+		LLVM_MSTL_CONSTEXPR mapping() LLVM_MSTL_NOEXCEPT = default;
+		LLVM_MSTL_CONSTEXPR mapping( const extents_type& __e ) LLVM_MSTL_NOEXCEPT : __ext( __e ) {}
+
+		LLVM_MSTL_CONSTEXPR auto extents() const LLVM_MSTL_NOEXCEPT->const extents_type& { return __ext; }
+
+		template < typename... _Indices >
+			requires( sizeof...( _Indices ) == extents_type::rank() )
+		LLVM_MSTL_CONSTEXPR auto operator()( _Indices... __is ) const LLVM_MSTL_NOEXCEPT->index_type {
+			index_type __offset = 0;
+			rank_type  __r      = 0;
+			( ( __offset = static_cast< index_type >( __offset * __ext.extent( __r++ ) + static_cast< index_type >( __is ) ) ), ... );
+			return __offset;
+		}
+
+		LLVM_MSTL_CONSTEXPR auto required_span_size() const LLVM_MSTL_NOEXCEPT->index_type { return __ext.__product( 0, extents_type::rank() ); }
+		LLVM_MSTL_CONSTEXPR auto stride( rank_type __r ) const LLVM_MSTL_NOEXCEPT->index_type { return __ext.__product( __r + 1, extents_type::rank() ); }
+
+		static LLVM_MSTL_CONSTEXPR auto is_always_unique() LLVM_MSTL_NOEXCEPT->bool { return true; }
+		static LLVM_MSTL_CONSTEXPR auto is_always_exhaustive() LLVM_MSTL_NOEXCEPT->bool { return true; }
+		static LLVM_MSTL_CONSTEXPR auto is_always_strided() LLVM_MSTL_NOEXCEPT->bool { return true; }
+		static LLVM_MSTL_CONSTEXPR auto is_unique() LLVM_MSTL_NOEXCEPT->bool { return true; }
+		static LLVM_MSTL_CONSTEXPR auto is_exhaustive() LLVM_MSTL_NOEXCEPT->bool { return true; }
+		static LLVM_MSTL_CONSTEXPR auto is_strided() LLVM_MSTL_NOEXCEPT->bool { return true; }
+
+		friend LLVM_MSTL_CONSTEXPR auto operator==( const mapping& __x, const mapping& __y ) LLVM_MSTL_NOEXCEPT->bool { return __x.__ext == __y.__ext; }
+
+	private:
+		extents_type __ext{};
+	};
+};
+
+/**
+ * @brief Column-major: the first index is contiguous, the C++23 `core::layout_left`.
+ *
+ * @ref https://en.cppreference.com/w/cpp/container/mdspan/layout_left
+ */
+struct layout_left {
+	template < typename _Extents >
+	class mapping {
+	public:
+		using extents_type = _Extents;
+		using index_type   = typename extents_type::index_type;
+		using size_type    = typename extents_type::size_type;
+		using rank_type    = typename extents_type::rank_type;
+		using layout_type  = layout_left;
+
+		LLVM_MSTL_CONSTEXPR mapping() LLVM_MSTL_NOEXCEPT = default;
+		LLVM_MSTL_CONSTEXPR mapping( const extents_type& __e ) LLVM_MSTL_NOEXCEPT : __ext( __e ) {}
+
+		LLVM_MSTL_CONSTEXPR auto extents() const LLVM_MSTL_NOEXCEPT->const extents_type& { return __ext; }
+
+		template < typename... _Indices >
+			requires( sizeof...( _Indices ) == extents_type::rank() )
+		LLVM_MSTL_CONSTEXPR auto operator()( _Indices... __is ) const LLVM_MSTL_NOEXCEPT->index_type {
+			const core::array< index_type, extents_type::rank() > __idx{ static_cast< index_type >( __is )... };
+			index_type                                             __offset = 0;
+			for ( rank_type __r = extents_type::rank(); __r-- > 0; ) {
+				__offset = static_cast< index_type >( __offset * __ext.extent( __r ) + __idx[ __r ] );
+			}
+			return __offset;
+		}
+
+		LLVM_MSTL_CONSTEXPR auto required_span_size() const LLVM_MSTL_NOEXCEPT->index_type { return __ext.__product( 0, extents_type::rank() ); }
+		LLVM_MSTL_CONSTEXPR auto stride( rank_type __r ) const LLVM_MSTL_NOEXCEPT->index_type { return __ext.__product( 0, __r ); }
+
+		static LLVM_MSTL_CONSTEXPR auto is_always_unique() LLVM_MSTL_NOEXCEPT->bool { return true; }
+		static LLVM_MSTL_CONSTEXPR auto is_always_exhaustive() LLVM_MSTL_NOEXCEPT->bool { return true; }
+		static LLVM_MSTL_CONSTEXPR auto is_always_strided() LLVM_MSTL_NOEXCEPT->bool { return true; }
+		static LLVM_MSTL_CONSTEXPR auto is_unique() LLVM_MSTL_NOEXCEPT->bool { return true; }
+		static LLVM_MSTL_CONSTEXPR auto is_exhaustive() LLVM_MSTL_NOEXCEPT->bool { return true; }
+		static LLVM_MSTL_CONSTEXPR auto is_strided() LLVM_MSTL_NOEXCEPT->bool { return true; }
+
+		friend LLVM_MSTL_CONSTEXPR auto operator==( const mapping& __x, const mapping& __y ) LLVM_MSTL_NOEXCEPT->bool { return __x.__ext == __y.__ext; }
+
+	private:
+		extents_type __ext{};
+	};
+};
+
+/**
+ * @brief Row-major with each row padded to a multiple of `_Pad` elements.
+ *
+ * With the storage aligned to `_Pad` elements, every row starts aligned too, so a row can be processed with
+ * aligned vector loads and no scalar prologue. The padding elements are never addressed.
+ *
+ * @tparam _Pad The row stride granularity, in elements.
+ */
+template < size_t _Pad >
+struct layout_right_padded {
+	static_assert( _Pad > 0 );
+
+	template < typename _Extents >
+	class mapping {
+	public:
+		using extents_type = _Extents;
+		using index_type   = typename extents_type::index_type;
+		using size_type    = typename extents_type::size_type;
+		using rank_type    = typename extents_type::rank_type;
+		using layout_type  = layout_right_padded;
+
+		static_assert( extents_type::rank() > 0 );
+
+		LLVM_MSTL_CONSTEXPR mapping() LLVM_MSTL_NOEXCEPT = default;
+		LLVM_MSTL_CONSTEXPR mapping( const extents_type& __e ) LLVM_MSTL_NOEXCEPT : __ext( __e ) {}
+
+		LLVM_MSTL_CONSTEXPR auto extents() const LLVM_MSTL_NOEXCEPT->const extents_type& { return __ext; }
+
+		template < typename... _Indices >
+			requires( sizeof...( _Indices ) == extents_type::rank() )
+		LLVM_MSTL_CONSTEXPR auto operator()( _Indices... __is ) const LLVM_MSTL_NOEXCEPT->index_type {
+			const core::array< index_type, extents_type::rank() > __idx{ static_cast< index_type >( __is )... };
+			index_type                                             __offset = 0;
+			for ( rank_type __r = 0; __r + 1 < extents_type::rank(); ++__r ) {
+				__offset = static_cast< index_type >( __offset * __extent_of( __r ) + __idx[ __r ] );
+			}
+			return static_cast< index_type >( __offset * __padded_row() + __idx[ extents_type::rank() - 1 ] );
+		}
+
+		LLVM_MSTL_CONSTEXPR auto required_span_size() const LLVM_MSTL_NOEXCEPT->index_type {
+			if ( __ext.__product( 0, extents_type::rank() ) == 0 ) return 0;
+			return static_cast< index_type >( __ext.__product( 0, extents_type::rank() - 1 ) * __padded_row() );
+		}
+
+		LLVM_MSTL_CONSTEXPR auto stride( rank_type __r ) const LLVM_MSTL_NOEXCEPT->index_type {
+			if ( __r + 1 == extents_type::rank() ) return 1;
+			return static_cast< index_type >( __ext.__product( __r + 1, extents_type::rank() - 1 ) * __padded_row() );
+		}
+
+		static LLVM_MSTL_CONSTEXPR auto is_always_unique() LLVM_MSTL_NOEXCEPT->bool { return true; }
+		static LLVM_MSTL_CONSTEXPR auto is_always_exhaustive() LLVM_MSTL_NOEXCEPT->bool { return _Pad == 1; }
+		static LLVM_MSTL_CONSTEXPR auto is_always_strided() LLVM_MSTL_NOEXCEPT->bool { return true; }
+		static LLVM_MSTL_CONSTEXPR auto is_unique() LLVM_MSTL_NOEXCEPT->bool { return true; }
+		LLVM_MSTL_CONSTEXPR auto is_exhaustive() const LLVM_MSTL_NOEXCEPT->bool { return __padded_row() == __ext.extent( extents_type::rank() - 1 ); }
+		static LLVM_MSTL_CONSTEXPR auto is_strided() LLVM_MSTL_NOEXCEPT->bool { return true; }
+
+		friend LLVM_MSTL_CONSTEXPR auto operator==( const mapping& __x, const mapping& __y ) LLVM_MSTL_NOEXCEPT->bool { return __x.__ext == __y.__ext; }
+
+	private:
+		LLVM_MSTL_CONSTEXPR auto __extent_of( rank_type __r ) const LLVM_MSTL_NOEXCEPT->index_type { return __ext.extent( __r ); }
+
+		//<--- the stride of the second to last rank
+		LLVM_MSTL_CONSTEXPR auto __padded_row() const LLVM_MSTL_NOEXCEPT->index_type {
+			const auto __n = static_cast< size_t >( __ext.extent( extents_type::rank() - 1 ) );
+			return static_cast< index_type >( ( __n + _Pad - 1 ) / _Pad * _Pad );
+		}
+
+		extents_type __ext{};
+	};
+};
+
+/**
+ * @brief A matrix stored as `_TileRows x _TileCols` tiles, the tiles row-major and each tile row-major.
+ *
+ * A tile is contiguous, so a blocked algorithm working tile by tile (a transpose, a blocked matrix product)
+ * touches `_TileRows` rows of the matrix through `_TileRows * _TileCols` consecutive elements rather than
+ * through `_TileRows` distant cache lines. The extents are rounded up to whole tiles; with power-of-two
+ * tile sizes the index arithmetic reduces to shifts and masks.
+ *
+ * @tparam _TileRows The rows of a tile.
+ * @tparam _TileCols The columns of a tile.
+ */
+template < size_t _TileRows, size_t _TileCols >
+struct layout_tiled {
+	static_assert( _TileRows > 0 && _TileCols > 0 );
+
+	static LLVM_MSTL_CONSTEXPR size_t tile_rows = _TileRows;
+	static LLVM_MSTL_CONSTEXPR size_t tile_cols = _TileCols;
+
+	template < typename _Extents >
+	class mapping {
+	public:
+		using extents_type = _Extents;
+		using index_type   = typename extents_type::index_type;
+		using size_type    = typename extents_type::size_type;
+		using rank_type    = typename extents_type::rank_type;
+		using layout_type  = layout_tiled;
+
+		static_assert( extents_type::rank() == 2, "layout_tiled maps matrices" );
+
+		LLVM_MSTL_CONSTEXPR mapping() LLVM_MSTL_NOEXCEPT = default;
+		LLVM_MSTL_CONSTEXPR mapping( const extents_type& __e ) LLVM_MSTL_NOEXCEPT : __ext( __e ) {}
+
+		LLVM_MSTL_CONSTEXPR auto extents() const LLVM_MSTL_NOEXCEPT->const extents_type& { return __ext; }
+
+		template < typename _I, typename _J >
+		LLVM_MSTL_CONSTEXPR auto operator()( _I __i, _J __j ) const LLVM_MSTL_NOEXCEPT->index_type {
+			const auto   __row = static_cast< size_t >( __i );
+			const auto   __col = static_cast< size_t >( __j );
+			const size_t __tile = ( __row / _TileRows ) * __tiles_per_row() + __col / _TileCols;
+			return static_cast< index_type >( __tile * _TileRows * _TileCols + ( __row % _TileRows ) * _TileCols + __col % _TileCols );
+		}
+
+		LLVM_MSTL_CONSTEXPR auto required_span_size() const LLVM_MSTL_NOEXCEPT->index_type {
+			const auto __rows = static_cast< size_t >( __ext.extent( 0 ) );
+			if ( __rows == 0 || __ext.extent( 1 ) == 0 ) return 0;
+			return static_cast< index_type >( ( __rows + _TileRows - 1 ) / _TileRows * __tiles_per_row() * _TileRows * _TileCols );
+		}
+
+		static LLVM_MSTL_CONSTEXPR auto is_always_unique() LLVM_MSTL_NOEXCEPT->bool { return true; }
+		static LLVM_MSTL_CONSTEXPR auto is_always_exhaustive() LLVM_MSTL_NOEXCEPT->bool { return false; }
+		static LLVM_MSTL_CONSTEXPR auto is_always_strided() LLVM_MSTL_NOEXCEPT->bool { return false; }
+		static LLVM_MSTL_CONSTEXPR auto is_unique() LLVM_MSTL_NOEXCEPT->bool { return true; }
+		LLVM_MSTL_CONSTEXPR auto is_exhaustive() const LLVM_MSTL_NOEXCEPT->bool {
+			return static_cast< size_t >( __ext.extent( 0 ) ) % _TileRows == 0 && static_cast< size_t >( __ext.extent( 1 ) ) % _TileCols == 0;
+		}
+		static LLVM_MSTL_CONSTEXPR auto is_strided() LLVM_MSTL_NOEXCEPT->bool { return false; }
+
+		friend LLVM_MSTL_CONSTEXPR auto operator==( const mapping& __x, const mapping& __y ) LLVM_MSTL_NOEXCEPT->bool { return __x.__ext == __y.__ext; }
+
+	private:
+		LLVM_MSTL_CONSTEXPR auto __tiles_per_row() const LLVM_MSTL_NOEXCEPT->size_t {
+			return ( static_cast< size_t >( __ext.extent( 1 ) ) + _TileCols - 1 ) / _TileCols;
+		}
+
+		extents_type __ext{};
+	};
+};
+
+LLVM_MSTL_END_NAMESPACE_STD
+
+#endif//LLVM_MSTL_LAYOUTS_H
@@ -0,0 +1,133 @@
+#ifndef LLVM_MSTL_MDSPAN_H
+#define LLVM_MSTL_MDSPAN_H
+
+#include "__config.h"
+#include "__mdspan/extents.h"
+#include "__mdspan/layouts.h"
+
+#include <array>
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+#include <version>
+#ifdef __cpp_lib_mdspan
+#include <mdspan>
+#endif
+
+LLVM_MSTL_BEGIN_NAMESPACE_STD
+LLVM_MSTL_CORE_STD
+
+/**
+ * @brief A non-owning multidimensional view, the C++23 `core::mdspan` with the default accessor.
+ *
+ * @ref https://en.cppreference.com/w/cpp/container/mdspan
+ *
+ * The multidimensional `operator[]` needs C++23, so the element access is `operator()( i, j, ... )`, or
+ * `operator[]` with an array of indices. `to_mdspan()` converts the row-major and column-major views to
+ * `core::mdspan` where the standard library provides it.
+ *
+ * @tparam _Tp The element type.
+ * @tparam _Extents The `extents`.
+ * @tparam _Layout The layout policy.
+ */
+template < typename _Tp, typename _Extents, typename _Layout = layout_right >
+class LLVM_MSTL_TEMPLATE_VIS mdspan {
+public:
+	using extents_type     = _Extents;
+	using layout_type      = _Layout;
+	using mapping_type     = typename layout_type::template mapping< extents_type >;
+	using element_type     = _Tp;
+	using value_type       = core::remove_cv_t< element_type >;
+	using index_type       = typename extents_type::index_type;
+	using size_type        = typename extents_type::size_type;
+	using rank_type        = typename extents_type::rank_type;
+	using data_handle_type = element_type*;
+	using reference        = element_type&;
+
+	LLVM_MSTL_CONSTEXPR mdspan() = default;
+
+	LLVM_MSTL_CONSTEXPR mdspan( data_handle_type __p, const mapping_type& __m ) LLVM_MSTL_NOEXCEPT
+			: __ptr( __p ),
+				__map( __m ) {}
+
+	LLVM_MSTL_CONSTEXPR mdspan( data_handle_type __p, const extents_type& __e ) LLVM_MSTL_NOEXCEPT
+			: __ptr( __p ),
+				__map( __e ) {}
+
+	template < typename... _Ints >
+		requires( ( core::is_convertible_v< _Ints, index_type > && ... ) && sizeof...( _Ints ) != 0 &&
+							( sizeof...( _Ints ) == extents_type::rank() || sizeof...( _Ints ) == extents_type::rank_dynamic() ) )
+	LLVM_MSTL_CONSTEXPR explicit mdspan( data_handle_type __p, _Ints... __exts ) LLVM_MSTL_NOEXCEPT
+			: mdspan( __p, extents_type( static_cast< index_type >( __exts )... ) ) {}
+
+	//<--- mdspan< T > to mdspan< const T >
+	template < typename _Up >
+		requires( core::is_convertible_v< _Up ( * )[], element_type ( * )[] > && !core::is_same_v< _Up, element_type > )
+	LLVM_MSTL_CONSTEXPR mdspan( const mdspan< _Up, extents_type, layout_type >& __x ) LLVM_MSTL_NOEXCEPT
+			: __ptr( __x.data_handle() ),
+				__map( __x.mapping() ) {}
+
+	template < typename... _Indices >
+		requires( sizeof...( _Indices ) == extents_type::rank() && ( core::is_convertible_v< _Indices, index_type > && ... ) )
+	LLVM_MSTL_CONSTEXPR auto operator()( _Indices... __is ) const LLVM_MSTL_NOEXCEPT->reference {
+		return __ptr[ __map( static_cast< index_type >( __is )... ) ];
+	}
+
+	template < typename _OtherIndexType >
+	LLVM_MSTL_CONSTEXPR auto operator[]( const core::array< _OtherIndexType, extents_type::rank() >& __is ) const LLVM_MSTL_NOEXCEPT->reference {
+		return [ & ]< size_t... _Is >( __tuple_indices< _Is... > ) -> reference {
+			return ( *this )( __is[ _Is ]... );
+		}( typename __make_tuple_indices< extents_type::rank() >::type() );
+	}
+
+	static LLVM_MSTL_CONSTEXPR auto rank() LLVM_MSTL_NOEXCEPT->rank_type { return extents_type::rank(); }
+	static LLVM_MSTL_CONSTEXPR auto rank_dynamic() LLVM_MSTL_NOEXCEPT->rank_type { return extents_type::rank_dynamic(); }
+	static LLVM_MSTL_CONSTEXPR auto static_extent( rank_type __r ) LLVM_MSTL_NOEXCEPT->size_t { return extents_type::static_extent( __r ); }
+
+	LLVM_MSTL_CONSTEXPR auto extent( rank_type __r ) const LLVM_MSTL_NOEXCEPT->index_type { return extents().extent( __r ); }
+	LLVM_MSTL_CONSTEXPR auto size() const LLVM_MSTL_NOEXCEPT->size_type { return static_cast< size_type >( extents().__product( 0, rank() ) ); }
+	LLVM_MSTL_NODISCARD LLVM_MSTL_CONSTEXPR auto empty() const LLVM_MSTL_NOEXCEPT->bool { return size() == 0; }
+
+	LLVM_MSTL_CONSTEXPR auto extents() const LLVM_MSTL_NOEXCEPT->const extents_type& { return __map.extents(); }
+	LLVM_MSTL_CONSTEXPR auto data_handle() const LLVM_MSTL_NOEXCEPT->const data_handle_type& { return __ptr; }
+	LLVM_MSTL_CONSTEXPR auto mapping() const LLVM_MSTL_NOEXCEPT->const mapping_type& { return __map; }
+
+	LLVM_MSTL_CONSTEXPR auto stride( rank_type __r ) const LLVM_MSTL_NOEXCEPT->index_type
+		requires( mapping_type::is_always_strided() )
+	{
+		return __map.stride( __r );
+	}
+
+	LLVM_MSTL_CONSTEXPR auto is_unique() const -> bool { return __map.is_unique(); }
+	LLVM_MSTL_CONSTEXPR auto is_exhaustive() const -> bool { return __map.is_exhaustive(); }
+	LLVM_MSTL_CONSTEXPR auto is_strided() const -> bool { return __map.is_strided(); }
+
+#ifdef __cpp_lib_mdspan
+	template < size_t... _Es >
+	static auto __std_extents( const nya::extents< index_type, _Es... >& __e ) {
+		return [ & ]< size_t... _Is >( __tuple_indices< _Is... > ) {
+			return core::extents< index_type, _Es... >( core::array< index_type, sizeof...( _Es ) >{ __e.extent( _Is )... } );
+		}( typename __make_tuple_indices< sizeof...( _Es ) >::type() );
+	}
+
+	auto to_mdspan() const
+		requires( core::is_same_v< layout_type, layout_right > || core::is_same_v< layout_type, layout_left > )
+	{
+		using __std_layout = core::conditional_t< core::is_same_v< layout_type, layout_right >, core::layout_right, core::layout_left >;
+		const auto __e     = __std_extents( extents() );
+		return core::mdspan< element_type, core::remove_cvref_t< decltype( __e ) >, __std_layout >( __ptr, __e );
+	}
+#endif
+
+private:
+	data_handle_type __ptr = nullptr;//<--- the first element
+	mapping_type     __map{};        //<--- maps the indices to offsets from `__ptr`
+};
+
+template < typename _Tp, typename... _Ints >
+	requires( ( core::is_convertible_v< _Ints, size_t > && ... ) && sizeof...( _Ints ) > 0 )
+explicit mdspan( _Tp*, _Ints... ) -> mdspan< _Tp, dextents< size_t, sizeof...( _Ints ) > >;
+
+LLVM_MSTL_END_NAMESPACE_STD
+
+#endif//LLVM_MSTL_MDSPAN_H
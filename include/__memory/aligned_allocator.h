@@ -0,0 +1,61 @@
+#ifndef LLVM_MSTL_ALIGNED_ALLOCATOR_H
+#define LLVM_MSTL_ALIGNED_ALLOCATOR_H
+
+#include "__config.h"
+
+#include <cstddef>
+#include <new>
+#include <type_traits>
+
+LLVM_MSTL_BEGIN_NAMESPACE_STD
+LLVM_MSTL_CORE_STD
+
+/**
+ * @brief A stateless allocator whose storage is aligned to `_Align` bytes.
+ *
+ * Used for storage scanned by wide loads, e.g. 64 bytes is one cache line and one AVX-512 register,
+ * so every block of a `dynamic_bitset` word array starts a new line.
+ *
+ * @tparam _Tp The value type.
+ * @tparam _Align The alignment in bytes, a power of two not less than `alignof( _Tp )`.
+ */
+template < typename _Tp, size_t _Align >
+class __aligned_allocator {
+	static_assert( ( _Align & ( _Align - 1 ) ) == 0, "__aligned_allocator: the alignment must be a power of two" );
+	static_assert( _Align >= alignof( _Tp ), "__aligned_allocator: the alignment must not be weaker than alignof( _Tp )" );
+
+public:
+	using value_type                             = _Tp;
+	using size_type                              = size_t;
+	using difference_type                        = ptrdiff_t;
+	using propagate_on_container_move_assignment = core::true_type;
+	using is_always_equal                        = core::true_type;
+
+	//<--- `_Align` is not a type parameter, so `allocator_traits` can not rebind on its own
+	template < typename _Up >
+	struct rebind {
+		using other = __aligned_allocator< _Up, _Align >;
+	};
+
+	LLVM_MSTL_CONSTEXPR __aligned_allocator() LLVM_MSTL_NOEXCEPT = default;
+
+	template < typename _Up >
+	LLVM_MSTL_CONSTEXPR __aligned_allocator( const __aligned_allocator< _Up, _Align >& ) LLVM_MSTL_NOEXCEPT {}
+
+	LLVM_MSTL_NODISCARD auto allocate( size_type __n ) -> _Tp* {
+		return static_cast< _Tp* >( ::operator new( __n * sizeof( _Tp ), core::align_val_t( _Align ) ) );
+	}
+
+	auto deallocate( _Tp* __p, size_type __n ) LLVM_MSTL_NOEXCEPT->void {
+		::operator delete( __p, __n * sizeof( _Tp ), core::align_val_t( _Align ) );
+	}
+
+	template < typename _Up >
+	friend LLVM_MSTL_CONSTEXPR auto operator==( const __aligned_allocator&, const __aligned_allocator< _Up, _Align >& ) LLVM_MSTL_NOEXCEPT->bool {
+		return true;
+	}
+};
+
+LLVM_MSTL_END_NAMESPACE_STD
+
+#endif//LLVM_MSTL_ALIGNED_ALLOCATOR_H
@@ -2,8 +2,10 @@
 #define LLVM_MSTL_ALLOCATE_AT_LEAST_H
 
 #include "__config.h"
+#include "__type_traits/void_t.h"
 
 #include <memory>
+#include <type_traits>
 
 LLVM_MSTL_BEGIN_NAMESPACE_STD
 LLVM_MSTL_CORE_STD
@@ -37,6 +39,35 @@ LLVM_MSTL_NODISCARD LLVM_MSTL_CONSTEXPR auto __allocate_at_least( _Alloc& __allo
 	return { __alloc.allocate( __n ), __n };
 }
 
+/**
+ * @brief Whether `_Alloc` can allocate storage whose bytes are already zero: `__alloc.allocate_zeroed( __n )`,
+ * released by `deallocate` as any other.
+ *
+ * @tparam _Alloc The allocator type.
+ */
+template < typename _Alloc, typename = void >
+struct __has_allocate_zeroed : core::false_type {};
+
+template < typename _Alloc >
+struct __has_allocate_zeroed< _Alloc, __void_t< decltype( core::declval< _Alloc& >().allocate_zeroed( size_t() ) ) > >
+		: core::true_type {};
+
+/**
+ * @brief As @ref __allocate_at_least, from `allocate_zeroed`: value-initializing zero-initializable elements in
+ * that storage is a no-op, and an allocator over `calloc` or a fresh `mmap` only commits the pages on write.
+ *
+ * @tparam _Alloc The allocator type, see @ref __has_allocate_zeroed.
+ * @param __alloc The allocator object.
+ * @param __n The number of elements to allocate.
+ * @return The __allocation_result structure containing the allocated pointer and count.
+ */
+template < typename _Alloc >
+	requires __has_allocate_zeroed< _Alloc >::value
+LLVM_MSTL_NODISCARD LLVM_MSTL_CONSTEXPR auto __allocate_zeroed_at_least( _Alloc& __alloc, size_t __n )
+	-> __allocation_result< typename core::allocator_traits< _Alloc >::pointer > {
+	return { __alloc.allocate_zeroed( __n ), __n };
+}
+
 LLVM_MSTL_END_NAMESPACE_STD
 
 #endif//LLVM_MSTL_ALLOCATE_AT_LEAST_H
\ No newline at end of file
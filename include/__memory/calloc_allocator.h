@@ -0,0 +1,74 @@
+#ifndef LLVM_MSTL_CALLOC_ALLOCATOR_H
+#define LLVM_MSTL_CALLOC_ALLOCATOR_H
+
+#include "__config.h"
+#include "stdexcept.h"
+
+#include <cstddef>
+#include <cstdlib>
+#include <limits>
+#include <type_traits>
+
+LLVM_MSTL_BEGIN_NAMESPACE_STD
+LLVM_MSTL_CORE_STD
+
+/**
+ * @brief A stateless allocator over `malloc`, which can also hand out storage that is already zero.
+ *
+ * `allocate_zeroed` is `calloc`: a large block is a fresh anonymous mapping, whose pages the kernel maps to the
+ * zero page and only commits on the first write, so a value-initialized `vector< double, __calloc_allocator< double > >`
+ * of any size is constructed without touching its storage, see @ref __allocate_zeroed_at_least.
+ *
+ * @tparam _Tp The value type, not over-aligned.
+ */
+template < typename _Tp >
+class __calloc_allocator {
+	static_assert( alignof( _Tp ) <= alignof( core::max_align_t ), "__calloc_allocator: `malloc` does not align over-aligned types" );
+
+public:
+	using value_type                             = _Tp;
+	using size_type                              = size_t;
+	using difference_type                        = ptrdiff_t;
+	using propagate_on_container_move_assignment = core::true_type;
+	using is_always_equal                        = core::true_type;
+
+	LLVM_MSTL_CONSTEXPR __calloc_allocator() LLVM_MSTL_NOEXCEPT = default;
+
+	template < typename _Up >
+	LLVM_MSTL_CONSTEXPR __calloc_allocator( const __calloc_allocator< _Up >& ) LLVM_MSTL_NOEXCEPT {}
+
+	LLVM_MSTL_NODISCARD auto allocate( size_type __n ) -> _Tp* {
+		if ( __n > core::numeric_limits< size_type >::max() / sizeof( _Tp ) ) __throw_bad_alloc();
+		void* __p = core::malloc( __n * sizeof( _Tp ) );
+		if ( __p == nullptr && __n != 0 ) __throw_bad_alloc();
+		return static_cast< _Tp* >( __p );
+	}
+
+	//<--- storage of `__n` elements whose bytes are all zero, to be released by `deallocate`
+	LLVM_MSTL_NODISCARD auto allocate_zeroed( size_type __n ) -> _Tp* {
+		void* __p = core::calloc( __n, sizeof( _Tp ) );//<--- checks the product itself
+		if ( __p == nullptr && __n != 0 ) __throw_bad_alloc();
+		return static_cast< _Tp* >( __p );
+	}
+
+	auto deallocate( _Tp* __p, size_type ) LLVM_MSTL_NOEXCEPT->void { core::free( __p ); }
+
+	template < typename _Up >
+	friend LLVM_MSTL_CONSTEXPR auto operator==( const __calloc_allocator&, const __calloc_allocator< _Up >& ) LLVM_MSTL_NOEXCEPT->bool {
+		return true;
+	}
+};
+
+/**
+ * @brief The allocator to hand a `vector` whose value-initialized storage should come from `calloc`.
+ *
+ * `core::allocator` has no zeroed allocation to ask for, and `vector` cannot swap `operator new` for `calloc` behind
+ * its back, so the saving is opt-in: `vector< double, calloc_allocator< double > > __v( __n )` takes its `__n` zeros
+ * from the kernel instead of writing them.
+ */
+template < typename _Tp >
+using calloc_allocator = __calloc_allocator< _Tp >;
+
+LLVM_MSTL_END_NAMESPACE_STD
+
+#endif//LLVM_MSTL_CALLOC_ALLOCATOR_H
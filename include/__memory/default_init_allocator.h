@@ -0,0 +1,58 @@
+#ifndef LLVM_MSTL_DEFAULT_INIT_ALLOCATOR_H
+#define LLVM_MSTL_DEFAULT_INIT_ALLOCATOR_H
+
+#include "__config.h"
+
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+LLVM_MSTL_BEGIN_NAMESPACE_STD
+LLVM_MSTL_CORE_STD
+
+/**
+ * @brief An allocator adaptor whose construction without arguments default-initializes instead of value-initializing.
+ *
+ * `vector::resize( __n )` then leaves trivial elements indeterminate rather than zeroing them, e.g. for the
+ * sparse array of a `sparse_set`, which never reads a slot it has not written but through a checked lookup.
+ * Construction with arguments is forwarded to `_Base`.
+ *
+ * @tparam _Tp The value type.
+ * @tparam _Base The adapted allocator.
+ */
+template < typename _Tp, typename _Base = core::allocator< _Tp > >
+class __default_init_allocator : public _Base {
+	using __base_traits = core::allocator_traits< _Base >;
+
+public:
+	template < typename _Up >
+	struct rebind {
+		using other = __default_init_allocator< _Up, typename __base_traits::template rebind_alloc< _Up > >;
+	};
+
+	using _Base::_Base;
+
+	LLVM_MSTL_CONSTEXPR __default_init_allocator() LLVM_MSTL_NOEXCEPT_V( core::is_nothrow_default_constructible_v< _Base > ) = default;
+
+	LLVM_MSTL_CONSTEXPR __default_init_allocator( const _Base& __b ) LLVM_MSTL_NOEXCEPT
+			: _Base( __b ) {}
+
+	template < typename _Up, typename _OtherBase >
+	LLVM_MSTL_CONSTEXPR __default_init_allocator( const __default_init_allocator< _Up, _OtherBase >& __x ) LLVM_MSTL_NOEXCEPT
+			: _Base( static_cast< const _OtherBase& >( __x ) ) {}
+
+	template < typename _Up >
+	auto construct( _Up* __p ) LLVM_MSTL_NOEXCEPT_V( core::is_nothrow_default_constructible_v< _Up > )->void {
+		::new ( static_cast< void* >( __p ) ) _Up;
+	}
+
+	template < typename _Up, typename... _Args >
+	auto construct( _Up* __p, _Args&&... __args ) -> void {
+		__base_traits::construct( static_cast< _Base& >( *this ), __p, core::forward< _Args >( __args )... );
+	}
+};
+
+LLVM_MSTL_END_NAMESPACE_STD
+
+#endif//LLVM_MSTL_DEFAULT_INIT_ALLOCATOR_H
@@ -0,0 +1,52 @@
+#ifndef LLVM_MSTL_SCRATCH_BUFFER_H
+#define LLVM_MSTL_SCRATCH_BUFFER_H
+
+#include "__config.h"
+#include "__memory/uninitialized_algorithms.h"
+
+#include <cstddef>
+#include <memory>
+
+LLVM_MSTL_BEGIN_NAMESPACE_STD
+LLVM_MSTL_CORE_STD
+
+/**
+ * @brief Raw storage for `n` elements from an allocator, for the out-of-place passes of the sorts.
+ *
+ * The elements are constructed all at once by the first pass that writes the buffer, which then calls
+ * `__mark_constructed()`; the buffer destroys them only if so, and always deallocates.
+ *
+ * @tparam _Tp The element type.
+ * @tparam _Alloc An allocator, rebound to `_Tp`.
+ */
+template < typename _Tp, typename _Alloc >
+struct __scratch_buffer {
+	using allocator_type = typename core::allocator_traits< _Alloc >::template rebind_alloc< _Tp >;
+	using __alloc_traits = core::allocator_traits< allocator_type >;
+	using pointer        = typename __alloc_traits::pointer;
+
+	allocator_type __a;
+	pointer        __p;
+	size_t         __n;
+	bool           __constructed = false;
+
+	__scratch_buffer( const _Alloc& __alloc, size_t __size )
+			: __a( __alloc )
+			, __p( __alloc_traits::allocate( __a, __size ) )
+			, __n( __size ) {}
+
+	~__scratch_buffer() {
+		if ( __constructed ) __alloctor_destroy( __a, __p, __p + __n );
+		__alloc_traits::deallocate( __a, __p, __n );
+	}
+
+	__scratch_buffer( const __scratch_buffer& )                    = delete;
+	auto operator=( const __scratch_buffer& ) -> __scratch_buffer& = delete;
+
+	auto data() const LLVM_MSTL_NOEXCEPT->_Tp* { return core::to_address( __p ); }
+	auto __mark_constructed() LLVM_MSTL_NOEXCEPT->void { __constructed = true; }
+};
+
+LLVM_MSTL_END_NAMESPACE_STD
+
+#endif//LLVM_MSTL_SCRATCH_BUFFER_H
@@ -0,0 +1,46 @@
+#ifndef LLVM_MSTL_TEMP_VALUE_H
+#define LLVM_MSTL_TEMP_VALUE_H
+
+#include "__config.h"
+#include <memory>
+#include <utility>
+
+LLVM_MSTL_BEGIN_NAMESPACE_STD
+LLVM_MSTL_CORE_STD
+
+/**
+ * @brief A value constructed and destroyed through an allocator, living on the stack.
+ *
+ * Containers use this when an element has to be built before its final slot can be touched,
+ * e.g. when the constructor arguments may refer to elements that are about to be shifted.
+ *
+ * @tparam _Tp The type of the value.
+ * @tparam _Alloc The allocator used to construct and destroy the value.
+ */
+template < typename _Tp, typename _Alloc >
+struct __temp_value {
+	using _Traits = core::allocator_traits< _Alloc >;
+
+	union {
+		_Tp __v;
+	};
+	_Alloc& __a;
+
+	LLVM_MSTL_CONSTEXPR_SINCE_CXX20 auto __addr() -> _Tp* { return core::addressof( __v ); }
+
+	LLVM_MSTL_CONSTEXPR_SINCE_CXX20 auto get() -> _Tp& { return *__addr(); }
+
+	template < typename... _Args >
+	LLVM_MSTL_CONSTEXPR_SINCE_CXX20 __temp_value( _Alloc& __alloc, _Args&&... __args ) : __a( __alloc ) {
+		_Traits::construct( __a, __addr(), core::forward< _Args >( __args )... );
+	}
+
+	LLVM_MSTL_CONSTEXPR_SINCE_CXX20 ~__temp_value() { _Traits::destroy( __a, __addr() ); }
+
+	__temp_value( const __temp_value& )            = delete;
+	__temp_value& operator=( const __temp_value& ) = delete;
+};
+
+LLVM_MSTL_END_NAMESPACE_STD
+
+#endif//LLVM_MSTL_TEMP_VALUE_H
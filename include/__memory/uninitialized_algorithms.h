@@ -1,11 +1,14 @@
 #ifndef LLVM_MSTL_UNINITIALIZED_ALGORITHMS_H
 #define LLVM_MSTL_UNINITIALIZED_ALGORITHMS_H
 
+#include "__algorithm/simd_fill.h"
 #include "__config.h"
 #include "__memory/allocator_traits.h"
+#include "__type_traits/is_zero_initializable.h"
 #include "__type_traits/negation.h"
 #include "__utility/exception_guard.h"
 
+#include <cstring>
 #include <iterator>
 #include <memory>
 #include <type_traits>
@@ -91,6 +94,141 @@ template < typename _Type >
 struct __allocator_has_trivial_copy_construct< core::allocator< _Type >, _Type >
 		: core::true_type {};
 
+/**
+ * @brief Whether `allocator_traits< _Alloc >::construct( __a, __p )` is a plain value-initialization of `_Type`.
+ *
+ * An allocator with a `construct` of its own, e.g. `__default_init_allocator`, decides what an element is made of.
+ *
+ * @tparam _Alloc The allocator type.
+ * @tparam _Type The element type.
+ */
+template < typename _Alloc, typename _Type >
+struct __allocator_has_trivial_value_construct
+		: _Not< __has_construct< _Alloc, _Type* > > {};
+
+template < typename _Type >
+struct __allocator_has_trivial_value_construct< core::allocator< _Type >, _Type >
+		: core::true_type {};
+
+/**
+ * @brief Value-initializes the `__n` elements of uninitialized storage from `__first` with one `memset`.
+ *
+ * Only where the allocator adds nothing to a value-initialization that is all zero bytes.
+ *
+ * @return The end of the constructed elements.
+ */
+template <
+	typename _Alloc,
+	typename _Type,
+	core::enable_if_t<
+		__is_zero_initializable< _Type >::value &&
+		__allocator_has_trivial_value_construct< _Alloc, _Type >::value >* = nullptr >
+LLVM_MSTL_CONSTEXPR_SINCE_CXX20 auto __uninitialized_allocator_value_construct_n(
+	_Alloc&, _Type* __first, size_t __n ) -> _Type* {
+	if ( core::is_constant_evaluated() ) {
+		for ( size_t __i = 0; __i != __n; ++__i ) core::construct_at( __first + __i );
+	} else if ( __n != 0 ) {
+		core::memset( static_cast< void* >( __first ), 0, __n * sizeof( _Type ) );
+	}
+	return __first + __n;
+}
+
+/**
+ * @brief Copy-constructs `__x` into the `__n` elements of uninitialized storage from `__first` as a broadcast store.
+ *
+ * Only where the allocator adds nothing to a copy of the bytes; the types of the width of an integer go through
+ * the vector kernels, see @ref __simd_dispatch_fill.
+ *
+ * @return The end of the constructed elements.
+ */
+template <
+	typename _Alloc,
+	typename _Type,
+	core::enable_if_t<
+		core::is_trivially_copyable_v< _Type > &&
+		__allocator_has_trivial_copy_construct< _Alloc, _Type >::value >* = nullptr >
+LLVM_MSTL_CONSTEXPR_SINCE_CXX20 auto __uninitialized_allocator_fill_n(
+	_Alloc&, _Type* __first, size_t __n, const _Type& __x ) -> _Type* {
+	if ( core::is_constant_evaluated() ) {
+		for ( size_t __i = 0; __i != __n; ++__i ) core::construct_at( __first + __i, __x );
+	} else if constexpr ( __simd_fillable< _Type > ) {
+		__simd_dispatch_fill( __first, __n, _Type( __x ) );//<--- `__x` may be one of the elements the fill is about to reach
+	} else {
+		core::uninitialized_fill_n( __first, __n, __x );
+	}
+	return __first + __n;
+}
+
+/**
+ * @brief Whether a source iterator has its elements contiguous in memory, at `__contiguous_address( __it )`.
+ *
+ * A `contiguous_iterator`, e.g. the iterators of `vector` and `span`, or a `move_iterator` over one.
+ */
+template < typename _Iter >
+inline LLVM_MSTL_CONSTEXPR bool __is_contiguous_source = core::contiguous_iterator< _Iter >;
+
+template < typename _Iter >
+inline LLVM_MSTL_CONSTEXPR bool __is_contiguous_source< core::move_iterator< _Iter > > = core::contiguous_iterator< _Iter >;
+
+template < typename _Iter >
+LLVM_MSTL_CONSTEXPR auto __contiguous_address( _Iter __it ) LLVM_MSTL_NOEXCEPT {
+	return core::to_address( __it );
+}
+
+template < typename _Iter >
+LLVM_MSTL_CONSTEXPR auto __contiguous_address( const core::move_iterator< _Iter >& __it ) LLVM_MSTL_NOEXCEPT {
+	return core::to_address( __it.base() );
+}
+
+/**
+ * @brief Whether `allocator_traits< _Alloc >::construct` copies a `_Type` as its bytes: the condition of the
+ * `const _Type*` overload of `__uninitialized_allocator_copy`.
+ *
+ * @tparam _Alloc The allocator type.
+ * @tparam _Type The element type.
+ */
+template < typename _Alloc, typename _Type >
+inline LLVM_MSTL_CONSTEXPR bool __is_trivially_allocator_copyable =
+	core::is_trivially_copy_constructible_v< _Type > && core::is_trivially_copy_assignable_v< _Type > &&
+	__allocator_has_trivial_copy_construct< _Alloc, _Type >::value;
+
+/**
+ * @brief Whether `[__first1, __last1)` can be copied into raw `_Iter2` storage as the `const _Type*` range of its
+ * addresses: contiguous elements of the type of the destination, which the `const _Type*` overload takes.
+ *
+ * Not when the source already is a `const _Type*` range, which has the overload of its own. Elements the
+ * overload would copy where the source hands out rvalues, e.g. of a move-only type, stay with the element-wise loop.
+ */
+template < typename _Alloc, typename _Iter1, typename _Sent1, typename _Iter2, typename _Type = core::remove_pointer_t< _Iter2 > >
+inline LLVM_MSTL_CONSTEXPR bool __is_contiguous_copy_source =
+	core::is_pointer_v< _Iter2 > && core::is_same_v< _Iter1, _Sent1 > && !core::is_same_v< _Iter1, const _Type* > &&
+	__is_contiguous_source< _Iter1 > && core::is_same_v< core::remove_cv_t< core::iter_value_t< _Iter1 > >, _Type > &&
+	core::is_trivially_constructible_v< _Type, core::iter_reference_t< _Iter1 > > && __is_trivially_allocator_copyable< _Alloc, _Type >;
+
+/**
+ * @brief Copy-construct a `const _Type*` range of trivially copyable objects: one `memmove` out of constant evaluation.
+ *
+ * Declared first: the overload for any iterators forwards contiguous ones to it.
+ */
+template <
+	typename _Alloc,
+	typename _Type,
+	typename _RawType = core::remove_const_t< _Type >,
+	core::enable_if_t< __is_trivially_allocator_copyable< _Alloc, _RawType > >* = nullptr >
+LLVM_MSTL_CONSTEXPR_SINCE_CXX20 auto __uninitialized_allocator_copy(
+	_Alloc&, const _Type* __first1, const _Type* __last1, _Type* __first2 ) -> _Type* {
+	if ( core::is_constant_evaluated() ) {
+		while ( __first1 != __last1 ) {
+			core::construct_at( core::to_address( __first2 ), *__first1 );
+			++__first1;
+			++__first2;
+		}
+		return __first2;
+	} else {
+		return core::copy( __first1, __last1, const_cast< _RawType* >( __first2 ) );
+	}
+}
+
 /**
  * @brief Copy-construct objects using an allocator and uninitialized memory.
  *
@@ -110,44 +248,28 @@ struct __allocator_has_trivial_copy_construct< core::allocator< _Type >, _Type >
 template < typename _Alloc, typename _Iter1, typename _Sent1, typename _Iter2 >
 LLVM_MSTL_CONSTEXPR_SINCE_CXX20 auto __uninitialized_allocator_copy(
 	_Alloc& __alloc, _Iter1 __first1, _Sent1 __last1, _Iter2 __first2 ) -> _Iter2 {
-	auto __destruct_first = __first2;
-	auto __guard          = __make_exception_guard(
-    _AllocatorDestroyRangeReverse< _Alloc, _Iter2 >( __alloc, __destruct_first, __first2 ) );
-	//!<--- When an exception occurs in the logical code below that
-	//!<--- causes the code to exit directly (without passing through '__guard.__complete()'),
-	//!<--- then the destruction procedure is executed, so that the resources
-	//!<--- in the requested [__last, __first2) interval can be released normally
-
-	//<--- This is the range of Iterator: [__first1, __last1)
-	//<--- We want to do that use the `__first1` to initialize the allocate address start at `__first2`'s address
-	while ( __first1 != __last1 ) {
-		core::allocator_traits< _Alloc >::construct( __alloc, core::to_address( __first2 ), *__first1 );
-		++__first1;
-		++__first2;
-	}
-	__guard.__complete();
-	return __first2;
-}
+	if constexpr ( __is_contiguous_copy_source< _Alloc, _Iter1, _Sent1, _Iter2 > ) {
+		//<--- to the `const _Type*` overload above, which copies trivially copyable elements with one `memmove`
+		const core::remove_pointer_t< _Iter2 >* __first = __contiguous_address( __first1 );
+		return __uninitialized_allocator_copy( __alloc, __first, __first + ( __last1 - __first1 ), __first2 );
+	} else {
+		auto __destruct_first = __first2;
+		auto __guard          = __make_exception_guard(
+			_AllocatorDestroyRangeReverse< _Alloc, _Iter2 >( __alloc, __destruct_first, __first2 ) );
+		//!<--- When an exception occurs in the logical code below that
+		//!<--- causes the code to exit directly (without passing through '__guard.__complete()'),
+		//!<--- then the destruction procedure is executed, so that the resources
+		//!<--- in the requested [__last, __first2) interval can be released normally
 
-template <
-	typename _Alloc,
-	typename _Type,
-	typename _RawType = core::remove_const_t< _Type >,
-	core::enable_if_t<
-		core::is_trivially_copy_constructible_v< _RawType > &&
-		core ::is_trivially_copy_assignable_v< _RawType > &&
-		__allocator_has_trivial_copy_construct< _Alloc, _RawType >::value >* = nullptr >
-LLVM_MSTL_CONSTEXPR_SINCE_CXX20 auto __uninitialized_allocator_copy(
-	_Alloc&, const _Type* __first1, const _Type* __last1, _Type* __first2 ) -> _Type* {
-	if ( core::is_constant_evaluated() ) {
+		//<--- This is the range of Iterator: [__first1, __last1)
+		//<--- We want to do that use the `__first1` to initialize the allocate address start at `__first2`'s address
 		while ( __first1 != __last1 ) {
-			core::construct_at( core::to_address( __first2 ), *__first1 );
+			core::allocator_traits< _Alloc >::construct( __alloc, core::to_address( __first2 ), *__first1 );
 			++__first1;
 			++__first2;
 		}
+		__guard.__complete();
 		return __first2;
-	} else {
-		return core::copy( __first1, __last1, const_cast< _RawType* >( __first2 ) );
 	}
 }
 
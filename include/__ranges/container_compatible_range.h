@@ -0,0 +1,27 @@
+#ifndef LLVM_MSTL_CONTAINER_COMPATIBLE_RANGE_H
+#define LLVM_MSTL_CONTAINER_COMPATIBLE_RANGE_H
+
+#include "__config.h"
+
+#include <concepts>
+#include <ranges>
+
+LLVM_MSTL_BEGIN_NAMESPACE_STD
+LLVM_MSTL_CORE_STD
+
+/**
+ * @brief A range whose elements can be used to construct the elements of a container of `_Tp`.
+ *
+ * @ref https://en.cppreference.com/w/cpp/ranges/to (container compatible range)
+ *
+ * @tparam _Range The range type.
+ * @tparam _Tp The value type of the container.
+ */
+template < typename _Range, typename _Tp >
+concept _ContainerCompatibleRange =
+	core::ranges::input_range< _Range > &&
+	core::convertible_to< core::ranges::range_reference_t< _Range >, _Tp >;
+
+LLVM_MSTL_END_NAMESPACE_STD
+
+#endif//LLVM_MSTL_CONTAINER_COMPATIBLE_RANGE_H
@@ -0,0 +1,27 @@
+#ifndef LLVM_MSTL_FROM_RANGE_H
+#define LLVM_MSTL_FROM_RANGE_H
+
+#include "__config.h"
+
+LLVM_MSTL_BEGIN_NAMESPACE_STD
+
+/**
+ * @brief Disambiguation tag for constructing a container from a range.
+ *
+ * @ref https://en.cppreference.com/w/cpp/ranges/from_range
+ *
+ * The C++23 `core::from_range_t` is not available in C++20, so the containers of the library use this one.
+ *
+ * @code{cc}
+ * nya::vector< int, core::allocator< int > > __v( nya::from_range, core::views::iota( 0, 10 ) );
+ * @endcode
+ */
+struct from_range_t {
+	explicit from_range_t() = default;
+};
+
+inline LLVM_MSTL_CONSTEXPR from_range_t from_range{};
+
+LLVM_MSTL_END_NAMESPACE_STD
+
+#endif//LLVM_MSTL_FROM_RANGE_H
@@ -6,9 +6,12 @@
 #include "__memory/allocate_at_least.h"
 #include "__memory/compress_pair.h"
 #include "__memory/swap_allocator.h"
+#include "__memory/uninitialized_algorithms.h"
+#include "__type_traits/is_trivially_relocatable.h"
 
 
 #include <algorithm>
+#include <cstring>
 #include <iterator>
 #include <memory>
 #include <type_traits>
@@ -52,6 +55,21 @@ public:
 	pointer                                      __end;     //<--- Pointer to the end of the constructed range.
 	__compressed_pair< pointer, allocator_type > __end_capm;//<--- '__end_capm.first' holds the reference to '__end',
 																													//<--- so here '__end_cap()' is modified to point to the last position of the element's last position
+	size_type __front_pushes = 0;//<--- The pushes at the front so far, they steer where '__make_room' puts the free slots.
+	size_type __back_pushes  = 0;//<--- The pushes at the back so far.
+
+	/**
+	* @brief Whether the elements can be moved around with `memmove`/`memcpy` instead of one by one.
+	*
+	* True when the value type is trivially relocatable (see @ref __is_trivially_relocatable), the pointer is a raw
+	* pointer and the allocator does not customize the construction.
+	*/
+	static LLVM_MSTL_CONSTEXPR bool __relocate_by_memmove =
+		__is_trivially_relocatable< value_type >::value && core::is_pointer_v< pointer > &&
+		__allocator_has_trivial_copy_construct< __alloc_rr, value_type >::value;
+
+	//<--- '__make_room' re-centers in place only if every side that is pushed to gets at least size() / __recenter_divisor slots
+	static LLVM_MSTL_CONSTEXPR size_type __recenter_divisor = 16;
 
 	using __alloc_ref       = core::add_lvalue_reference_t< allocator_type >;
 	using __alloc_const_ref = core::add_lvalue_reference_t< allocator_type >;
@@ -294,11 +312,8 @@ public:
 	* @brief Inserts an element at the beginning of the split buffer.
 	*
 	* This function inserts the element `__x` at the beginning of the split buffer. 
-	* If there is enough space before the beginning pointer `__begin`, the element is inserted directly by moving the existing elements 
-	* to make room. 
-	* If there is not enough space, a new split buffer `__t` is created with increased capacity. 
-	* The elements from the current buffer are moved to `__t` using move iterators and the `__construct_at_end` member function. 
-	* Then, the pointers and capacity of the current buffer are swapped with the corresponding values of `__t` to update the buffer. 
+	* If there is no free slot before the beginning pointer `__begin`, `__make_room` first lays the elements out again, 
+	* in place or in a larger allocation. 
 	* Finally, the element `__x` is constructed at the new beginning position.
 	*
 	* @param __x The element to be inserted at the beginning of the split buffer.
@@ -308,11 +323,8 @@ public:
 	* @brief Inserts an `rvalue element` at the beginning of the split buffer.
 	*
 	* This function inserts the rvalue element `__x` at the beginning of the split buffer. 
-	* If there is enough space before the beginning pointer `__begin`, the element is inserted directly by moving the existing elements 
-	* to make room. 
-	* If there is not enough space, a new split buffer `__t` is created with increased capacity. 
-	* The elements from the current buffer are moved to `__t` using move iterators and the `__construct_at_end` member function. 
-	* Then, the pointers and capacity of the current buffer are swapped with the corresponding values of `__t` to update the buffer. 
+	* If there is no free slot before the beginning pointer `__begin`, `__make_room` first lays the elements out again, 
+	* in place or in a larger allocation. 
 	* Finally, the rvalue element `__x` is constructed at the new beginning position.
 	*
 	* @param __x The rvalue element to be inserted at the beginning of the split buffer.
@@ -323,9 +335,7 @@ public:
 	*
 	* This function inserts the element `__x` at the end of the split buffer. 
 	* If there is enough space after the end pointer `__end`, the element is inserted directly by constructing it at `__end`. 
-	* If there is not enough space, a new split buffer `__t` is created with increased capacity. 
-	* The elements from the current buffer are moved to `__t` using move iterators and the `__construct_at_end` member function. 
-	* Then, the pointers and capacity of the current buffer are swapped with the corresponding values of `__t` to update the buffer. 
+	* Otherwise `__make_room` first lays the elements out again, in place or in a larger allocation. 
 	* Finally, the element `__x` is constructed at the new end position.
 	*
 	* @param __x The element to be inserted at the end of the split buffer.
@@ -336,9 +346,7 @@ public:
 	*
 	* This function inserts the rvalue element `__x` at the end of the split buffer. 
 	* If there is enough space after the end pointer `__end`, the element is inserted directly by constructing it at `__end`. 
-	* If there is not enough space, a new split buffer `__t` is created with increased capacity. 
-	* The elements from the current buffer are moved to `__t` using move iterators and the `__construct_at_end` member function. 
-	* Then, the pointers and capacity of the current buffer are swapped with the corresponding values of `__t` to update the buffer. 
+	* Otherwise `__make_room` first lays the elements out again, in place or in a larger allocation. 
 	* Finally, the rvalue element `__x` is constructed at the new end position.
 	*
 	* @param __x The rvalue element to be inserted at the end of the split buffer.
@@ -349,9 +357,7 @@ public:
 	*
 	* This function constructs an element at the end of the split buffer by forwarding the given arguments `__args`. 
 	* If there is enough space after the end pointer `__end`, the element is constructed directly at `__end`. 
-	* If there is not enough space, a new split buffer `__t` is created with increased capacity. 
-	* The elements from the current buffer are moved to `__t` using move iterators and the `__construct_at_end` member function. 
-	* Then, the pointers and capacity of the current buffer are swapped with the corresponding values of `__t` to update the buffer. 
+	* Otherwise `__make_room` first lays the elements out again, in place or in a larger allocation. 
 	* Finally, the element is constructed at the new end position by forwarding the arguments `__args`.
 	*
 	* @tparam _Args The types of the arguments used to construct the element.
@@ -391,6 +397,42 @@ public:
 			!__alloc_traits::propagate_on_container_swap::value ||
 			core::is_nothrow_swappable_v< __alloc_rr > );
 
+	/********************************		Recentering		**************************************/
+	/**
+	* @brief Frees at least one slot before `__begin` (`__at_front`) or after `__end`, in amortized O(1).
+	*
+	* The free slots are split between the two sides in proportion to the pushes seen at each end (see
+	* `__front_room`), so a buffer only ever pushed at the front gives all of them to the front. The elements are then
+	* shifted in place if that leaves every side that is pushed to at least `size() / __recenter_divisor` free slots:
+	* the O(n) shift is paid for by as many pushes before the same side runs out again. Otherwise the buffer moves to
+	* an allocation of twice the capacity, split the same way. Alternating pushes at both ends thus cannot degrade
+	* into a shift per push, which halving the other side's spare on every shift did.
+	*
+	* @param __at_front The side that needs the slot.
+	*/
+	LLVM_MSTL_CONSTEXPR_SINCE_CXX20 auto __make_room( bool __at_front ) -> void;
+	/**
+	* @brief The number of the `__spare` free slots to put before the elements when they are laid out again.
+	*
+	* A side never pushed to gets nothing; otherwise each side gets its share of the pushes, rounded to eighths and
+	* kept between 1/8 and 7/8, and the side `__at_front` designates gets at least one slot.
+	*/
+	LLVM_MSTL_CONSTEXPR_SINCE_CXX20 auto __front_room( size_type __spare, bool __at_front ) const LLVM_MSTL_NOEXCEPT->size_type;
+	/**
+	* @brief Moves the elements within the storage so that they start at `__to`.
+	*
+	* Trivially relocatable elements are moved with one `memmove`. Others are move-constructed into the free slots
+	* they enter and move-assigned over the elements they pass, and the slots they leave are destroyed.
+	*/
+	LLVM_MSTL_CONSTEXPR_SINCE_CXX20 auto __shift_to( pointer __to ) -> void;
+	/**
+	* @brief Moves the elements to a new allocation of `__cap` slots, `__front` of them before the elements.
+	*
+	* Trivially relocatable elements are copied with one `memcpy`; others are moved if that cannot throw and copied
+	* otherwise, so the buffer is left untouched if the reallocation fails.
+	*/
+	LLVM_MSTL_CONSTEXPR_SINCE_CXX20 auto __relocate_to( size_type __cap, size_type __front ) -> void;
+
 	/********************************		Help Constructor		**************************************/
 	/**
 	* @brief Constructs and initializes elements at the end of the split buffer.
@@ -684,7 +726,9 @@ LLVM_MSTL_CONSTEXPR_SINCE_CXX20 __split_buffer< _Tp, _Allocator >::__split_buffe
 		: __first( core::move( __c.__first ) )
 		, __begin( core::move( __c.__begin ) )
 		, __end( core::move( __c.__end ) )
-		, __end_capm( core::move( __c.__end_capm ) ) {
+		, __end_capm( core::move( __c.__end_capm ) )
+		, __front_pushes( __c.__front_pushes )
+		, __back_pushes( __c.__back_pushes ) {
 	__c.__first     = nullptr;
 	__c.__begin     = nullptr;
 	__c.__end       = nullptr;
@@ -735,6 +779,8 @@ LLVM_MSTL_CONSTEXPR_SINCE_CXX20
 	__begin     = __c.__begin;
 	__end       = __c.__end;
 	__end_cap() = __c.__end_cap();
+	__front_pushes = __c.__front_pushes;
+	__back_pushes  = __c.__back_pushes;
 	__move_assign_alloc( __c, core::integral_constant< bool, __alloc_traits::propagate_on_container_move_assignment::value >() );
 	__c.__first = __c.__begin = __c.__end = __c.__end_cap() = nullptr;
 	return *this;
@@ -773,50 +819,16 @@ LLVM_MSTL_CONSTEXPR_SINCE_CXX20 auto __split_buffer< _Tp, _Allocator >::shrink_t
 
 template < typename _Tp, typename _Allocator >
 LLVM_MSTL_CONSTEXPR_SINCE_CXX20 auto __split_buffer< _Tp, _Allocator >::push_front( const_reference __x ) {
-	if ( __begin == __first ) {
-		if ( __end < __end_cap() ) {
-			difference_type __d = __end_cap() - __end;
-			__d                 = ( __d + 1 ) / 2;
-			__begin             = core::move_backward( __begin, __end, __end + __d );
-			__end += __d;
-		} else {
-			size_type __c =
-				core::max< size_type >( 2 * static_cast< size_t >( __end_cap() - __first ), 1 );
-			__split_buffer< value_type, __alloc_rr& > __t( __c, ( __c + 3 ) / 4, __alloc() );
-			__t.__construct_at_end(
-				core::move_iterator< pointer >( __begin ),
-				core::move_iterator< pointer >( __end ) );
-			core::swap( __first, __t.__first );
-			core::swap( __begin, __t.__begin );
-			core::swap( __end, __t.__end );
-			core::swap( __end_cap(), __t.__end_cap() );
-		}
-	}
+	++__front_pushes;
+	if ( __begin == __first ) __make_room( true );
 	__alloc_traits::construct( __alloc(), core::to_address( __begin - 1 ), __x );
 	--__begin;
 }
 
 template < typename _Tp, typename _Alloctor >
 LLVM_MSTL_CONSTEXPR_SINCE_CXX20 auto __split_buffer< _Tp, _Alloctor >::push_front( value_type&& __x ) {
-	if ( __begin == __first ) {
-		if ( __end < __end_cap() ) {
-			difference_type __d = __end_cap() - __end;
-			__d                 = ( __d + 1 ) / 2;
-			__begin             = core::move_backward( __begin, __end, __end + __d );
-			__end += __d;
-		} else {
-			size_type __c =
-				core::max< size_type >( 2 * static_cast< size_t >( __end_cap() - __first ), 1 );
-			__split_buffer< value_type, __alloc_rr& > __t( __c, ( __c + 3 ) / 4, __alloc() );
-			__t.__construct_at_end(
-				core::move_iterator< pointer >( __begin ),
-				core::move_iterator< pointer >( __end ) );
-			core::swap( __first, __t.__first );
-			core::swap( __begin, __t.__begin );
-			core::swap( __end, __t.__end );
-			core::swap( __end_cap(), __t.__end_cap() );
-		}
-	}
+	++__front_pushes;
+	if ( __begin == __first ) __make_room( true );
 	__alloc_traits::construct( __alloc(), core::to_address( __begin - 1 ), core::move( __x ) );
 	--__begin;
 }
@@ -825,25 +837,8 @@ template < typename _Tp, typename _Allocator >
 LLVM_MSTL_CONSTEXPR_SINCE_CXX20
 	LLVM_MSTL_TEMPLATE_INLINE auto
 	__split_buffer< _Tp, _Allocator >::push_back( const_reference __x ) {
-	if ( __end == __end_cap() ) {
-		if ( __begin > __first ) {
-			difference_type __d = __begin - __first;
-			__d                 = ( __d + 1 ) / 2;
-			__end               = core::move( __begin, __end, __begin - __d );
-			__begin             = __begin - __d;
-		} else {
-			size_type __c =
-				core::max< size_type >( 2 * static_cast< size_t >( __end_cap() - __first ), 1 );
-			__split_buffer< value_type, __alloc_rr& > __t( __c, __c / 4, __alloc() );
-			__t.__construct_at_end(
-				core::move_iterator< pointer >( __begin ),
-				core::move_iterator< pointer >( __end ) );
-			core::swap( __first, __t.__first );
-			core::swap( __begin, __t.__begin );
-			core::swap( __end, __t.__end );
-			core::swap( __end_cap(), __t.__end_cap() );
-		}
-	}
+	++__back_pushes;
+	if ( __end == __end_cap() ) __make_room( false );
 	__alloc_traits::construct( __alloc(), core::to_address( __end ), __x );
 	++__end;
 }
@@ -852,25 +847,8 @@ template < typename _Tp, typename _Allocator >
 LLVM_MSTL_CONSTEXPR_SINCE_CXX20
 	LLVM_MSTL_TEMPLATE_INLINE auto
 	__split_buffer< _Tp, _Allocator >::push_back( value_type&& __x ) {
-	if ( __end == __end_cap() ) {
-		if ( __begin > __first ) {
-			difference_type __d = __begin - __first;
-			__d                 = ( __d + 1 ) / 2;
-			__end               = core::move( __begin, __end, __begin - __d );
-			__begin             = __begin - __d;
-		} else {
-			size_type __c =
-				core::max< size_type >( 2 * static_cast< size_t >( __end_cap() - __first ), 1 );
-			__split_buffer< value_type, __alloc_rr& > __t( __c, __c / 4, __alloc() );
-			__t.__construct_at_end(
-				core::move_iterator< pointer >( __begin ),
-				core::move_iterator< pointer >( __end ) );
-			core::swap( __first, __t.__first );
-			core::swap( __begin, __t.__begin );
-			core::swap( __end, __t.__end );
-			core::swap( __end_cap(), __t.__end_cap() );
-		}
-	}
+	++__back_pushes;
+	if ( __end == __end_cap() ) __make_room( false );
 	__alloc_traits::construct( __alloc(), core::to_address( __end ), core::move( __x ) );
 	++__end;
 }
@@ -878,25 +856,8 @@ LLVM_MSTL_CONSTEXPR_SINCE_CXX20
 template < typename _Tp, typename _Allocator >
 template < typename... _Args >
 LLVM_MSTL_CONSTEXPR_SINCE_CXX20 auto __split_buffer< _Tp, _Allocator >::emplace_back( _Args&&... __args ) {
-	if ( __end == __end_cap() ) {
-		if ( __begin > __first ) {
-			difference_type __d = __begin - __first;
-			__d                 = ( __d + 1 ) / 2;
-			__end               = core::move( __begin, __end, __begin - __d );
-			__begin             = __begin - __d;
-		} else {
-			size_type __c =
-				core::max< size_type >( 2 * static_cast< size_t >( __end_cap() - __first ), 1 );
-			__split_buffer< value_type, __alloc_rr& > __t( __c, __c / 4, __alloc() );
-			__t.__construct_at_end(
-				core::move_iterator< pointer >( __begin ),
-				core::move_iterator< pointer >( __end ) );
-			core::swap( __first, __t.__first );
-			core::swap( __begin, __t.__begin );
-			core::swap( __end, __t.__end );
-			core::swap( __end_cap(), __t.__end_cap() );
-		}
-	}
+	++__back_pushes;
+	if ( __end == __end_cap() ) __make_room( false );
 	__alloc_traits::construct( __alloc(), core::to_address( __end ), core::forward< _Args >( __args )... );
 	++__end;
 }
@@ -910,23 +871,127 @@ LLVM_MSTL_CONSTEXPR_SINCE_CXX20 auto __split_buffer< _Tp, _Allocator >::swap( __
 	core::swap( __begin, __x.__begin );
 	core::swap( __end, __x.__end );
 	core::swap( __end_cap(), __x.__end_cap() );
+	core::swap( __front_pushes, __x.__front_pushes );
+	core::swap( __back_pushes, __x.__back_pushes );
 	__swap_allocator( __alloc(), __x.__alloc() );
 }
 
+/*************************************		Recentering		****************************************/
+template < typename _Tp, typename _Allocator >
+LLVM_MSTL_CONSTEXPR_SINCE_CXX20 auto __split_buffer< _Tp, _Allocator >::__make_room( bool __at_front ) -> void {
+	const size_type __sz       = size();
+	const size_type __cap      = capacity();
+	const size_type __front    = __front_room( __cap - __sz, __at_front );
+	const size_type __back     = __cap - __sz - __front;
+	const size_type __min_room = __sz / __recenter_divisor;
+
+	const bool __in_place =
+		( __at_front ? __front : __back ) >= core::max< size_type >( __min_room, 1 ) &&
+		( ( __at_front ? __back_pushes : __front_pushes ) == 0 || ( __at_front ? __back : __front ) >= __min_room );
+	if ( __in_place ) {
+		__shift_to( __first + __front );
+	} else {
+		const size_type __c = core::max< size_type >( 2 * __cap, 1 );
+		__relocate_to( __c, __front_room( __c - __sz, __at_front ) );
+	}
+}
+
+template < typename _Tp, typename _Allocator >
+LLVM_MSTL_CONSTEXPR_SINCE_CXX20 auto __split_buffer< _Tp, _Allocator >::__front_room( size_type __spare, bool __at_front ) const
+	LLVM_MSTL_NOEXCEPT->size_type {
+	size_type __front = __spare;
+	if ( __front_pushes == 0 ) __front = 0;
+	else if ( __back_pushes != 0 ) {
+		const size_type __pushes = __front_pushes + __back_pushes;
+		const size_type __eighths =
+			core::clamp< size_type >( ( 8 * __front_pushes + __pushes / 2 ) / __pushes, 1, 7 );
+		__front = __spare / 8 * __eighths + __spare % 8 * __eighths / 8;
+	}
+	if ( __spare != 0 ) {
+		if ( __at_front && __front == 0 ) __front = 1;
+		if ( !__at_front && __front == __spare ) __front = __spare - 1;
+	}
+	return __front;
+}
+
+template < typename _Tp, typename _Allocator >
+LLVM_MSTL_CONSTEXPR_SINCE_CXX20 auto __split_buffer< _Tp, _Allocator >::__shift_to( pointer __to ) -> void {
+	const pointer         __old_begin = __begin;
+	const pointer         __old_end   = __end;
+	const difference_type __n         = __old_end - __old_begin;
+	if ( __to == __old_begin ) return;
+	if constexpr ( __relocate_by_memmove ) {
+		if ( !core::is_constant_evaluated() ) {
+			if ( __n != 0 ) core::memmove( static_cast< void* >( __to ), static_cast< const void* >( __old_begin ), static_cast< size_t >( __n ) * sizeof( value_type ) );
+			__begin = __to;
+			__end   = __to + __n;
+			return;
+		}
+	}
+	if ( __to < __old_begin ) {
+		pointer __d = __to;
+		for ( pointer __s = __old_begin; __s != __old_end; ++__s, (void) ++__d ) {
+			if ( __d < __old_begin ) __alloc_traits::construct( __alloc(), core::to_address( __d ), core::move( *__s ) );
+			else *__d = core::move( *__s );
+		}
+		__destruct_at_end( core::max( __d, __old_begin ) );
+	} else {
+		pointer __d = __to + __n;
+		for ( pointer __s = __old_end; __s != __old_begin; ) {
+			--__s;
+			--__d;
+			if ( __old_end <= __d ) __alloc_traits::construct( __alloc(), core::to_address( __d ), core::move( *__s ) );
+			else *__d = core::move( *__s );
+		}
+		__destruct_at_begin( core::min( __to, __old_end ) );
+	}
+	__begin = __to;
+	__end   = __to + __n;
+}
+
+template < typename _Tp, typename _Allocator >
+LLVM_MSTL_CONSTEXPR_SINCE_CXX20 auto __split_buffer< _Tp, _Allocator >::__relocate_to( size_type __cap, size_type __front ) -> void {
+	__split_buffer< value_type, __alloc_rr& > __t( __cap, __front, __alloc() );
+	if constexpr ( __relocate_by_memmove ) {
+		if ( !core::is_constant_evaluated() ) {
+			const size_type __n = size();
+			if ( __n != 0 ) core::memcpy( static_cast< void* >( __t.__end ), static_cast< const void* >( __begin ), __n * sizeof( value_type ) );
+			__t.__end += __n;
+			__end = __begin;//<--- the bytes now live in '__t', there is nothing left to destroy
+		} else {
+			__t.__end = __uninitialized_allocator_move_if_noexcept( __alloc(), __begin, __end, __t.__end );
+		}
+	} else {
+		__t.__end = __uninitialized_allocator_move_if_noexcept( __alloc(), __begin, __end, __t.__end );
+	}
+	core::swap( __first, __t.__first );
+	core::swap( __begin, __t.__begin );
+	core::swap( __end, __t.__end );
+	core::swap( __end_cap(), __t.__end_cap() );
+}
+
 /********************************		Help Constructor		**************************************/
 template < typename _Tp, typename _Allocator >
 LLVM_MSTL_CONSTEXPR_SINCE_CXX20 auto __split_buffer< _Tp, _Allocator >::__construct_at_end( size_type __n ) {
 	_ConstructTransaction __tx( &this->__end, __n );
-	for ( ; __tx.__pos != __tx.__end; ++__tx.__pos ) {
-		__alloc_traits::construct( this->__alloc(), core::to_address( __tx.__pos ) );
+	if constexpr ( requires { __uninitialized_allocator_value_construct_n( this->__alloc(), __tx.__pos, __n ); } ) {
+		__tx.__pos = __uninitialized_allocator_value_construct_n( this->__alloc(), __tx.__pos, __n );
+	} else {
+		for ( ; __tx.__pos != __tx.__end; ++__tx.__pos ) {
+			__alloc_traits::construct( this->__alloc(), core::to_address( __tx.__pos ) );
+		}
 	}
 }
 
 template < typename _Tp, typename _Allocator >
 LLVM_MSTL_CONSTEXPR_SINCE_CXX20 auto __split_buffer< _Tp, _Allocator >::__construct_at_end( size_type __n, const_reference __x ) {
 	_ConstructTransaction __tx( &this->__end, __n );
-	for ( ; __tx.__pos != __tx.__end; ++__tx.__pos ) {
-		__alloc_traits::construct( this->__alloc(), core::to_address( __tx.__pos ), __x );
+	if constexpr ( requires { __uninitialized_allocator_fill_n( this->__alloc(), __tx.__pos, __n, __x ); } ) {
+		__tx.__pos = __uninitialized_allocator_fill_n( this->__alloc(), __tx.__pos, __n, __x );
+	} else {
+		for ( ; __tx.__pos != __tx.__end; ++__tx.__pos ) {
+			__alloc_traits::construct( this->__alloc(), core::to_address( __tx.__pos ), __x );
+		}
 	}
 }
 
@@ -955,9 +1020,7 @@ template < typename _ForwardIter >
 LLVM_MSTL_CONSTEXPR_SINCE_CXX20 auto __split_buffer< _Tp, _Allocator >::__construct_at_end( _ForwardIter __fst, _ForwardIter __last )
 	-> core::enable_if_t< __is_cpp17_forward_iterator< _ForwardIter >::value > {
 	_ConstructTransaction __tx( &this->__end, (size_type) core::distance( __fst, __last ) );
-	for ( ; __tx.__pos != __tx.__end; ++__tx.__pos, (void) ++__fst ) {
-		__alloc_traits::construct( this->__alloc(), core::to_address( __tx.__pos ), *__fst );
-	}
+	__tx.__pos = __uninitialized_allocator_copy( this->__alloc(), __fst, __last, __tx.__pos );//<--- a `memmove` from contiguous sources
 }
 
 template < typename _Tp, typename _Allocator >
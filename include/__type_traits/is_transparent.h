@@ -0,0 +1,24 @@
+#ifndef LLVM_MSTL_IS_TRANSPARENT_H
+#define LLVM_MSTL_IS_TRANSPARENT_H
+
+#include "__config.h"
+#include "__type_traits/void_t.h"
+
+#include <type_traits>
+
+LLVM_MSTL_BEGIN_NAMESPACE_STD
+LLVM_MSTL_CORE_STD
+
+/**
+ * @brief `true` if the comparator `_Compare` declares `is_transparent`, i.e. accepts keys of any type,
+ * which enables the heterogeneous lookup overloads of the ordered containers.
+ */
+template < typename _Compare, typename = void >
+inline LLVM_MSTL_CONSTEXPR bool __is_transparent_v = false;
+
+template < typename _Compare >
+inline LLVM_MSTL_CONSTEXPR bool __is_transparent_v< _Compare, __void_t< typename _Compare::is_transparent > > = true;
+
+LLVM_MSTL_END_NAMESPACE_STD
+
+#endif//LLVM_MSTL_IS_TRANSPARENT_H
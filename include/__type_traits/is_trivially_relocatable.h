@@ -0,0 +1,29 @@
+#ifndef LLVM_MSTL_IS_TRIVIALLY_RELOCATABLE_H
+#define LLVM_MSTL_IS_TRIVIALLY_RELOCATABLE_H
+
+#include "__config.h"
+#include <type_traits>
+
+LLVM_MSTL_BEGIN_NAMESPACE_STD
+LLVM_MSTL_CORE_STD
+
+/**
+ * @brief Whether an object of `_Tp` can be moved to new storage by copying its bytes, the old bytes then being dropped.
+ *
+ * That holds for every trivially copyable type. A class can opt in with `using __trivially_relocatable = _Self;`
+ * when its move constructor followed by the destruction of the source is equivalent to a `memcpy`, e.g. a
+ * `unique_ptr`-like owner that does not point into itself.
+ *
+ * @tparam _Tp The type to check.
+ */
+template < typename _Tp, typename = void >
+struct __is_trivially_relocatable : core::is_trivially_copyable< _Tp > {};
+
+template < typename _Tp >
+struct __is_trivially_relocatable<
+	_Tp,
+	core::enable_if_t< core::is_same_v< _Tp, typename _Tp::__trivially_relocatable > > > : core::true_type {};
+
+LLVM_MSTL_END_NAMESPACE_STD
+
+#endif//LLVM_MSTL_IS_TRIVIALLY_RELOCATABLE_H
@@ -0,0 +1,31 @@
+#ifndef LLVM_MSTL_IS_ZERO_INITIALIZABLE_H
+#define LLVM_MSTL_IS_ZERO_INITIALIZABLE_H
+
+#include "__config.h"
+#include <type_traits>
+
+LLVM_MSTL_BEGIN_NAMESPACE_STD
+LLVM_MSTL_CORE_STD
+
+/**
+ * @brief Whether a value-initialized `_Tp` is all zero bytes, so storage can be value-initialized by a `memset`.
+ *
+ * That holds for the arithmetic, enumeration and object pointer types on the targets of the library. Not for the
+ * pointers to data members, whose null value is `-1` in the Itanium ABI, nor for the classes, which may hold one.
+ * A class can opt in with `using __zero_initializable = _Self;` when its value-initialization only zeroes it.
+ *
+ * @tparam _Tp The type to check.
+ */
+template < typename _Tp, typename = void >
+struct __is_zero_initializable
+		: core::bool_constant< core::is_arithmetic_v< _Tp > || core::is_enum_v< _Tp > || core::is_pointer_v< _Tp > ||
+													 core::is_null_pointer_v< _Tp > > {};
+
+template < typename _Tp >
+struct __is_zero_initializable<
+	_Tp,
+	core::enable_if_t< core::is_same_v< _Tp, typename _Tp::__zero_initializable > > > : core::is_trivially_copyable< _Tp > {};
+
+LLVM_MSTL_END_NAMESPACE_STD
+
+#endif//LLVM_MSTL_IS_ZERO_INITIALIZABLE_H
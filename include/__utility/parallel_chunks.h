@@ -0,0 +1,67 @@
+#ifndef LLVM_MSTL_PARALLEL_CHUNKS_H
+#define LLVM_MSTL_PARALLEL_CHUNKS_H
+
+#include "__config.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <exception>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+LLVM_MSTL_BEGIN_NAMESPACE_STD
+LLVM_MSTL_CORE_STD
+
+/**
+ * @brief The number of chunks @ref __parallel_chunks splits `[0, __n)` into for `__jobs` requested jobs.
+ */
+inline auto __parallel_jobs( size_t __jobs, size_t __n ) LLVM_MSTL_NOEXCEPT->size_t {
+	if ( __jobs == 0 ) __jobs = core::max< size_t >( 1, core::thread::hardware_concurrency() );
+	return core::max< size_t >( 1, core::min( __jobs, __n ) );
+}
+
+/**
+ * @brief Splits `[0, __n)` into `__jobs` contiguous chunks and runs `__f( __job, __first, __last )` on each, one thread per chunk.
+ *
+ * The calling thread runs the first chunk; with one job, or nothing to split, no thread is started. The first
+ * exception thrown by a chunk is rethrown once all the chunks are done.
+ *
+ * @param __jobs The number of chunks, 0 means `core::thread::hardware_concurrency()`.
+ * @param __n The size of the index range.
+ * @param __f The work of one chunk, called with the index of the chunk and its bounds.
+ * @return The number of chunks run, see @ref __parallel_jobs.
+ */
+template < typename _Fn >
+auto __parallel_chunks( size_t __jobs, size_t __n, _Fn&& __f ) -> size_t {
+	__jobs = __parallel_jobs( __jobs, __n );
+	if ( __jobs == 1 ) {
+		__f( size_t( 0 ), size_t( 0 ), __n );
+		return 1;
+	}
+
+	const size_t        __chunk = ( __n + __jobs - 1 ) / __jobs;
+	core::exception_ptr __error;
+	core::mutex         __error_lock;
+	const auto          __run = [ & ]( size_t __job ) {
+		const size_t __first = core::min( __n, __job * __chunk );
+		try {
+			__f( __job, __first, core::min( __n, __first + __chunk ) );
+		} catch ( ... ) {
+			const core::lock_guard< core::mutex > __lock( __error_lock );
+			if ( !__error ) __error = core::current_exception();
+		}
+	};
+	{
+		core::vector< core::jthread > __threads;
+		__threads.reserve( __jobs - 1 );
+		for ( size_t __job = 1; __job < __jobs; ++__job ) __threads.emplace_back( __run, __job );
+		__run( 0 );
+	}//<--- the threads join here
+	if ( __error ) core::rethrow_exception( __error );
+	return __jobs;
+}
+
+LLVM_MSTL_END_NAMESPACE_STD
+
+#endif//LLVM_MSTL_PARALLEL_CHUNKS_H
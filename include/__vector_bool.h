@@ -0,0 +1,912 @@
+#ifndef LLVM_MSTL_VECTOR_BOOL_H
+#define LLVM_MSTL_VECTOR_BOOL_H
+
+/**
+ * @file __vector_bool.h
+ * @brief The bit-packed `vector< bool, _Allocator >` specialization, included by `vector.hpp`.
+ */
+
+#include "__bit_reference.h"
+#include "__config.h"
+#include "__iterator/iterator_traits.h"
+#include "__memory/allocate_at_least.h"
+#include "__memory/compress_pair.h"
+#include "__memory/swap_allocator.h"
+#include "__ranges/container_compatible_range.h"
+#include "__ranges/from_range.h"
+#include "__utility/exception_guard.h"
+#include "stdexcept.h"
+
+#include "spdlog/spdlog.h"
+
+#include <algorithm>
+#include <climits>
+#include <initializer_list>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <ranges>
+#include <type_traits>
+
+LLVM_MSTL_BEGIN_NAMESPACE_STD
+LLVM_MSTL_CORE_STD
+
+/**
+ * @brief Bit-packed vector of `bool`.
+ *
+ * @ref https://en.cppreference.com/w/cpp/container/vector_bool
+ *
+ * The flags are stored one bit each in words of `size_type`, so the container takes 1/8 of the memory of a
+ * byte-per-flag vector. Element access goes through the proxy `__bit_reference`; the algorithms in
+ * `__bit_reference.h` (`count`, `find`, `fill`, `copy`, `equal`) and the members `flip` and `operator==` work on
+ * whole words.
+ *
+ * Invariant: every word holding at least one element bit is initialized. The bits past `size()` in the last word
+ * have unspecified values and are masked out by every algorithm.
+ *
+ * @tparam _Allocator The allocator type, rebound to `size_type` for the storage.
+ */
+template < typename _Allocator >
+class LLVM_MSTL_TEMPLATE_VIS vector< bool, _Allocator > {
+public:
+	using __self          = vector;
+	using value_type      = bool;
+	using allocator_type  = _Allocator;
+	using __alloc_traits  = core::allocator_traits< allocator_type >;
+	using size_type       = typename __alloc_traits::size_type;
+	using difference_type = typename __alloc_traits::difference_type;
+
+	using __storage_type          = size_type;
+	using __storage_allocator     = typename __alloc_traits::template rebind_alloc< __storage_type >;
+	using __storage_traits        = core::allocator_traits< __storage_allocator >;
+	using __storage_pointer       = typename __storage_traits::pointer;
+	using __const_storage_pointer = typename __storage_traits::const_pointer;
+
+	static LLVM_MSTL_CONSTEXPR unsigned __bits_per_word = static_cast< unsigned >( sizeof( __storage_type ) * CHAR_BIT );
+
+	using reference              = __bit_reference< vector >;
+	using const_reference        = bool;
+	using iterator               = __bit_iterator< vector, false >;
+	using const_iterator         = __bit_iterator< vector, true >;
+	using pointer                = iterator;
+	using const_pointer          = const_iterator;
+	using reverse_iterator       = core::reverse_iterator< iterator >;
+	using const_reverse_iterator = core::reverse_iterator< const_iterator >;
+
+	static_assert(
+		core::is_same_v< typename allocator_type::value_type, value_type >,
+		"Allocator::value_type must be same type as value_type" );
+
+	/*************************************************************************************
+	 *                                                                                   *
+	 *															CONSTRUCTOR BEGIN		                                 *
+	 *                                                                                   *
+	 *************************************************************************************/
+
+	LLVM_MSTL_CONSTEXPR_SINCE_CXX20 vector()
+		LLVM_MSTL_NOEXCEPT_V( core::is_nothrow_default_constructible_v< allocator_type > ) {}
+
+	LLVM_MSTL_CONSTEXPR_SINCE_CXX20 explicit vector( const allocator_type& __a ) LLVM_MSTL_NOEXCEPT
+			: __cap_alloc( 0, static_cast< __storage_allocator >( __a ) ) {}
+
+	LLVM_MSTL_CONSTEXPR_SINCE_CXX20 explicit vector( size_type __n );
+	LLVM_MSTL_CONSTEXPR_SINCE_CXX20 explicit vector( size_type __n, const allocator_type& __a );
+	LLVM_MSTL_CONSTEXPR_SINCE_CXX20 vector( size_type __n, const value_type& __x );
+	LLVM_MSTL_CONSTEXPR_SINCE_CXX20 vector( size_type __n, const value_type& __x, const allocator_type& __a );
+
+	template <
+		typename _InputIterator,
+		core::enable_if_t< __is_exactly_cpp17_input_iterator< _InputIterator >::value, int > = 0 >
+	LLVM_MSTL_CONSTEXPR_SINCE_CXX20 vector( _InputIterator __first, _InputIterator __last, const allocator_type& __a = allocator_type() );
+
+	template <
+		typename _ForwardIterator,
+		core::enable_if_t< __is_cpp17_forward_iterator< _ForwardIterator >::value, int > = 0 >
+	LLVM_MSTL_CONSTEXPR_SINCE_CXX20 vector( _ForwardIterator __first, _ForwardIterator __last, const allocator_type& __a = allocator_type() );
+
+	template < _ContainerCompatibleRange< bool > _Range >
+	LLVM_MSTL_CONSTEXPR_SINCE_CXX20 vector( from_range_t, _Range&& __range, const allocator_type& __a = allocator_type() );
+
+	LLVM_MSTL_CONSTEXPR_SINCE_CXX20 vector( const vector& __v );
+	LLVM_MSTL_CONSTEXPR_SINCE_CXX20 vector( const vector& __v, const core::type_identity_t< allocator_type >& __a );
+	LLVM_MSTL_CONSTEXPR_SINCE_CXX20 vector( vector&& __v ) LLVM_MSTL_NOEXCEPT;
+	LLVM_MSTL_CONSTEXPR_SINCE_CXX20 vector( vector&& __v, const core::type_identity_t< allocator_type >& __a );
+	LLVM_MSTL_CONSTEXPR_SINCE_CXX20 vector( core::initializer_list< value_type > __il, const allocator_type& __a = allocator_type() );
+
+	LLVM_MSTL_CONSTEXPR_SINCE_CXX20 ~vector() { __vdeallocate(); }
+
+	/*************************************************************************************
+	 *                                                                                   *
+	 *																CONSTRUCTOR END			                               *
+	 *                                                                                   *
+	 *************************************************************************************/
+
+	LLVM_MSTL_CONSTEXPR_SINCE_CXX20 auto operator=( const vector& __v ) -> vector&;
+	LLVM_MSTL_CONSTEXPR_SINCE_CXX20 auto operator=( vector&& __v )
+		LLVM_MSTL_NOEXCEPT_V(
+			__storage_traits::propagate_on_container_move_assignment::value ||
+			__storage_traits::is_always_equal::value ) -> vector&;
+	LLVM_MSTL_CONSTEXPR_SINCE_CXX20 auto operator=( core::initializer_list< value_type > __il ) -> vector& {
+		assign( __il.begin(), __il.end() );
+		return *this;
+	}
+
+	LLVM_MSTL_CONSTEXPR_SINCE_CXX20 auto assign( size_type __n, const value_type& __x ) -> void;
+
+	template <
+		typename _InputIterator,
+		core::enable_if_t< __is_exactly_cpp17_input_iterator< _InputIterator >::value, int > = 0 >
+	LLVM_MSTL_CONSTEXPR_SINCE_CXX20 auto assign( _InputIterator __first, _InputIterator __last ) -> void;
+
+	template <
+		typename _ForwardIterator,
+		core::enable_if_t< __is_cpp17_forward_iterator< _ForwardIterator >::value, int > = 0 >
+	LLVM_MSTL_CONSTEXPR_SINCE_CXX20 auto assign( _ForwardIterator __first, _ForwardIterator __last ) -> void;
+
+	LLVM_MSTL_CONSTEXPR_SINCE_CXX20 auto assign( core::initializer_list< value_type > __il ) -> void {
+		assign( __il.begin(), __il.end() );
+	}
+
+	LLVM_MSTL_CONSTEXPR_SINCE_CXX20 auto get_allocator() const LLVM_MSTL_NOEXCEPT->allocator_type {
+		return allocator_type( __alloc() );
+	}
+
+	/*************************************************************************************
+	 *                                                                                   *
+	 *																ITERATOR BEGIN			                               *
+	 *                                                                                   *
+	 *************************************************************************************/
+
+	LLVM_MSTL_CONSTEXPR_SINCE_CXX20 auto begin() LLVM_MSTL_NOEXCEPT->iterator { return __make_iter( 0 ); }
+	LLVM_MSTL_CONSTEXPR_SINCE_CXX20 auto begin() const LLVM_MSTL_NOEXCEPT->const_iterator { return __make_iter( 0 ); }
+	LLVM_MSTL_CONSTEXPR_SINCE_CXX20 auto end() LLVM_MSTL_NOEXCEPT->iterator { return __make_iter( __size ); }
+	LLVM_MSTL_CONSTEXPR_SINCE_CXX20 auto end() const LLVM_MSTL_NOEXCEPT->const_iterator { return __make_iter( __size ); }
+	LLVM_MSTL_CONSTEXPR_SINCE_CXX20 auto cbegin() const LLVM_MSTL_NOEXCEPT->const_iterator { return begin(); }
+	LLVM_MSTL_CONSTEXPR_SINCE_CXX20 auto cend() const LLVM_MSTL_NOEXCEPT->const_iterator { return end(); }
+
+	LLVM_MSTL_CONSTEXPR_SINCE_CXX20 auto rbegin() LLVM_MSTL_NOEXCEPT->reverse_iterator { return reverse_iterator( end() ); }
+	LLVM_MSTL_CONSTEXPR_SINCE_CXX20 auto rbegin() const LLVM_MSTL_NOEXCEPT->const_reverse_iterator { return const_reverse_iterator( end() ); }
+	LLVM_MSTL_CONSTEXPR_SINCE_CXX20 auto rend() LLVM_MSTL_NOEXCEPT->reverse_iterator { return reverse_iterator( begin() ); }
+	LLVM_MSTL_CONSTEXPR_SINCE_CXX20 auto rend() const LLVM_MSTL_NOEXCEPT->const_reverse_iterator { return const_reverse_iterator( begin() ); }
+	LLVM_MSTL_CONSTEXPR_SINCE_CXX20 auto crbegin() const LLVM_MSTL_NOEXCEPT->const_reverse_iterator { return rbegin(); }
+	LLVM_MSTL_CONSTEXPR_SINCE_CXX20 auto crend() const LLVM_MSTL_NOEXCEPT->const_reverse_iterator { return rend(); }
+
+	/*************************************************************************************
+	 *                                                                                   *
+	 *																	ITERATOR END			                               *
+	 *                                                                                   *
+	 *************************************************************************************/
+
+	/*************************************************************************************
+	 *                                                                                   *
+	 *															ELEMENT ACCESS BEGIN		               	             *
+	 *                                                                                   *
+	 *************************************************************************************/
+
+	LLVM_MSTL_CONSTEXPR_SINCE_CXX20 auto operator[]( size_type __n ) -> reference { return *__make_iter( __n ); }
+	LLVM_MSTL_CONSTEXPR_SINCE_CXX20 auto operator[]( size_type __n ) const -> const_reference { return *__make_iter( __n ); }
+
+	LLVM_MSTL_CONSTEXPR_SINCE_CXX20 auto at( size_type __n ) -> reference;
+	LLVM_MSTL_CONSTEXPR_SINCE_CXX20 auto at( size_type __n ) const -> const_reference;
+
+	LLVM_MSTL_CONSTEXPR_SINCE_CXX20 auto front() -> reference { return *begin(); }
+	LLVM_MSTL_CONSTEXPR_SINCE_CXX20 auto front() const -> const_reference { return *begin(); }
+	LLVM_MSTL_CONSTEXPR_SINCE_CXX20 auto back() -> reference { return *__make_iter( __size - 1 ); }
+	LLVM_MSTL_CONSTEXPR_SINCE_CXX20 auto back() const -> const_reference { return *__make_iter( __size - 1 ); }
+
+	/*************************************************************************************
+	 *                                                                                   *
+	 *															ELEMENT ACCESS END		               	               *
+	 *                                                                                   *
+	 *************************************************************************************/
+
+	/*************************************************************************************
+	 *                                                                                   *
+	 *															 	CAPACITY BEGIN			               	               *
+	 *                                                                                   *
+	 *************************************************************************************/
+
+	LLVM_MSTL_NODISCARD LLVM_MSTL_CONSTEXPR_SINCE_CXX20 auto empty() const LLVM_MSTL_NOEXCEPT->bool { return __size == 0; }
+	LLVM_MSTL_CONSTEXPR_SINCE_CXX20 auto size() const LLVM_MSTL_NOEXCEPT->size_type { return __size; }
+	LLVM_MSTL_CONSTEXPR_SINCE_CXX20 auto max_size() const LLVM_MSTL_NOEXCEPT->size_type;
+	LLVM_MSTL_CONSTEXPR_SINCE_CXX20 auto capacity() const LLVM_MSTL_NOEXCEPT->size_type { return __cap() * __bits_per_word; }
+	LLVM_MSTL_CONSTEXPR_SINCE_CXX20 auto reserve( size_type __n ) -> void;
+	LLVM_MSTL_CONSTEXPR_SINCE_CXX20 auto shrink_to_fit() -> void;
+
+	/*************************************************************************************
+	 *                                                                                   *
+	 *															 		CAPACITY END			               	               *
+	 *                                                                                   *
+	 *************************************************************************************/
+
+	/*************************************************************************************
+	 *                                                                                   *
+	 *															 	MODIFIERS BEGIN			               	               *
+	 *                                                                                   *
+	 *************************************************************************************/
+
+	LLVM_MSTL_CONSTEXPR_SINCE_CXX20 auto clear() LLVM_MSTL_NOEXCEPT->void { __size = 0; }
+
+	LLVM_MSTL_CONSTEXPR_SINCE_CXX20 auto insert( const_iterator __position, const value_type& __x ) -> iterator;
+	LLVM_MSTL_CONSTEXPR_SINCE_CXX20 auto insert( const_iterator __position, size_type __n, const value_type& __x ) -> iterator;
+
+	template <
+		typename _InputIterator,
+		core::enable_if_t< __is_exactly_cpp17_input_iterator< _InputIterator >::value, int > = 0 >
+	LLVM_MSTL_CONSTEXPR_SINCE_CXX20 auto insert( const_iterator __position, _InputIterator __first, _InputIterator __last ) -> iterator;
+
+	template <
+		typename _ForwardIterator,
+		core::enable_if_t< __is_cpp17_forward_iterator< _ForwardIterator >::value, int > = 0 >
+	LLVM_MSTL_CONSTEXPR_SINCE_CXX20 auto insert( const_iterator __position, _ForwardIterator __first, _ForwardIterator __last ) -> iterator;
+
+	LLVM_MSTL_CONSTEXPR_SINCE_CXX20 auto insert( const_iterator __position, core::initializer_list< value_type > __il ) -> iterator {
+		return insert( __position, __il.begin(), __il.end() );
+	}
+
+	template < typename... _Args >
+	LLVM_MSTL_CONSTEXPR_SINCE_CXX20 auto emplace( const_iterator __position, _Args&&... __args ) -> iterator {
+		return insert( __position, value_type( core::forward< _Args >( __args )... ) );
+	}
+
+	LLVM_MSTL_CONSTEXPR_SINCE_CXX20 auto erase( const_iterator __position ) -> iterator;
+	LLVM_MSTL_CONSTEXPR_SINCE_CXX20 auto erase( const_iterator __first, const_iterator __last ) -> iterator;
+
+	LLVM_MSTL_CONSTEXPR_SINCE_CXX20 auto push_back( const value_type& __x ) -> void;
+
+	template < typename... _Args >
+	LLVM_MSTL_CONSTEXPR_SINCE_CXX20 auto emplace_back( _Args&&... __args ) -> reference {
+		push_back( value_type( core::forward< _Args >( __args )... ) );
+		return back();
+	}
+
+	LLVM_MSTL_CONSTEXPR_SINCE_CXX20 auto pop_back() -> void { --__size; }
+
+	LLVM_MSTL_CONSTEXPR_SINCE_CXX20 auto resize( size_type __n, value_type __x = false ) -> void;
+
+	LLVM_MSTL_CONSTEXPR_SINCE_CXX20 auto swap( vector& __v )
+		LLVM_MSTL_NOEXCEPT_V( !__storage_traits::propagate_on_container_swap::value || core::is_nothrow_swappable_v< __storage_allocator > ) -> void;
+
+	static LLVM_MSTL_CONSTEXPR_SINCE_CXX20 auto swap( reference __x, reference __y ) LLVM_MSTL_NOEXCEPT->void {
+		nya::swap( __x, __y );
+	}
+
+	/**
+	* @brief Flips every bit, a word at a time.
+	*/
+	LLVM_MSTL_CONSTEXPR_SINCE_CXX20 auto flip() LLVM_MSTL_NOEXCEPT->void;
+
+	/*************************************************************************************
+	 *                                                                                   *
+	 *															 		MODIFIERS END			               	               *
+	 *                                                                                   *
+	 *************************************************************************************/
+
+private:
+	/*************************************************************************************
+	 *                                                                                   *
+	 *																HELPER BEGIN		               	                   *
+	 *                                                                                   *
+	 *************************************************************************************/
+
+	/**
+	* @brief Number of words needed to hold `__n` bits.
+	*/
+	static LLVM_MSTL_CONSTEXPR auto __words( size_type __n ) LLVM_MSTL_NOEXCEPT->size_type {
+		return ( __n + ( __bits_per_word - 1 ) ) / __bits_per_word;
+	}
+
+	/**
+	* @brief Rounds `__n` bits up to whole words.
+	*/
+	static LLVM_MSTL_CONSTEXPR auto __align_it( size_type __n ) LLVM_MSTL_NOEXCEPT->size_type {
+		return __words( __n ) * __bits_per_word;
+	}
+
+	LLVM_MSTL_CONSTEXPR_SINCE_CXX20 auto __make_iter( size_type __pos ) LLVM_MSTL_NOEXCEPT->iterator {
+		return iterator( __begin + static_cast< difference_type >( __pos / __bits_per_word ), static_cast< unsigned >( __pos % __bits_per_word ) );
+	}
+
+	LLVM_MSTL_CONSTEXPR_SINCE_CXX20 auto __make_iter( size_type __pos ) const LLVM_MSTL_NOEXCEPT->const_iterator {
+		return const_iterator( __begin + static_cast< difference_type >( __pos / __bits_per_word ), static_cast< unsigned >( __pos % __bits_per_word ) );
+	}
+
+	LLVM_MSTL_CONSTEXPR_SINCE_CXX20 auto __const_iterator_cast( const_iterator __p ) LLVM_MSTL_NOEXCEPT->iterator {
+		return begin() + ( __p - cbegin() );
+	}
+
+	LLVM_MSTL_CONSTEXPR_SINCE_CXX20 auto __cap() LLVM_MSTL_NOEXCEPT->size_type& { return __cap_alloc.first(); }
+	LLVM_MSTL_CONSTEXPR_SINCE_CXX20 auto __cap() const LLVM_MSTL_NOEXCEPT->const size_type& { return __cap_alloc.first(); }
+	LLVM_MSTL_CONSTEXPR_SINCE_CXX20 auto __alloc() LLVM_MSTL_NOEXCEPT->__storage_allocator& { return __cap_alloc.second(); }
+	LLVM_MSTL_CONSTEXPR_SINCE_CXX20 auto __alloc() const LLVM_MSTL_NOEXCEPT->const __storage_allocator& { return __cap_alloc.second(); }
+
+	/**
+	* @brief Allocates room for at least `__n` bits, the vector must not own storage.
+	*/
+	LLVM_MSTL_CONSTEXPR_SINCE_CXX20 auto __vallocate( size_type __n ) -> void;
+	LLVM_MSTL_CONSTEXPR_SINCE_CXX20 auto __vdeallocate() LLVM_MSTL_NOEXCEPT->void;
+
+	/**
+	* @brief The capacity (in bits) to grow to when `__new_size` bits are needed, see `vector::__recommend`.
+	*/
+	LLVM_MSTL_CONSTEXPR_SINCE_CXX20 auto __recommend( size_type __new_size ) const -> size_type;
+
+	/**
+	* @brief Sets the size to `__n` (within the capacity), zeroing the words that come into use.
+	*
+	* This keeps the invariant that every word holding an element bit is initialized, the new bits themselves
+	* are left for the caller to write.
+	*/
+	LLVM_MSTL_CONSTEXPR_SINCE_CXX20 auto __set_size( size_type __n ) LLVM_MSTL_NOEXCEPT->void {
+		const size_type __old_words = __words( __size );
+		const size_type __new_words = __words( __n );
+		if ( __new_words > __old_words ) {
+			core::fill_n( core::to_address( __begin ) + __old_words, __new_words - __old_words, __storage_type( 0 ) );
+		}
+		__size = __n;
+	}
+
+	LLVM_MSTL_CONSTEXPR_SINCE_CXX20 auto __construct_at_end( size_type __n, bool __x ) -> void;
+
+	template < typename _ForwardIterator, typename _Sentinel >
+	LLVM_MSTL_CONSTEXPR_SINCE_CXX20 auto __construct_at_end( _ForwardIterator __first, _Sentinel __last, size_type __n ) -> void;
+
+	/**
+	* @brief Copies [__first, __last) to `__result`, a word at a time when the source is a bit iterator.
+	*/
+	template < typename _Iterator, typename _Sentinel >
+	static LLVM_MSTL_CONSTEXPR_SINCE_CXX20 auto __copy_bits( _Iterator __first, _Sentinel __last, iterator __result ) -> iterator {
+		if constexpr ( core::is_same_v< _Iterator, iterator > || core::is_same_v< _Iterator, const_iterator > ) {
+			return nya::copy( const_iterator( __first ), const_iterator( __last ), __result );
+		} else {
+			for ( ; __first != __last; ++__first, (void) ++__result ) {
+				*__result = static_cast< bool >( *__first );
+			}
+			return __result;
+		}
+	}
+
+	/**
+	* @brief Opens a gap of `__n` bits in front of `__position`, returns an iterator to the first bit of the gap.
+	*
+	* Grows to `__recommend( size() + __n )` when the capacity does not suffice.
+	*/
+	LLVM_MSTL_CONSTEXPR_SINCE_CXX20 auto __insert_gap( const_iterator __position, size_type __n ) -> iterator;
+
+	LLVM_MSTL_CONSTEXPR_SINCE_CXX20 auto __copy_assign_alloc( const vector& __v ) -> void {
+		if constexpr ( __storage_traits::propagate_on_container_copy_assignment::value ) {
+			if ( __alloc() != __v.__alloc() ) __vdeallocate();
+			__alloc() = __v.__alloc();
+		}
+	}
+
+	LLVM_MSTL_CONSTEXPR_SINCE_CXX20 auto __move_assign( vector& __v, core::true_type ) LLVM_MSTL_NOEXCEPT->void;
+	LLVM_MSTL_CONSTEXPR_SINCE_CXX20 auto __move_assign( vector& __v, core::false_type ) -> void;
+
+	LLVM_MSTL_NORETURN auto __throw_length_error() const {
+		nya::__throw_length_error( "vector" );
+	}
+
+	LLVM_MSTL_NORETURN auto __throw_out_of_range() const {
+		nya::__throw_out_of_range( "vector" );
+	}
+
+	/*************************************************************************************
+	 *                                                                                   *
+	 *																	HELPER END		               	                   *
+	 *                                                                                   *
+	 *************************************************************************************/
+
+	template < typename _Alloc >
+	friend LLVM_MSTL_CONSTEXPR_SINCE_CXX20 bool operator==( const vector< bool, _Alloc >&, const vector< bool, _Alloc >& );
+
+private:
+	__storage_pointer __begin = nullptr;//<--- the first word
+	size_type         __size  = 0;      //<--- the number of bits
+	__compressed_pair< size_type, __storage_allocator > __cap_alloc =
+		//<--- the `first` is the capacity in words, the `second` is the allocator
+		__compressed_pair< size_type, __storage_allocator >( 0, __default_init_tag() );
+};
+
+/*************************************************************************************
+ *                                                                                   *
+ *															CONSTRUCTOR BEGIN		                                 *
+ *                                                                                   *
+ *************************************************************************************/
+
+template < typename _Allocator >
+LLVM_MSTL_CONSTEXPR_SINCE_CXX20 vector< bool, _Allocator >::vector( size_type __n ) {
+	if ( __n > 0 ) {
+		__vallocate( __n );
+		__construct_at_end( __n, false );
+	}
+}
+
+template < typename _Allocator >
+LLVM_MSTL_CONSTEXPR_SINCE_CXX20 vector< bool, _Allocator >::vector( size_type __n, const allocator_type& __a )
+		: __cap_alloc( 0, static_cast< __storage_allocator >( __a ) ) {
+	if ( __n > 0 ) {
+		__vallocate( __n );
+		__construct_at_end( __n, false );
+	}
+}
+
+template < typename _Allocator >
+LLVM_MSTL_CONSTEXPR_SINCE_CXX20 vector< bool, _Allocator >::vector( size_type __n, const value_type& __x ) {
+	if ( __n > 0 ) {
+		__vallocate( __n );
+		__construct_at_end( __n, __x );
+	}
+}
+
+template < typename _Allocator >
+LLVM_MSTL_CONSTEXPR_SINCE_CXX20 vector< bool, _Allocator >::vector( size_type __n, const value_type& __x, const allocator_type& __a )
+		: __cap_alloc( 0, static_cast< __storage_allocator >( __a ) ) {
+	if ( __n > 0 ) {
+		__vallocate( __n );
+		__construct_at_end( __n, __x );
+	}
+}
+
+template < typename _Allocator >
+template <
+	typename _InputIterator,
+	core::enable_if_t< __is_exactly_cpp17_input_iterator< _InputIterator >::value, int > >
+LLVM_MSTL_CONSTEXPR_SINCE_CXX20 vector< bool, _Allocator >::vector( _InputIterator __first, _InputIterator __last, const allocator_type& __a )
+		: __cap_alloc( 0, static_cast< __storage_allocator >( __a ) ) {
+	auto __guard = __make_exception_guard( [ this ] { __vdeallocate(); } );
+	for ( ; __first != __last; ++__first ) {
+		push_back( *__first );
+	}
+	__guard.__complete();
+}
+
+template < typename _Allocator >
+template <
+	typename _ForwardIterator,
+	core::enable_if_t< __is_cpp17_forward_iterator< _ForwardIterator >::value, int > >
+LLVM_MSTL_CONSTEXPR_SINCE_CXX20 vector< bool, _Allocator >::vector( _ForwardIterator __first, _ForwardIterator __last, const allocator_type& __a )
+		: __cap_alloc( 0, static_cast< __storage_allocator >( __a ) ) {
+	auto      __guard = __make_exception_guard( [ this ] { __vdeallocate(); } );
+	size_type __n     = static_cast< size_type >( core::distance( __first, __last ) );
+	if ( __n > 0 ) {
+		__vallocate( __n );
+		__construct_at_end( __first, __last, __n );
+	}
+	__guard.__complete();
+}
+
+template < typename _Allocator >
+template < _ContainerCompatibleRange< bool > _Range >
+LLVM_MSTL_CONSTEXPR_SINCE_CXX20 vector< bool, _Allocator >::vector( from_range_t, _Range&& __range, const allocator_type& __a )
+		: __cap_alloc( 0, static_cast< __storage_allocator >( __a ) ) {
+	if constexpr ( core::ranges::sized_range< _Range > || core::ranges::forward_range< _Range > ) {
+		auto      __guard = __make_exception_guard( [ this ] { __vdeallocate(); } );
+		size_type __n     = static_cast< size_type >( core::ranges::distance( __range ) );
+		if ( __n > 0 ) {
+			__vallocate( __n );
+			__construct_at_end( core::ranges::begin( __range ), core::ranges::end( __range ), __n );
+		}
+		__guard.__complete();
+	} else {
+		auto __guard = __make_exception_guard( [ this ] { __vdeallocate(); } );
+		for ( auto&& __x : __range ) {
+			push_back( static_cast< bool >( __x ) );
+		}
+		__guard.__complete();
+	}
+}
+
+template < typename _Allocator >
+LLVM_MSTL_CONSTEXPR_SINCE_CXX20 vector< bool, _Allocator >::vector( const vector& __v )
+		: __cap_alloc( 0, __storage_traits::select_on_container_copy_construction( __v.__alloc() ) ) {
+	if ( __v.__size > 0 ) {
+		__vallocate( __v.__size );
+		//<--- both start on a word boundary, copy the words
+		core::copy_n( core::to_address( __v.__begin ), __words( __v.__size ), core::to_address( __begin ) );
+		__size = __v.__size;
+	}
+}
+
+template < typename _Allocator >
+LLVM_MSTL_CONSTEXPR_SINCE_CXX20 vector< bool, _Allocator >::vector( const vector& __v, const core::type_identity_t< allocator_type >& __a )
+		: __cap_alloc( 0, static_cast< __storage_allocator >( __a ) ) {
+	if ( __v.__size > 0 ) {
+		__vallocate( __v.__size );
+		core::copy_n( core::to_address( __v.__begin ), __words( __v.__size ), core::to_address( __begin ) );
+		__size = __v.__size;
+	}
+}
+
+template < typename _Allocator >
+LLVM_MSTL_CONSTEXPR_SINCE_CXX20 vector< bool, _Allocator >::vector( vector&& __v ) LLVM_MSTL_NOEXCEPT
+		: __begin( __v.__begin )
+		, __size( __v.__size )
+		, __cap_alloc( core::move( __v.__cap_alloc ) ) {
+	__v.__begin = nullptr;
+	__v.__size  = 0;
+	__v.__cap() = 0;
+}
+
+template < typename _Allocator >
+LLVM_MSTL_CONSTEXPR_SINCE_CXX20 vector< bool, _Allocator >::vector( vector&& __v, const core::type_identity_t< allocator_type >& __a )
+		: __cap_alloc( 0, static_cast< __storage_allocator >( __a ) ) {
+	if ( __a == allocator_type( __v.__alloc() ) ) {
+		__begin = __v.__begin;
+		__size  = __v.__size;
+		__cap() = __v.__cap();
+		__v.__begin = nullptr;
+		__v.__cap() = __v.__size = 0;
+	} else if ( __v.__size > 0 ) {
+		__vallocate( __v.__size );
+		core::copy_n( core::to_address( __v.__begin ), __words( __v.__size ), core::to_address( __begin ) );
+		__size = __v.__size;
+	}
+}
+
+template < typename _Allocator >
+LLVM_MSTL_CONSTEXPR_SINCE_CXX20 vector< bool, _Allocator >::vector( core::initializer_list< value_type > __il, const allocator_type& __a )
+		: __cap_alloc( 0, static_cast< __storage_allocator >( __a ) ) {
+	if ( __il.size() > 0 ) {
+		__vallocate( __il.size() );
+		__construct_at_end( __il.begin(), __il.end(), __il.size() );
+	}
+}
+
+/*************************************************************************************
+ *                                                                                   *
+ *																CONSTRUCTOR END			                               *
+ *                                                                                   *
+ *************************************************************************************/
+
+/*************************************************************************************
+ *                                                                                   *
+ *																OPERATOR BEGIN			                               *
+ *                                                                                   *
+ *************************************************************************************/
+
+template < typename _Allocator >
+LLVM_MSTL_CONSTEXPR_SINCE_CXX20 auto vector< bool, _Allocator >::operator=( const vector& __v ) -> vector& {
+	if ( this != core::addressof( __v ) ) {
+		__copy_assign_alloc( __v );
+		if ( __v.__size > capacity() ) {
+			__vdeallocate();
+			__vallocate( __v.__size );
+		}
+		core::copy_n( core::to_address( __v.__begin ), __words( __v.__size ), core::to_address( __begin ) );
+		__size = __v.__size;
+	}
+	return *this;
+}
+
+template < typename _Allocator >
+LLVM_MSTL_CONSTEXPR_SINCE_CXX20 auto vector< bool, _Allocator >::operator=( vector&& __v )
+	LLVM_MSTL_NOEXCEPT_V(
+		__storage_traits::propagate_on_container_move_assignment::value ||
+		__storage_traits::is_always_equal::value ) -> vector& {
+	__move_assign( __v, core::integral_constant< bool, __storage_traits::propagate_on_container_move_assignment::value >() );
+	return *this;
+}
+
+/**
+ * @brief Equality of two bit vectors, the words are compared directly.
+ */
+template < typename _Allocator >
+LLVM_MSTL_CONSTEXPR_SINCE_CXX20 bool
+operator==( const vector< bool, _Allocator >& __x, const vector< bool, _Allocator >& __y ) {
+	using __storage_type = typename vector< bool, _Allocator >::__storage_type;
+	if ( __x.__size != __y.__size ) return false;
+	const auto __full = __x.__size / vector< bool, _Allocator >::__bits_per_word;
+	const auto __tail = static_cast< unsigned >( __x.__size % vector< bool, _Allocator >::__bits_per_word );
+	if ( !core::equal( core::to_address( __x.__begin ), core::to_address( __x.__begin ) + __full, core::to_address( __y.__begin ) ) ) {
+		return false;
+	}
+	const __storage_type __m = __low_bits_mask< __storage_type >( __tail );
+	return __tail == 0 || ( ( __x.__begin[ __full ] ^ __y.__begin[ __full ] ) & __m ) == 0;
+}
+
+/*************************************************************************************
+ *                                                                                   *
+ *																	OPERATOR END			                               *
+ *                                                                                   *
+ *************************************************************************************/
+
+template < typename _Allocator >
+LLVM_MSTL_CONSTEXPR_SINCE_CXX20 auto vector< bool, _Allocator >::assign( size_type __n, const value_type& __x ) -> void {
+	__size = 0;
+	if ( __n > capacity() ) {
+		__vdeallocate();
+		__vallocate( __n );
+	}
+	__construct_at_end( __n, __x );
+}
+
+template < typename _Allocator >
+template <
+	typename _InputIterator,
+	core::enable_if_t< __is_exactly_cpp17_input_iterator< _InputIterator >::value, int > >
+LLVM_MSTL_CONSTEXPR_SINCE_CXX20 auto vector< bool, _Allocator >::assign( _InputIterator __first, _InputIterator __last ) -> void {
+	clear();
+	for ( ; __first != __last; ++__first ) {
+		push_back( *__first );
+	}
+}
+
+template < typename _Allocator >
+template <
+	typename _ForwardIterator,
+	core::enable_if_t< __is_cpp17_forward_iterator< _ForwardIterator >::value, int > >
+LLVM_MSTL_CONSTEXPR_SINCE_CXX20 auto vector< bool, _Allocator >::assign( _ForwardIterator __first, _ForwardIterator __last ) -> void {
+	clear();
+	const size_type __n = static_cast< size_type >( core::distance( __first, __last ) );
+	if ( __n > 0 ) {
+		if ( __n > capacity() ) {
+			__vdeallocate();
+			__vallocate( __n );
+		}
+		__construct_at_end( __first, __last, __n );
+	}
+}
+
+/*************************************************************************************
+ *                                                                                   *
+ *															ELEMENT ACCESS BEGIN		               	             *
+ *                                                                                   *
+ *************************************************************************************/
+
+template < typename _Allocator >
+LLVM_MSTL_CONSTEXPR_SINCE_CXX20 auto vector< bool, _Allocator >::at( size_type __n ) -> reference {
+	if ( __n >= __size ) {
+		spdlog::error( "vector<bool>::at out of range, __n[{}], size()[{}]", __n, __size );
+		this->__throw_out_of_range();
+	}
+	return ( *this )[ __n ];
+}
+
+template < typename _Allocator >
+LLVM_MSTL_CONSTEXPR_SINCE_CXX20 auto vector< bool, _Allocator >::at( size_type __n ) const -> const_reference {
+	if ( __n >= __size ) {
+		spdlog::error( "vector<bool>::at out of range, __n[{}], size()[{}]", __n, __size );
+		this->__throw_out_of_range();
+	}
+	return ( *this )[ __n ];
+}
+
+/*************************************************************************************
+ *                                                                                   *
+ *															ELEMENT ACCESS END		               	               *
+ *                                                                                   *
+ *************************************************************************************/
+
+/*************************************************************************************
+ *                                                                                   *
+ *															 	CAPACITY BEGIN			               	               *
+ *                                                                                   *
+ *************************************************************************************/
+
+template < typename _Allocator >
+LLVM_MSTL_CONSTEXPR_SINCE_CXX20 auto vector< bool, _Allocator >::max_size() const LLVM_MSTL_NOEXCEPT->size_type {
+	const size_type __amax = __storage_traits::max_size( __alloc() );
+	const size_type __nmax = core::numeric_limits< size_type >::max() / 2;//<--- leave room for difference_type
+	if ( __nmax / __bits_per_word <= __amax ) return __nmax;
+	return __amax * __bits_per_word;
+}
+
+template < typename _Allocator >
+LLVM_MSTL_CONSTEXPR_SINCE_CXX20 auto vector< bool, _Allocator >::reserve( size_type __n ) -> void {
+	if ( __n > capacity() ) {
+		if ( __n > max_size() ) this->__throw_length_error();
+		vector __v( get_allocator() );
+		__v.__vallocate( __n );
+		__v.__construct_at_end( cbegin(), cend(), __size );
+		swap( __v );
+	}
+}
+
+template < typename _Allocator >
+LLVM_MSTL_CONSTEXPR_SINCE_CXX20 auto vector< bool, _Allocator >::shrink_to_fit() -> void {
+	if ( __words( __size ) < __cap() ) {
+		vector( *this, allocator_type( __alloc() ) ).swap( *this );
+	}
+}
+
+/*************************************************************************************
+ *                                                                                   *
+ *															 		CAPACITY END			               	               *
+ *                                                                                   *
+ *************************************************************************************/
+
+/*************************************************************************************
+ *                                                                                   *
+ *															 	MODIFIERS BEGIN			               	               *
+ *                                                                                   *
+ *************************************************************************************/
+
+template < typename _Allocator >
+LLVM_MSTL_CONSTEXPR_SINCE_CXX20 auto vector< bool, _Allocator >::insert( const_iterator __position, const value_type& __x ) -> iterator {
+	iterator __r = __insert_gap( __position, 1 );
+	*__r         = __x;
+	return __r;
+}
+
+template < typename _Allocator >
+LLVM_MSTL_CONSTEXPR_SINCE_CXX20 auto vector< bool, _Allocator >::insert( const_iterator __position, size_type __n, const value_type& __x ) -> iterator {
+	iterator __r = __insert_gap( __position, __n );
+	nya::fill_n( __r, __n, __x );
+	return __r;
+}
+
+template < typename _Allocator >
+template <
+	typename _InputIterator,
+	core::enable_if_t< __is_exactly_cpp17_input_iterator< _InputIterator >::value, int > >
+LLVM_MSTL_CONSTEXPR_SINCE_CXX20 auto vector< bool, _Allocator >::insert( const_iterator __position, _InputIterator __first, _InputIterator __last ) -> iterator {
+	//<--- single pass, gather the bits first so that the gap is opened only once
+	vector __tmp( __first, __last, get_allocator() );
+	return insert( __position, __tmp.cbegin(), __tmp.cend() );
+}
+
+template < typename _Allocator >
+template <
+	typename _ForwardIterator,
+	core::enable_if_t< __is_cpp17_forward_iterator< _ForwardIterator >::value, int > >
+LLVM_MSTL_CONSTEXPR_SINCE_CXX20 auto vector< bool, _Allocator >::insert( const_iterator __position, _ForwardIterator __first, _ForwardIterator __last ) -> iterator {
+	const size_type __n = static_cast< size_type >( core::distance( __first, __last ) );
+	iterator        __r = __insert_gap( __position, __n );
+	__copy_bits( __first, __last, __r );
+	return __r;
+}
+
+template < typename _Allocator >
+LLVM_MSTL_CONSTEXPR_SINCE_CXX20 auto vector< bool, _Allocator >::erase( const_iterator __position ) -> iterator {
+	iterator __r = __const_iterator_cast( __position );
+	nya::copy( __position + 1, cend(), __r );
+	--__size;
+	return __r;
+}
+
+template < typename _Allocator >
+LLVM_MSTL_CONSTEXPR_SINCE_CXX20 auto vector< bool, _Allocator >::erase( const_iterator __first, const_iterator __last ) -> iterator {
+	iterator __r = __const_iterator_cast( __first );
+	nya::copy( __last, cend(), __r );
+	__size -= static_cast< size_type >( __last - __first );
+	return __r;
+}
+
+template < typename _Allocator >
+LLVM_MSTL_CONSTEXPR_SINCE_CXX20 auto vector< bool, _Allocator >::push_back( const value_type& __x ) -> void {
+	if ( __size == capacity() ) reserve( __recommend( __size + 1 ) );
+	__set_size( __size + 1 );
+	back() = __x;
+}
+
+template < typename _Allocator >
+LLVM_MSTL_CONSTEXPR_SINCE_CXX20 auto vector< bool, _Allocator >::resize( size_type __n, value_type __x ) -> void {
+	if ( __n > __size ) {
+		if ( __n > capacity() ) reserve( __recommend( __n ) );
+		__construct_at_end( __n - __size, __x );
+	} else {
+		__size = __n;
+	}
+}
+
+template < typename _Allocator >
+LLVM_MSTL_CONSTEXPR_SINCE_CXX20 auto vector< bool, _Allocator >::swap( vector& __v )
+	LLVM_MSTL_NOEXCEPT_V( !__storage_traits::propagate_on_container_swap::value || core::is_nothrow_swappable_v< __storage_allocator > ) -> void {
+	core::swap( __begin, __v.__begin );
+	core::swap( __size, __v.__size );
+	core::swap( __cap(), __v.__cap() );
+	__swap_allocator(
+		__alloc(), __v.__alloc(), core::integral_constant< bool, __storage_traits::propagate_on_container_swap::value >() );
+}
+
+template < typename _Allocator >
+LLVM_MSTL_CONSTEXPR_SINCE_CXX20 auto vector< bool, _Allocator >::flip() LLVM_MSTL_NOEXCEPT->void {
+	//<--- the bits past `size()` are flipped too, they are unspecified anyway
+	__storage_type* __p = core::to_address( __begin );
+	for ( size_type __i = 0, __n = __words( __size ); __i < __n; ++__i ) {
+		__p[ __i ] = static_cast< __storage_type >( ~__p[ __i ] );
+	}
+}
+
+/*************************************************************************************
+ *                                                                                   *
+ *															  	MODIFIERS END			               	               *
+ *                                                                                   *
+ *************************************************************************************/
+
+/*************************************************************************************
+ *                                                                                   *
+ *																 HELPER BEGIN 			                               *
+ *                                                                                   *
+ *************************************************************************************/
+
+template < typename _Allocator >
+LLVM_MSTL_CONSTEXPR_SINCE_CXX20 auto vector< bool, _Allocator >::__vallocate( size_type __n ) -> void {
+	if ( __n > max_size() ) this->__throw_length_error();
+	auto __allocation = __allocate_at_least( __alloc(), __words( __n ) );
+	__begin           = __allocation.ptr;
+	__size            = 0;
+	__cap()           = __allocation.count;
+}
+
+template < typename _Allocator >
+LLVM_MSTL_CONSTEXPR_SINCE_CXX20 auto vector< bool, _Allocator >::__vdeallocate() LLVM_MSTL_NOEXCEPT->void {
+	if ( __begin != nullptr ) {
+		__storage_traits::deallocate( __alloc(), __begin, __cap() );
+		__begin = nullptr;
+		__size = __cap() = 0;
+	}
+}
+
+template < typename _Allocator >
+LLVM_MSTL_CONSTEXPR_SINCE_CXX20 auto vector< bool, _Allocator >::__recommend( size_type __new_size ) const -> size_type {
+	const size_type __ms = max_size();
+	if ( __new_size > __ms ) this->__throw_length_error();
+	const size_type __cap = capacity();
+	if ( __cap >= __ms / 2 ) return __ms;
+	return core::max< size_type >( 2 * __cap, __align_it( __new_size ) );
+}
+
+template < typename _Allocator >
+LLVM_MSTL_CONSTEXPR_SINCE_CXX20 auto vector< bool, _Allocator >::__construct_at_end( size_type __n, bool __x ) -> void {
+	const size_type __old_size = __size;
+	__set_size( __size + __n );
+	nya::fill_n( __make_iter( __old_size ), __n, __x );
+}
+
+template < typename _Allocator >
+template < typename _ForwardIterator, typename _Sentinel >
+LLVM_MSTL_CONSTEXPR_SINCE_CXX20 auto
+vector< bool, _Allocator >::__construct_at_end( _ForwardIterator __first, _Sentinel __last, size_type __n ) -> void {
+	const size_type __old_size = __size;
+	__set_size( __size + __n );
+	__copy_bits( core::move( __first ), core::move( __last ), __make_iter( __old_size ) );
+}
+
+template < typename _Allocator >
+LLVM_MSTL_CONSTEXPR_SINCE_CXX20 auto vector< bool, _Allocator >::__insert_gap( const_iterator __position, size_type __n ) -> iterator {
+	const size_type __c = capacity();
+	if ( __n <= __c && __size <= __c - __n ) {
+		const_iterator __old_end = cend();
+		__set_size( __size + __n );
+		nya::copy_backward( __position, __old_end, end() );
+		return __const_iterator_cast( __position );
+	}
+	vector __v( get_allocator() );
+	__v.__vallocate( __recommend( __size + __n ) );
+	__v.__set_size( __size + __n );
+	iterator __r = nya::copy( cbegin(), __position, __v.begin() );
+	nya::copy( __position, cend(), __r + static_cast< difference_type >( __n ) );
+	swap( __v );
+	return __r;
+}
+
+template < typename _Allocator >
+LLVM_MSTL_CONSTEXPR_SINCE_CXX20 auto vector< bool, _Allocator >::__move_assign( vector& __v, core::true_type ) LLVM_MSTL_NOEXCEPT->void {
+	__vdeallocate();
+	__alloc()     = core::move( __v.__alloc() );
+	__begin       = __v.__begin;
+	__size        = __v.__size;
+	__cap()       = __v.__cap();
+	__v.__begin   = nullptr;
+	__v.__cap()   = __v.__size = 0;
+}
+
+template < typename _Allocator >
+LLVM_MSTL_CONSTEXPR_SINCE_CXX20 auto vector< bool, _Allocator >::__move_assign( vector& __v, core::false_type ) -> void {
+	if ( __alloc() != __v.__alloc() )
+		assign( __v.cbegin(), __v.cend() );
+	else
+		__move_assign( __v, core::true_type() );
+}
+
+/*************************************************************************************
+ *                                                                                   *
+ *																	HELPER END		               	                   *
+ *                                                                                   *
+ *************************************************************************************/
+
+LLVM_MSTL_END_NAMESPACE_STD
+
+#endif//LLVM_MSTL_VECTOR_BOOL_H
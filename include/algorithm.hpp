@@ -0,0 +1,16 @@
+#ifndef LLVM_MSTL_ALGORITHM_H
+#define LLVM_MSTL_ALGORITHM_H
+
+/**
+ * @file algorithm.hpp
+ * @brief The algorithms of the library over ranges and `nya::vector`: `radix_sort`, the `sort` of the execution policies
+ * and the vectorized searches and comparisons of contiguous ranges.
+ */
+
+#include "__algorithm/execution_policy.h"
+#include "__algorithm/parallel_sort.h"
+#include "__algorithm/radix_sort.h"
+#include "__algorithm/simd_dispatch.h"
+#include "__algorithm/simd_search.h"
+
+#endif//LLVM_MSTL_ALGORITHM_H
@@ -0,0 +1,674 @@
+#ifndef LLVM_MSTL_CIRCULAR_BUFFER_H
+#define LLVM_MSTL_CIRCULAR_BUFFER_H
+
+/**
+ * @file circular_buffer.hpp
+ * @brief A ring buffer over one allocation, read and written in at most two contiguous segments.
+ */
+
+#include "__config.h"
+#include "__iterator/iterator_traits.h"
+#include "__memory/compress_pair.h"
+#include "__memory/swap_allocator.h"
+#include "__memory/temp_value.h"
+#include "__memory/uninitialized_algorithms.h"
+#include "__utility/exception_guard.h"
+#include "stdexcept.h"
+
+#include "spdlog/spdlog.h"
+
+#include <algorithm>
+#include <array>
+#include <compare>
+#include <initializer_list>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <span>
+#include <type_traits>
+#include <utility>
+
+LLVM_MSTL_BEGIN_NAMESPACE_STD
+LLVM_MSTL_CORE_STD
+
+/**
+ * @brief What a push does when the @ref circular_buffer is full.
+ */
+enum class circular_buffer_policy : unsigned char {
+	overwrite,//<--- drops the element at the other end, the buffer keeps the latest `capacity()` elements
+	grow,     //<--- doubles the capacity, as `vector` does
+	fixed     //<--- throws `length_error`
+};
+
+/**
+ * @brief The random access iterator of @ref circular_buffer, a position counted from the front.
+ */
+template < typename _Buffer, bool _IsConst >
+class __circular_buffer_iterator {
+	using __buffer_pointer = core::conditional_t< _IsConst, const _Buffer*, _Buffer* >;
+
+public:
+	using iterator_category = core::random_access_iterator_tag;
+	using iterator_concept  = core::random_access_iterator_tag;
+	using value_type        = typename _Buffer::value_type;
+	using difference_type   = typename _Buffer::difference_type;
+	using reference         = core::conditional_t< _IsConst, const value_type&, value_type& >;
+	using pointer           = core::conditional_t< _IsConst, const value_type*, value_type* >;
+
+	__circular_buffer_iterator() = default;
+
+	__circular_buffer_iterator( __buffer_pointer __b, difference_type __i ) LLVM_MSTL_NOEXCEPT
+			: __buf( __b ),
+				__idx( __i ) {}
+
+	template < bool _OtherConst >
+		requires( _IsConst && !_OtherConst )
+	__circular_buffer_iterator( const __circular_buffer_iterator< _Buffer, _OtherConst >& __x ) LLVM_MSTL_NOEXCEPT
+			: __buf( __x.__buf ),
+				__idx( __x.__idx ) {}
+
+	auto operator*() const LLVM_MSTL_NOEXCEPT->reference { return ( *__buf )[ static_cast< typename _Buffer::size_type >( __idx ) ]; }
+	auto operator->() const LLVM_MSTL_NOEXCEPT->pointer { return core::addressof( **this ); }
+	auto operator[]( difference_type __n ) const LLVM_MSTL_NOEXCEPT->reference { return *( *this + __n ); }
+
+	auto operator++() LLVM_MSTL_NOEXCEPT->__circular_buffer_iterator& {
+		++__idx;
+		return *this;
+	}
+	auto operator++( int ) LLVM_MSTL_NOEXCEPT->__circular_buffer_iterator {
+		auto __t = *this;
+		++__idx;
+		return __t;
+	}
+	auto operator--() LLVM_MSTL_NOEXCEPT->__circular_buffer_iterator& {
+		--__idx;
+		return *this;
+	}
+	auto operator--( int ) LLVM_MSTL_NOEXCEPT->__circular_buffer_iterator {
+		auto __t = *this;
+		--__idx;
+		return __t;
+	}
+	auto operator+=( difference_type __n ) LLVM_MSTL_NOEXCEPT->__circular_buffer_iterator& {
+		__idx += __n;
+		return *this;
+	}
+	auto operator-=( difference_type __n ) LLVM_MSTL_NOEXCEPT->__circular_buffer_iterator& {
+		__idx -= __n;
+		return *this;
+	}
+
+	friend auto operator+( __circular_buffer_iterator __x, difference_type __n ) LLVM_MSTL_NOEXCEPT->__circular_buffer_iterator { return __x += __n; }
+	friend auto operator+( difference_type __n, __circular_buffer_iterator __x ) LLVM_MSTL_NOEXCEPT->__circular_buffer_iterator { return __x += __n; }
+	friend auto operator-( __circular_buffer_iterator __x, difference_type __n ) LLVM_MSTL_NOEXCEPT->__circular_buffer_iterator { return __x -= __n; }
+	friend auto operator-( const __circular_buffer_iterator& __x, const __circular_buffer_iterator& __y ) LLVM_MSTL_NOEXCEPT->difference_type {
+		return __x.__idx - __y.__idx;
+	}
+	friend auto operator==( const __circular_buffer_iterator& __x, const __circular_buffer_iterator& __y ) LLVM_MSTL_NOEXCEPT->bool {
+		return __x.__idx == __y.__idx;
+	}
+	friend auto operator<=>( const __circular_buffer_iterator& __x, const __circular_buffer_iterator& __y ) LLVM_MSTL_NOEXCEPT {
+		return __x.__idx <=> __y.__idx;
+	}
+
+private:
+	template < typename, bool >
+	friend class __circular_buffer_iterator;
+
+	__buffer_pointer __buf = nullptr;
+	difference_type  __idx = 0;//<--- counted from the front, not a slot of the storage
+};
+
+/**
+ * @brief A ring buffer: a double-ended queue in one allocation of `capacity()` slots, which wrap around.
+ *
+ * @ref https://www.boost.org/doc/libs/release/doc/html/circular_buffer.html
+ *
+ * The elements occupy at most two contiguous segments of the storage, the front one running to the end of the
+ * allocation and the back one starting at its beginning. `as_spans()` returns them, e.g. for a `writev`, and the
+ * bulk `push_n`/`pop_n` copy a whole range in at most two segment copies, one `memmove` each for trivially copyable
+ * elements. `linearize()` rotates the elements in place so that they form a single segment.
+ *
+ * What a push does when the buffer is full is up to the @ref circular_buffer_policy: keep the latest `capacity()`
+ * elements (`overwrite`, the default with a capacity), reallocate (`grow`, the default without one) or throw
+ * (`fixed`). The buffer is not synchronized.
+ *
+ * @code{.cc}
+ * nya::circular_buffer< float > __last( 1024 );//<--- overwrites once 1024 samples are in
+ * __last.push_n( __samples.data(), __samples.size() );
+ * auto [ __older, __newer ] = __last.as_spans();
+ * @endcode
+ *
+ * @tparam _Tp The element type.
+ * @tparam _Allocator The allocator of the elements.
+ */
+template < typename _Tp, typename _Allocator = core::allocator< _Tp > >
+class LLVM_MSTL_TEMPLATE_VIS circular_buffer {
+	using __alloc_traits = core::allocator_traits< _Allocator >;
+
+public:
+	using value_type             = _Tp;
+	using allocator_type         = _Allocator;
+	using size_type              = typename __alloc_traits::size_type;
+	using difference_type        = typename __alloc_traits::difference_type;
+	using reference              = value_type&;
+	using const_reference        = const value_type&;
+	using pointer                = typename __alloc_traits::pointer;
+	using const_pointer          = typename __alloc_traits::const_pointer;
+	using iterator               = __circular_buffer_iterator< circular_buffer, false >;
+	using const_iterator         = __circular_buffer_iterator< circular_buffer, true >;
+	using reverse_iterator       = core::reverse_iterator< iterator >;
+	using const_reverse_iterator = core::reverse_iterator< const_iterator >;
+	using span_type              = core::span< value_type >;
+	using const_span_type        = core::span< const value_type >;
+
+	static_assert( core::is_same_v< value_type, typename allocator_type::value_type >, "circular_buffer: allocator of another type" );
+
+	/*************************************************************************************
+	 *                                                                                   *
+	 *															CONSTRUCTOR BEGIN		                                 *
+	 *                                                                                   *
+	 *************************************************************************************/
+
+	//<--- no capacity, the first push allocates
+	circular_buffer() LLVM_MSTL_NOEXCEPT_V( core::is_nothrow_default_constructible_v< allocator_type > )
+			: __capm( 0, __default_init_tag() ) {}
+
+	explicit circular_buffer( const allocator_type& __a ) LLVM_MSTL_NOEXCEPT
+			: __capm( 0, __a ) {}
+
+	explicit circular_buffer(
+		size_type              __cap,
+		circular_buffer_policy __policy = circular_buffer_policy::overwrite,
+		const allocator_type&  __a      = allocator_type() )
+			: __capm( 0, __a ),
+				__pol( __policy ) {
+		__allocate( __cap );
+	}
+
+	circular_buffer( core::initializer_list< value_type > __il, const allocator_type& __a = allocator_type() )
+			: circular_buffer( __il.size(), circular_buffer_policy::grow, __a ) {
+		push_n( __il.begin(), __il.size() );
+	}
+
+	//<--- the copy has the capacity and the policy of `__x`, its elements start at the first slot
+	circular_buffer( const circular_buffer& __x )
+			: circular_buffer( __x, __alloc_traits::select_on_container_copy_construction( __x.__alloc() ) ) {}
+
+	circular_buffer( const circular_buffer& __x, const allocator_type& __a )
+			: circular_buffer( __x.capacity(), __x.__pol, __a ) {
+		const auto [ __s1, __s2 ] = __x.as_spans();
+		push_n( __s1.data(), __s1.size() );
+		push_n( __s2.data(), __s2.size() );
+	}
+
+	circular_buffer( circular_buffer&& __x ) LLVM_MSTL_NOEXCEPT
+			: __buf( core::exchange( __x.__buf, nullptr ) ),
+				__head( core::exchange( __x.__head, 0 ) ),
+				__size( core::exchange( __x.__size, 0 ) ),
+				__capm( core::exchange( __x.__cap(), 0 ), core::move( __x.__alloc() ) ),
+				__pol( __x.__pol ) {}
+
+	~circular_buffer() { __deallocate(); }
+
+	//<--- like the copy, the assignments take the capacity and the policy of `__x`
+	auto operator=( const circular_buffer& __x ) -> circular_buffer& {
+		if ( this != core::addressof( __x ) ) {
+			circular_buffer __t( __x, __alloc_traits::propagate_on_container_copy_assignment::value ? __x.__alloc() : __alloc() );
+			__swap_storage( __t );
+			if constexpr ( __alloc_traits::propagate_on_container_copy_assignment::value ) core::swap( __alloc(), __t.__alloc() );
+			__pol = __x.__pol;
+		}
+		return *this;
+	}
+
+	auto operator=( circular_buffer&& __x )
+		LLVM_MSTL_NOEXCEPT_V( __alloc_traits::propagate_on_container_move_assignment::value || __alloc_traits::is_always_equal::value )
+			->circular_buffer& {
+		if ( this == core::addressof( __x ) ) return *this;
+		if constexpr ( __alloc_traits::propagate_on_container_move_assignment::value ) {
+			__deallocate();
+			__alloc() = core::move( __x.__alloc() );
+			__swap_storage( __x );
+		} else if ( __alloc_traits::is_always_equal::value || __alloc() == __x.__alloc() ) {
+			__deallocate();
+			__swap_storage( __x );
+		} else {
+			circular_buffer __t( __x.capacity(), __x.__pol, __alloc() );
+			for ( auto& __e : __x ) __t.push_back( core::move( __e ) );
+			__swap_storage( __t );
+		}
+		__pol = __x.__pol;
+		return *this;
+	}
+
+	/*************************************************************************************
+	 *                                                                                   *
+	 *																CONSTRUCTOR END			                               *
+	 *                                                                                   *
+	 *************************************************************************************/
+
+	auto get_allocator() const LLVM_MSTL_NOEXCEPT->allocator_type { return __alloc(); }
+	auto policy() const LLVM_MSTL_NOEXCEPT->circular_buffer_policy { return __pol; }
+	auto set_policy( circular_buffer_policy __policy ) LLVM_MSTL_NOEXCEPT->void { __pol = __policy; }
+
+	auto begin() LLVM_MSTL_NOEXCEPT->iterator { return iterator( this, 0 ); }
+	auto begin() const LLVM_MSTL_NOEXCEPT->const_iterator { return const_iterator( this, 0 ); }
+	auto end() LLVM_MSTL_NOEXCEPT->iterator { return iterator( this, static_cast< difference_type >( __size ) ); }
+	auto end() const LLVM_MSTL_NOEXCEPT->const_iterator { return const_iterator( this, static_cast< difference_type >( __size ) ); }
+	auto cbegin() const LLVM_MSTL_NOEXCEPT->const_iterator { return begin(); }
+	auto cend() const LLVM_MSTL_NOEXCEPT->const_iterator { return end(); }
+	auto rbegin() LLVM_MSTL_NOEXCEPT->reverse_iterator { return reverse_iterator( end() ); }
+	auto rbegin() const LLVM_MSTL_NOEXCEPT->const_reverse_iterator { return const_reverse_iterator( end() ); }
+	auto rend() LLVM_MSTL_NOEXCEPT->reverse_iterator { return reverse_iterator( begin() ); }
+	auto rend() const LLVM_MSTL_NOEXCEPT->const_reverse_iterator { return const_reverse_iterator( begin() ); }
+
+	/*************************************************************************************
+	 *                                                                                   *
+	 *																CAPACITY BEGIN			                               *
+	 *                                                                                   *
+	 *************************************************************************************/
+
+	LLVM_MSTL_NODISCARD auto empty() const LLVM_MSTL_NOEXCEPT->bool { return __size == 0; }
+	auto full() const LLVM_MSTL_NOEXCEPT->bool { return __size == capacity(); }
+	auto size() const LLVM_MSTL_NOEXCEPT->size_type { return __size; }
+	auto capacity() const LLVM_MSTL_NOEXCEPT->size_type { return __cap(); }
+
+	auto max_size() const LLVM_MSTL_NOEXCEPT->size_type {
+		return core::min< size_type >( __alloc_traits::max_size( __alloc() ), core::numeric_limits< difference_type >::max() );
+	}
+
+	//<--- grows the capacity to at least `__n`, whatever the policy
+	auto reserve( size_type __n ) -> void {
+		if ( __n > capacity() ) __reallocate( __n );
+	}
+
+	/**
+	* @brief Reallocates to exactly `__n` slots, dropping the oldest (front) elements that do not fit.
+	* @throws length_error If `__n > max_size()`.
+	*/
+	auto set_capacity( size_type __n ) -> void {
+		if ( __n == capacity() ) return;
+		if ( __size > __n ) pop_n( __size - __n );
+		__reallocate( __n );
+	}
+
+	auto shrink_to_fit() -> void { set_capacity( __size ); }
+
+	/*************************************************************************************
+	 *                                                                                   *
+	 *																CAPACITY END			                                 *
+	 *                                                                                   *
+	 *************************************************************************************/
+
+	/*************************************************************************************
+	 *                                                                                   *
+	 *															 	ELEMENT ACCESS BEGIN			                         *
+	 *                                                                                   *
+	 *************************************************************************************/
+
+	//<--- `__n` counts from the front
+	auto operator[]( size_type __n ) LLVM_MSTL_NOEXCEPT->reference { return __buf[ __wrap( __head + __n ) ]; }
+	auto operator[]( size_type __n ) const LLVM_MSTL_NOEXCEPT->const_reference { return __buf[ __wrap( __head + __n ) ]; }
+
+	/**
+	* @brief The element `__n` places from the front.
+	* @throws out_of_range If `__n >= size()`.
+	*/
+	auto at( size_type __n ) -> reference {
+		__check_index( __n );
+		return ( *this )[ __n ];
+	}
+
+	auto at( size_type __n ) const -> const_reference {
+		__check_index( __n );
+		return ( *this )[ __n ];
+	}
+
+	auto front() LLVM_MSTL_NOEXCEPT->reference { return __buf[ __head ]; }
+	auto front() const LLVM_MSTL_NOEXCEPT->const_reference { return __buf[ __head ]; }
+	auto back() LLVM_MSTL_NOEXCEPT->reference { return ( *this )[ __size - 1 ]; }
+	auto back() const LLVM_MSTL_NOEXCEPT->const_reference { return ( *this )[ __size - 1 ]; }
+
+	/**
+	* @brief The elements as two contiguous segments, front to back; the second one is empty unless they wrap around.
+	*/
+	auto as_spans() LLVM_MSTL_NOEXCEPT->core::array< span_type, 2 > {
+		const size_type __n1 = __front_segment();
+		return { span_type( __data() + __head, __n1 ), span_type( __data(), __size - __n1 ) };
+	}
+
+	auto as_spans() const LLVM_MSTL_NOEXCEPT->core::array< const_span_type, 2 > {
+		const size_type __n1 = __front_segment();
+		return { const_span_type( __data() + __head, __n1 ), const_span_type( __data(), __size - __n1 ) };
+	}
+
+	/**
+	* @brief Rotates the elements in place so that they start at the first slot, and returns them as one span.
+	*
+	* O(size()) element moves at most, no allocation. The next pushes wrap around again.
+	*/
+	auto linearize() -> span_type;
+
+	/*************************************************************************************
+	 *                                                                                   *
+	 *															 	ELEMENT ACCESS END			                           *
+	 *                                                                                   *
+	 *************************************************************************************/
+
+	/*************************************************************************************
+	 *                                                                                   *
+	 *															 	MODIFIERS BEGIN			               	               *
+	 *                                                                                   *
+	 *************************************************************************************/
+
+	/**
+	* @brief Appends an element built from `__args`.
+	*
+	* On a full buffer, `overwrite` assigns the new element over the front one, which then becomes the back.
+	*
+	* @throws length_error If the buffer is full and the policy is `fixed`, or it has no capacity to overwrite.
+	*/
+	template < typename... _Args >
+	auto emplace_back( _Args&&... __args ) -> reference;
+
+	//<--- the mirror image of `emplace_back`: on a full buffer, `overwrite` replaces the back element
+	template < typename... _Args >
+	auto emplace_front( _Args&&... __args ) -> reference;
+
+	auto push_back( const value_type& __x ) -> void { emplace_back( __x ); }
+	auto push_back( value_type&& __x ) -> void { emplace_back( core::move( __x ) ); }
+	auto push_front( const value_type& __x ) -> void { emplace_front( __x ); }
+	auto push_front( value_type&& __x ) -> void { emplace_front( core::move( __x ) ); }
+
+	auto pop_front() LLVM_MSTL_NOEXCEPT->void {
+		__alloc_traits::destroy( __alloc(), core::to_address( __buf + __head ) );
+		__head = __wrap( __head + 1 );
+		--__size;
+	}
+
+	auto pop_back() LLVM_MSTL_NOEXCEPT->void {
+		__alloc_traits::destroy( __alloc(), core::to_address( __buf + __wrap( __head + __size - 1 ) ) );
+		--__size;
+	}
+
+	/**
+	* @brief Appends the `__n` elements starting at `__first`, copied in at most two segments.
+	*
+	* With `overwrite` the oldest elements make room, and only the last `capacity()` of the range are kept if it
+	* is longer than that; with `grow` the buffer reallocates once for the whole range.
+	*
+	* @throws length_error If the elements do not fit and the policy is `fixed`.
+	*/
+	template < typename _ForwardIterator >
+		requires( __is_cpp17_forward_iterator< _ForwardIterator >::value )
+	auto push_n( _ForwardIterator __first, size_type __n ) -> void;
+
+	auto push_n( const_span_type __s ) -> void { push_n( __s.data(), __s.size() ); }
+
+	/**
+	* @brief Moves the `min( __n, size() )` front elements to `__out` in at most two segments and pops them.
+	*
+	* @return The end of the written range.
+	*/
+	template < typename _OutputIterator >
+	auto pop_n( _OutputIterator __out, size_type __n ) -> _OutputIterator;
+
+	//<--- drops the `min( __n, size() )` front elements
+	auto pop_n( size_type __n ) LLVM_MSTL_NOEXCEPT->void {
+		__n = core::min( __n, __size );
+		for ( ; __n != 0; --__n ) pop_front();
+	}
+
+	auto clear() LLVM_MSTL_NOEXCEPT->void {
+		pop_n( __size );
+		__head = 0;
+	}
+
+	auto swap( circular_buffer& __x )
+		LLVM_MSTL_NOEXCEPT_V( !__alloc_traits::propagate_on_container_swap::value || core::is_nothrow_swappable_v< allocator_type > )
+			->void {
+		__swap_storage( __x );
+		core::swap( __pol, __x.__pol );
+		__swap_allocator( __alloc(), __x.__alloc() );
+	}
+
+	friend auto swap( circular_buffer& __x, circular_buffer& __y ) LLVM_MSTL_NOEXCEPT_V( LLVM_MSTL_NOEXCEPT( __x.swap( __y ) ) )->void { __x.swap( __y ); }
+
+	/*************************************************************************************
+	 *                                                                                   *
+	 *															 		MODIFIERS END			               	               *
+	 *                                                                                   *
+	 *************************************************************************************/
+
+	//<--- same elements in the same order; the capacities, the layouts and the policies may differ
+	friend auto operator==( const circular_buffer& __x, const circular_buffer& __y ) -> bool {
+		return __x.size() == __y.size() && core::equal( __x.begin(), __x.end(), __y.begin() );
+	}
+
+private:
+	auto __alloc() LLVM_MSTL_NOEXCEPT->allocator_type& { return __capm.second(); }
+	auto __alloc() const LLVM_MSTL_NOEXCEPT->const allocator_type& { return __capm.second(); }
+	auto __cap() LLVM_MSTL_NOEXCEPT->size_type& { return __capm.first(); }
+	auto __cap() const LLVM_MSTL_NOEXCEPT->const size_type& { return __capm.first(); }
+
+	auto __data() const LLVM_MSTL_NOEXCEPT->value_type* { return core::to_address( __buf ); }
+
+	//<--- the slot of `__i < 2 * capacity()`, counted from the first slot around the ring
+	auto __wrap( size_type __i ) const LLVM_MSTL_NOEXCEPT->size_type { return __i >= capacity() ? __i - capacity() : __i; }
+
+	//<--- the number of elements from the front up to the end of the storage
+	auto __front_segment() const LLVM_MSTL_NOEXCEPT->size_type { return core::min( __size, capacity() - __head ); }
+
+	auto __check_index( size_type __n ) const -> void {
+		if ( __n >= __size ) {
+			spdlog::error( "circular_buffer::at index out of range, __n[{}] size()[{}]", __n, __size );
+			nya::__throw_out_of_range( "circular_buffer" );
+		}
+	}
+
+	auto __check_length( size_type __n ) const -> void {
+		if ( __n > max_size() ) {
+			spdlog::error( "circular_buffer length exceeds max_size(), __n[{}] max_size()[{}]", __n, max_size() );
+			nya::__throw_length_error( "circular_buffer" );
+		}
+	}
+
+	LLVM_MSTL_NORETURN auto __throw_full( size_type __n ) const -> void {
+		spdlog::error( "circular_buffer is full, size()[{}] + __n[{}] > capacity()[{}]", __size, __n, capacity() );
+		nya::__throw_length_error( "circular_buffer" );
+	}
+
+	//<--- storage for `__n` elements of an empty buffer
+	auto __allocate( size_type __n ) -> void {
+		__check_length( __n );
+		if ( __n != 0 ) __buf = __alloc_traits::allocate( __alloc(), __n );
+		__cap()  = __n;
+		__head   = 0;
+	}
+
+	auto __deallocate() LLVM_MSTL_NOEXCEPT->void {
+		clear();
+		if ( __buf ) __alloc_traits::deallocate( __alloc(), __buf, capacity() );
+		__buf   = nullptr;
+		__cap() = 0;
+	}
+
+	auto __swap_storage( circular_buffer& __x ) LLVM_MSTL_NOEXCEPT->void {
+		core::swap( __buf, __x.__buf );
+		core::swap( __head, __x.__head );
+		core::swap( __size, __x.__size );
+		core::swap( __cap(), __x.__cap() );
+	}
+
+	/**
+	* @brief Moves the elements to a new storage of exactly `__n >= size()` slots, starting at its first slot.
+	*
+	* The elements are moved if that cannot throw, copied otherwise, so the buffer is left untouched on failure.
+	*/
+	auto __reallocate( size_type __n ) -> void;
+
+	//<--- the capacity `grow` moves to when `__n` more elements are needed
+	auto __recommend( size_type __n ) const -> size_type {
+		if ( __n > max_size() - __size ) {
+			spdlog::error( "circular_buffer length exceeds max_size(), size()[{}] + __n[{}] > max_size()[{}]", __size, __n, max_size() );
+			nya::__throw_length_error( "circular_buffer" );
+		}
+		const size_type __required = __size + __n;
+		if ( capacity() >= max_size() / 2 ) return core::max( max_size(), __required );
+		return core::max( 2 * capacity(), __required );
+	}
+
+	/**
+	* @brief Moves `[__first, __last)` down to `__to`, with `__to <= __first` and the slots from `__to` up to `__first` raw.
+	*
+	* Raw slots are move-constructed, live ones move-assigned, and the slots left behind are destroyed.
+	*/
+	auto __shift_down( pointer __first, pointer __last, pointer __to ) -> void;
+
+	pointer                                        __buf  = nullptr;//<--- the storage, `capacity()` slots
+	size_type                                      __head = 0;      //<--- the slot of the front element
+	size_type                                      __size = 0;      //<--- the number of elements, from `__head` around the ring
+	__compressed_pair< size_type, allocator_type > __capm;          //<--- the capacity and the allocator
+	circular_buffer_policy                         __pol = circular_buffer_policy::grow;
+};
+
+template < typename _Tp, typename _Allocator >
+template < typename... _Args >
+auto circular_buffer< _Tp, _Allocator >::emplace_back( _Args&&... __args ) -> reference {
+	if ( full() ) {
+		if ( __pol == circular_buffer_policy::overwrite && capacity() != 0 ) {
+			//<--- the value is built before the front is touched, the arguments may refer to it
+			front() = value_type( core::forward< _Args >( __args )... );
+			__head  = __wrap( __head + 1 );
+			return back();
+		}
+		if ( __pol != circular_buffer_policy::grow ) __throw_full( 1 );
+		__temp_value< value_type, allocator_type > __tmp( __alloc(), core::forward< _Args >( __args )... );
+		__reallocate( __recommend( 1 ) );
+		__alloc_traits::construct( __alloc(), core::to_address( __buf + __wrap( __head + __size ) ), core::move( __tmp.get() ) );
+	} else {
+		__alloc_traits::construct( __alloc(), core::to_address( __buf + __wrap( __head + __size ) ), core::forward< _Args >( __args )... );
+	}
+	++__size;
+	return back();
+}
+
+template < typename _Tp, typename _Allocator >
+template < typename... _Args >
+auto circular_buffer< _Tp, _Allocator >::emplace_front( _Args&&... __args ) -> reference {
+	if ( full() ) {
+		if ( __pol == circular_buffer_policy::overwrite && capacity() != 0 ) {
+			back() = value_type( core::forward< _Args >( __args )... );
+			__head = __wrap( __head + capacity() - 1 );
+			return front();
+		}
+		if ( __pol != circular_buffer_policy::grow ) __throw_full( 1 );
+		__temp_value< value_type, allocator_type > __tmp( __alloc(), core::forward< _Args >( __args )... );
+		__reallocate( __recommend( 1 ) );
+		const size_type __slot = __wrap( __head + capacity() - 1 );
+		__alloc_traits::construct( __alloc(), core::to_address( __buf + __slot ), core::move( __tmp.get() ) );
+		__head = __slot;
+	} else {
+		const size_type __slot = __wrap( __head + capacity() - 1 );
+		__alloc_traits::construct( __alloc(), core::to_address( __buf + __slot ), core::forward< _Args >( __args )... );
+		__head = __slot;
+	}
+	++__size;
+	return front();
+}
+
+template < typename _Tp, typename _Allocator >
+template < typename _ForwardIterator >
+	requires( __is_cpp17_forward_iterator< _ForwardIterator >::value )
+auto circular_buffer< _Tp, _Allocator >::push_n( _ForwardIterator __first, size_type __n ) -> void {
+	if constexpr ( core::is_same_v< _ForwardIterator, value_type* > ) {
+		//<--- as a pointer to const, a trivially copyable range takes the `memmove` path of `__uninitialized_allocator_copy`
+		push_n( static_cast< const value_type* >( __first ), __n );
+	} else {
+		if ( __n > capacity() - __size ) {
+			switch ( __pol ) {
+				case circular_buffer_policy::grow:
+					__reallocate( __recommend( __n ) );
+					break;
+				case circular_buffer_policy::fixed:
+					__throw_full( __n );
+				case circular_buffer_policy::overwrite:
+					if ( __n >= capacity() ) {
+						clear();
+						core::advance( __first, static_cast< difference_type >( __n - capacity() ) );
+						__n = capacity();
+					} else {
+						pop_n( __n - ( capacity() - __size ) );
+					}
+					break;
+			}
+		}
+		if ( __n == 0 ) return;
+
+		const size_type __tail = __wrap( __head + __size );
+		const size_type __n1   = core::min( __n, capacity() - __tail );
+		auto            __mid  = core::next( __first, static_cast< difference_type >( __n1 ) );
+		__uninitialized_allocator_copy( __alloc(), __first, __mid, __data() + __tail );
+		auto __guard = __make_exception_guard( [ & ]() {
+			__alloctor_destroy( __alloc(), __data() + __tail, __data() + __tail + __n1 );
+		} );
+		__uninitialized_allocator_copy( __alloc(), __mid, core::next( __mid, static_cast< difference_type >( __n - __n1 ) ), __data() );
+		__guard.__complete();
+		__size += __n;
+	}
+}
+
+template < typename _Tp, typename _Allocator >
+template < typename _OutputIterator >
+auto circular_buffer< _Tp, _Allocator >::pop_n( _OutputIterator __out, size_type __n ) -> _OutputIterator {
+	__n                  = core::min( __n, __size );
+	const size_type __n1 = core::min( __n, capacity() - __head );
+	__out                = core::move( __data() + __head, __data() + __head + __n1, __out );
+	__out                = core::move( __data(), __data() + ( __n - __n1 ), __out );
+	pop_n( __n );
+	return __out;
+}
+
+template < typename _Tp, typename _Allocator >
+auto circular_buffer< _Tp, _Allocator >::linearize() -> span_type {
+	if ( __head != 0 ) {
+		const size_type __n1 = __front_segment();
+		if ( __n1 == __size ) {
+			__shift_down( __buf + __head, __buf + __head + __size, __buf );
+		} else {
+			//<--- [ back segment | raw | front segment ]: close the gap, then swap the two segments
+			const size_type __n2 = __size - __n1;
+			__shift_down( __buf + __head, __buf + capacity(), __buf + __n2 );
+			core::rotate( __buf, __buf + __n2, __buf + __size );
+		}
+		__head = 0;
+	}
+	return span_type( __data(), __size );
+}
+
+template < typename _Tp, typename _Allocator >
+auto circular_buffer< _Tp, _Allocator >::__shift_down( pointer __first, pointer __last, pointer __to ) -> void {
+	if ( __to == __first ) return;//<--- a full buffer, no gap to close
+	pointer __d = __to;
+	for ( pointer __s = __first; __s != __last; ++__s, (void) ++__d ) {
+		if ( __d < __first ) __alloc_traits::construct( __alloc(), core::to_address( __d ), core::move( *__s ) );
+		else *__d = core::move( *__s );
+	}
+	__alloctor_destroy( __alloc(), core::max( __d, __first ), __last );
+}
+
+template < typename _Tp, typename _Allocator >
+auto circular_buffer< _Tp, _Allocator >::__reallocate( size_type __n ) -> void {
+	circular_buffer __t( __n, __pol, __alloc() );
+	const size_type __n1 = __front_segment();
+	pointer         __p  = __uninitialized_allocator_move_if_noexcept( __alloc(), __buf + __head, __buf + __head + __n1, __t.__buf );
+	__t.__size           = __n1;//<--- destroyed by `__t` if the second segment throws
+	__uninitialized_allocator_move_if_noexcept( __alloc(), __buf, __buf + ( __size - __n1 ), __p );
+	__t.__size = __size;
+	__swap_storage( __t );
+}
+
+LLVM_MSTL_END_NAMESPACE_STD
+
+#endif//LLVM_MSTL_CIRCULAR_BUFFER_H
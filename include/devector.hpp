@@ -0,0 +1,656 @@
+#ifndef LLVM_MSTL_DEVECTOR_H
+#define LLVM_MSTL_DEVECTOR_H
+
+/**
+ * @file devector.hpp
+ * @brief A contiguous sequence with amortized O(1) insertion and removal at both ends.
+ */
+
+#include "__algorithm/remove_if.h"
+#include "__config.h"
+#include "__iterator/iterator_traits.h"
+#include "__iterator/wrap_iter.h"
+#include "__memory/temp_value.h"
+#include "__memory/uninitialized_algorithms.h"
+#include "__split_buffer.h"
+#include "__utility/exception_guard.h"
+#include "stdexcept.h"
+
+#include "spdlog/spdlog.h"
+
+#include <algorithm>
+#include <initializer_list>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <span>
+#include <type_traits>
+#include <utility>
+
+LLVM_MSTL_BEGIN_NAMESPACE_STD
+LLVM_MSTL_CORE_STD
+
+/**
+ * @brief The default growth policy of @ref devector.
+ *
+ * When a side runs out of room the elements are laid out again, in place or in a new allocation, and the free
+ * slots are split between the two sides: `_FrontSlack` percent of them go in front of the elements, the rest
+ * behind. A queue that only pushes at the back and pops at the front (a sliding window) wants `_FrontSlack = 0`,
+ * a stack growing at the front wants 100.
+ *
+ * @tparam _FrontSlack The share of the free slots kept in front of the elements, in percent.
+ * @tparam _MinCapacity The capacity of the first allocation.
+ */
+template < size_t _FrontSlack = 50, size_t _MinCapacity = 8 >
+struct devector_growth {
+	static_assert( _FrontSlack <= 100, "devector_growth: the front slack is a percentage" );
+
+	//<--- the capacity to reallocate to from `__cap` when `__required` slots are needed
+	static LLVM_MSTL_CONSTEXPR auto capacity( size_t __cap, size_t __required ) LLVM_MSTL_NOEXCEPT->size_t {
+		return core::max( { 2 * __cap, __required, _MinCapacity } );
+	}
+
+	//<--- how many of `__spare` free slots are placed in front of the elements
+	static LLVM_MSTL_CONSTEXPR auto front_slack( size_t __spare ) LLVM_MSTL_NOEXCEPT->size_t {
+		return __spare / 100 * _FrontSlack + __spare % 100 * _FrontSlack / 100;
+	}
+
+	//<--- whether `__required` slots fit in `__cap` loosely enough to re-center in place rather than reallocate
+	static LLVM_MSTL_CONSTEXPR auto recenter( size_t __cap, size_t __required ) LLVM_MSTL_NOEXCEPT->bool {
+		return __required <= __cap / 2;
+	}
+};
+
+/**
+ * @brief A double-ended vector: contiguous elements with free capacity on both sides.
+ *
+ * @ref https://www.boost.org/doc/libs/release/doc/html/container/non_standard_containers.html#container.non_standard_containers.devector
+ *
+ * The elements live in a @ref __split_buffer, whose free slots in front of the elements make `push_front` and
+ * `pop_front` as cheap as `push_back` and `pop_back`, while `data()` and `span()` still see one contiguous array,
+ * which neither `vector` (O(n) at the front) nor a `deque` (segmented) gives.
+ *
+ * A side that runs out of room is refilled by `_Growth` (see @ref devector_growth): if the elements take at most
+ * half of the capacity they are shifted in place, otherwise they move to a larger allocation. `insert` and `erase`
+ * in the middle shift whichever side of the position is shorter. Emptying the devector puts its elements back
+ * where the policy wants them, so a sliding window that drains regularly never shifts at all.
+ *
+ * @code{.cc}
+ * nya::devector< int, core::allocator< int >, nya::devector_growth< 0 > > __window;
+ * for ( int __x : __samples ) {
+ *   __window.push_back( __x );
+ *   if ( __window.size() > 64 ) __window.pop_front();
+ *   consume( __window.span() );
+ * }
+ * @endcode
+ *
+ * @tparam _Tp The element type.
+ * @tparam _Allocator The allocator of the elements.
+ * @tparam _Growth The growth policy.
+ */
+template < typename _Tp, typename _Allocator = core::allocator< _Tp >, typename _Growth = devector_growth<> >
+class LLVM_MSTL_TEMPLATE_VIS devector {
+	using __buffer_type  = __split_buffer< _Tp, _Allocator >;
+	using __alloc_traits = core::allocator_traits< _Allocator >;
+
+public:
+	using value_type             = _Tp;
+	using allocator_type         = _Allocator;
+	using growth_policy          = _Growth;
+	using size_type              = typename __alloc_traits::size_type;
+	using difference_type        = typename __alloc_traits::difference_type;
+	using reference              = value_type&;
+	using const_reference        = const value_type&;
+	using pointer                = typename __alloc_traits::pointer;
+	using const_pointer          = typename __alloc_traits::const_pointer;
+	using iterator               = __wrap_iter< pointer >;
+	using const_iterator         = __wrap_iter< const_pointer >;
+	using reverse_iterator       = core::reverse_iterator< iterator >;
+	using const_reverse_iterator = core::reverse_iterator< const_iterator >;
+
+	static_assert( core::is_same_v< value_type, typename allocator_type::value_type >, "devector: allocator of another type" );
+
+	/*************************************************************************************
+	 *                                                                                   *
+	 *															CONSTRUCTOR BEGIN		                                 *
+	 *                                                                                   *
+	 *************************************************************************************/
+
+	devector() LLVM_MSTL_NOEXCEPT_V( core::is_nothrow_default_constructible_v< allocator_type > ) = default;
+
+	explicit devector( const allocator_type& __a ) LLVM_MSTL_NOEXCEPT
+			: __buf( __a ) {}
+
+	explicit devector( size_type __n, const allocator_type& __a = allocator_type() )
+			: __buf( __a ) {
+		resize( __n );
+	}
+
+	devector( size_type __n, const value_type& __x, const allocator_type& __a = allocator_type() )
+			: __buf( __a ) {
+		resize( __n, __x );
+	}
+
+	template < typename _InputIterator >
+		requires( __has_iterator_category_convertible_to< _InputIterator, core::input_iterator_tag >::value )
+	devector( _InputIterator __first, _InputIterator __last, const allocator_type& __a = allocator_type() )
+			: __buf( __a ) {
+		assign( __first, __last );
+	}
+
+	devector( core::initializer_list< value_type > __il, const allocator_type& __a = allocator_type() )
+			: devector( __il.begin(), __il.end(), __a ) {}
+
+	devector( const devector& __x )
+			: __buf( __alloc_traits::select_on_container_copy_construction( __x.__alloc() ) ) {
+		assign( __x.begin(), __x.end() );
+	}
+
+	devector( const devector& __x, const allocator_type& __a )
+			: __buf( __a ) {
+		assign( __x.begin(), __x.end() );
+	}
+
+	devector( devector&& __x ) LLVM_MSTL_NOEXCEPT
+			: __buf( core::move( __x.__buf ) ) {}
+
+	devector( devector&& __x, const allocator_type& __a )
+			: __buf( __a ) {
+		if ( __a == __x.__alloc() ) __swap_storage( __x.__buf );
+		else assign( core::make_move_iterator( __x.begin() ), core::make_move_iterator( __x.end() ) );
+	}
+
+	auto operator=( const devector& __x ) -> devector& {
+		if ( this != core::addressof( __x ) ) {
+			if constexpr ( __alloc_traits::propagate_on_container_copy_assignment::value ) {
+				if ( __alloc() != __x.__alloc() ) {
+					clear();
+					shrink_to_fit();
+				}
+				__alloc() = __x.__alloc();
+			}
+			assign( __x.begin(), __x.end() );
+		}
+		return *this;
+	}
+
+	auto operator=( devector&& __x )
+		LLVM_MSTL_NOEXCEPT_V( __alloc_traits::propagate_on_container_move_assignment::value || __alloc_traits::is_always_equal::value )
+			->devector& {
+		if ( this == core::addressof( __x ) ) return *this;
+		if constexpr ( __alloc_traits::propagate_on_container_move_assignment::value ) {
+			__release();
+			__alloc() = core::move( __x.__alloc() );
+			__swap_storage( __x.__buf );
+		} else if ( __alloc_traits::is_always_equal::value || __alloc() == __x.__alloc() ) {
+			__release();
+			__swap_storage( __x.__buf );
+		} else {
+			assign( core::make_move_iterator( __x.begin() ), core::make_move_iterator( __x.end() ) );
+		}
+		return *this;
+	}
+
+	auto operator=( core::initializer_list< value_type > __il ) -> devector& {
+		assign( __il.begin(), __il.end() );
+		return *this;
+	}
+
+	/*************************************************************************************
+	 *                                                                                   *
+	 *																CONSTRUCTOR END			                               *
+	 *                                                                                   *
+	 *************************************************************************************/
+
+	template < typename _InputIterator >
+		requires( __has_iterator_category_convertible_to< _InputIterator, core::input_iterator_tag >::value )
+	auto assign( _InputIterator __first, _InputIterator __last ) -> void {
+		if constexpr ( __is_cpp17_forward_iterator< _InputIterator >::value ) {
+			const auto __n = static_cast< size_type >( core::distance( __first, __last ) );
+			if ( __n > capacity() ) {
+				__check_length( __n );
+				__split_buffer< value_type, allocator_type& > __t( __n, 0, __alloc() );
+				__t.__construct_at_end( __first, __last );
+				__swap_storage( __t );
+			} else {
+				clear();
+				__buf.__begin = __buf.__end = __buf.__first + _Growth::front_slack( capacity() - __n );
+				__buf.__end                 = __uninitialized_allocator_copy( __alloc(), __first, __last, __buf.__begin );
+			}
+		} else {
+			clear();
+			for ( ; __first != __last; ++__first ) emplace_back( *__first );
+		}
+	}
+
+	auto assign( size_type __n, const value_type& __x ) -> void {
+		clear();
+		resize( __n, __x );
+	}
+
+	auto assign( core::initializer_list< value_type > __il ) -> void { assign( __il.begin(), __il.end() ); }
+
+	auto get_allocator() const LLVM_MSTL_NOEXCEPT->allocator_type { return __alloc(); }
+
+	/*************************************************************************************
+	 *                                                                                   *
+	 *																ITERATORS BEGIN			                               *
+	 *                                                                                   *
+	 *************************************************************************************/
+
+	auto begin() LLVM_MSTL_NOEXCEPT->iterator { return iterator( this, __buf.__begin ); }
+	auto begin() const LLVM_MSTL_NOEXCEPT->const_iterator { return const_iterator( this, __buf.__begin ); }
+	auto end() LLVM_MSTL_NOEXCEPT->iterator { return iterator( this, __buf.__end ); }
+	auto end() const LLVM_MSTL_NOEXCEPT->const_iterator { return const_iterator( this, __buf.__end ); }
+	auto cbegin() const LLVM_MSTL_NOEXCEPT->const_iterator { return begin(); }
+	auto cend() const LLVM_MSTL_NOEXCEPT->const_iterator { return end(); }
+	auto rbegin() LLVM_MSTL_NOEXCEPT->reverse_iterator { return reverse_iterator( end() ); }
+	auto rbegin() const LLVM_MSTL_NOEXCEPT->const_reverse_iterator { return const_reverse_iterator( end() ); }
+	auto rend() LLVM_MSTL_NOEXCEPT->reverse_iterator { return reverse_iterator( begin() ); }
+	auto rend() const LLVM_MSTL_NOEXCEPT->const_reverse_iterator { return const_reverse_iterator( begin() ); }
+	auto crbegin() const LLVM_MSTL_NOEXCEPT->const_reverse_iterator { return rbegin(); }
+	auto crend() const LLVM_MSTL_NOEXCEPT->const_reverse_iterator { return rend(); }
+
+	/*************************************************************************************
+	 *                                                                                   *
+	 *																ITERATORS END			                                 *
+	 *                                                                                   *
+	 *************************************************************************************/
+
+	/*************************************************************************************
+	 *                                                                                   *
+	 *																CAPACITY BEGIN			                               *
+	 *                                                                                   *
+	 *************************************************************************************/
+
+	LLVM_MSTL_NODISCARD auto empty() const LLVM_MSTL_NOEXCEPT->bool { return __buf.__begin == __buf.__end; }
+	auto size() const LLVM_MSTL_NOEXCEPT->size_type { return __buf.size(); }
+	auto capacity() const LLVM_MSTL_NOEXCEPT->size_type { return static_cast< size_type >( __buf.__end_cap() - __buf.__first ); }
+
+	auto max_size() const LLVM_MSTL_NOEXCEPT->size_type {
+		return core::min< size_type >( __alloc_traits::max_size( __alloc() ), core::numeric_limits< difference_type >::max() );
+	}
+
+	//<--- the elements `push_front` can add before the storage is laid out again
+	auto front_free_capacity() const LLVM_MSTL_NOEXCEPT->size_type { return __buf.__front_spare(); }
+	//<--- the elements `push_back` can add before the storage is laid out again
+	auto back_free_capacity() const LLVM_MSTL_NOEXCEPT->size_type { return __buf.__back_spare(); }
+
+	//<--- same as `reserve_back`, as in `vector`
+	auto reserve( size_type __n ) -> void { reserve_back( __n ); }
+
+	/**
+	* @brief Makes room for `__n` elements counted from `begin()`, keeping the free slots in front.
+	* @throws length_error If `__n > max_size()`.
+	*/
+	auto reserve_back( size_type __n ) -> void {
+		if ( __n <= size() + back_free_capacity() ) return;
+		__check_length( __n );
+		__buf.__relocate_to( front_free_capacity() + __n, front_free_capacity() );
+	}
+
+	/**
+	* @brief Makes room for `__n` elements counted back from `end()`, keeping the free slots behind.
+	* @throws length_error If `__n > max_size()`.
+	*/
+	auto reserve_front( size_type __n ) -> void {
+		if ( __n <= size() + front_free_capacity() ) return;
+		__check_length( __n );
+		__buf.__relocate_to( __n + back_free_capacity(), __n - size() );
+	}
+
+	auto resize( size_type __n ) -> void { __resize( __n ); }
+	auto resize( size_type __n, const value_type& __x ) -> void { __resize( __n, __x ); }
+
+	//<--- drops the free slots on both sides
+	auto shrink_to_fit() -> void {
+		if ( capacity() > size() ) __buf.__relocate_to( size(), 0 );
+	}
+
+	/*************************************************************************************
+	 *                                                                                   *
+	 *																CAPACITY END			                                 *
+	 *                                                                                   *
+	 *************************************************************************************/
+
+	/*************************************************************************************
+	 *                                                                                   *
+	 *															 	ELEMENT ACCESS BEGIN			                         *
+	 *                                                                                   *
+	 *************************************************************************************/
+
+	auto operator[]( size_type __n ) LLVM_MSTL_NOEXCEPT->reference { return __buf.__begin[ __n ]; }
+	auto operator[]( size_type __n ) const LLVM_MSTL_NOEXCEPT->const_reference { return __buf.__begin[ __n ]; }
+
+	/**
+	* @brief The element at `__n`.
+	* @throws out_of_range If `__n >= size()`.
+	*/
+	auto at( size_type __n ) -> reference {
+		__check_index( __n );
+		return __buf.__begin[ __n ];
+	}
+
+	auto at( size_type __n ) const -> const_reference {
+		__check_index( __n );
+		return __buf.__begin[ __n ];
+	}
+
+	auto front() LLVM_MSTL_NOEXCEPT->reference { return *__buf.__begin; }
+	auto front() const LLVM_MSTL_NOEXCEPT->const_reference { return *__buf.__begin; }
+	auto back() LLVM_MSTL_NOEXCEPT->reference { return *( __buf.__end - 1 ); }
+	auto back() const LLVM_MSTL_NOEXCEPT->const_reference { return *( __buf.__end - 1 ); }
+
+	auto data() LLVM_MSTL_NOEXCEPT->value_type* { return core::to_address( __buf.__begin ); }
+	auto data() const LLVM_MSTL_NOEXCEPT->const value_type* { return core::to_address( __buf.__begin ); }
+
+	auto span() LLVM_MSTL_NOEXCEPT->core::span< value_type > { return core::span< value_type >( data(), size() ); }
+	auto span() const LLVM_MSTL_NOEXCEPT->core::span< const value_type > { return core::span< const value_type >( data(), size() ); }
+
+	/*************************************************************************************
+	 *                                                                                   *
+	 *															 	ELEMENT ACCESS END			                           *
+	 *                                                                                   *
+	 *************************************************************************************/
+
+	/*************************************************************************************
+	 *                                                                                   *
+	 *															 	MODIFIERS BEGIN			               	               *
+	 *                                                                                   *
+	 *************************************************************************************/
+
+	template < typename... _Args >
+	auto emplace_front( _Args&&... __args ) -> reference {
+		if ( __buf.__begin == __buf.__first ) {
+			//<--- the arguments may refer to an element that is about to move
+			__temp_value< value_type, allocator_type > __tmp( __alloc(), core::forward< _Args >( __args )... );
+			__make_room( true, 1 );
+			__alloc_traits::construct( __alloc(), core::to_address( __buf.__begin - 1 ), core::move( __tmp.get() ) );
+		} else {
+			__alloc_traits::construct( __alloc(), core::to_address( __buf.__begin - 1 ), core::forward< _Args >( __args )... );
+		}
+		--__buf.__begin;
+		return front();
+	}
+
+	template < typename... _Args >
+	auto emplace_back( _Args&&... __args ) -> reference {
+		if ( __buf.__end == __buf.__end_cap() ) {
+			__temp_value< value_type, allocator_type > __tmp( __alloc(), core::forward< _Args >( __args )... );
+			__make_room( false, 1 );
+			__alloc_traits::construct( __alloc(), core::to_address( __buf.__end ), core::move( __tmp.get() ) );
+		} else {
+			__alloc_traits::construct( __alloc(), core::to_address( __buf.__end ), core::forward< _Args >( __args )... );
+		}
+		++__buf.__end;
+		return back();
+	}
+
+	auto push_front( const value_type& __x ) -> void { emplace_front( __x ); }
+	auto push_front( value_type&& __x ) -> void { emplace_front( core::move( __x ) ); }
+	auto push_back( const value_type& __x ) -> void { emplace_back( __x ); }
+	auto push_back( value_type&& __x ) -> void { emplace_back( core::move( __x ) ); }
+
+	auto pop_front() LLVM_MSTL_NOEXCEPT->void {
+		__buf.__destruct_at_begin( __buf.__begin + 1 );
+		if ( empty() ) __recenter_empty();
+	}
+
+	auto pop_back() LLVM_MSTL_NOEXCEPT->void {
+		__buf.__destruct_at_end( __buf.__end - 1 );
+		if ( empty() ) __recenter_empty();
+	}
+
+	/**
+	* @brief Inserts an element built from `__args` before `__pos`, shifting the shorter side.
+	*
+	* @return An iterator to the new element.
+	*/
+	template < typename... _Args >
+	auto emplace( const_iterator __pos, _Args&&... __args ) -> iterator {
+		const size_type __i = static_cast< size_type >( __pos - cbegin() );
+		if ( __i == size() ) {
+			emplace_back( core::forward< _Args >( __args )... );
+		} else if ( __i == 0 ) {
+			emplace_front( core::forward< _Args >( __args )... );
+		} else {
+			__temp_value< value_type, allocator_type > __tmp( __alloc(), core::forward< _Args >( __args )... );
+			__insert_with( __i, 1, [ & ]( pointer __p ) {
+				__alloc_traits::construct( __alloc(), core::to_address( __p ), core::move( __tmp.get() ) );
+			} );
+		}
+		return begin() + static_cast< difference_type >( __i );
+	}
+
+	auto insert( const_iterator __pos, const value_type& __x ) -> iterator { return emplace( __pos, __x ); }
+	auto insert( const_iterator __pos, value_type&& __x ) -> iterator { return emplace( __pos, core::move( __x ) ); }
+
+	auto insert( const_iterator __pos, size_type __n, const value_type& __x ) -> iterator {
+		const size_type __i = static_cast< size_type >( __pos - cbegin() );
+		if ( __n != 0 ) {
+			__temp_value< value_type, allocator_type > __tmp( __alloc(), __x );
+			__insert_with( __i, __n, [ & ]( pointer __p ) {
+				__construct_fill_n( __p, __n, __tmp.get() );
+			} );
+		}
+		return begin() + static_cast< difference_type >( __i );
+	}
+
+	//<--- `[__first, __last)` must not point into the devector
+	template < typename _InputIterator >
+		requires( __has_iterator_category_convertible_to< _InputIterator, core::input_iterator_tag >::value )
+	auto insert( const_iterator __pos, _InputIterator __first, _InputIterator __last ) -> iterator {
+		const size_type __i = static_cast< size_type >( __pos - cbegin() );
+		if constexpr ( __is_cpp17_forward_iterator< _InputIterator >::value ) {
+			const auto __n = static_cast< size_type >( core::distance( __first, __last ) );
+			if ( __n != 0 ) {
+				__insert_with( __i, __n, [ & ]( pointer __p ) {
+					__uninitialized_allocator_copy( __alloc(), __first, __last, __p );
+				} );
+			}
+		} else {
+			devector __t( __first, __last, __alloc() );
+			insert( __pos, core::make_move_iterator( __t.begin() ), core::make_move_iterator( __t.end() ) );
+		}
+		return begin() + static_cast< difference_type >( __i );
+	}
+
+	auto insert( const_iterator __pos, core::initializer_list< value_type > __il ) -> iterator {
+		return insert( __pos, __il.begin(), __il.end() );
+	}
+
+	auto erase( const_iterator __pos ) -> iterator { return erase( __pos, __pos + 1 ); }
+
+	/**
+	* @brief Erases `[__first, __last)`, shifting the shorter side over the gap.
+	*
+	* @return An iterator to the element that followed the erased ones.
+	*/
+	auto erase( const_iterator __first, const_iterator __last ) -> iterator {
+		const auto __i = __first - cbegin();
+		pointer    __f = __buf.__begin + __i;
+		pointer    __l = __buf.__begin + ( __last - cbegin() );
+		if ( __f != __l ) {
+			if ( __f - __buf.__begin < __buf.__end - __l ) __buf.__destruct_at_begin( core::move_backward( __buf.__begin, __f, __l ) );
+			else __buf.__destruct_at_end( core::move( __l, __buf.__end, __f ) );
+			if ( empty() ) __recenter_empty();
+		}
+		return begin() + __i;
+	}
+
+	auto clear() LLVM_MSTL_NOEXCEPT->void {
+		__buf.clear();
+		__recenter_empty();
+	}
+
+	auto swap( devector& __x ) LLVM_MSTL_NOEXCEPT_V( !__alloc_traits::propagate_on_container_swap::value || core::is_nothrow_swappable_v< allocator_type > )
+		->void {
+		__buf.swap( __x.__buf );
+	}
+
+	friend auto swap( devector& __x, devector& __y ) LLVM_MSTL_NOEXCEPT_V( LLVM_MSTL_NOEXCEPT( __x.swap( __y ) ) )->void { __x.swap( __y ); }
+
+	/*************************************************************************************
+	 *                                                                                   *
+	 *															 		MODIFIERS END			               	               *
+	 *                                                                                   *
+	 *************************************************************************************/
+
+	friend auto operator==( const devector& __x, const devector& __y ) -> bool {
+		return __x.size() == __y.size() && core::equal( __x.begin(), __x.end(), __y.begin() );
+	}
+
+private:
+	//<--- an in-place shift never leaves a half moved sequence behind
+	static LLVM_MSTL_CONSTEXPR bool __nothrow_shift =
+		__buffer_type::__relocate_by_memmove ||
+		( core::is_nothrow_move_constructible_v< value_type > && core::is_nothrow_move_assignable_v< value_type > );
+
+	auto __alloc() LLVM_MSTL_NOEXCEPT->allocator_type& { return __buf.__alloc(); }
+	auto __alloc() const LLVM_MSTL_NOEXCEPT->const allocator_type& { return __buf.__alloc(); }
+
+	auto __check_index( size_type __n ) const -> void {
+		if ( __n >= size() ) {
+			spdlog::error( "devector::at index out of range, __n[{}] size()[{}]", __n, size() );
+			nya::__throw_out_of_range( "devector" );
+		}
+	}
+
+	auto __check_length( size_type __n ) const -> void {
+		if ( __n > max_size() ) {
+			spdlog::error( "devector length exceeds max_size(), __n[{}] max_size()[{}]", __n, max_size() );
+			nya::__throw_length_error( "devector" );
+		}
+	}
+
+	//<--- takes over the storage of `__t` and gives it the old one, which `__t` then destroys and frees
+	template < typename _Buffer >
+	auto __swap_storage( _Buffer& __t ) LLVM_MSTL_NOEXCEPT->void {
+		core::swap( __buf.__first, __t.__first );
+		core::swap( __buf.__begin, __t.__begin );
+		core::swap( __buf.__end, __t.__end );
+		core::swap( __buf.__end_cap(), __t.__end_cap() );
+	}
+
+	//<--- destroys the elements and frees the storage, the allocator is left alone
+	auto __release() LLVM_MSTL_NOEXCEPT->void {
+		__split_buffer< value_type, allocator_type& > __t( __alloc() );
+		__swap_storage( __t );
+	}
+
+	//<--- with nothing to keep, the next pushes start from where the policy places the elements
+	auto __recenter_empty() LLVM_MSTL_NOEXCEPT->void {
+		__buf.__begin = __buf.__end = __buf.__first + _Growth::front_slack( capacity() );
+	}
+
+	/**
+	* @brief Guarantees `__n` free slots in front of the elements, or behind them if `!__at_front`.
+	*
+	* The elements are re-centered in place when `_Growth` allows it and moves cannot throw, and moved to a larger
+	* allocation otherwise. Either way the other free slots are split as `_Growth::front_slack` says.
+	*
+	* @throws length_error If `size() + __n > max_size()`.
+	*/
+	auto __make_room( bool __at_front, size_type __n ) -> void {
+		if ( ( __at_front ? front_free_capacity() : back_free_capacity() ) >= __n ) return;
+		const size_type __sz = size();
+		if ( __n > max_size() - __sz ) {
+			spdlog::error( "devector length exceeds max_size(), size()[{}] + __n[{}]", __sz, __n );
+			nya::__throw_length_error( "devector" );
+		}
+		const size_type __required = __sz + __n;
+		const size_type __cap      = capacity();
+		size_type       __new_cap  = __cap;
+		if ( !( __nothrow_shift && _Growth::recenter( __cap, __required ) ) ) {
+			__new_cap = core::min( core::max( _Growth::capacity( __cap, __required ), __required ), max_size() );
+		}
+		const size_type __spare = __new_cap - __required;
+		const size_type __front = core::min( _Growth::front_slack( __spare ), __spare ) + ( __at_front ? __n : 0 );
+		if ( __new_cap == __cap ) __buf.__shift_to( __buf.__first + __front );
+		else __buf.__relocate_to( __new_cap, __front );
+	}
+
+	//<--- builds `__n` copies of `__x` in the raw slots at `__p`, all or none
+	auto __construct_fill_n( pointer __p, size_type __n, const value_type& __x ) -> void {
+		pointer __cur   = __p;
+		auto    __guard = __make_exception_guard( [ & ]() {
+      while ( __cur != __p ) __alloc_traits::destroy( __alloc(), core::to_address( --__cur ) );
+    } );
+		for ( ; __n != 0; --__n, (void) ++__cur ) __alloc_traits::construct( __alloc(), core::to_address( __cur ), __x );
+		__guard.__complete();
+	}
+
+	/**
+	* @brief Inserts `__n` elements at index `__i`, built in raw slots by `__construct( __p )`.
+	*
+	* The side of `__i` holding fewer elements is shifted, unless only the other side has `__n` free slots. The
+	* new elements are built next to that side, then rotated into place.
+	*/
+	template < typename _Construct >
+	auto __insert_with( size_type __i, size_type __n, _Construct __construct ) -> void {
+		bool __at_front = __i < size() - __i;
+		if ( ( __at_front ? front_free_capacity() : back_free_capacity() ) < __n &&
+				 ( __at_front ? back_free_capacity() : front_free_capacity() ) >= __n ) {
+			__at_front = !__at_front;
+		}
+		__make_room( __at_front, __n );
+		if ( __at_front ) {
+			pointer __old_begin = __buf.__begin;
+			__construct( __old_begin - __n );
+			__buf.__begin = __old_begin - __n;
+			core::rotate( __buf.__begin, __old_begin, __old_begin + __i );
+		} else {
+			pointer __old_end = __buf.__end;
+			__construct( __old_end );
+			__buf.__end = __old_end + __n;
+			core::rotate( __buf.__begin + __i, __old_end, __buf.__end );
+		}
+	}
+
+	template < typename... _Args >
+	auto __resize( size_type __n, const _Args&... __args ) -> void {
+		const size_type __sz = size();
+		if ( __n <= __sz ) {
+			__buf.__destruct_at_end( __buf.__begin + __n );
+			if ( empty() ) __recenter_empty();
+			return;
+		}
+		__make_room( false, __n - __sz );
+		pointer __old_end = __buf.__end;
+		auto    __guard   = __make_exception_guard( [ & ]() { __buf.__destruct_at_end( __old_end ); } );
+		for ( ; __buf.__end != __old_end + ( __n - __sz ); ++__buf.__end ) {
+			__alloc_traits::construct( __alloc(), core::to_address( __buf.__end ), __args... );
+		}
+		__guard.__complete();
+	}
+
+	__buffer_type __buf;//<--- the elements in [__begin, __end), free slots in [__first, __begin) and [__end, __end_cap())
+};
+
+/**
+ * @brief Erases every element equal to `__v`.
+ *
+ * @return The number of erased elements.
+ */
+template < typename _Tp, typename _Allocator, typename _Growth, typename _Up >
+auto erase( devector< _Tp, _Allocator, _Growth >& __c, const _Up& __v ) -> typename devector< _Tp, _Allocator, _Growth >::size_type {
+	return erase_if( __c, [ & ]( const auto& __e ) -> bool { return __e == __v; } );
+}
+
+/**
+ * @brief Erases every element satisfying `__pred`.
+ *
+ * @return The number of erased elements.
+ */
+template < typename _Tp, typename _Allocator, typename _Growth, typename _Predicate >
+auto erase_if( devector< _Tp, _Allocator, _Growth >& __c, _Predicate __pred ) -> typename devector< _Tp, _Allocator, _Growth >::size_type {
+	const auto __old_size = __c.size();
+	_Tp*       __data     = __c.data();
+	_Tp*       __new_last = nya::__remove_if( __data, __data + __old_size, __pred );
+	__c.erase( __c.begin() + ( __new_last - __data ), __c.end() );
+	return __old_size - __c.size();
+}
+
+LLVM_MSTL_END_NAMESPACE_STD
+
+#endif//LLVM_MSTL_DEVECTOR_H
@@ -0,0 +1,471 @@
+#ifndef LLVM_MSTL_DYNAMIC_BITSET_H
+#define LLVM_MSTL_DYNAMIC_BITSET_H
+
+/**
+ * @file dynamic_bitset.hpp
+ * @brief A run-time sized bitset for bulk set algebra over row-selection bitmaps.
+ */
+
+#include "__algorithm/simd_words.h"
+#include "__config.h"
+#include "__memory/aligned_allocator.h"
+#include "stdexcept.h"
+#include "vector.hpp"
+
+#include "spdlog/spdlog.h"
+
+#include <algorithm>
+#include <bit>
+#include <limits>
+#include <stdint.h>
+#include <type_traits>
+
+LLVM_MSTL_BEGIN_NAMESPACE_STD
+LLVM_MSTL_CORE_STD
+
+/**
+ * @brief A bitset whose size is chosen at run time.
+ *
+ * The bits live in a `nya::vector< uint64_t >` whose storage is aligned to 64 bytes (one cache line), bit `i`
+ * being bit `i % 64` of block `i / 64`. The bits past `size()` in the last block are always zero, so `count`,
+ * `any`, `none` and `operator==` never need to mask.
+ *
+ * The set operations `&=`, `|=`, `^=` and `-=`, and `count`, run the word kernels of the library built for the
+ * host, see @ref simd_isa: AVX2 or AVX-512 registers where the host has them. `~` is a plain loop over the
+ * blocks that the compiler vectorizes. `combine` evaluates an expression over several bitsets (e.g. `a & b & ~c`) in a single pass,
+ * without the intermediate bitsets and the extra trips through memory that chaining the operators costs.
+ *
+ * @code{cc}
+ * nya::dynamic_bitset<> __rows( 1 << 20 );
+ * __rows.combine( []( auto __w, auto __x, auto __y, auto __z ) { return __x & __y & ~__z; }, __a, __b, __c );
+ * __rows.for_each_set( [ & ]( size_t __row ) { __emit( __row ); } );
+ * @endcode
+ *
+ * @tparam _Allocator The allocator of the `uint64_t` blocks.
+ */
+template < typename _Allocator = __aligned_allocator< uint64_t, 64 > >
+class LLVM_MSTL_TEMPLATE_VIS dynamic_bitset {
+public:
+	using block_type     = uint64_t;
+	using allocator_type = _Allocator;
+	using size_type      = size_t;
+	using __blocks_type  = vector< block_type, allocator_type >;
+
+	static LLVM_MSTL_CONSTEXPR size_type npos           = core::numeric_limits< size_type >::max();
+	static LLVM_MSTL_CONSTEXPR unsigned  bits_per_block = core::numeric_limits< block_type >::digits;
+
+	/*************************************************************************************
+	 *                                                                                   *
+	 *															CONSTRUCTOR BEGIN		                                 *
+	 *                                                                                   *
+	 *************************************************************************************/
+
+	dynamic_bitset() = default;
+
+	explicit dynamic_bitset( const allocator_type& __a )
+			: __blocks( __a ) {}
+
+	/**
+	* @brief Constructs a bitset of `__n` bits, all set to `__value`.
+	*/
+	explicit dynamic_bitset( size_type __n, bool __value = false, const allocator_type& __a = allocator_type() )
+			: __blocks( __num_blocks( __n ), __value ? ~block_type( 0 ) : block_type( 0 ), __a )
+			, __size( __n ) {
+		__zero_unused_bits();
+	}
+
+	dynamic_bitset( const dynamic_bitset& )                    = default;
+	dynamic_bitset( dynamic_bitset&& ) LLVM_MSTL_NOEXCEPT      = default;
+	auto operator=( const dynamic_bitset& ) -> dynamic_bitset& = default;
+	auto operator=( dynamic_bitset&& ) -> dynamic_bitset&      = default;
+
+	/*************************************************************************************
+	 *                                                                                   *
+	 *																CONSTRUCTOR END			                               *
+	 *                                                                                   *
+	 *************************************************************************************/
+
+	/*************************************************************************************
+	 *                                                                                   *
+	 *															 	CAPACITY BEGIN			               	               *
+	 *                                                                                   *
+	 *************************************************************************************/
+
+	auto size() const LLVM_MSTL_NOEXCEPT->size_type { return __size; }
+	auto num_blocks() const LLVM_MSTL_NOEXCEPT->size_type { return __blocks.size(); }
+	LLVM_MSTL_NODISCARD auto empty() const LLVM_MSTL_NOEXCEPT->bool { return __size == 0; }
+	auto capacity() const LLVM_MSTL_NOEXCEPT->size_type { return __blocks.capacity() * bits_per_block; }
+	auto reserve( size_type __n ) -> void { __blocks.reserve( __num_blocks( __n ) ); }
+
+	/**
+	* @brief The blocks, bit `i` is bit `i % 64` of block `i / 64`. The unused high bits of the last block are zero.
+	*/
+	auto data() const LLVM_MSTL_NOEXCEPT->const block_type* { return __blocks.data(); }
+
+	/*************************************************************************************
+	 *                                                                                   *
+	 *															 		CAPACITY END			               	               *
+	 *                                                                                   *
+	 *************************************************************************************/
+
+	/*************************************************************************************
+	 *                                                                                   *
+	 *															 	MODIFIERS BEGIN			               	               *
+	 *                                                                                   *
+	 *************************************************************************************/
+
+	/**
+	* @brief Resizes to `__n` bits, the new bits are set to `__value`.
+	*/
+	auto resize( size_type __n, bool __value = false ) -> void;
+
+	auto clear() LLVM_MSTL_NOEXCEPT->void {
+		__blocks.clear();
+		__size = 0;
+	}
+
+	auto push_back( bool __value ) -> void {
+		if ( __size % bits_per_block == 0 ) __blocks.push_back( block_type( 0 ) );
+		++__size;
+		if ( __value ) __set_unchecked( __size - 1 );
+	}
+
+	auto swap( dynamic_bitset& __x ) LLVM_MSTL_NOEXCEPT->void {
+		__blocks.swap( __x.__blocks );
+		core::swap( __size, __x.__size );
+	}
+
+	/*************************************************************************************
+	 *                                                                                   *
+	 *															 		MODIFIERS END			               	               *
+	 *                                                                                   *
+	 *************************************************************************************/
+
+	/*************************************************************************************
+	 *                                                                                   *
+	 *															 	BIT ACCESS BEGIN			               	               *
+	 *                                                                                   *
+	 *************************************************************************************/
+
+	auto operator[]( size_type __pos ) const LLVM_MSTL_NOEXCEPT->bool {
+		return ( __blocks[ __block_index( __pos ) ] >> __bit_index( __pos ) ) & 1;
+	}
+
+	/**
+	* @brief Returns the bit at `__pos`.
+	* @throws out_of_range If `__pos >= size()`.
+	*/
+	auto test( size_type __pos ) const -> bool {
+		__check_pos( __pos, "test" );
+		return ( *this )[ __pos ];
+	}
+
+	auto set( size_type __pos, bool __value = true ) -> dynamic_bitset& {
+		__check_pos( __pos, "set" );
+		if ( __value )
+			__set_unchecked( __pos );
+		else
+			__blocks[ __block_index( __pos ) ] &= ~__bit_mask( __pos );
+		return *this;
+	}
+
+	auto reset( size_type __pos ) -> dynamic_bitset& { return set( __pos, false ); }
+
+	auto flip( size_type __pos ) -> dynamic_bitset& {
+		__check_pos( __pos, "flip" );
+		__blocks[ __block_index( __pos ) ] ^= __bit_mask( __pos );
+		return *this;
+	}
+
+	auto set() LLVM_MSTL_NOEXCEPT->dynamic_bitset& {
+		core::fill_n( __blocks.data(), __blocks.size(), ~block_type( 0 ) );
+		__zero_unused_bits();
+		return *this;
+	}
+
+	auto reset() LLVM_MSTL_NOEXCEPT->dynamic_bitset& {
+		core::fill_n( __blocks.data(), __blocks.size(), block_type( 0 ) );
+		return *this;
+	}
+
+	auto flip() LLVM_MSTL_NOEXCEPT->dynamic_bitset& {
+		return combine( []( block_type __x ) { return static_cast< block_type >( ~__x ); } );
+	}
+
+	/*************************************************************************************
+	 *                                                                                   *
+	 *															 		BIT ACCESS END			               	               *
+	 *                                                                                   *
+	 *************************************************************************************/
+
+	/*************************************************************************************
+	 *                                                                                   *
+	 *															 	SET OPERATION BEGIN			               	           *
+	 *                                                                                   *
+	 *************************************************************************************/
+
+	/**
+	* @brief Replaces every block with `__op( block, other blocks... )`, in one pass over all the operands.
+	*
+	* `__op` is called with one `block_type` per operand, `*this` first, and must return the new block. It must
+	* map zero unused bits to zero unused bits (any expression of `&`, `|`, `^` and `& ~` does), otherwise the
+	* unused bits of the last block are cleared afterwards, which is cheap.
+	*
+	* @code{cc}
+	* __r.combine( []( auto __x, auto __y, auto __z ) { return __x & __y & ~__z; }, __a, __b );//<--- r &= a & ~b
+	* @endcode
+	*
+	* @throws length_error If an operand has a different size.
+	*/
+	template < typename _Op, typename... _Bitsets >
+	auto combine( _Op __op, const _Bitsets&... __others ) -> dynamic_bitset&;
+
+	auto operator&=( const dynamic_bitset& __x ) -> dynamic_bitset& { return __combine_words< __simd_word_op::__and >( __x ); }
+	auto operator|=( const dynamic_bitset& __x ) -> dynamic_bitset& { return __combine_words< __simd_word_op::__or >( __x ); }
+	auto operator^=( const dynamic_bitset& __x ) -> dynamic_bitset& { return __combine_words< __simd_word_op::__xor >( __x ); }
+
+	/**
+	* @brief Set difference (and-not), clears the bits that are set in `__x`.
+	*/
+	auto operator-=( const dynamic_bitset& __x ) -> dynamic_bitset& { return __combine_words< __simd_word_op::__andnot >( __x ); }
+
+	auto operator~() const -> dynamic_bitset {
+		dynamic_bitset __r( *this );
+		__r.flip();
+		return __r;
+	}
+
+	/**
+	* @brief `true` if every bit set in `*this` is set in `__x`.
+	*/
+	auto is_subset_of( const dynamic_bitset& __x ) const -> bool;
+
+	/**
+	* @brief `true` if `*this` and `__x` have a set bit in common.
+	*/
+	auto intersects( const dynamic_bitset& __x ) const -> bool;
+
+	/*************************************************************************************
+	 *                                                                                   *
+	 *															 		SET OPERATION END			               	             *
+	 *                                                                                   *
+	 *************************************************************************************/
+
+	/*************************************************************************************
+	 *                                                                                   *
+	 *															 	SEARCH BEGIN			               	                 *
+	 *                                                                                   *
+	 *************************************************************************************/
+
+	/**
+	* @brief Number of set bits, through the popcount kernel of the host.
+	*/
+	auto count() const LLVM_MSTL_NOEXCEPT->size_type;
+
+	auto any() const LLVM_MSTL_NOEXCEPT->bool {
+		return core::any_of( __blocks.begin(), __blocks.end(), []( block_type __b ) { return __b != 0; } );
+	}
+
+	auto none() const LLVM_MSTL_NOEXCEPT->bool { return !any(); }
+
+	auto all() const LLVM_MSTL_NOEXCEPT->bool;
+
+	/**
+	* @brief Position of the first set bit, or `npos`.
+	*/
+	auto find_first() const LLVM_MSTL_NOEXCEPT->size_type { return __find_from( 0 ); }
+
+	/**
+	* @brief Position of the first set bit after `__pos`, or `npos`.
+	*/
+	auto find_next( size_type __pos ) const LLVM_MSTL_NOEXCEPT->size_type {
+		return __size == 0 || __pos >= __size - 1 ? npos : __find_from( __pos + 1 );
+	}
+
+	/**
+	* @brief Calls `__f( pos )` for every set bit, in increasing order.
+	*
+	* Each block is walked with count-trailing-zeros and `__w &= __w - 1`, so the cost is one step per set bit
+	* plus one per block, not one per bit.
+	*/
+	template < typename _Func >
+	auto for_each_set( _Func __f ) const -> void {
+		const block_type* __p = __blocks.data();
+		for ( size_type __i = 0, __n = __blocks.size(); __i < __n; ++__i ) {
+			for ( block_type __w = __p[ __i ]; __w != 0; __w &= __w - 1 ) {
+				__f( __i * bits_per_block + static_cast< size_type >( core::countr_zero( __w ) ) );
+			}
+		}
+	}
+
+	/*************************************************************************************
+	 *                                                                                   *
+	 *															 		SEARCH END			               	                   *
+	 *                                                                                   *
+	 *************************************************************************************/
+
+	friend auto operator==( const dynamic_bitset& __x, const dynamic_bitset& __y ) -> bool {
+		return __x.__size == __y.__size && core::equal( __x.__blocks.begin(), __x.__blocks.end(), __y.__blocks.begin() );
+	}
+
+private:
+	static LLVM_MSTL_CONSTEXPR auto __num_blocks( size_type __n ) LLVM_MSTL_NOEXCEPT->size_type {
+		return ( __n + ( bits_per_block - 1 ) ) / bits_per_block;
+	}
+
+	static LLVM_MSTL_CONSTEXPR auto __block_index( size_type __pos ) LLVM_MSTL_NOEXCEPT->size_type { return __pos / bits_per_block; }
+	static LLVM_MSTL_CONSTEXPR auto __bit_index( size_type __pos ) LLVM_MSTL_NOEXCEPT->unsigned {
+		return static_cast< unsigned >( __pos % bits_per_block );
+	}
+	//<--- the binary operators through the word kernels; they keep the unused bits zero
+	template < __simd_word_op _Op >
+	auto __combine_words( const dynamic_bitset& __x ) -> dynamic_bitset& {
+		__check_same_size( __x );
+		__simd_dispatch_combine_words< _Op >( __blocks.data(), __x.__blocks.data(), __blocks.size() );
+		return *this;
+	}
+
+	static LLVM_MSTL_CONSTEXPR auto __bit_mask( size_type __pos ) LLVM_MSTL_NOEXCEPT->block_type {
+		return block_type( 1 ) << __bit_index( __pos );
+	}
+
+	auto __set_unchecked( size_type __pos ) LLVM_MSTL_NOEXCEPT->void { __blocks[ __block_index( __pos ) ] |= __bit_mask( __pos ); }
+
+	/**
+	* @brief Clears the bits past `size()` in the last block, restoring the class invariant.
+	*/
+	auto __zero_unused_bits() LLVM_MSTL_NOEXCEPT->void {
+		const unsigned __extra = __bit_index( __size );
+		if ( __extra != 0 ) __blocks.back() &= ( block_type( 1 ) << __extra ) - 1;
+	}
+
+	auto __find_from( size_type __pos ) const LLVM_MSTL_NOEXCEPT->size_type;
+
+	auto __check_pos( size_type __pos, const char* __op ) const -> void {
+		if ( __pos >= __size ) {
+			spdlog::error( "dynamic_bitset::{} out of range, __pos[{}], size()[{}]", __op, __pos, __size );
+			nya::__throw_out_of_range( "dynamic_bitset" );
+		}
+	}
+
+	auto __check_same_size( const dynamic_bitset& __x ) const -> void {
+		if ( __x.__size != __size ) {
+			spdlog::error( "dynamic_bitset operands differ in size, size()[{}], other[{}]", __size, __x.__size );
+			nya::__throw_length_error( "dynamic_bitset" );
+		}
+	}
+
+private:
+	__blocks_type __blocks = __blocks_type( allocator_type() );//<--- the bits, 64 per block
+	size_type     __size   = 0;                                //<--- the number of bits
+};
+
+template < typename _Allocator >
+auto dynamic_bitset< _Allocator >::resize( size_type __n, bool __value ) -> void {
+	const size_type __old_size = __size;
+	__blocks.resize( __num_blocks( __n ), __value ? ~block_type( 0 ) : block_type( 0 ) );
+	if ( __value && __n > __old_size && __bit_index( __old_size ) != 0 ) {
+		//<--- the unused bits of the old last block are zero, set those that come into use
+		__blocks[ __block_index( __old_size ) ] |= ~block_type( 0 ) << __bit_index( __old_size );
+	}
+	__size = __n;
+	__zero_unused_bits();
+}
+
+template < typename _Allocator >
+template < typename _Op, typename... _Bitsets >
+auto dynamic_bitset< _Allocator >::combine( _Op __op, const _Bitsets&... __others ) -> dynamic_bitset& {
+	static_assert( ( core::is_same_v< _Bitsets, dynamic_bitset > && ... ), "dynamic_bitset::combine operands must be dynamic_bitsets" );
+	( __check_same_size( __others ), ... );
+	block_type*     __dst = __blocks.data();
+	const size_type __n   = __blocks.size();
+	//<--- a simple indexed loop over every operand, the compiler turns it into wide loads and stores
+	for ( size_type __i = 0; __i < __n; ++__i ) {
+		__dst[ __i ] = static_cast< block_type >( __op( __dst[ __i ], __others.__blocks.data()[ __i ]... ) );
+	}
+	__zero_unused_bits();
+	return *this;
+}
+
+template < typename _Allocator >
+auto dynamic_bitset< _Allocator >::is_subset_of( const dynamic_bitset& __x ) const -> bool {
+	__check_same_size( __x );
+	const block_type* __a = __blocks.data();
+	const block_type* __b = __x.__blocks.data();
+	block_type        __r = 0;
+	for ( size_type __i = 0, __n = __blocks.size(); __i < __n; ++__i ) __r |= __a[ __i ] & ~__b[ __i ];
+	return __r == 0;
+}
+
+template < typename _Allocator >
+auto dynamic_bitset< _Allocator >::intersects( const dynamic_bitset& __x ) const -> bool {
+	__check_same_size( __x );
+	const block_type* __a = __blocks.data();
+	const block_type* __b = __x.__blocks.data();
+	for ( size_type __i = 0, __n = __blocks.size(); __i < __n; ++__i ) {
+		if ( __a[ __i ] & __b[ __i ] ) return true;
+	}
+	return false;
+}
+
+template < typename _Allocator >
+auto dynamic_bitset< _Allocator >::count() const LLVM_MSTL_NOEXCEPT->size_type {
+	return __simd_dispatch_popcount( __blocks.data(), __blocks.size(), 0 );
+}
+
+template < typename _Allocator >
+auto dynamic_bitset< _Allocator >::all() const LLVM_MSTL_NOEXCEPT->bool {
+	if ( __size == 0 ) return true;
+	const block_type* __p    = __blocks.data();
+	const size_type   __full = __size / bits_per_block;
+	for ( size_type __i = 0; __i < __full; ++__i ) {
+		if ( __p[ __i ] != ~block_type( 0 ) ) return false;
+	}
+	const unsigned __extra = __bit_index( __size );
+	return __extra == 0 || __p[ __full ] == ( block_type( 1 ) << __extra ) - 1;
+}
+
+template < typename _Allocator >
+auto dynamic_bitset< _Allocator >::__find_from( size_type __pos ) const LLVM_MSTL_NOEXCEPT->size_type {
+	if ( __pos >= __size ) return npos;
+	const block_type* __p = __blocks.data();
+	size_type         __i = __block_index( __pos );
+	block_type        __w = __p[ __i ] >> __bit_index( __pos );
+	if ( __w != 0 ) return __pos + static_cast< size_type >( core::countr_zero( __w ) );
+	for ( ++__i; __i < __blocks.size(); ++__i ) {
+		if ( __p[ __i ] != 0 ) return __i * bits_per_block + static_cast< size_type >( core::countr_zero( __p[ __i ] ) );
+	}
+	return npos;
+}
+
+template < typename _Allocator >
+auto operator&( const dynamic_bitset< _Allocator >& __x, const dynamic_bitset< _Allocator >& __y ) -> dynamic_bitset< _Allocator > {
+	dynamic_bitset< _Allocator > __r( __x );
+	__r &= __y;
+	return __r;
+}
+
+template < typename _Allocator >
+auto operator|( const dynamic_bitset< _Allocator >& __x, const dynamic_bitset< _Allocator >& __y ) -> dynamic_bitset< _Allocator > {
+	dynamic_bitset< _Allocator > __r( __x );
+	__r |= __y;
+	return __r;
+}
+
+template < typename _Allocator >
+auto operator^( const dynamic_bitset< _Allocator >& __x, const dynamic_bitset< _Allocator >& __y ) -> dynamic_bitset< _Allocator > {
+	dynamic_bitset< _Allocator > __r( __x );
+	__r ^= __y;
+	return __r;
+}
+
+template < typename _Allocator >
+auto operator-( const dynamic_bitset< _Allocator >& __x, const dynamic_bitset< _Allocator >& __y ) -> dynamic_bitset< _Allocator > {
+	dynamic_bitset< _Allocator > __r( __x );
+	__r -= __y;
+	return __r;
+}
+
+LLVM_MSTL_END_NAMESPACE_STD
+
+#endif//LLVM_MSTL_DYNAMIC_BITSET_H
@@ -0,0 +1,219 @@
+#ifndef LLVM_MSTL_EYTZINGER_INDEX_H
+#define LLVM_MSTL_EYTZINGER_INDEX_H
+
+/**
+ * @file eytzinger_index.hpp
+ * @brief A static search index over sorted keys in the Eytzinger (BFS) layout, with batched lookups.
+ */
+
+#include "__config.h"
+#include "__memory/aligned_allocator.h"
+#include "stdexcept.h"
+#include "vector.hpp"
+
+#include "spdlog/spdlog.h"
+
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <limits>
+#include <span>
+#include <type_traits>
+
+LLVM_MSTL_BEGIN_NAMESPACE_STD
+LLVM_MSTL_CORE_STD
+
+/**
+ * @brief The sorted keys of a table laid out as an implicit binary search tree in breadth-first order.
+ *
+ * @ref https://arxiv.org/abs/1509.05053 (Khuong, Morin: Array layouts for comparison-based searching)
+ *
+ * Node `__k` (from 1) has the children `2 * __k` and `2 * __k + 1`, so the first levels of the tree, which every
+ * search goes through, share a few cache lines, and the 16 great-grandchildren of great-grandchildren of a node
+ * are adjacent: a search prefetches them four levels ahead, then walks down without a data dependent branch.
+ * A binary search over the sorted array instead spreads its first probes over as many cache lines.
+ *
+ * The lookups answer ranks in the sorted order the index was built from, so the index sits next to the original
+ * table (or its payloads) and replaces `core::lower_bound` over it. The batched `lower_bound` runs a group of
+ * searches in lockstep, so their cache misses overlap.
+ *
+ * @code{.cc}
+ * const nya::eytzinger_index< uint64_t > __index( __sorted_keys );
+ * const size_t __rank = __index.lower_bound( __key );//<--- as `core::lower_bound( ... ) - __sorted_keys.begin()`
+ * __index.lower_bound( __queries, __ranks );
+ * @endcode
+ *
+ * @tparam _Tp The key type.
+ * @tparam _Compare The strict weak ordering the keys are sorted by.
+ */
+template < typename _Tp, typename _Compare = core::less< _Tp > >
+class LLVM_MSTL_TEMPLATE_VIS eytzinger_index {
+public:
+	using value_type    = _Tp;
+	using value_compare = _Compare;
+	using size_type     = size_t;
+	using rank_type     = uint32_t;//<--- the ranks are stored, half the footprint of `size_type` ones
+
+	//<--- the number of searches a batched lookup runs in lockstep
+	static LLVM_MSTL_CONSTEXPR size_type batch = 16;
+
+private:
+	using __keys_type  = vector< value_type, __aligned_allocator< value_type, 64 > >;
+	using __ranks_type = vector< rank_type, core::allocator< rank_type > >;
+
+public:
+	/*************************************************************************************
+	 *                                                                                   *
+	 *															CONSTRUCTOR BEGIN		                                 *
+	 *                                                                                   *
+	 *************************************************************************************/
+
+	eytzinger_index() = default;
+
+	/**
+	* @brief Lays out the `__n` keys sorted by `__compare` from `__first`.
+	* @throws length_error If there are more keys than `rank_type` ranks.
+	*/
+	template < typename _RandomAccessIterator >
+		requires core::random_access_iterator< _RandomAccessIterator >
+	eytzinger_index( _RandomAccessIterator __first, _RandomAccessIterator __last, const value_compare& __comp = value_compare() )
+			: __compare( __comp ) {
+		__build( __first, static_cast< size_type >( __last - __first ) );
+	}
+
+	template < typename _Allocator >
+	explicit eytzinger_index( const vector< value_type, _Allocator >& __sorted, const value_compare& __comp = value_compare() )
+			: eytzinger_index( __sorted.begin(), __sorted.end(), __comp ) {}
+
+	/*************************************************************************************
+	 *                                                                                   *
+	 *																CONSTRUCTOR END			                               *
+	 *                                                                                   *
+	 *************************************************************************************/
+
+	LLVM_MSTL_NODISCARD auto empty() const LLVM_MSTL_NOEXCEPT->bool { return __n == 0; }
+	auto size() const LLVM_MSTL_NOEXCEPT->size_type { return __n; }
+
+	//<--- the keys in the Eytzinger order, node `__k` at `__k - 1`
+	auto keys() const LLVM_MSTL_NOEXCEPT->core::span< const value_type > { return core::span< const value_type >( __keys.data() + 1, __n ); }
+
+	/**
+	* @brief The rank of the first key not less than `__x`, `size()` if there is none.
+	*/
+	auto lower_bound( const value_type& __x ) const -> size_type { return __rank_of( __lower_node( __x ) ); }
+
+	auto contains( const value_type& __x ) const -> bool {
+		const size_type __k = __lower_node( __x );
+		return __k != 0 && !__compare( __x, __keys[ __k ] );
+	}
+
+	/**
+	* @brief The `lower_bound` of every query to `__out`, `batch` searches at a time.
+	*
+	* The searches of a group step down one level together, so one of them waiting on memory does not hold up
+	* the issue of the others.
+	*
+	* @pre `__out.size() >= __queries.size()`.
+	*/
+	auto lower_bound( core::span< const value_type > __queries, core::span< size_type > __out ) const -> void;
+
+private:
+	//<--- a hint for the node `__k`, which may be past the end of the tree
+	auto __prefetch( size_type __k ) const LLVM_MSTL_NOEXCEPT->void {
+		LLVM_MSTL_PREFETCH( reinterpret_cast< const void* >( reinterpret_cast< uintptr_t >( __keys.data() ) + __k * sizeof( value_type ) ) );
+	}
+
+	/**
+	* @brief Undoes the right turns past the lower bound: the walk fell off the tree at `__k`.
+	*
+	* The lower bound is the node where the walk last went left, found by shifting out the trailing right turns
+	* (the one bits) and that left turn; node 0 means it always went right.
+	*/
+	static auto __undo_right_turns( size_type __k ) LLVM_MSTL_NOEXCEPT->size_type { return __k >> ( core::countr_one( __k ) + 1 ); }
+
+	//<--- the node of the lower bound of `__x`, 0 if there is none
+	auto __lower_node( const value_type& __x ) const -> size_type {
+		size_type __k = 1;
+		while ( __k <= __n ) {
+			__prefetch( __k * 16 );//<--- the 16 descendants four levels down are adjacent
+			__k = 2 * __k + static_cast< size_type >( static_cast< bool >( __compare( __keys[ __k ], __x ) ) );
+		}
+		return __undo_right_turns( __k );
+	}
+
+	auto __rank_of( size_type __node ) const LLVM_MSTL_NOEXCEPT->size_type { return __node == 0 ? __n : __ranks[ __node ]; }
+
+	template < typename _RandomAccessIterator >
+	auto __build( _RandomAccessIterator __first, size_type __n_keys ) -> void;
+
+	template < typename _RandomAccessIterator >
+	auto __fill( _RandomAccessIterator __first, size_type& __r, size_type __k ) -> void;
+
+	__keys_type   __keys;     //<--- the keys by node, from 1; slot 0 is unused
+	__ranks_type  __ranks;    //<--- the sorted rank of each node, from 1
+	size_type     __n = 0;    //<--- the number of keys
+	value_compare __compare{};//<--- the ordering of the keys
+};
+
+template < typename _Tp, typename _Compare >
+auto eytzinger_index< _Tp, _Compare >::lower_bound( core::span< const value_type > __queries, core::span< size_type > __out ) const
+	-> void {
+	const size_type __m = __queries.size();
+	if ( __n == 0 ) {
+		for ( size_type __i = 0; __i != __m; ++__i ) __out[ __i ] = 0;
+		return;
+	}
+	//<--- the full levels hold nodes for every walk, the last one may be partial
+	const auto __full = static_cast< size_type >( core::bit_width( __n + 1 ) - 1 );
+
+	size_type __i = 0;
+	for ( ; __i + batch <= __m; __i += batch ) {
+		size_type __k[ batch ];
+		for ( size_type __j = 0; __j != batch; ++__j ) __k[ __j ] = 1;
+		for ( size_type __level = 0; __level != __full; ++__level ) {
+			for ( size_type __j = 0; __j != batch; ++__j ) {
+				__prefetch( __k[ __j ] * 16 );
+				__k[ __j ] = 2 * __k[ __j ] + static_cast< size_type >( static_cast< bool >( __compare( __keys[ __k[ __j ] ], __queries[ __i + __j ] ) ) );
+			}
+		}
+		for ( size_type __j = 0; __j != batch; ++__j ) {
+			//<--- off the partial level counts as a right turn, which `__rank_of` shifts out
+			const bool __right = __k[ __j ] > __n || __compare( __keys[ __k[ __j ] ], __queries[ __i + __j ] );
+			__out[ __i + __j ] = __rank_of( __undo_right_turns( 2 * __k[ __j ] + static_cast< size_type >( __right ) ) );
+		}
+	}
+	for ( ; __i != __m; ++__i ) __out[ __i ] = lower_bound( __queries[ __i ] );
+}
+
+template < typename _Tp, typename _Compare >
+template < typename _RandomAccessIterator >
+auto eytzinger_index< _Tp, _Compare >::__build( _RandomAccessIterator __first, size_type __n_keys ) -> void {
+	if ( __n_keys >= core::numeric_limits< rank_type >::max() ) {
+		spdlog::error( "eytzinger_index has more keys than ranks, __n[{}] max[{}]", __n_keys, core::numeric_limits< rank_type >::max() - 1 );
+		nya::__throw_length_error( "eytzinger_index" );
+	}
+	if ( __n_keys == 0 ) return;
+	__keys.resize( __n_keys + 1, *__first );
+	__ranks.resize( __n_keys + 1, 0 );
+	__n           = __n_keys;
+	size_type __r = 0;
+	__fill( __first, __r, 1 );
+}
+
+//<--- an in-order walk of the implicit tree hands out the keys in sorted order
+template < typename _Tp, typename _Compare >
+template < typename _RandomAccessIterator >
+auto eytzinger_index< _Tp, _Compare >::__fill( _RandomAccessIterator __first, size_type& __r, size_type __k ) -> void {
+	if ( __k > __n ) return;
+	__fill( __first, __r, 2 * __k );
+	__keys[ __k ]  = __first[ static_cast< typename core::iterator_traits< _RandomAccessIterator >::difference_type >( __r ) ];
+	__ranks[ __k ] = static_cast< rank_type >( __r );
+	++__r;
+	__fill( __first, __r, 2 * __k + 1 );
+}
+
+LLVM_MSTL_END_NAMESPACE_STD
+
+#endif//LLVM_MSTL_EYTZINGER_INDEX_H
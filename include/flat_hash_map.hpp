@@ -0,0 +1,217 @@
+#ifndef LLVM_MSTL_FLAT_HASH_MAP_H
+#define LLVM_MSTL_FLAT_HASH_MAP_H
+
+/**
+ * @file flat_hash_map.hpp
+ * @brief An unordered map stored inline in an open addressing table probed eight control bytes at a time.
+ */
+
+#include "__config.h"
+#include "__flat_hash/raw_hash_set.h"
+#include "stdexcept.h"
+
+#include "spdlog/spdlog.h"
+
+#include <functional>
+#include <memory>
+#include <new>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+LLVM_MSTL_BEGIN_NAMESPACE_STD
+LLVM_MSTL_CORE_STD
+
+/**
+ * @brief The slots hold a `core::pair< _Key, _Tp >` seen through a `core::pair< const _Key, _Tp >`, as libc++'s
+ * `__hash_value_type` does, so that a rehash or an erasure moves the keys instead of copying them.
+ */
+template < typename _Key, typename _Tp >
+struct __flat_hash_map_policy {
+	using key_type    = _Key;
+	using value_type  = core::pair< const _Key, _Tp >;
+	using __slot_type = core::pair< _Key, _Tp >;
+
+	static_assert( sizeof( __slot_type ) == sizeof( value_type ) && alignof( __slot_type ) == alignof( value_type ) );
+
+	static LLVM_MSTL_CONSTEXPR bool __constant_iterators = false;
+
+	static auto __key( const value_type& __v ) LLVM_MSTL_NOEXCEPT->const key_type& { return __v.first; }
+	static auto __key( const __slot_type& __s ) LLVM_MSTL_NOEXCEPT->const key_type& { return __s.first; }
+
+	static auto __value( __slot_type& __s ) LLVM_MSTL_NOEXCEPT->value_type& {
+		return *core::launder( reinterpret_cast< value_type* >( core::addressof( __s ) ) );
+	}
+	static auto __value( const __slot_type& __s ) LLVM_MSTL_NOEXCEPT->const value_type& {
+		return *core::launder( reinterpret_cast< const value_type* >( core::addressof( __s ) ) );
+	}
+
+	//<--- moves the element of `__from` into the raw slot `__to` and destroys it
+	template < typename _Alloc >
+	static auto __relocate( _Alloc& __a, __slot_type* __to, __slot_type* __from ) -> void {
+		core::allocator_traits< _Alloc >::construct( __a, __to, core::move( *__from ) );
+		core::allocator_traits< _Alloc >::destroy( __a, __from );
+	}
+};
+
+/**
+ * @brief An unordered map of unique keys, with the `core::unordered_map` interface minus the bucket API.
+ *
+ * @ref https://abseil.io/docs/cpp/guides/container
+ *
+ * The key-value pairs are stored inline in one array, see @ref __raw_hash_set. Unlike `core::unordered_map`
+ * an insertion may move the elements and invalidates all iterators, references and pointers; an erasure
+ * may move the elements that follow in the same cluster.
+ *
+ * @tparam _Key The key type.
+ * @tparam _Tp The mapped type.
+ * @tparam _Hash The hash function.
+ * @tparam _Eq The key equality.
+ * @tparam _Alloc The allocator of the pairs.
+ */
+template <
+	typename _Key,
+	typename _Tp,
+	typename _Hash  = core::hash< _Key >,
+	typename _Eq    = core::equal_to< _Key >,
+	typename _Alloc = core::allocator< core::pair< const _Key, _Tp > > >
+class LLVM_MSTL_TEMPLATE_VIS flat_hash_map : public __raw_hash_set< __flat_hash_map_policy< _Key, _Tp >, _Hash, _Eq, _Alloc > {
+	using __base = __raw_hash_set< __flat_hash_map_policy< _Key, _Tp >, _Hash, _Eq, _Alloc >;
+
+public:
+	using mapped_type = _Tp;
+	using typename __base::const_iterator;
+	using typename __base::iterator;
+	using typename __base::key_type;
+	using typename __base::size_type;
+	using typename __base::value_type;
+
+	using __base::__base;
+	using __base::emplace;
+	using __base::insert;
+
+	/*************************************************************************************
+	 *                                                                                   *
+	 *															 	ELEMENT ACCESS BEGIN			                         *
+	 *                                                                                   *
+	 *************************************************************************************/
+
+	auto operator[]( const key_type& __k ) -> mapped_type& { return try_emplace( __k ).first->second; }
+	auto operator[]( key_type&& __k ) -> mapped_type& { return try_emplace( core::move( __k ) ).first->second; }
+
+	/**
+	* @brief Returns the value mapped to `__k`.
+	* @throws out_of_range If there is no such key.
+	*/
+	auto at( const key_type& __k ) -> mapped_type& { return this->__slot_at( __at_index( __k ) ).second; }
+	auto at( const key_type& __k ) const -> const mapped_type& { return this->__slot_at( __at_index( __k ) ).second; }
+
+	/*************************************************************************************
+	 *                                                                                   *
+	 *															 	ELEMENT ACCESS END			                           *
+	 *                                                                                   *
+	 *************************************************************************************/
+
+	/*************************************************************************************
+	 *                                                                                   *
+	 *															 	MODIFIERS BEGIN			               	               *
+	 *                                                                                   *
+	 *************************************************************************************/
+
+	template < typename _Pair >
+		requires( core::is_constructible_v< value_type, _Pair && > && !core::is_same_v< core::remove_cvref_t< _Pair >, value_type > )
+	auto insert( _Pair&& __p ) -> core::pair< iterator, bool > {
+		return emplace( core::forward< _Pair >( __p ) );
+	}
+
+	//<--- the key is looked up before any element is built
+	template < typename _Kp, typename _Mp >
+		requires core::is_same_v< core::remove_cvref_t< _Kp >, key_type >
+	auto emplace( _Kp&& __k, _Mp&& __m ) -> core::pair< iterator, bool > {
+		return try_emplace( core::forward< _Kp >( __k ), core::forward< _Mp >( __m ) );
+	}
+
+	/**
+	* @brief Inserts `( __k, mapped_type( __args... ) )` if `__k` is absent, leaves `__args` untouched otherwise.
+	*/
+	template < typename... _Args >
+	auto try_emplace( const key_type& __k, _Args&&... __args ) -> core::pair< iterator, bool > {
+		return __try_emplace( __k, core::forward< _Args >( __args )... );
+	}
+
+	template < typename... _Args >
+	auto try_emplace( key_type&& __k, _Args&&... __args ) -> core::pair< iterator, bool > {
+		return __try_emplace( core::move( __k ), core::forward< _Args >( __args )... );
+	}
+
+	template < typename... _Args >
+	auto try_emplace( const_iterator, const key_type& __k, _Args&&... __args ) -> iterator {
+		return try_emplace( __k, core::forward< _Args >( __args )... ).first;
+	}
+
+	template < typename... _Args >
+	auto try_emplace( const_iterator, key_type&& __k, _Args&&... __args ) -> iterator {
+		return try_emplace( core::move( __k ), core::forward< _Args >( __args )... ).first;
+	}
+
+	template < typename _Mp >
+	auto insert_or_assign( const key_type& __k, _Mp&& __m ) -> core::pair< iterator, bool > {
+		return __insert_or_assign( __k, core::forward< _Mp >( __m ) );
+	}
+
+	template < typename _Mp >
+	auto insert_or_assign( key_type&& __k, _Mp&& __m ) -> core::pair< iterator, bool > {
+		return __insert_or_assign( core::move( __k ), core::forward< _Mp >( __m ) );
+	}
+
+	/*************************************************************************************
+	 *                                                                                   *
+	 *															 		MODIFIERS END			               	               *
+	 *                                                                                   *
+	 *************************************************************************************/
+
+private:
+	auto __at_index( const key_type& __k ) const -> size_type {
+		const size_type __i = this->__find_index( __k );
+		if ( __i == __base::__not_found() ) {
+			spdlog::error( "flat_hash_map::at key not found, size()[{}]", this->size() );
+			nya::__throw_out_of_range( "flat_hash_map" );
+		}
+		return __i;
+	}
+
+	template < typename _Kp, typename... _Args >
+	auto __try_emplace( _Kp&& __k, _Args&&... __args ) -> core::pair< iterator, bool > {
+		const auto [ __i, __inserted ] = this->__find_or_prepare_insert( __k );
+		if ( __inserted ) {
+			this->__construct_at(
+				__i,
+				core::piecewise_construct,
+				core::forward_as_tuple( core::forward< _Kp >( __k ) ),
+				core::forward_as_tuple( core::forward< _Args >( __args )... ) );
+		}
+		return { this->__iterator_at( __i ), __inserted };
+	}
+
+	template < typename _Kp, typename _Mp >
+	auto __insert_or_assign( _Kp&& __k, _Mp&& __m ) -> core::pair< iterator, bool > {
+		auto __r = __try_emplace( core::forward< _Kp >( __k ), core::forward< _Mp >( __m ) );
+		if ( !__r.second ) __r.first->second = core::forward< _Mp >( __m );
+		return __r;
+	}
+};
+
+/**
+ * @brief Erases every element satisfying `__pred`.
+ *
+ * @return The number of erased elements.
+ */
+template < typename _Key, typename _Tp, typename _Hash, typename _Eq, typename _Alloc, typename _Predicate >
+auto erase_if( flat_hash_map< _Key, _Tp, _Hash, _Eq, _Alloc >& __c, _Predicate __pred ) ->
+	typename flat_hash_map< _Key, _Tp, _Hash, _Eq, _Alloc >::size_type {
+	return __erase_if_hash( __c, __pred );
+}
+
+LLVM_MSTL_END_NAMESPACE_STD
+
+#endif//LLVM_MSTL_FLAT_HASH_MAP_H
@@ -0,0 +1,73 @@
+#ifndef LLVM_MSTL_FLAT_HASH_SET_H
+#define LLVM_MSTL_FLAT_HASH_SET_H
+
+/**
+ * @file flat_hash_set.hpp
+ * @brief An unordered set stored inline in an open addressing table probed eight control bytes at a time.
+ */
+
+#include "__config.h"
+#include "__flat_hash/raw_hash_set.h"
+
+#include <functional>
+#include <memory>
+
+LLVM_MSTL_BEGIN_NAMESPACE_STD
+LLVM_MSTL_CORE_STD
+
+template < typename _Key >
+struct __flat_hash_set_policy {
+	using key_type    = _Key;
+	using value_type  = _Key;
+	using __slot_type = _Key;
+
+	static LLVM_MSTL_CONSTEXPR bool __constant_iterators = true;//<--- a mutable key would break the table
+
+	static auto __key( const value_type& __v ) LLVM_MSTL_NOEXCEPT->const key_type& { return __v; }
+
+	static auto __value( __slot_type& __s ) LLVM_MSTL_NOEXCEPT->value_type& { return __s; }
+	static auto __value( const __slot_type& __s ) LLVM_MSTL_NOEXCEPT->const value_type& { return __s; }
+
+	//<--- moves the element of `__from` into the raw slot `__to` and destroys it
+	template < typename _Alloc >
+	static auto __relocate( _Alloc& __a, value_type* __to, value_type* __from ) -> void {
+		core::allocator_traits< _Alloc >::construct( __a, __to, core::move( *__from ) );
+		core::allocator_traits< _Alloc >::destroy( __a, __from );
+	}
+};
+
+/**
+ * @brief An unordered set of unique keys, with the `core::unordered_set` interface minus the bucket API.
+ *
+ * @ref https://abseil.io/docs/cpp/guides/container
+ *
+ * The keys are stored inline in one array, see @ref __raw_hash_set. Unlike `core::unordered_set` an
+ * insertion may move the elements and invalidates all iterators, references and pointers; an erasure
+ * may move the elements that follow in the same cluster.
+ *
+ * @tparam _Key The key type.
+ * @tparam _Hash The hash function.
+ * @tparam _Eq The key equality.
+ * @tparam _Alloc The allocator of the keys.
+ */
+template < typename _Key, typename _Hash = core::hash< _Key >, typename _Eq = core::equal_to< _Key >, typename _Alloc = core::allocator< _Key > >
+class LLVM_MSTL_TEMPLATE_VIS flat_hash_set : public __raw_hash_set< __flat_hash_set_policy< _Key >, _Hash, _Eq, _Alloc > {
+	using __base = __raw_hash_set< __flat_hash_set_policy< _Key >, _Hash, _Eq, _Alloc >;
+
+public:
+	using __base::__base;
+};
+
+/**
+ * @brief Erases every key satisfying `__pred`.
+ *
+ * @return The number of erased keys.
+ */
+template < typename _Key, typename _Hash, typename _Eq, typename _Alloc, typename _Predicate >
+auto erase_if( flat_hash_set< _Key, _Hash, _Eq, _Alloc >& __c, _Predicate __pred ) -> typename flat_hash_set< _Key, _Hash, _Eq, _Alloc >::size_type {
+	return __erase_if_hash( __c, __pred );
+}
+
+LLVM_MSTL_END_NAMESPACE_STD
+
+#endif//LLVM_MSTL_FLAT_HASH_SET_H
@@ -0,0 +1,681 @@
+#ifndef LLVM_MSTL_FLAT_MAP_H
+#define LLVM_MSTL_FLAT_MAP_H
+
+/**
+ * @file flat_map.hpp
+ * @brief An ordered map stored as two sorted columns, for read-mostly lookup tables rebuilt in batches.
+ */
+
+#include "__algorithm/lower_bound.h"
+#include "__config.h"
+#include "__flat_map/key_value_iterator.h"
+#include "__flat_map/sorted_unique.h"
+#include "__ranges/container_compatible_range.h"
+#include "__ranges/from_range.h"
+#include "__type_traits/is_transparent.h"
+#include "__utility/exception_guard.h"
+#include "stdexcept.h"
+#include "vector.hpp"
+
+#include "spdlog/spdlog.h"
+
+#include <algorithm>
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <numeric>
+#include <ranges>
+#include <type_traits>
+#include <utility>
+
+LLVM_MSTL_BEGIN_NAMESPACE_STD
+LLVM_MSTL_CORE_STD
+
+/**
+ * @brief A sorted associative container of unique keys, with the C++23 `core::flat_map` interface.
+ *
+ * @ref https://en.cppreference.com/w/cpp/container/flat_map
+ *
+ * The keys and the mapped values live in two separate sequence containers (two `nya::vector`s by default)
+ * kept sorted by key. A lookup is a branchless binary search over the dense key column only, which is much
+ * cheaper than chasing the nodes of a `core::map`; a single insertion or erasure shifts the tail of both columns.
+ *
+ * Batches are inserted with `insert( first, last )`, or `insert( sorted_unique, first, last )` when the batch
+ * is already sorted: the batch is appended to the columns (which grow geometrically, so the capacity of the
+ * previous rebuilds is reused), sorted on its own, and merged into place in a single backward pass.
+ *
+ * If an exception is thrown while the columns are being reordered, the map is cleared, as the C++23 map does.
+ *
+ * @tparam _Key The key type.
+ * @tparam _Tp The mapped type.
+ * @tparam _Compare The strict weak ordering of the keys.
+ * @tparam _KeyContainer The random access container of the keys.
+ * @tparam _MappedContainer The random access container of the mapped values.
+ */
+template <
+	typename _Key,
+	typename _Tp,
+	typename _Compare         = core::less< _Key >,
+	typename _KeyContainer    = vector< _Key, core::allocator< _Key > >,
+	typename _MappedContainer = vector< _Tp, core::allocator< _Tp > > >
+class LLVM_MSTL_TEMPLATE_VIS flat_map {
+	static_assert( core::is_same_v< _Key, typename _KeyContainer::value_type > );
+	static_assert( core::is_same_v< _Tp, typename _MappedContainer::value_type > );
+
+public:
+	using key_type               = _Key;
+	using mapped_type            = _Tp;
+	using value_type             = core::pair< key_type, mapped_type >;
+	using key_compare            = _Compare;
+	using reference              = core::pair< const key_type&, mapped_type& >;
+	using const_reference        = core::pair< const key_type&, const mapped_type& >;
+	using size_type              = size_t;
+	using difference_type        = ptrdiff_t;
+	using key_container_type     = _KeyContainer;
+	using mapped_container_type  = _MappedContainer;
+	using iterator               = __key_value_iterator< typename key_container_type::const_iterator, typename mapped_container_type::iterator >;
+	using const_iterator         = __key_value_iterator< typename key_container_type::const_iterator, typename mapped_container_type::const_iterator >;
+	using reverse_iterator       = core::reverse_iterator< iterator >;
+	using const_reverse_iterator = core::reverse_iterator< const_iterator >;
+
+	struct containers {
+		key_container_type    keys;
+		mapped_container_type values;
+	};
+
+	class value_compare {
+		friend class flat_map;
+
+		key_compare __comp;
+
+		explicit value_compare( key_compare __c )
+				: __comp( __c ) {}
+
+	public:
+		auto operator()( const_reference __x, const_reference __y ) const -> bool { return __comp( __x.first, __y.first ); }
+	};
+
+	/*************************************************************************************
+	 *                                                                                   *
+	 *															CONSTRUCTOR BEGIN		                                 *
+	 *                                                                                   *
+	 *************************************************************************************/
+
+	flat_map()
+			: flat_map( key_compare() ) {}
+
+	explicit flat_map( const key_compare& __comp )
+			: __containers()
+			, __compare( __comp ) {}
+
+	/**
+	* @brief Adopts the two columns, sorts them by key and drops the duplicate keys.
+	* @throws length_error If the columns differ in size.
+	*/
+	flat_map( key_container_type __keys, mapped_container_type __values, const key_compare& __comp = key_compare() )
+			: __containers{ core::move( __keys ), core::move( __values ) }
+			, __compare( __comp ) {
+		__check_columns( __containers.keys, __containers.values );
+		auto __guard = __make_exception_guard( [ this ]() { clear(); } );
+		__merge_batch< false >( 0 );
+		__guard.__complete();
+	}
+
+	/**
+	* @brief Adopts two columns already sorted by key and free of duplicate keys.
+	* @throws length_error If the columns differ in size.
+	*/
+	flat_map( sorted_unique_t, key_container_type __keys, mapped_container_type __values, const key_compare& __comp = key_compare() )
+			: __containers{ core::move( __keys ), core::move( __values ) }
+			, __compare( __comp ) {
+		__check_columns( __containers.keys, __containers.values );
+	}
+
+	template < typename _InputIterator >
+		requires core::input_iterator< _InputIterator >
+	flat_map( _InputIterator __first, _InputIterator __last, const key_compare& __comp = key_compare() )
+			: flat_map( __comp ) {
+		insert( __first, __last );
+	}
+
+	template < typename _InputIterator >
+		requires core::input_iterator< _InputIterator >
+	flat_map( sorted_unique_t, _InputIterator __first, _InputIterator __last, const key_compare& __comp = key_compare() )
+			: flat_map( __comp ) {
+		insert( sorted_unique, __first, __last );
+	}
+
+	template < _ContainerCompatibleRange< value_type > _Range >
+	flat_map( from_range_t, _Range&& __range, const key_compare& __comp = key_compare() )
+			: flat_map( __comp ) {
+		insert_range( core::forward< _Range >( __range ) );
+	}
+
+	flat_map( core::initializer_list< value_type > __il, const key_compare& __comp = key_compare() )
+			: flat_map( __il.begin(), __il.end(), __comp ) {}
+
+	flat_map( sorted_unique_t, core::initializer_list< value_type > __il, const key_compare& __comp = key_compare() )
+			: flat_map( sorted_unique, __il.begin(), __il.end(), __comp ) {}
+
+	auto operator=( core::initializer_list< value_type > __il ) -> flat_map& {
+		clear();
+		insert( __il );
+		return *this;
+	}
+
+	/*************************************************************************************
+	 *                                                                                   *
+	 *																CONSTRUCTOR END			                               *
+	 *                                                                                   *
+	 *************************************************************************************/
+
+	/*************************************************************************************
+	 *                                                                                   *
+	 *															 	ITERATOR BEGIN			               	               *
+	 *                                                                                   *
+	 *************************************************************************************/
+
+	auto begin() LLVM_MSTL_NOEXCEPT->iterator { return __make_iterator( 0 ); }
+	auto begin() const LLVM_MSTL_NOEXCEPT->const_iterator { return __make_iterator( 0 ); }
+	auto end() LLVM_MSTL_NOEXCEPT->iterator { return __make_iterator( size() ); }
+	auto end() const LLVM_MSTL_NOEXCEPT->const_iterator { return __make_iterator( size() ); }
+	auto cbegin() const LLVM_MSTL_NOEXCEPT->const_iterator { return begin(); }
+	auto cend() const LLVM_MSTL_NOEXCEPT->const_iterator { return end(); }
+	auto rbegin() LLVM_MSTL_NOEXCEPT->reverse_iterator { return reverse_iterator( end() ); }
+	auto rbegin() const LLVM_MSTL_NOEXCEPT->const_reverse_iterator { return const_reverse_iterator( end() ); }
+	auto rend() LLVM_MSTL_NOEXCEPT->reverse_iterator { return reverse_iterator( begin() ); }
+	auto rend() const LLVM_MSTL_NOEXCEPT->const_reverse_iterator { return const_reverse_iterator( begin() ); }
+	auto crbegin() const LLVM_MSTL_NOEXCEPT->const_reverse_iterator { return rbegin(); }
+	auto crend() const LLVM_MSTL_NOEXCEPT->const_reverse_iterator { return rend(); }
+
+	/*************************************************************************************
+	 *                                                                                   *
+	 *															 		ITERATOR END			               	               *
+	 *                                                                                   *
+	 *************************************************************************************/
+
+	/*************************************************************************************
+	 *                                                                                   *
+	 *															 	CAPACITY BEGIN			               	               *
+	 *                                                                                   *
+	 *************************************************************************************/
+
+	LLVM_MSTL_NODISCARD auto empty() const LLVM_MSTL_NOEXCEPT->bool { return __containers.keys.empty(); }
+	auto size() const LLVM_MSTL_NOEXCEPT->size_type { return __containers.keys.size(); }
+	auto max_size() const LLVM_MSTL_NOEXCEPT->size_type {
+		return core::min< size_type >( __containers.keys.max_size(), __containers.values.max_size() );
+	}
+
+	/*************************************************************************************
+	 *                                                                                   *
+	 *															 		CAPACITY END			               	               *
+	 *                                                                                   *
+	 *************************************************************************************/
+
+	/*************************************************************************************
+	 *                                                                                   *
+	 *															 	ELEMENT ACCESS BEGIN			               	           *
+	 *                                                                                   *
+	 *************************************************************************************/
+
+	auto operator[]( const key_type& __k ) -> mapped_type& { return try_emplace( __k ).first->second; }
+	auto operator[]( key_type&& __k ) -> mapped_type& { return try_emplace( core::move( __k ) ).first->second; }
+
+	/**
+	* @brief Returns the value mapped to `__k`.
+	* @throws out_of_range If there is no such key.
+	*/
+	auto at( const key_type& __k ) -> mapped_type& { return __containers.values[ __at_index( __k ) ]; }
+	auto at( const key_type& __k ) const -> const mapped_type& { return __containers.values[ __at_index( __k ) ]; }
+
+	/*************************************************************************************
+	 *                                                                                   *
+	 *															 	ELEMENT ACCESS END			               	             *
+	 *                                                                                   *
+	 *************************************************************************************/
+
+	/*************************************************************************************
+	 *                                                                                   *
+	 *															 	MODIFIERS BEGIN			               	               *
+	 *                                                                                   *
+	 *************************************************************************************/
+
+	template < typename... _Args >
+	auto emplace( _Args&&... __args ) -> core::pair< iterator, bool > {
+		value_type __v( core::forward< _Args >( __args )... );
+		return __try_emplace( core::move( __v.first ), core::move( __v.second ) );
+	}
+
+	/**
+	* @brief Emplaces at `__hint` if the key belongs there, otherwise searches the position.
+	*/
+	template < typename... _Args >
+	auto emplace_hint( const_iterator __hint, _Args&&... __args ) -> iterator {
+		value_type      __v( core::forward< _Args >( __args )... );
+		const size_type __h = static_cast< size_type >( __hint - cbegin() );
+		if ( ( __h == 0 || __compare( __containers.keys[ __h - 1 ], __v.first ) ) &&
+				 ( __h == size() || __compare( __v.first, __containers.keys[ __h ] ) ) ) {
+			return __emplace_at( __h, core::move( __v.first ), core::move( __v.second ) );
+		}
+		return __try_emplace( core::move( __v.first ), core::move( __v.second ) ).first;
+	}
+
+	auto insert( const value_type& __x ) -> core::pair< iterator, bool > { return emplace( __x ); }
+	auto insert( value_type&& __x ) -> core::pair< iterator, bool > { return emplace( core::move( __x ) ); }
+	auto insert( const_iterator __hint, const value_type& __x ) -> iterator { return emplace_hint( __hint, __x ); }
+	auto insert( const_iterator __hint, value_type&& __x ) -> iterator { return emplace_hint( __hint, core::move( __x ) ); }
+
+	/**
+	* @brief Inserts a batch: appends it, sorts it and merges it into the columns in one pass.
+	*
+	* Of several equivalent keys in the batch, the first one is inserted. Keys already in the map are not
+	* overwritten.
+	*/
+	template < typename _InputIterator >
+		requires core::input_iterator< _InputIterator >
+	auto insert( _InputIterator __first, _InputIterator __last ) -> void {
+		__insert_batch< false >( __first, __last );
+	}
+
+	/**
+	* @brief Inserts a batch sorted by key and free of duplicate keys, skipping the sort of @ref insert.
+	*/
+	template < typename _InputIterator >
+		requires core::input_iterator< _InputIterator >
+	auto insert( sorted_unique_t, _InputIterator __first, _InputIterator __last ) -> void {
+		__insert_batch< true >( __first, __last );
+	}
+
+	template < _ContainerCompatibleRange< value_type > _Range >
+	auto insert_range( _Range&& __range ) -> void {
+		__insert_batch< false >( core::ranges::begin( __range ), core::ranges::end( __range ) );
+	}
+
+	auto insert( core::initializer_list< value_type > __il ) -> void { insert( __il.begin(), __il.end() ); }
+	auto insert( sorted_unique_t, core::initializer_list< value_type > __il ) -> void {
+		insert( sorted_unique, __il.begin(), __il.end() );
+	}
+
+	template < typename... _Args >
+	auto try_emplace( const key_type& __k, _Args&&... __args ) -> core::pair< iterator, bool > {
+		return __try_emplace( __k, core::forward< _Args >( __args )... );
+	}
+
+	template < typename... _Args >
+	auto try_emplace( key_type&& __k, _Args&&... __args ) -> core::pair< iterator, bool > {
+		return __try_emplace( core::move( __k ), core::forward< _Args >( __args )... );
+	}
+
+	template < typename _Mp >
+	auto insert_or_assign( const key_type& __k, _Mp&& __m ) -> core::pair< iterator, bool > {
+		return __insert_or_assign( __k, core::forward< _Mp >( __m ) );
+	}
+
+	template < typename _Mp >
+	auto insert_or_assign( key_type&& __k, _Mp&& __m ) -> core::pair< iterator, bool > {
+		return __insert_or_assign( core::move( __k ), core::forward< _Mp >( __m ) );
+	}
+
+	/**
+	* @brief Moves the columns out, leaving the map empty.
+	*/
+	auto extract() && -> containers {
+		containers __r = core::move( __containers );
+		clear();
+		return __r;
+	}
+
+	/**
+	* @brief Replaces the columns by `__keys` and `__values`, which must be sorted by key and free of duplicate keys.
+	* @throws length_error If the columns differ in size.
+	*/
+	auto replace( key_container_type&& __keys, mapped_container_type&& __values ) -> void {
+		__check_columns( __keys, __values );
+		__containers.keys   = core::move( __keys );
+		__containers.values = core::move( __values );
+	}
+
+	auto erase( iterator __position ) -> iterator { return __erase_at( static_cast< size_type >( __position - begin() ), 1 ); }
+	auto erase( const_iterator __position ) -> iterator { return __erase_at( static_cast< size_type >( __position - cbegin() ), 1 ); }
+
+	auto erase( const_iterator __first, const_iterator __last ) -> iterator {
+		return __erase_at( static_cast< size_type >( __first - cbegin() ), static_cast< size_type >( __last - __first ) );
+	}
+
+	auto erase( const key_type& __k ) -> size_type {
+		const size_type __i = __lower_index( __k );
+		if ( __i == size() || __compare( __k, __containers.keys[ __i ] ) ) return 0;
+		__erase_at( __i, 1 );
+		return 1;
+	}
+
+	auto swap( flat_map& __x ) LLVM_MSTL_NOEXCEPT->void {
+		__containers.keys.swap( __x.__containers.keys );
+		__containers.values.swap( __x.__containers.values );
+		core::swap( __compare, __x.__compare );
+	}
+
+	auto clear() LLVM_MSTL_NOEXCEPT->void {
+		__containers.keys.clear();
+		__containers.values.clear();
+	}
+
+	/*************************************************************************************
+	 *                                                                                   *
+	 *															 		MODIFIERS END			               	               *
+	 *                                                                                   *
+	 *************************************************************************************/
+
+	/*************************************************************************************
+	 *                                                                                   *
+	 *															 	OBSERVERS BEGIN			               	               *
+	 *                                                                                   *
+	 *************************************************************************************/
+
+	auto key_comp() const -> key_compare { return __compare; }
+	auto value_comp() const -> value_compare { return value_compare( __compare ); }
+	auto keys() const LLVM_MSTL_NOEXCEPT->const key_container_type& { return __containers.keys; }
+	auto values() const LLVM_MSTL_NOEXCEPT->const mapped_container_type& { return __containers.values; }
+
+	/*************************************************************************************
+	 *                                                                                   *
+	 *															 		OBSERVERS END			               	               *
+	 *                                                                                   *
+	 *************************************************************************************/
+
+	/*************************************************************************************
+	 *                                                                                   *
+	 *															 	LOOKUP BEGIN			               	                 *
+	 *                                                                                   *
+	 *************************************************************************************/
+
+	auto find( const key_type& __k ) -> iterator { return __make_iterator( __find_index( __k ) ); }
+	auto find( const key_type& __k ) const -> const_iterator { return __make_iterator( __find_index( __k ) ); }
+	auto count( const key_type& __k ) const -> size_type { return contains( __k ) ? 1 : 0; }
+	auto contains( const key_type& __k ) const -> bool { return __find_index( __k ) != size(); }
+
+	auto lower_bound( const key_type& __k ) -> iterator { return __make_iterator( __lower_index( __k ) ); }
+	auto lower_bound( const key_type& __k ) const -> const_iterator { return __make_iterator( __lower_index( __k ) ); }
+	auto upper_bound( const key_type& __k ) -> iterator { return __make_iterator( __upper_index( __k ) ); }
+	auto upper_bound( const key_type& __k ) const -> const_iterator { return __make_iterator( __upper_index( __k ) ); }
+
+	auto equal_range( const key_type& __k ) -> core::pair< iterator, iterator > {
+		const size_type __i = __lower_index( __k );
+		return { __make_iterator( __i ), __make_iterator( __i + __found_at( __i, __k ) ) };
+	}
+
+	auto equal_range( const key_type& __k ) const -> core::pair< const_iterator, const_iterator > {
+		const size_type __i = __lower_index( __k );
+		return { __make_iterator( __i ), __make_iterator( __i + __found_at( __i, __k ) ) };
+	}
+
+	//<--- heterogeneous lookup, enabled by a transparent comparator
+	template < typename _Kp >
+		requires __is_transparent_v< _Compare >
+	auto find( const _Kp& __k ) -> iterator {
+		return __make_iterator( __find_index( __k ) );
+	}
+
+	template < typename _Kp >
+		requires __is_transparent_v< _Compare >
+	auto find( const _Kp& __k ) const -> const_iterator {
+		return __make_iterator( __find_index( __k ) );
+	}
+
+	template < typename _Kp >
+		requires __is_transparent_v< _Compare >
+	auto count( const _Kp& __k ) const -> size_type {
+		return contains( __k ) ? 1 : 0;
+	}
+
+	template < typename _Kp >
+		requires __is_transparent_v< _Compare >
+	auto contains( const _Kp& __k ) const -> bool {
+		return __find_index( __k ) != size();
+	}
+
+	template < typename _Kp >
+		requires __is_transparent_v< _Compare >
+	auto lower_bound( const _Kp& __k ) -> iterator {
+		return __make_iterator( __lower_index( __k ) );
+	}
+
+	template < typename _Kp >
+		requires __is_transparent_v< _Compare >
+	auto lower_bound( const _Kp& __k ) const -> const_iterator {
+		return __make_iterator( __lower_index( __k ) );
+	}
+
+	template < typename _Kp >
+		requires __is_transparent_v< _Compare >
+	auto upper_bound( const _Kp& __k ) -> iterator {
+		return __make_iterator( __upper_index( __k ) );
+	}
+
+	template < typename _Kp >
+		requires __is_transparent_v< _Compare >
+	auto upper_bound( const _Kp& __k ) const -> const_iterator {
+		return __make_iterator( __upper_index( __k ) );
+	}
+
+	/*************************************************************************************
+	 *                                                                                   *
+	 *															 		LOOKUP END			               	                   *
+	 *                                                                                   *
+	 *************************************************************************************/
+
+	friend auto operator==( const flat_map& __x, const flat_map& __y ) -> bool {
+		return __x.__containers.keys == __y.__containers.keys && __x.__containers.values == __y.__containers.values;
+	}
+
+	friend auto swap( flat_map& __x, flat_map& __y ) LLVM_MSTL_NOEXCEPT->void { __x.swap( __y ); }
+
+private:
+	auto __make_iterator( size_type __i ) -> iterator {
+		return iterator( __containers.keys.cbegin() + static_cast< difference_type >( __i ),
+										 __containers.values.begin() + static_cast< difference_type >( __i ) );
+	}
+
+	auto __make_iterator( size_type __i ) const -> const_iterator {
+		return const_iterator( __containers.keys.cbegin() + static_cast< difference_type >( __i ),
+													 __containers.values.cbegin() + static_cast< difference_type >( __i ) );
+	}
+
+	template < typename _Kp >
+	auto __lower_index( const _Kp& __k ) const -> size_type {
+		const auto& __keys = __containers.keys;
+		return static_cast< size_type >( __branchless_lower_bound( __keys.begin(), __keys.end(), __k, __compare ) - __keys.begin() );
+	}
+
+	template < typename _Kp >
+	auto __upper_index( const _Kp& __k ) const -> size_type {
+		const auto& __keys = __containers.keys;
+		return static_cast< size_type >( __branchless_upper_bound( __keys.begin(), __keys.end(), __k, __compare ) - __keys.begin() );
+	}
+
+	//<--- 1 if the key at `__i` (a lower bound) is equivalent to `__k`
+	template < typename _Kp >
+	auto __found_at( size_type __i, const _Kp& __k ) const -> size_type {
+		return __i != size() && !__compare( __k, __containers.keys[ __i ] ) ? 1 : 0;
+	}
+
+	template < typename _Kp >
+	auto __find_index( const _Kp& __k ) const -> size_type {
+		const size_type __i = __lower_index( __k );
+		return __found_at( __i, __k ) ? __i : size();
+	}
+
+	auto __at_index( const key_type& __k ) const -> size_type {
+		const size_type __i = __find_index( __k );
+		if ( __i == size() ) {
+			spdlog::error( "flat_map::at key not found, size()[{}]", size() );
+			nya::__throw_out_of_range( "flat_map" );
+		}
+		return __i;
+	}
+
+	static auto __check_columns( const key_container_type& __keys, const mapped_container_type& __values ) -> void {
+		if ( __keys.size() != __values.size() ) {
+			spdlog::error( "flat_map columns differ in size, keys[{}], values[{}]", __keys.size(), __values.size() );
+			nya::__throw_length_error( "flat_map" );
+		}
+	}
+
+	/**
+	* @brief Inserts the key and the mapped value constructed from `__args` at `__i`, keeping the columns in step.
+	*/
+	template < typename _Kp, typename... _Args >
+	auto __emplace_at( size_type __i, _Kp&& __k, _Args&&... __args ) -> iterator {
+		auto& __keys   = __containers.keys;
+		auto& __values = __containers.values;
+		auto  __key_it = __keys.emplace( __keys.begin() + static_cast< difference_type >( __i ), core::forward< _Kp >( __k ) );
+		auto  __guard  = __make_exception_guard( [ & ]() { __keys.erase( __key_it ); } );
+		__values.emplace( __values.begin() + static_cast< difference_type >( __i ), core::forward< _Args >( __args )... );
+		__guard.__complete();
+		return __make_iterator( __i );
+	}
+
+	template < typename _Kp, typename... _Args >
+	auto __try_emplace( _Kp&& __k, _Args&&... __args ) -> core::pair< iterator, bool > {
+		const size_type __i = __lower_index( __k );
+		if ( __found_at( __i, __k ) ) return { __make_iterator( __i ), false };
+		return { __emplace_at( __i, core::forward< _Kp >( __k ), core::forward< _Args >( __args )... ), true };
+	}
+
+	template < typename _Kp, typename _Mp >
+	auto __insert_or_assign( _Kp&& __k, _Mp&& __m ) -> core::pair< iterator, bool > {
+		const size_type __i = __lower_index( __k );
+		if ( __found_at( __i, __k ) ) {
+			__containers.values[ __i ] = core::forward< _Mp >( __m );
+			return { __make_iterator( __i ), false };
+		}
+		return { __emplace_at( __i, core::forward< _Kp >( __k ), core::forward< _Mp >( __m ) ), true };
+	}
+
+	auto __erase_at( size_type __i, size_type __n ) -> iterator {
+		auto& __keys   = __containers.keys;
+		auto& __values = __containers.values;
+		auto  __first  = static_cast< difference_type >( __i );
+		auto  __last   = static_cast< difference_type >( __i + __n );
+		__keys.erase( __keys.begin() + __first, __keys.begin() + __last );
+		__values.erase( __values.begin() + __first, __values.begin() + __last );
+		return __make_iterator( __i );
+	}
+
+	template < bool _Sorted, typename _InputIterator, typename _Sentinel >
+	auto __insert_batch( _InputIterator __first, _Sentinel __last ) -> void {
+		auto            __guard = __make_exception_guard( [ this ]() { clear(); } );
+		const size_type __m     = size();
+		for ( ; __first != __last; ++__first ) __append_one( *__first );
+		__merge_batch< _Sorted >( __m );
+		__guard.__complete();
+	}
+
+	template < typename _Pair >
+	auto __append_one( _Pair&& __p ) -> void {
+		__containers.keys.emplace_back( core::get< 0 >( core::forward< _Pair >( __p ) ) );
+		__containers.values.emplace_back( core::get< 1 >( core::forward< _Pair >( __p ) ) );
+	}
+
+	/**
+	* @brief Merges the batch appended after the first `__m` elements into the sorted prefix.
+	*
+	* The batch is sorted through an index permutation (the two columns can not be sorted together), the
+	* duplicates within the batch and the keys already present in the prefix are dropped while the survivors
+	* are gathered into a scratch pair of columns, and the survivors are merged backwards into the tail
+	* of the columns. The prefix is read once and every element is moved at most once.
+	*
+	* @tparam _Sorted `true` if the batch is already sorted and free of duplicates.
+	* @param __m The size of the sorted prefix.
+	*/
+	template < bool _Sorted >
+	auto __merge_batch( size_type __m ) -> void {
+		auto&           __keys   = __containers.keys;
+		auto&           __values = __containers.values;
+		const size_type __k      = __keys.size() - __m;
+		if ( __k == 0 ) return;
+
+		vector< size_type, core::allocator< size_type > > __order;
+		if constexpr ( !_Sorted ) {
+			__order.resize( __k );
+			core::iota( __order.begin(), __order.end(), __m );
+			core::stable_sort( __order.begin(), __order.end(), [ & ]( size_type __x, size_type __y ) {
+				return __compare( __keys[ __x ], __keys[ __y ] );
+			} );
+		}
+
+		key_container_type    __batch_keys;
+		mapped_container_type __batch_values;
+		__batch_keys.reserve( __k );
+		__batch_values.reserve( __k );
+		auto       __hint = __keys.begin();
+		const auto __mid  = __keys.begin() + static_cast< difference_type >( __m );
+		for ( size_type __i = 0; __i < __k; ++__i ) {
+			size_type __j;
+			if constexpr ( _Sorted )
+				__j = __m + __i;
+			else
+				__j = __order[ __i ];
+			auto& __key = __keys[ __j ];
+			if ( !__batch_keys.empty() && !__compare( __batch_keys.back(), __key ) ) continue;//<--- equivalent to the previous one
+			//<--- the batch is sorted, so the search range of the prefix only shrinks
+			__hint = __branchless_lower_bound( __hint, __mid, __key, __compare );
+			if ( __hint != __mid && !__compare( __key, *__hint ) ) continue;//<--- already in the map
+			__batch_keys.push_back( core::move( __key ) );
+			__batch_values.push_back( core::move( __values[ __j ] ) );
+		}
+
+		const size_type __n = __batch_keys.size();
+		__keys.erase( __keys.begin() + static_cast< difference_type >( __m + __n ), __keys.end() );
+		__values.erase( __values.begin() + static_cast< difference_type >( __m + __n ), __values.end() );
+		size_type __i = __m, __j = __n, __w = __m + __n;
+		while ( __j != 0 ) {
+			--__w;
+			if ( __i != 0 && __compare( __batch_keys[ __j - 1 ], __keys[ __i - 1 ] ) ) {
+				--__i;
+				__keys[ __w ]   = core::move( __keys[ __i ] );
+				__values[ __w ] = core::move( __values[ __i ] );
+			} else {
+				--__j;
+				__keys[ __w ]   = core::move( __batch_keys[ __j ] );
+				__values[ __w ] = core::move( __batch_values[ __j ] );
+			}
+		}
+	}
+
+private:
+	containers  __containers;//<--- the key and the mapped column, sorted by key
+	key_compare __compare;   //<--- the ordering of the keys
+};
+
+/**
+ * @brief Erases every element satisfying `__pred`, compacting both columns in one pass.
+ *
+ * @return The number of erased elements.
+ */
+template < typename _Key, typename _Tp, typename _Compare, typename _KeyContainer, typename _MappedContainer, typename _Predicate >
+auto erase_if( flat_map< _Key, _Tp, _Compare, _KeyContainer, _MappedContainer >& __c, _Predicate __pred ) ->
+	typename flat_map< _Key, _Tp, _Compare, _KeyContainer, _MappedContainer >::size_type {
+	using const_reference = typename flat_map< _Key, _Tp, _Compare, _KeyContainer, _MappedContainer >::const_reference;
+	auto         __containers = core::move( __c ).extract();
+	auto&        __keys       = __containers.keys;
+	auto&        __values     = __containers.values;
+	const size_t __n          = __keys.size();
+	size_t       __w          = 0;
+	for ( size_t __r = 0; __r < __n; ++__r ) {
+		if ( __pred( const_reference( __keys[ __r ], __values[ __r ] ) ) ) continue;
+		if ( __w != __r ) {
+			__keys[ __w ]   = core::move( __keys[ __r ] );
+			__values[ __w ] = core::move( __values[ __r ] );
+		}
+		++__w;
+	}
+	__keys.erase( __keys.begin() + static_cast< ptrdiff_t >( __w ), __keys.end() );
+	__values.erase( __values.begin() + static_cast< ptrdiff_t >( __w ), __values.end() );
+	__c.replace( core::move( __keys ), core::move( __values ) );
+	return __n - __w;
+}
+
+LLVM_MSTL_END_NAMESPACE_STD
+
+#endif//LLVM_MSTL_FLAT_MAP_H
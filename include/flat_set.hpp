@@ -0,0 +1,383 @@
+#ifndef LLVM_MSTL_FLAT_SET_H
+#define LLVM_MSTL_FLAT_SET_H
+
+/**
+ * @file flat_set.hpp
+ * @brief An ordered set stored as one sorted column, for read-mostly lookup tables rebuilt in batches.
+ */
+
+#include "__algorithm/lower_bound.h"
+#include "__config.h"
+#include "__flat_map/sorted_unique.h"
+#include "__ranges/container_compatible_range.h"
+#include "__ranges/from_range.h"
+#include "__type_traits/is_transparent.h"
+#include "__utility/exception_guard.h"
+#include "vector.hpp"
+
+#include <algorithm>
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <ranges>
+#include <type_traits>
+#include <utility>
+
+LLVM_MSTL_BEGIN_NAMESPACE_STD
+LLVM_MSTL_CORE_STD
+
+/**
+ * @brief A sorted associative container of unique keys, with the C++23 `core::flat_set` interface.
+ *
+ * @ref https://en.cppreference.com/w/cpp/container/flat_set
+ *
+ * The keys live in one sequence container (a `nya::vector` by default) kept sorted; lookups are branchless
+ * binary searches, and batches are merged in a single pass as in @ref flat_map.
+ *
+ * @tparam _Key The key type.
+ * @tparam _Compare The strict weak ordering of the keys.
+ * @tparam _KeyContainer The random access container of the keys.
+ */
+template < typename _Key, typename _Compare = core::less< _Key >, typename _KeyContainer = vector< _Key, core::allocator< _Key > > >
+class LLVM_MSTL_TEMPLATE_VIS flat_set {
+	static_assert( core::is_same_v< _Key, typename _KeyContainer::value_type > );
+
+public:
+	using key_type               = _Key;
+	using value_type             = _Key;
+	using key_compare            = _Compare;
+	using value_compare          = _Compare;
+	using reference              = value_type&;
+	using const_reference        = const value_type&;
+	using size_type              = typename _KeyContainer::size_type;
+	using difference_type        = typename _KeyContainer::difference_type;
+	using iterator               = typename _KeyContainer::const_iterator;//<--- the keys are immutable
+	using const_iterator         = typename _KeyContainer::const_iterator;
+	using reverse_iterator       = core::reverse_iterator< iterator >;
+	using const_reverse_iterator = core::reverse_iterator< const_iterator >;
+	using container_type         = _KeyContainer;
+
+	/*************************************************************************************
+	 *                                                                                   *
+	 *															CONSTRUCTOR BEGIN		                                 *
+	 *                                                                                   *
+	 *************************************************************************************/
+
+	flat_set()
+			: flat_set( key_compare() ) {}
+
+	explicit flat_set( const key_compare& __comp )
+			: __keys()
+			, __compare( __comp ) {}
+
+	/**
+	* @brief Adopts `__cont`, sorts it and drops the duplicates.
+	*/
+	explicit flat_set( container_type __cont, const key_compare& __comp = key_compare() )
+			: __keys( core::move( __cont ) )
+			, __compare( __comp ) {
+		auto __guard = __make_exception_guard( [ this ]() { clear(); } );
+		__merge_batch< false >( 0 );
+		__guard.__complete();
+	}
+
+	/**
+	* @brief Adopts `__cont`, which must be sorted and free of duplicates.
+	*/
+	flat_set( sorted_unique_t, container_type __cont, const key_compare& __comp = key_compare() )
+			: __keys( core::move( __cont ) )
+			, __compare( __comp ) {}
+
+	template < typename _InputIterator >
+		requires core::input_iterator< _InputIterator >
+	flat_set( _InputIterator __first, _InputIterator __last, const key_compare& __comp = key_compare() )
+			: flat_set( __comp ) {
+		insert( __first, __last );
+	}
+
+	template < typename _InputIterator >
+		requires core::input_iterator< _InputIterator >
+	flat_set( sorted_unique_t, _InputIterator __first, _InputIterator __last, const key_compare& __comp = key_compare() )
+			: flat_set( __comp ) {
+		insert( sorted_unique, __first, __last );
+	}
+
+	template < _ContainerCompatibleRange< value_type > _Range >
+	flat_set( from_range_t, _Range&& __range, const key_compare& __comp = key_compare() )
+			: flat_set( __comp ) {
+		insert_range( core::forward< _Range >( __range ) );
+	}
+
+	flat_set( core::initializer_list< value_type > __il, const key_compare& __comp = key_compare() )
+			: flat_set( __il.begin(), __il.end(), __comp ) {}
+
+	flat_set( sorted_unique_t, core::initializer_list< value_type > __il, const key_compare& __comp = key_compare() )
+			: flat_set( sorted_unique, __il.begin(), __il.end(), __comp ) {}
+
+	auto operator=( core::initializer_list< value_type > __il ) -> flat_set& {
+		clear();
+		insert( __il );
+		return *this;
+	}
+
+	/*************************************************************************************
+	 *                                                                                   *
+	 *																CONSTRUCTOR END			                               *
+	 *                                                                                   *
+	 *************************************************************************************/
+
+	auto begin() const LLVM_MSTL_NOEXCEPT->const_iterator { return __keys.begin(); }
+	auto end() const LLVM_MSTL_NOEXCEPT->const_iterator { return __keys.end(); }
+	auto cbegin() const LLVM_MSTL_NOEXCEPT->const_iterator { return __keys.cbegin(); }
+	auto cend() const LLVM_MSTL_NOEXCEPT->const_iterator { return __keys.cend(); }
+	auto rbegin() const LLVM_MSTL_NOEXCEPT->const_reverse_iterator { return const_reverse_iterator( end() ); }
+	auto rend() const LLVM_MSTL_NOEXCEPT->const_reverse_iterator { return const_reverse_iterator( begin() ); }
+	auto crbegin() const LLVM_MSTL_NOEXCEPT->const_reverse_iterator { return rbegin(); }
+	auto crend() const LLVM_MSTL_NOEXCEPT->const_reverse_iterator { return rend(); }
+
+	LLVM_MSTL_NODISCARD auto empty() const LLVM_MSTL_NOEXCEPT->bool { return __keys.empty(); }
+	auto size() const LLVM_MSTL_NOEXCEPT->size_type { return __keys.size(); }
+	auto max_size() const LLVM_MSTL_NOEXCEPT->size_type { return __keys.max_size(); }
+
+	/*************************************************************************************
+	 *                                                                                   *
+	 *															 	MODIFIERS BEGIN			               	               *
+	 *                                                                                   *
+	 *************************************************************************************/
+
+	template < typename... _Args >
+	auto emplace( _Args&&... __args ) -> core::pair< iterator, bool > {
+		if constexpr ( sizeof...( _Args ) == 1 && ( core::is_same_v< core::remove_cvref_t< _Args >, value_type > && ... ) ) {
+			return __insert_one( core::forward< _Args >( __args )... );
+		} else {
+			return __insert_one( value_type( core::forward< _Args >( __args )... ) );
+		}
+	}
+
+	template < typename... _Args >
+	auto emplace_hint( const_iterator __hint, _Args&&... __args ) -> iterator {
+		value_type __v( core::forward< _Args >( __args )... );
+		if ( ( __hint == begin() || __compare( *core::prev( __hint ), __v ) ) && ( __hint == end() || __compare( __v, *__hint ) ) ) {
+			return __keys.emplace( __hint, core::move( __v ) );
+		}
+		return __insert_one( core::move( __v ) ).first;
+	}
+
+	auto insert( const value_type& __x ) -> core::pair< iterator, bool > { return __insert_one( __x ); }
+	auto insert( value_type&& __x ) -> core::pair< iterator, bool > { return __insert_one( core::move( __x ) ); }
+	auto insert( const_iterator __hint, const value_type& __x ) -> iterator { return emplace_hint( __hint, __x ); }
+	auto insert( const_iterator __hint, value_type&& __x ) -> iterator { return emplace_hint( __hint, core::move( __x ) ); }
+
+	/**
+	* @brief Inserts a batch: appends it, sorts it and merges it into the keys in one pass.
+	*/
+	template < typename _InputIterator >
+		requires core::input_iterator< _InputIterator >
+	auto insert( _InputIterator __first, _InputIterator __last ) -> void {
+		__insert_batch< false >( __first, __last );
+	}
+
+	/**
+	* @brief Inserts a sorted batch free of duplicates, skipping the sort of @ref insert.
+	*/
+	template < typename _InputIterator >
+		requires core::input_iterator< _InputIterator >
+	auto insert( sorted_unique_t, _InputIterator __first, _InputIterator __last ) -> void {
+		__insert_batch< true >( __first, __last );
+	}
+
+	template < _ContainerCompatibleRange< value_type > _Range >
+	auto insert_range( _Range&& __range ) -> void {
+		auto            __guard = __make_exception_guard( [ this ]() { clear(); } );
+		const size_type __m     = size();
+		__keys.append_range( core::forward< _Range >( __range ) );
+		__merge_batch< false >( __m );
+		__guard.__complete();
+	}
+
+	auto insert( core::initializer_list< value_type > __il ) -> void { insert( __il.begin(), __il.end() ); }
+	auto insert( sorted_unique_t, core::initializer_list< value_type > __il ) -> void {
+		insert( sorted_unique, __il.begin(), __il.end() );
+	}
+
+	/**
+	* @brief Moves the keys out, leaving the set empty.
+	*/
+	auto extract() && -> container_type {
+		container_type __r = core::move( __keys );
+		clear();
+		return __r;
+	}
+
+	/**
+	* @brief Replaces the keys by `__cont`, which must be sorted and free of duplicates.
+	*/
+	auto replace( container_type&& __cont ) -> void { __keys = core::move( __cont ); }
+
+	auto erase( const_iterator __position ) -> iterator { return __keys.erase( __position ); }
+	auto erase( const_iterator __first, const_iterator __last ) -> iterator { return __keys.erase( __first, __last ); }
+
+	auto erase( const key_type& __k ) -> size_type {
+		const auto __it = lower_bound( __k );
+		if ( __it == end() || __compare( __k, *__it ) ) return 0;
+		__keys.erase( __it );
+		return 1;
+	}
+
+	auto swap( flat_set& __x ) LLVM_MSTL_NOEXCEPT->void {
+		__keys.swap( __x.__keys );
+		core::swap( __compare, __x.__compare );
+	}
+
+	auto clear() LLVM_MSTL_NOEXCEPT->void { __keys.clear(); }
+
+	/*************************************************************************************
+	 *                                                                                   *
+	 *															 		MODIFIERS END			               	               *
+	 *                                                                                   *
+	 *************************************************************************************/
+
+	auto key_comp() const -> key_compare { return __compare; }
+	auto value_comp() const -> value_compare { return __compare; }
+
+	/*************************************************************************************
+	 *                                                                                   *
+	 *															 	LOOKUP BEGIN			               	                 *
+	 *                                                                                   *
+	 *************************************************************************************/
+
+	auto find( const key_type& __k ) const -> const_iterator { return __find( __k ); }
+	auto count( const key_type& __k ) const -> size_type { return contains( __k ) ? 1 : 0; }
+	auto contains( const key_type& __k ) const -> bool { return __find( __k ) != end(); }
+	auto lower_bound( const key_type& __k ) const -> const_iterator { return __branchless_lower_bound( begin(), end(), __k, __compare ); }
+	auto upper_bound( const key_type& __k ) const -> const_iterator { return __branchless_upper_bound( begin(), end(), __k, __compare ); }
+
+	auto equal_range( const key_type& __k ) const -> core::pair< const_iterator, const_iterator > {
+		const auto __it = lower_bound( __k );
+		return { __it, __it != end() && !__compare( __k, *__it ) ? core::next( __it ) : __it };
+	}
+
+	//<--- heterogeneous lookup, enabled by a transparent comparator
+	template < typename _Kp >
+		requires __is_transparent_v< _Compare >
+	auto find( const _Kp& __k ) const -> const_iterator {
+		return __find( __k );
+	}
+
+	template < typename _Kp >
+		requires __is_transparent_v< _Compare >
+	auto count( const _Kp& __k ) const -> size_type {
+		return contains( __k ) ? 1 : 0;
+	}
+
+	template < typename _Kp >
+		requires __is_transparent_v< _Compare >
+	auto contains( const _Kp& __k ) const -> bool {
+		return __find( __k ) != end();
+	}
+
+	template < typename _Kp >
+		requires __is_transparent_v< _Compare >
+	auto lower_bound( const _Kp& __k ) const -> const_iterator {
+		return __branchless_lower_bound( begin(), end(), __k, __compare );
+	}
+
+	template < typename _Kp >
+		requires __is_transparent_v< _Compare >
+	auto upper_bound( const _Kp& __k ) const -> const_iterator {
+		return __branchless_upper_bound( begin(), end(), __k, __compare );
+	}
+
+	/*************************************************************************************
+	 *                                                                                   *
+	 *															 		LOOKUP END			               	                   *
+	 *                                                                                   *
+	 *************************************************************************************/
+
+	friend auto operator==( const flat_set& __x, const flat_set& __y ) -> bool { return __x.__keys == __y.__keys; }
+
+	friend auto swap( flat_set& __x, flat_set& __y ) LLVM_MSTL_NOEXCEPT->void { __x.swap( __y ); }
+
+private:
+	template < typename _Kp >
+	auto __find( const _Kp& __k ) const -> const_iterator {
+		const auto __it = __branchless_lower_bound( begin(), end(), __k, __compare );
+		return __it != end() && !__compare( __k, *__it ) ? __it : end();
+	}
+
+	template < typename _Vp >
+	auto __insert_one( _Vp&& __v ) -> core::pair< iterator, bool > {
+		const auto __it = lower_bound( __v );
+		if ( __it != end() && !__compare( __v, *__it ) ) return { __it, false };
+		return { __keys.emplace( __it, core::forward< _Vp >( __v ) ), true };
+	}
+
+	template < bool _Sorted, typename _InputIterator >
+	auto __insert_batch( _InputIterator __first, _InputIterator __last ) -> void {
+		auto            __guard = __make_exception_guard( [ this ]() { clear(); } );
+		const size_type __m     = size();
+		for ( ; __first != __last; ++__first ) __keys.emplace_back( *__first );
+		__merge_batch< _Sorted >( __m );
+		__guard.__complete();
+	}
+
+	/**
+	* @brief Merges the batch appended after the first `__m` keys into the sorted prefix.
+	*
+	* The batch is sorted in place, then its duplicates and the keys already in the prefix are dropped while
+	* the survivors are moved into a scratch column, which is merged backwards into the tail.
+	*
+	* @tparam _Sorted `true` if the batch is already sorted and free of duplicates.
+	* @param __m The size of the sorted prefix.
+	*/
+	template < bool _Sorted >
+	auto __merge_batch( size_type __m ) -> void {
+		const auto __mid = __keys.begin() + static_cast< difference_type >( __m );
+		if ( __mid == __keys.end() ) return;
+		if constexpr ( !_Sorted ) core::stable_sort( __mid, __keys.end(), __compare );
+
+		container_type __batch;
+		__batch.reserve( static_cast< size_type >( __keys.end() - __mid ) );
+		auto __hint = __keys.begin();
+		for ( auto __it = __mid; __it != __keys.end(); ++__it ) {
+			if ( !__batch.empty() && !__compare( __batch.back(), *__it ) ) continue;//<--- equivalent to the previous one
+			__hint = __branchless_lower_bound( __hint, __mid, *__it, __compare );
+			if ( __hint != __mid && !__compare( *__it, *__hint ) ) continue;//<--- already in the set
+			__batch.push_back( core::move( *__it ) );
+		}
+
+		const size_type __n = __batch.size();
+		__keys.erase( __keys.begin() + static_cast< difference_type >( __m + __n ), __keys.end() );
+		size_type __i = __m, __j = __n, __w = __m + __n;
+		while ( __j != 0 ) {
+			--__w;
+			if ( __i != 0 && __compare( __batch[ __j - 1 ], __keys[ __i - 1 ] ) )
+				__keys[ __w ] = core::move( __keys[ --__i ] );
+			else
+				__keys[ __w ] = core::move( __batch[ --__j ] );
+		}
+	}
+
+private:
+	container_type __keys;   //<--- the keys, sorted
+	key_compare    __compare;//<--- the ordering of the keys
+};
+
+/**
+ * @brief Erases every key satisfying `__pred`.
+ *
+ * @return The number of erased keys.
+ */
+template < typename _Key, typename _Compare, typename _KeyContainer, typename _Predicate >
+auto erase_if( flat_set< _Key, _Compare, _KeyContainer >& __c, _Predicate __pred ) -> typename flat_set< _Key, _Compare, _KeyContainer >::size_type {
+	auto       __keys = core::move( __c ).extract();
+	const auto __n    = __keys.size();
+	__keys.erase( core::remove_if( __keys.begin(), __keys.end(), __pred ), __keys.end() );
+	const auto __erased = __n - __keys.size();
+	__c.replace( core::move( __keys ) );
+	return __erased;
+}
+
+LLVM_MSTL_END_NAMESPACE_STD
+
+#endif//LLVM_MSTL_FLAT_SET_H
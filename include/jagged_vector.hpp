@@ -0,0 +1,335 @@
+#ifndef LLVM_MSTL_JAGGED_VECTOR_H
+#define LLVM_MSTL_JAGGED_VECTOR_H
+
+/**
+ * @file jagged_vector.hpp
+ * @brief A sequence of variable length rows stored back to back (CSR layout), in place of `vector< vector< T > >`.
+ */
+
+#include "__config.h"
+#include "__ranges/container_compatible_range.h"
+#include "__utility/parallel_chunks.h"
+#include "stdexcept.h"
+#include "vector.hpp"
+
+#include "spdlog/spdlog.h"
+
+#include <algorithm>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <ranges>
+#include <span>
+#include <type_traits>
+#include <utility>
+
+LLVM_MSTL_BEGIN_NAMESPACE_STD
+LLVM_MSTL_CORE_STD
+
+/**
+ * @brief Rows of values in one `vector`, delimited by a `vector` of offsets (compressed sparse row).
+ *
+ * Row `r` is `values()[ offsets()[ r ], offsets()[ r + 1 ] )`, so a million rows cost two allocations instead of a
+ * million, and a traversal of all the rows is a linear scan. Rows are appended at the back only; the last row can
+ * grow with `push_back`.
+ *
+ * Static data such as adjacency lists are best built at once: @ref from_pairs counting-sorts `( row, value )`
+ * pairs, and @ref build fills rows whose sizes are known up front. Both can split the work over threads.
+ *
+ * @code{.cc}
+ * nya::jagged_vector< uint32_t > __adj;
+ * __adj.push_row( { 1, 2 } );
+ * __adj.push_row();
+ * __adj.push_back( 0 );//<--- appended to the last row
+ * for ( uint32_t __to : __adj[ 0 ] ) visit( __to );
+ * @endcode
+ *
+ * @tparam _Tp The value type.
+ * @tparam _Allocator The allocator of the values.
+ */
+template < typename _Tp, typename _Allocator = core::allocator< _Tp > >
+class LLVM_MSTL_TEMPLATE_VIS jagged_vector {
+	static_assert( !core::is_same_v< _Tp, bool >, "jagged_vector< bool > would need spans over bits" );
+
+public:
+	using value_type      = _Tp;
+	using allocator_type  = _Allocator;
+	using size_type       = size_t;
+	using difference_type = ptrdiff_t;
+	using reference       = value_type&;
+	using const_reference = const value_type&;
+	using row_type        = core::span< value_type >;
+	using const_row_type  = core::span< const value_type >;
+	using values_type     = vector< value_type, allocator_type >;
+	using offsets_type    = vector< size_type, typename core::allocator_traits< allocator_type >::template rebind_alloc< size_type > >;
+
+	/*************************************************************************************
+	 *                                                                                   *
+	 *															CONSTRUCTOR BEGIN		                                 *
+	 *                                                                                   *
+	 *************************************************************************************/
+
+	jagged_vector() = default;
+
+	//<--- `__rows` empty rows
+	explicit jagged_vector( size_type __rows )
+			: __offsets( __rows == 0 ? 0 : __rows + 1, size_type( 0 ) ) {}
+
+	jagged_vector( core::initializer_list< core::initializer_list< value_type > > __il ) {
+		size_type __n = 0;
+		for ( const auto& __row : __il ) __n += __row.size();
+		reserve( __il.size(), __n );
+		for ( const auto& __row : __il ) push_row( __row );
+	}
+
+	/*************************************************************************************
+	 *                                                                                   *
+	 *																CONSTRUCTOR END			                               *
+	 *                                                                                   *
+	 *************************************************************************************/
+
+	/**
+	* @brief Builds `__rows` rows from `( row, value )` pairs with a stable counting sort.
+	*
+	* The values of a row keep the order of the pairs. The pairs are counted and scattered in `__jobs` chunks in
+	* parallel (0 means one per hardware thread), each chunk with its own row histogram.
+	*
+	* @tparam _RandomAccessIterator An iterator over pair-like entries, `first` convertible to `size_type` and
+	*                               `second` assignable to a value. The values are value-initialized, then assigned.
+	* @throws out_of_range If a row is not less than `__rows`.
+	*/
+	template < core::random_access_iterator _RandomAccessIterator >
+	static auto from_pairs( size_type __rows, _RandomAccessIterator __first, _RandomAccessIterator __last, size_type __jobs = 1 )
+		-> jagged_vector;
+
+	/**
+	* @brief Builds `__rows` rows, row `r` of `__size_of( r )` value-initialized values then filled by `__fill( r, row )`.
+	*
+	* The sizes and the rows are computed in `__jobs` chunks of rows in parallel (0 means one per hardware thread),
+	* so `__size_of` and `__fill` must be safe to call concurrently for distinct rows.
+	*/
+	template < typename _SizeFn, typename _FillFn >
+	static auto build( size_type __rows, _SizeFn __size_of, _FillFn __fill, size_type __jobs = 1 ) -> jagged_vector;
+
+	/*************************************************************************************
+	 *                                                                                   *
+	 *															 	ELEMENT ACCESS BEGIN			                         *
+	 *                                                                                   *
+	 *************************************************************************************/
+
+	auto operator[]( size_type __r ) LLVM_MSTL_NOEXCEPT->row_type {
+		return row_type( __values.data() + __offsets[ __r ], __offsets[ __r + 1 ] - __offsets[ __r ] );
+	}
+
+	auto operator[]( size_type __r ) const LLVM_MSTL_NOEXCEPT->const_row_type {
+		return const_row_type( __values.data() + __offsets[ __r ], __offsets[ __r + 1 ] - __offsets[ __r ] );
+	}
+
+	/**
+	* @brief The row `__r`.
+	* @throws out_of_range If `__r >= rows()`.
+	*/
+	auto at( size_type __r ) -> row_type {
+		__check_row( __r );
+		return ( *this )[ __r ];
+	}
+
+	auto at( size_type __r ) const -> const_row_type {
+		__check_row( __r );
+		return ( *this )[ __r ];
+	}
+
+	auto front() LLVM_MSTL_NOEXCEPT->row_type { return ( *this )[ 0 ]; }
+	auto front() const LLVM_MSTL_NOEXCEPT->const_row_type { return ( *this )[ 0 ]; }
+	auto back() LLVM_MSTL_NOEXCEPT->row_type { return ( *this )[ rows() - 1 ]; }
+	auto back() const LLVM_MSTL_NOEXCEPT->const_row_type { return ( *this )[ rows() - 1 ]; }
+
+	//<--- all the values, row after row
+	auto values() LLVM_MSTL_NOEXCEPT->row_type { return row_type( __values.data(), __values.size() ); }
+	auto values() const LLVM_MSTL_NOEXCEPT->const_row_type { return const_row_type( __values.data(), __values.size() ); }
+
+	//<--- `rows() + 1` offsets into `values()`, or none while there is no row
+	auto offsets() const LLVM_MSTL_NOEXCEPT->core::span< const size_type > {
+		return core::span< const size_type >( __offsets.data(), __offsets.size() );
+	}
+
+	/*************************************************************************************
+	 *                                                                                   *
+	 *															 	ELEMENT ACCESS END			                           *
+	 *                                                                                   *
+	 *************************************************************************************/
+
+	/*************************************************************************************
+	 *                                                                                   *
+	 *															 	CAPACITY BEGIN			               	               *
+	 *                                                                                   *
+	 *************************************************************************************/
+
+	LLVM_MSTL_NODISCARD auto empty() const LLVM_MSTL_NOEXCEPT->bool { return rows() == 0; }
+	auto rows() const LLVM_MSTL_NOEXCEPT->size_type { return __offsets.empty() ? 0 : __offsets.size() - 1; }
+	auto row_size( size_type __r ) const LLVM_MSTL_NOEXCEPT->size_type { return __offsets[ __r + 1 ] - __offsets[ __r ]; }
+	//<--- the number of values in all the rows
+	auto size() const LLVM_MSTL_NOEXCEPT->size_type { return __values.size(); }
+
+	auto reserve( size_type __rows, size_type __values_count ) -> void {
+		__offsets.reserve( __rows + 1 );
+		__values.reserve( __values_count );
+	}
+
+	auto shrink_to_fit() -> void {
+		__offsets.shrink_to_fit();
+		__values.shrink_to_fit();
+	}
+
+	/*************************************************************************************
+	 *                                                                                   *
+	 *															 		CAPACITY END			               	               *
+	 *                                                                                   *
+	 *************************************************************************************/
+
+	/*************************************************************************************
+	 *                                                                                   *
+	 *															 	MODIFIERS BEGIN			               	               *
+	 *                                                                                   *
+	 *************************************************************************************/
+
+	auto clear() LLVM_MSTL_NOEXCEPT->void {
+		__values.clear();
+		__offsets.clear();
+	}
+
+	//<--- appends an empty row
+	auto push_row() -> row_type {
+		__open_row();
+		__offsets.push_back( __values.size() );
+		return back();
+	}
+
+	template < _ContainerCompatibleRange< _Tp > _Range >
+	auto push_row( _Range&& __range ) -> row_type {
+		__open_row();
+		__values.append_range( core::forward< _Range >( __range ) );
+		__offsets.push_back( __values.size() );
+		return back();
+	}
+
+	auto push_row( core::initializer_list< value_type > __il ) -> row_type { return push_row( core::ranges::subrange( __il.begin(), __il.end() ) ); }
+
+	/**
+	* @brief Appends a value to the last row.
+	* @pre `!empty()`.
+	*/
+	auto push_back( const value_type& __x ) -> void { emplace_back( __x ); }
+	auto push_back( value_type&& __x ) -> void { emplace_back( core::move( __x ) ); }
+
+	template < typename... _Args >
+	auto emplace_back( _Args&&... __args ) -> reference {
+		__values.emplace_back( core::forward< _Args >( __args )... );
+		++__offsets.back();
+		return __values.back();
+	}
+
+	auto pop_row() -> void {
+		__values.resize( __offsets[ rows() - 1 ] );
+		__offsets.pop_back();
+		if ( __offsets.size() == 1 ) __offsets.clear();
+	}
+
+	auto swap( jagged_vector& __x ) LLVM_MSTL_NOEXCEPT->void {
+		__values.swap( __x.__values );
+		__offsets.swap( __x.__offsets );
+	}
+
+	friend auto swap( jagged_vector& __x, jagged_vector& __y ) LLVM_MSTL_NOEXCEPT->void { __x.swap( __y ); }
+
+	/*************************************************************************************
+	 *                                                                                   *
+	 *															 		MODIFIERS END			               	               *
+	 *                                                                                   *
+	 *************************************************************************************/
+
+	friend auto operator==( const jagged_vector& __x, const jagged_vector& __y ) -> bool {
+		return __x.rows() == __y.rows() && __x.__values == __y.__values &&
+					 core::equal( __x.__offsets.begin(), __x.__offsets.end(), __y.__offsets.begin(), __y.__offsets.end() );
+	}
+
+private:
+	auto __open_row() -> void {
+		if ( __offsets.empty() ) __offsets.push_back( 0 );
+	}
+
+	auto __check_row( size_type __r ) const -> void {
+		if ( __r >= rows() ) {
+			spdlog::error( "jagged_vector::at out of range, row[{}] rows()[{}]", __r, rows() );
+			nya::__throw_out_of_range( "jagged_vector" );
+		}
+	}
+
+	values_type  __values; //<--- the rows, back to back
+	offsets_type __offsets;//<--- where each row begins, then where the last one ends
+};
+
+template < typename _Tp, typename _Allocator >
+template < core::random_access_iterator _RandomAccessIterator >
+auto jagged_vector< _Tp, _Allocator >::from_pairs(
+	size_type __rows, _RandomAccessIterator __first, _RandomAccessIterator __last, size_type __jobs ) -> jagged_vector {
+	const size_type __n = static_cast< size_type >( __last - __first );
+	__jobs              = __parallel_jobs( __jobs, __n );
+
+	//<--- one histogram per chunk, turned in place into the first slot of each ( chunk, row ) in the values
+	offsets_type __slots( __jobs * __rows, size_type( 0 ) );
+	__parallel_chunks( __jobs, __n, [ & ]( size_t __job, size_t __from, size_t __to ) {
+		size_type* const __count = __slots.data() + __job * __rows;
+		for ( size_t __i = __from; __i < __to; ++__i ) {
+			const auto __r = static_cast< size_type >( __first[ static_cast< difference_type >( __i ) ].first );
+			if ( __r >= __rows ) {
+				spdlog::error( "jagged_vector::from_pairs row out of range, row[{}] rows[{}]", __r, __rows );
+				nya::__throw_out_of_range( "jagged_vector" );
+			}
+			++__count[ __r ];
+		}
+	} );
+	if ( __rows == 0 ) return jagged_vector();
+
+	jagged_vector __result( __rows );
+	size_type     __offset = 0;
+	for ( size_type __r = 0; __r < __rows; ++__r ) {
+		__result.__offsets[ __r ] = __offset;
+		for ( size_type __job = 0; __job < __jobs; ++__job ) {
+			const size_type __count          = __slots[ __job * __rows + __r ];
+			__slots[ __job * __rows + __r ] = __offset;
+			__offset += __count;
+		}
+	}
+	__result.__offsets[ __rows ] = __offset;
+	__result.__values.resize( __n );
+
+	__parallel_chunks( __jobs, __n, [ & ]( size_t __job, size_t __from, size_t __to ) {
+		size_type* const __slot = __slots.data() + __job * __rows;
+		for ( size_t __i = __from; __i < __to; ++__i ) {
+			const auto& __p                                       = __first[ static_cast< difference_type >( __i ) ];
+			__result.__values[ __slot[ static_cast< size_type >( __p.first ) ]++ ] = __p.second;
+		}
+	} );
+	return __result;
+}
+
+template < typename _Tp, typename _Allocator >
+template < typename _SizeFn, typename _FillFn >
+auto jagged_vector< _Tp, _Allocator >::build( size_type __rows, _SizeFn __size_of, _FillFn __fill, size_type __jobs ) -> jagged_vector {
+	if ( __rows == 0 ) return jagged_vector();
+	jagged_vector __result( __rows );
+	__parallel_chunks( __jobs, __rows, [ & ]( size_t, size_t __from, size_t __to ) {
+		for ( size_t __r = __from; __r < __to; ++__r ) __result.__offsets[ __r + 1 ] = static_cast< size_type >( __size_of( __r ) );
+	} );
+	for ( size_type __r = 0; __r < __rows; ++__r ) __result.__offsets[ __r + 1 ] += __result.__offsets[ __r ];
+	__result.__values.resize( __result.__offsets[ __rows ] );
+	__parallel_chunks( __jobs, __rows, [ & ]( size_t, size_t __from, size_t __to ) {
+		for ( size_t __r = __from; __r < __to; ++__r ) __fill( __r, __result[ __r ] );
+	} );
+	return __result;
+}
+
+LLVM_MSTL_END_NAMESPACE_STD
+
+#endif//LLVM_MSTL_JAGGED_VECTOR_H
@@ -0,0 +1,218 @@
+#ifndef LLVM_MSTL_MDARRAY_H
+#define LLVM_MSTL_MDARRAY_H
+
+/**
+ * @file mdarray.hpp
+ * @brief An owning multidimensional array in one contiguous `vector`, with the layouts and views of `mdspan`.
+ */
+
+#include "__config.h"
+#include "__mdspan/blocked_algorithms.h"
+#include "__mdspan/extents.h"
+#include "__mdspan/layouts.h"
+#include "__mdspan/mdspan.h"
+#include "__memory/aligned_allocator.h"
+#include "vector.hpp"
+
+#include <array>
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+LLVM_MSTL_BEGIN_NAMESPACE_STD
+LLVM_MSTL_CORE_STD
+
+/**
+ * @brief A multidimensional array owning its elements, after the `mdarray` proposal (P1684).
+ *
+ * @ref https://wg21.link/p1684
+ *
+ * The elements live in one container of `mapping().required_span_size()` elements, laid out by `_Layout`:
+ * `layout_right` (row-major), `layout_left` (column-major), `layout_right_padded< P >` (rows padded to `P`
+ * elements) or `layout_tiled< R, C >` (matrices in `R x C` blocks). The default container allocates on a cache
+ * line, so with `layout_right_padded` every row starts aligned.
+ *
+ * `view()` gives the `mdspan` over the elements, which the blocked `transpose` and `matrix_product` take.
+ *
+ * @code{.cc}
+ * nya::mdarray< float, nya::dextents< size_t, 2 >, nya::layout_tiled< 16, 16 > > __a( 1000, 1000 ), __t( 1000, 1000 );
+ * __a( 3, 4 ) = 1.f;
+ * nya::transpose( __a.view(), __t.view() );
+ * @endcode
+ *
+ * @tparam _Tp The element type.
+ * @tparam _Extents The `extents`.
+ * @tparam _Layout The layout policy.
+ * @tparam _Container The contiguous container of the elements.
+ */
+template <
+	typename _Tp,
+	typename _Extents,
+	typename _Layout    = layout_right,
+	typename _Container = vector< _Tp, __aligned_allocator< _Tp, 64 > > >
+class LLVM_MSTL_TEMPLATE_VIS mdarray {
+	static_assert( core::is_same_v< _Tp, typename _Container::value_type > );
+
+public:
+	using extents_type        = _Extents;
+	using layout_type         = _Layout;
+	using container_type      = _Container;
+	using mapping_type        = typename layout_type::template mapping< extents_type >;
+	using element_type        = _Tp;
+	using value_type          = _Tp;
+	using index_type          = typename extents_type::index_type;
+	using size_type           = typename extents_type::size_type;
+	using rank_type           = typename extents_type::rank_type;
+	using reference           = value_type&;
+	using const_reference     = const value_type&;
+	using pointer             = value_type*;
+	using const_pointer       = const value_type*;
+	using mdspan_type         = mdspan< element_type, extents_type, layout_type >;
+	using const_mdspan_type   = mdspan< const element_type, extents_type, layout_type >;
+
+	/*************************************************************************************
+	 *                                                                                   *
+	 *															CONSTRUCTOR BEGIN		                                 *
+	 *                                                                                   *
+	 *************************************************************************************/
+
+	mdarray() = default;
+
+	//<--- value-initialized elements
+	explicit mdarray( const mapping_type& __m )
+			: __map( __m ),
+				__ctr( static_cast< size_t >( __m.required_span_size() ) ) {}
+
+	explicit mdarray( const extents_type& __e )
+			: mdarray( mapping_type( __e ) ) {}
+
+	template < typename... _Ints >
+		requires( ( core::is_convertible_v< _Ints, index_type > && ... ) && sizeof...( _Ints ) != 0 &&
+							( sizeof...( _Ints ) == extents_type::rank() || sizeof...( _Ints ) == extents_type::rank_dynamic() ) )
+	explicit mdarray( _Ints... __exts )
+			: mdarray( extents_type( static_cast< index_type >( __exts )... ) ) {}
+
+	mdarray( const extents_type& __e, const value_type& __v )
+			: __map( __e ),
+				__ctr( static_cast< size_t >( __map.required_span_size() ), __v ) {}
+
+	//<--- copies the elements of a view of the same shape, whatever its layout
+	template < typename _Up, typename _OtherExtents, typename _OtherLayout >
+	explicit mdarray( const mdspan< _Up, _OtherExtents, _OtherLayout >& __x )
+			: mdarray( extents_type( __extents_array( __x.extents() ) ) ) {
+		__for_each_index( [ & ]( const auto& __idx ) { ( *this )[ __idx ] = __x[ __idx ]; } );
+	}
+
+	/*************************************************************************************
+	 *                                                                                   *
+	 *																CONSTRUCTOR END			                               *
+	 *                                                                                   *
+	 *************************************************************************************/
+
+	template < typename... _Indices >
+		requires( sizeof...( _Indices ) == extents_type::rank() && ( core::is_convertible_v< _Indices, index_type > && ... ) )
+	auto operator()( _Indices... __is ) LLVM_MSTL_NOEXCEPT->reference {
+		return __ctr.data()[ __map( static_cast< index_type >( __is )... ) ];
+	}
+
+	template < typename... _Indices >
+		requires( sizeof...( _Indices ) == extents_type::rank() && ( core::is_convertible_v< _Indices, index_type > && ... ) )
+	auto operator()( _Indices... __is ) const LLVM_MSTL_NOEXCEPT->const_reference {
+		return __ctr.data()[ __map( static_cast< index_type >( __is )... ) ];
+	}
+
+	template < typename _OtherIndexType >
+	auto operator[]( const core::array< _OtherIndexType, extents_type::rank() >& __is ) LLVM_MSTL_NOEXCEPT->reference {
+		return view()[ __is ];
+	}
+
+	template < typename _OtherIndexType >
+	auto operator[]( const core::array< _OtherIndexType, extents_type::rank() >& __is ) const LLVM_MSTL_NOEXCEPT->const_reference {
+		return view()[ __is ];
+	}
+
+	auto view() LLVM_MSTL_NOEXCEPT->mdspan_type { return mdspan_type( __ctr.data(), __map ); }
+	auto view() const LLVM_MSTL_NOEXCEPT->const_mdspan_type { return const_mdspan_type( __ctr.data(), __map ); }
+
+	operator mdspan_type() LLVM_MSTL_NOEXCEPT { return view(); }
+	operator const_mdspan_type() const LLVM_MSTL_NOEXCEPT { return view(); }
+
+#ifdef __cpp_lib_mdspan
+	auto to_mdspan() { return view().to_mdspan(); }
+	auto to_mdspan() const { return view().to_mdspan(); }
+#endif
+
+	static LLVM_MSTL_CONSTEXPR auto rank() LLVM_MSTL_NOEXCEPT->rank_type { return extents_type::rank(); }
+	static LLVM_MSTL_CONSTEXPR auto rank_dynamic() LLVM_MSTL_NOEXCEPT->rank_type { return extents_type::rank_dynamic(); }
+	static LLVM_MSTL_CONSTEXPR auto static_extent( rank_type __r ) LLVM_MSTL_NOEXCEPT->size_t { return extents_type::static_extent( __r ); }
+
+	auto extent( rank_type __r ) const LLVM_MSTL_NOEXCEPT->index_type { return extents().extent( __r ); }
+	auto extents() const LLVM_MSTL_NOEXCEPT->const extents_type& { return __map.extents(); }
+	auto mapping() const LLVM_MSTL_NOEXCEPT->const mapping_type& { return __map; }
+
+	//<--- the number of addressable elements, the padding excluded
+	auto size() const LLVM_MSTL_NOEXCEPT->size_type { return static_cast< size_type >( extents().__product( 0, rank() ) ); }
+	LLVM_MSTL_NODISCARD auto empty() const LLVM_MSTL_NOEXCEPT->bool { return size() == 0; }
+	//<--- the number of stored elements, the padding included
+	auto container_size() const LLVM_MSTL_NOEXCEPT->size_t { return __ctr.size(); }
+
+	auto data() LLVM_MSTL_NOEXCEPT->pointer { return __ctr.data(); }
+	auto data() const LLVM_MSTL_NOEXCEPT->const_pointer { return __ctr.data(); }
+	auto container() const LLVM_MSTL_NOEXCEPT->const container_type& { return __ctr; }
+	auto extract_container() && -> container_type { return core::move( __ctr ); }
+
+	auto stride( rank_type __r ) const LLVM_MSTL_NOEXCEPT->index_type
+		requires( mapping_type::is_always_strided() )
+	{
+		return __map.stride( __r );
+	}
+
+	auto swap( mdarray& __x ) LLVM_MSTL_NOEXCEPT->void {
+		core::swap( __map, __x.__map );
+		__ctr.swap( __x.__ctr );
+	}
+
+	friend auto swap( mdarray& __x, mdarray& __y ) LLVM_MSTL_NOEXCEPT->void { __x.swap( __y ); }
+
+	//<--- same extents and same elements, the padding ignored
+	friend auto operator==( const mdarray& __x, const mdarray& __y ) -> bool {
+		if ( !( __x.extents() == __y.extents() ) ) return false;
+		bool __equal = true;
+		__x.__for_each_index( [ & ]( const auto& __idx ) { __equal = __equal && __x[ __idx ] == __y[ __idx ]; } );
+		return __equal;
+	}
+
+private:
+	template < typename _OtherExtents >
+	static auto __extents_array( const _OtherExtents& __e ) -> core::array< index_type, extents_type::rank() > {
+		static_assert( _OtherExtents::rank() == extents_type::rank() );
+		core::array< index_type, extents_type::rank() > __a{};
+		for ( rank_type __r = 0; __r < extents_type::rank(); ++__r ) __a[ __r ] = static_cast< index_type >( __e.extent( __r ) );
+		return __a;
+	}
+
+	//<--- calls `__f` with every multi-index, the last index running fastest
+	template < typename _Fn >
+	auto __for_each_index( _Fn&& __f ) const -> void {
+		if ( empty() ) return;
+		core::array< index_type, extents_type::rank() > __idx{};
+		for ( ;; ) {
+			__f( __idx );
+			rank_type __r = extents_type::rank();
+			while ( __r > 0 ) {
+				--__r;
+				if ( ++__idx[ __r ] < extent( __r ) ) break;
+				__idx[ __r ] = 0;
+				if ( __r == 0 ) return;
+			}
+			if constexpr ( extents_type::rank() == 0 ) return;
+		}
+	}
+
+	mapping_type   __map{};//<--- the extents and the layout
+	container_type __ctr{};//<--- the elements, `__map.required_span_size()` of them
+};
+
+LLVM_MSTL_END_NAMESPACE_STD
+
+#endif//LLVM_MSTL_MDARRAY_H
@@ -0,0 +1,349 @@
+#ifndef LLVM_MSTL_PRIORITY_QUEUE_H
+#define LLVM_MSTL_PRIORITY_QUEUE_H
+
+/**
+ * @file priority_queue.hpp
+ * @brief A priority queue over a d-ary heap in a `vector`, with bulk heapify, replace-top and position tracking.
+ */
+
+#include "__config.h"
+#include "__ranges/container_compatible_range.h"
+#include "__ranges/from_range.h"
+#include "__utility/exception_guard.h"
+#include "stdexcept.h"
+#include "vector.hpp"
+
+#include "spdlog/spdlog.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <initializer_list>
+#include <iterator>
+#include <ranges>
+#include <type_traits>
+#include <utility>
+
+LLVM_MSTL_BEGIN_NAMESPACE_STD
+LLVM_MSTL_CORE_STD
+
+/**
+ * @brief The default position hook of @ref priority_queue, which tracks nothing.
+ */
+struct priority_queue_no_hook {
+	template < typename _Tp >
+	LLVM_MSTL_CONSTEXPR auto operator()( const _Tp&, size_t ) const LLVM_MSTL_NOEXCEPT->void {}
+};
+
+/**
+ * @brief A priority queue over a `_Arity`-ary heap: the top is the greatest element under `_Compare`.
+ *
+ * @ref https://en.wikipedia.org/wiki/D-ary_heap
+ *
+ * A node `__i` has the children `_Arity * __i + 1` to `_Arity * __i + _Arity`. A wider heap is shallower, so a pop
+ * sifts down through fewer levels, and the children it compares at each level are adjacent, one or two cache
+ * lines for small elements; pushes get cheaper as well. 4 is a good default, 2 gives the binary heap of
+ * `core::priority_queue`.
+ *
+ * On top of the usual adaptor:
+ * - `push_range` appends a batch and restores the heap in O(n) with Floyd's bottom-up heapify when the batch is
+ *   large enough, sifting each element up otherwise;
+ * - `pop_push` replaces the top in one sift-down instead of a pop and a push;
+ * - `_Hook` is called as `__hook( __x, __pos )` whenever an element `__x` lands at the position `__pos` of the
+ *   heap, so that a caller can map its items to their positions and `update` or `erase` them there, e.g. the
+ *   decrease-key of Dijkstra's algorithm.
+ *
+ * @code{.cc}
+ * nya::priority_queue< task, by_deadline, 4 > __ready;
+ * __ready.push_range( __batch );
+ * auto __next = __ready.top();
+ * __ready.pop_push( __next.rescheduled() );
+ * @endcode
+ *
+ * @tparam _Tp The element type.
+ * @tparam _Compare The strict weak ordering; the top is an element no other compares greater than.
+ * @tparam _Arity The number of children of a node, at least 2.
+ * @tparam _Hook The position hook, called with an element and its new position.
+ * @tparam _Container The random access container of the heap.
+ */
+template <
+	typename _Tp,
+	typename _Compare   = core::less< _Tp >,
+	size_t _Arity       = 4,
+	typename _Hook      = priority_queue_no_hook,
+	typename _Container = vector< _Tp, core::allocator< _Tp > > >
+class LLVM_MSTL_TEMPLATE_VIS priority_queue {
+	static_assert( _Arity >= 2, "priority_queue: a heap node needs at least two children" );
+	static_assert( core::is_same_v< _Tp, typename _Container::value_type > );
+
+	static LLVM_MSTL_CONSTEXPR bool __tracked = !core::is_same_v< _Hook, priority_queue_no_hook >;
+
+public:
+	using container_type  = _Container;
+	using value_compare   = _Compare;
+	using position_hook   = _Hook;
+	using value_type      = typename container_type::value_type;
+	using size_type       = typename container_type::size_type;
+	using reference       = typename container_type::reference;
+	using const_reference = typename container_type::const_reference;
+
+	static LLVM_MSTL_CONSTEXPR size_type arity = _Arity;
+
+	/*************************************************************************************
+	 *                                                                                   *
+	 *															CONSTRUCTOR BEGIN		                                 *
+	 *                                                                                   *
+	 *************************************************************************************/
+
+	priority_queue()
+			: priority_queue( value_compare() ) {}
+
+	explicit priority_queue( const value_compare& __comp, const position_hook& __hook = position_hook() )
+			: __c()
+			, __compare( __comp )
+			, __tracker( __hook ) {}
+
+	//<--- adopts `__cont` and heapifies it
+	priority_queue( const value_compare& __comp, container_type __cont, const position_hook& __hook = position_hook() )
+			: __c( core::move( __cont ) )
+			, __compare( __comp )
+			, __tracker( __hook ) {
+		__make_heap( 0 );
+	}
+
+	template < typename _InputIterator >
+		requires core::input_iterator< _InputIterator >
+	priority_queue( _InputIterator __first, _InputIterator __last, const value_compare& __comp = value_compare() )
+			: priority_queue( __comp, container_type( __first, __last ) ) {}
+
+	template < _ContainerCompatibleRange< value_type > _Range >
+	priority_queue( from_range_t, _Range&& __range, const value_compare& __comp = value_compare() )
+			: priority_queue( __comp ) {
+		push_range( core::forward< _Range >( __range ) );
+	}
+
+	priority_queue( core::initializer_list< value_type > __il, const value_compare& __comp = value_compare() )
+			: priority_queue( __il.begin(), __il.end(), __comp ) {}
+
+	/*************************************************************************************
+	 *                                                                                   *
+	 *																CONSTRUCTOR END			                               *
+	 *                                                                                   *
+	 *************************************************************************************/
+
+	LLVM_MSTL_NODISCARD auto empty() const LLVM_MSTL_NOEXCEPT->bool { return __c.empty(); }
+	auto size() const LLVM_MSTL_NOEXCEPT->size_type { return __c.size(); }
+	auto reserve( size_type __n ) -> void { __c.reserve( __n ); }
+
+	auto top() const LLVM_MSTL_NOEXCEPT->const_reference { return __c[ 0 ]; }
+
+	//<--- the element at the position `__pos` of the heap, as reported to the hook
+	auto operator[]( size_type __pos ) const LLVM_MSTL_NOEXCEPT->const_reference { return __c[ __pos ]; }
+
+	//<--- the heap, in heap order
+	auto container() const LLVM_MSTL_NOEXCEPT->const container_type& { return __c; }
+	auto value_comp() const -> value_compare { return __compare; }
+	auto hook() const -> const position_hook& { return __tracker; }
+
+	/*************************************************************************************
+	 *                                                                                   *
+	 *															 	MODIFIERS BEGIN			               	               *
+	 *                                                                                   *
+	 *************************************************************************************/
+
+	auto push( const value_type& __x ) -> void { emplace( __x ); }
+	auto push( value_type&& __x ) -> void { emplace( core::move( __x ) ); }
+
+	template < typename... _Args >
+	auto emplace( _Args&&... __args ) -> void {
+		__c.emplace_back( core::forward< _Args >( __args )... );
+		__sift_up( __c.size() - 1 );
+	}
+
+	/**
+	* @brief Appends a batch, then restores the heap by heapifying it or by sifting up the new elements.
+	*
+	* Floyd's heapify costs O(size()) moves, the sifts O(n log size()); the cheaper one is picked.
+	*/
+	template < _ContainerCompatibleRange< value_type > _Range >
+	auto push_range( _Range&& __range ) -> void {
+		const size_type __old   = __c.size();
+		auto            __guard = __make_exception_guard( [ & ]() { __c.erase( __c.begin() + __old, __c.end() ); } );
+		__c.append_range( core::forward< _Range >( __range ) );
+		__guard.__complete();
+
+		const size_type __n = __c.size() - __old;
+		if ( __n * __depth( __c.size() ) > __c.size() ) {
+			__make_heap( __old );
+		} else {
+			for ( size_type __i = __old; __i != __c.size(); ++__i ) __sift_up( __i );
+		}
+	}
+
+	auto pop() -> void {
+		if ( __c.size() > 1 ) {
+			__c[ 0 ] = core::move( __c[ __c.size() - 1 ] );
+			__c.pop_back();
+			__sift_down( 0 );
+		} else {
+			__c.pop_back();
+		}
+	}
+
+	/**
+	* @brief Replaces the top by `__x` in one sift-down, as a `pop` then a `push` in half the work.
+	* @pre `!empty()`.
+	*/
+	auto pop_push( value_type __x ) -> void {
+		__c[ 0 ] = core::move( __x );
+		__sift_down( 0 );
+	}
+
+	/**
+	* @brief Replaces the element at the position `__pos` by `__x`, sifting it up or down to where it belongs.
+	*
+	* A decrease-key (or increase-key) for the caller tracking the positions through the hook.
+	*
+	* @throws out_of_range If `__pos >= size()`.
+	*/
+	auto update( size_type __pos, value_type __x ) -> void {
+		__check_position( __pos );
+		__c[ __pos ] = core::move( __x );
+		if ( __pos != 0 && __compare( __c[ __parent( __pos ) ], __c[ __pos ] ) ) __sift_up( __pos );
+		else __sift_down( __pos );
+	}
+
+	/**
+	* @brief Removes the element at the position `__pos`.
+	* @throws out_of_range If `__pos >= size()`.
+	*/
+	auto erase( size_type __pos ) -> void {
+		__check_position( __pos );
+		if ( __pos + 1 == __c.size() ) {
+			__c.pop_back();
+			return;
+		}
+		value_type __last = core::move( __c[ __c.size() - 1 ] );
+		__c.pop_back();
+		update( __pos, core::move( __last ) );
+	}
+
+	auto clear() LLVM_MSTL_NOEXCEPT->void { __c.clear(); }
+
+	auto swap( priority_queue& __x ) LLVM_MSTL_NOEXCEPT_V(
+		core::is_nothrow_swappable_v< container_type >&& core::is_nothrow_swappable_v< value_compare >&&
+			core::is_nothrow_swappable_v< position_hook > )
+		->void {
+		using core::swap;
+		swap( __c, __x.__c );
+		swap( __compare, __x.__compare );
+		swap( __tracker, __x.__tracker );
+	}
+
+	friend auto swap( priority_queue& __x, priority_queue& __y ) LLVM_MSTL_NOEXCEPT_V( LLVM_MSTL_NOEXCEPT( __x.swap( __y ) ) )->void {
+		__x.swap( __y );
+	}
+
+	/*************************************************************************************
+	 *                                                                                   *
+	 *															 		MODIFIERS END			               	               *
+	 *                                                                                   *
+	 *************************************************************************************/
+
+private:
+	static LLVM_MSTL_CONSTEXPR auto __parent( size_type __i ) LLVM_MSTL_NOEXCEPT->size_type { return ( __i - 1 ) / _Arity; }
+	static LLVM_MSTL_CONSTEXPR auto __first_child( size_type __i ) LLVM_MSTL_NOEXCEPT->size_type { return _Arity * __i + 1; }
+
+	//<--- the number of levels of a heap of `__n` elements
+	static LLVM_MSTL_CONSTEXPR auto __depth( size_type __n ) LLVM_MSTL_NOEXCEPT->size_type {
+		size_type __d = 0;
+		for ( ; __n != 0; __n /= _Arity ) ++__d;
+		return __d;
+	}
+
+	auto __check_position( size_type __pos ) const -> void {
+		if ( __pos >= __c.size() ) {
+			spdlog::error( "priority_queue position out of range, __pos[{}] size()[{}]", __pos, __c.size() );
+			nya::__throw_out_of_range( "priority_queue" );
+		}
+	}
+
+	auto __place( size_type __pos, value_type&& __x ) -> void {
+		__c[ __pos ] = core::move( __x );
+		if constexpr ( __tracked ) __tracker( static_cast< const value_type& >( __c[ __pos ] ), __pos );
+	}
+
+	//<--- moves the element at `__pos` up past the parents it is greater than, through a hole
+	auto __sift_up( size_type __pos ) -> void {
+		if ( __pos == 0 || !__compare( __c[ __parent( __pos ) ], __c[ __pos ] ) ) {
+			if constexpr ( __tracked ) __tracker( static_cast< const value_type& >( __c[ __pos ] ), __pos );
+			return;
+		}
+		value_type __x = core::move( __c[ __pos ] );
+		do {
+			const size_type __p = __parent( __pos );
+			__place( __pos, core::move( __c[ __p ] ) );
+			__pos = __p;
+		} while ( __pos != 0 && __compare( __c[ __parent( __pos ) ], __x ) );
+		__place( __pos, core::move( __x ) );
+	}
+
+	//<--- the greatest of the up to `_Arity` children from `__first`
+	auto __greatest_child( size_type __first ) const -> size_type {
+		const size_type __last = core::min( __first + _Arity, __c.size() );
+		size_type       __best = __first;
+		for ( size_type __i = __first + 1; __i < __last; ++__i ) {
+			if ( __compare( __c[ __best ], __c[ __i ] ) ) __best = __i;
+		}
+		return __best;
+	}
+
+	//<--- moves the element at `__pos` down past the children greater than it, through a hole
+	auto __sift_down( size_type __pos ) -> void {
+		const size_type __n     = __c.size();
+		size_type       __child = __first_child( __pos );
+		if ( __child >= __n || !__compare( __c[ __pos ], __c[ __child = __greatest_child( __child ) ] ) ) {
+			if constexpr ( __tracked ) __tracker( static_cast< const value_type& >( __c[ __pos ] ), __pos );
+			return;
+		}
+		value_type __x = core::move( __c[ __pos ] );
+		do {
+			__place( __pos, core::move( __c[ __child ] ) );
+			__pos   = __child;
+			__child = __first_child( __pos );
+		} while ( __child < __n && __compare( __x, __c[ __child = __greatest_child( __child ) ] ) );
+		__place( __pos, core::move( __x ) );
+	}
+
+	/**
+	* @brief Floyd's heapify of the elements from `__from` on, the ones before being a heap already.
+	*
+	* Only the parents of the new elements and their ancestors can be out of order. They are sifted down range by
+	* range, one level up at a time, each range from its last node; O(size()) moves in all, fewer for a small batch.
+	*/
+	auto __make_heap( size_type __from ) -> void {
+		const size_type __n = __c.size();
+		if ( __n > 1 && __from < __n ) {
+			size_type __lo = __parent( core::max< size_type >( __from, 1 ) );
+			size_type __hi = __parent( __n - 1 );
+			for ( ;; ) {
+				for ( size_type __i = __hi + 1; __i-- > __lo; ) __sift_down( __i );
+				if ( __lo == 0 ) break;
+				__lo = __parent( __lo );
+				__hi = __parent( __hi );
+			}
+		}
+		if constexpr ( __tracked ) {
+			for ( size_type __i = 0; __i != __n; ++__i ) __tracker( static_cast< const value_type& >( __c[ __i ] ), __i );
+		}
+	}
+
+	container_type __c;      //<--- the heap, the top first
+	value_compare  __compare;//<--- the ordering, the top is the greatest
+	position_hook  __tracker;//<--- the hook, told of every element that lands somewhere
+};
+
+LLVM_MSTL_END_NAMESPACE_STD
+
+#endif//LLVM_MSTL_PRIORITY_QUEUE_H
@@ -0,0 +1,341 @@
+#ifndef LLVM_MSTL_SLOT_MAP_H
+#define LLVM_MSTL_SLOT_MAP_H
+
+/**
+ * @file slot_map.hpp
+ * @brief A container of densely stored values addressed by stable generational keys.
+ */
+
+#include "__config.h"
+#include "__utility/exception_guard.h"
+#include "stdexcept.h"
+#include "vector.hpp"
+
+#include "spdlog/spdlog.h"
+
+#include <compare>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <memory>
+#include <span>
+#include <type_traits>
+#include <utility>
+
+LLVM_MSTL_BEGIN_NAMESPACE_STD
+LLVM_MSTL_CORE_STD
+
+/**
+ * @brief The handle of a value in a @ref slot_map: a slot, and the generation of the slot it was issued for.
+ */
+struct slot_map_key {
+	uint32_t index      = 0;
+	uint32_t generation = 0;
+
+	friend auto operator==( const slot_map_key&, const slot_map_key& ) -> bool = default;
+	friend auto operator<=>( const slot_map_key&, const slot_map_key& )        = default;
+};
+
+/**
+ * @brief Values with O(1) insertion, erasure and lookup through keys that stay valid until their value is erased.
+ *
+ * @ref https://wg21.link/p0661
+ *
+ * The values are stored densely in a `vector`, so iteration is a linear scan over `values()`, in no particular
+ * order. A key names a slot of a sparse index, which holds the position of its value in the dense array and a
+ * generation counter:
+ * - `erase` moves the last value into the hole (swap-and-pop), repoints the slot of the moved value, bumps the
+ *   generation of the erased slot and pushes that slot on a free list;
+ * - `insert` appends the value and reuses the most recently freed slot, if any;
+ * - a key is valid while its generation matches that of its slot, so the key of an erased value stays invalid
+ *   even once its slot is reused (until the 32-bit generation wraps around). The generation of a slot is bumped
+ *   on erasure and on reuse, so it is odd while the slot is free and no key can match a free slot.
+ *
+ * Iterators and references are those of the dense `vector`: insertion may invalidate them all, erasure moves the
+ * last value. Keys are never invalidated but by the erasure of their own value.
+ *
+ * @code{.cc}
+ * nya::slot_map< entity > __entities;
+ * const auto __k = __entities.insert( entity{} );
+ * if ( entity* __e = __entities.get( __k ) ) __e->update();
+ * for ( entity& __e : __entities ) __e.render();
+ * __entities.erase( __k );
+ * @endcode
+ *
+ * @tparam _Tp The value type.
+ * @tparam _Allocator The allocator of the values; rebound for the index.
+ */
+template < typename _Tp, typename _Allocator = core::allocator< _Tp > >
+class LLVM_MSTL_TEMPLATE_VIS slot_map {
+	template < typename _Up >
+	using __rebind = typename core::allocator_traits< _Allocator >::template rebind_alloc< _Up >;
+
+	//<--- a live slot holds the position of its value, a free one the next free slot; the generation is odd while free
+	struct __slot {
+		uint32_t __index;
+		uint32_t __generation;
+	};
+
+	static LLVM_MSTL_CONSTEXPR uint32_t __no_slot = core::numeric_limits< uint32_t >::max();
+
+public:
+	using key_type        = slot_map_key;
+	using value_type      = _Tp;
+	using allocator_type  = _Allocator;
+	using size_type       = size_t;
+	using difference_type = ptrdiff_t;
+	using reference       = value_type&;
+	using const_reference = const value_type&;
+	using pointer         = value_type*;
+	using const_pointer   = const value_type*;
+	using values_type     = vector< value_type, allocator_type >;
+	using iterator        = typename values_type::iterator;
+	using const_iterator  = typename values_type::const_iterator;
+
+	/*************************************************************************************
+	 *                                                                                   *
+	 *															CONSTRUCTOR BEGIN		                                 *
+	 *                                                                                   *
+	 *************************************************************************************/
+
+	slot_map() = default;
+
+	explicit slot_map( const allocator_type& __a )
+			: __values( __a ),
+				__owners( __rebind< uint32_t >( __a ) ),
+				__slots( __rebind< __slot >( __a ) ) {}
+
+	/*************************************************************************************
+	 *                                                                                   *
+	 *																CONSTRUCTOR END			                               *
+	 *                                                                                   *
+	 *************************************************************************************/
+
+	auto get_allocator() const LLVM_MSTL_NOEXCEPT->allocator_type { return __values.get_allocator(); }
+
+	//<--- the dense values, in no particular order
+	auto begin() LLVM_MSTL_NOEXCEPT->iterator { return __values.begin(); }
+	auto begin() const LLVM_MSTL_NOEXCEPT->const_iterator { return __values.begin(); }
+	auto end() LLVM_MSTL_NOEXCEPT->iterator { return __values.end(); }
+	auto end() const LLVM_MSTL_NOEXCEPT->const_iterator { return __values.end(); }
+	auto cbegin() const LLVM_MSTL_NOEXCEPT->const_iterator { return begin(); }
+	auto cend() const LLVM_MSTL_NOEXCEPT->const_iterator { return end(); }
+
+	/*************************************************************************************
+	 *                                                                                   *
+	 *																CAPACITY BEGIN			                               *
+	 *                                                                                   *
+	 *************************************************************************************/
+
+	LLVM_MSTL_NODISCARD auto empty() const LLVM_MSTL_NOEXCEPT->bool { return __values.empty(); }
+	auto size() const LLVM_MSTL_NOEXCEPT->size_type { return __values.size(); }
+	auto capacity() const LLVM_MSTL_NOEXCEPT->size_type { return __values.capacity(); }
+	//<--- one slot is kept back as the end of the free list
+	auto max_size() const LLVM_MSTL_NOEXCEPT->size_type { return core::min< size_type >( __values.max_size(), __no_slot ); }
+	//<--- the number of slots ever handed out, live or free
+	auto slot_count() const LLVM_MSTL_NOEXCEPT->size_type { return __slots.size(); }
+
+	auto reserve( size_type __n ) -> void {
+		__check_length( __n );
+		__values.reserve( __n );
+		__owners.reserve( __n );
+		__slots.reserve( __n );
+	}
+
+	//<--- the slots are kept, the keys still name them
+	auto shrink_to_fit() -> void {
+		__values.shrink_to_fit();
+		__owners.shrink_to_fit();
+	}
+
+	/*************************************************************************************
+	 *                                                                                   *
+	 *																CAPACITY END			                                 *
+	 *                                                                                   *
+	 *************************************************************************************/
+
+	/*************************************************************************************
+	 *                                                                                   *
+	 *															 	ELEMENT ACCESS BEGIN			                         *
+	 *                                                                                   *
+	 *************************************************************************************/
+
+	auto contains( const key_type& __k ) const LLVM_MSTL_NOEXCEPT->bool {
+		return ( __k.generation & 1 ) == 0 && __k.index < __slots.size() && __slots[ __k.index ].__generation == __k.generation;
+	}
+
+	//<--- the value of `__k`, or `nullptr` if it was erased
+	auto get( const key_type& __k ) LLVM_MSTL_NOEXCEPT->pointer { return contains( __k ) ? __values.data() + __slots[ __k.index ].__index : nullptr; }
+	auto get( const key_type& __k ) const LLVM_MSTL_NOEXCEPT->const_pointer {
+		return contains( __k ) ? __values.data() + __slots[ __k.index ].__index : nullptr;
+	}
+
+	auto find( const key_type& __k ) LLVM_MSTL_NOEXCEPT->iterator { return contains( __k ) ? begin() + __slots[ __k.index ].__index : end(); }
+	auto find( const key_type& __k ) const LLVM_MSTL_NOEXCEPT->const_iterator {
+		return contains( __k ) ? begin() + __slots[ __k.index ].__index : end();
+	}
+
+	//<--- @pre `contains( __k )`
+	auto operator[]( const key_type& __k ) LLVM_MSTL_NOEXCEPT->reference { return __values[ __slots[ __k.index ].__index ]; }
+	auto operator[]( const key_type& __k ) const LLVM_MSTL_NOEXCEPT->const_reference { return __values[ __slots[ __k.index ].__index ]; }
+
+	/**
+	* @brief The value of `__k`.
+	* @throws out_of_range If `__k` names no value.
+	*/
+	auto at( const key_type& __k ) -> reference {
+		__check_key( __k );
+		return ( *this )[ __k ];
+	}
+
+	auto at( const key_type& __k ) const -> const_reference {
+		__check_key( __k );
+		return ( *this )[ __k ];
+	}
+
+	//<--- the key of the value at `__pos`, from the dense position back to its slot
+	auto key_of( const_iterator __pos ) const LLVM_MSTL_NOEXCEPT->key_type {
+		const uint32_t __s = __owners[ static_cast< size_type >( __pos - begin() ) ];
+		return key_type{ __s, __slots[ __s ].__generation };
+	}
+
+	auto values() LLVM_MSTL_NOEXCEPT->core::span< value_type > { return core::span< value_type >( __values.data(), __values.size() ); }
+	auto values() const LLVM_MSTL_NOEXCEPT->core::span< const value_type > {
+		return core::span< const value_type >( __values.data(), __values.size() );
+	}
+
+	/*************************************************************************************
+	 *                                                                                   *
+	 *															 	ELEMENT ACCESS END			                           *
+	 *                                                                                   *
+	 *************************************************************************************/
+
+	/*************************************************************************************
+	 *                                                                                   *
+	 *															 	MODIFIERS BEGIN			               	               *
+	 *                                                                                   *
+	 *************************************************************************************/
+
+	/**
+	* @brief Appends a value built from `__args` and returns its key.
+	*
+	* Strong exception guarantee.
+	*
+	* @throws length_error If `size() == max_size()`.
+	*/
+	template < typename... _Args >
+	auto emplace( _Args&&... __args ) -> key_type;
+
+	auto insert( const value_type& __x ) -> key_type { return emplace( __x ); }
+	auto insert( value_type&& __x ) -> key_type { return emplace( core::move( __x ) ); }
+
+	//<--- erases the value of `__k` if there is one, returns the number of values erased
+	auto erase( const key_type& __k ) -> size_type {
+		if ( !contains( __k ) ) return 0;
+		__erase_at( __slots[ __k.index ].__index );
+		return 1;
+	}
+
+	//<--- the returned iterator is `__pos` again, now at the value that was last, or `end()`
+	auto erase( const_iterator __pos ) -> iterator {
+		const auto __i = static_cast< size_type >( __pos - begin() );
+		__erase_at( static_cast< uint32_t >( __i ) );
+		return begin() + static_cast< difference_type >( __i );
+	}
+
+	//<--- erases every value, every key becomes invalid
+	auto clear() LLVM_MSTL_NOEXCEPT->void {
+		while ( !__values.empty() ) __erase_at( static_cast< uint32_t >( __values.size() - 1 ) );
+	}
+
+	auto swap( slot_map& __x ) LLVM_MSTL_NOEXCEPT->void {
+		__values.swap( __x.__values );
+		__owners.swap( __x.__owners );
+		__slots.swap( __x.__slots );
+		core::swap( __free, __x.__free );
+	}
+
+	friend auto swap( slot_map& __x, slot_map& __y ) LLVM_MSTL_NOEXCEPT->void { __x.swap( __y ); }
+
+	/*************************************************************************************
+	 *                                                                                   *
+	 *															 		MODIFIERS END			               	               *
+	 *                                                                                   *
+	 *************************************************************************************/
+
+private:
+	auto __check_key( const key_type& __k ) const -> void {
+		if ( !contains( __k ) ) {
+			spdlog::error( "slot_map::at stale or foreign key, index[{}] generation[{}]", __k.index, __k.generation );
+			nya::__throw_out_of_range( "slot_map" );
+		}
+	}
+
+	auto __check_length( size_type __n ) const -> void {
+		if ( __n > max_size() ) {
+			spdlog::error( "slot_map length exceeds max_size(), __n[{}] max_size()[{}]", __n, max_size() );
+			nya::__throw_length_error( "slot_map" );
+		}
+	}
+
+	/**
+	* @brief Swap-and-pop of the value at the dense position `__i`, whose slot goes on the free list.
+	*
+	* The last value is move-assigned into the hole, so that may throw; the moved value is left in place then.
+	*/
+	auto __erase_at( uint32_t __i ) -> void {
+		const auto     __last = static_cast< uint32_t >( __values.size() - 1 );
+		const uint32_t __s    = __owners[ __i ];
+		if ( __i != __last ) {
+			__values[ __i ]                    = core::move( __values[ __last ] );
+			__owners[ __i ]                    = __owners[ __last ];
+			__slots[ __owners[ __i ] ].__index = __i;
+		}
+		__values.pop_back();
+		__owners.pop_back();
+		++__slots[ __s ].__generation;
+		__slots[ __s ].__index = __free;
+		__free                 = __s;
+	}
+
+	values_type                              __values;          //<--- the values, dense
+	vector< uint32_t, __rebind< uint32_t > > __owners;          //<--- the slot of each value, parallel to `__values`
+	vector< __slot, __rebind< __slot > >     __slots;           //<--- the sparse index, addressed by `key_type::index`
+	uint32_t                                 __free = __no_slot;//<--- the most recently freed slot, the head of the free list
+};
+
+template < typename _Tp, typename _Allocator >
+template < typename... _Args >
+auto slot_map< _Tp, _Allocator >::emplace( _Args&&... __args ) -> key_type {
+	__check_length( size() + 1 );
+	const auto     __i = static_cast< uint32_t >( __values.size() );
+	const uint32_t __s = __free != __no_slot ? __free : static_cast< uint32_t >( __slots.size() );
+
+	__values.emplace_back( core::forward< _Args >( __args )... );
+	auto __guard = __make_exception_guard( [ & ]() {
+		if ( __owners.size() > __i ) __owners.pop_back();
+		__values.pop_back();
+	} );
+	__owners.push_back( __s );
+	if ( __s == __slots.size() ) __slots.push_back( __slot{ __i, 0 } );
+	__guard.__complete();
+
+	if ( __s == __free ) {
+		__free                 = __slots[ __s ].__index;
+		__slots[ __s ].__index = __i;
+		++__slots[ __s ].__generation;
+	}
+	return key_type{ __s, __slots[ __s ].__generation };
+}
+
+LLVM_MSTL_END_NAMESPACE_STD
+
+template <>
+struct std::hash< nya::slot_map_key > {
+	auto operator()( const nya::slot_map_key& __k ) const noexcept -> size_t {
+		return std::hash< uint64_t >()( static_cast< uint64_t >( __k.generation ) << 32 | __k.index );
+	}
+};
+
+#endif//LLVM_MSTL_SLOT_MAP_H
@@ -0,0 +1,531 @@
+#ifndef LLVM_MSTL_SOA_VECTOR_H
+#define LLVM_MSTL_SOA_VECTOR_H
+
+/**
+ * @file soa_vector.hpp
+ * @brief A structure-of-arrays sequence: one contiguous column per field, all in a single allocation.
+ */
+
+#include "__config.h"
+#include "__memory/aligned_allocator.h"
+#include "__memory/uninitialized_algorithms.h"
+#include "__tuple_dir/tuple_indices.h"
+#include "__utility/exception_guard.h"
+#include "stdexcept.h"
+
+#include "spdlog/spdlog.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <span>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+LLVM_MSTL_BEGIN_NAMESPACE_STD
+LLVM_MSTL_CORE_STD
+
+/**
+ * @brief A sequence of records stored column by column.
+ *
+ * A scan over one field of a `vector` of records pulls the whole records through the cache; here each field
+ * lives in its own contiguous column, so `column< I >()` is a plain `core::span` that the compiler can
+ * vectorize. All the columns share one allocation: column `I` starts at a cache line boundary after
+ * column `I - 1`, and the columns grow together.
+ *
+ * The rows are addressed by index. `operator[]` yields a `core::tuple` of references to the fields of a row.
+ * `push_back`, `emplace_back` and reallocation give the strong exception guarantee: a row is built column by
+ * column under an `__exception_guard` that destroys the built fields if a later one throws, and the columns are
+ * moved to new storage only when none of them can throw, copied otherwise. `insert` and `erase` in the middle
+ * give the guarantee of `vector`: strong unless a move throws.
+ *
+ * @code{.cc}
+ * nya::soa_vector< float, float, int > __particles;
+ * __particles.emplace_back( 1.f, 2.f, 7 );
+ * for ( float& __x : __particles.column< 0 >() ) __x *= 2;
+ * @endcode
+ *
+ * @tparam _Ts The field types, one column each.
+ */
+template < typename... _Ts >
+class LLVM_MSTL_TEMPLATE_VIS soa_vector {
+	static_assert( sizeof...( _Ts ) > 0, "soa_vector needs at least one column" );
+
+public:
+	using size_type       = size_t;
+	using difference_type = ptrdiff_t;
+	using value_type      = core::tuple< _Ts... >;
+	using reference       = core::tuple< _Ts&... >;
+	using const_reference = core::tuple< const _Ts&... >;
+
+	static LLVM_MSTL_CONSTEXPR size_type __column_count = sizeof...( _Ts );
+	static LLVM_MSTL_CONSTEXPR size_type __column_align = 64;//<--- a cache line, and the widest vector register
+
+	template < size_t _Ip >
+	using column_type = core::tuple_element_t< _Ip, value_type >;
+
+private:
+	static_assert( ( ( alignof( _Ts ) <= __column_align ) && ... ), "soa_vector: over-aligned column type" );
+
+	using __byte_allocator = __aligned_allocator< core::byte, __column_align >;
+	using __byte_traits    = core::allocator_traits< __byte_allocator >;
+
+	template < size_t _Ip >
+	using __column_allocator = __aligned_allocator< column_type< _Ip >, __column_align >;
+
+	using __indices = typename __make_tuple_indices< sizeof...( _Ts ) >::type;
+
+	//<--- the columns are moved to new storage only if none of them can throw, so that a failure leaves the old storage intact
+	static LLVM_MSTL_CONSTEXPR bool __nothrow_relocate =
+		( ( core::is_nothrow_move_constructible_v< _Ts > || !core::is_copy_constructible_v< _Ts > ) && ... );
+
+public:
+	/*************************************************************************************
+	 *                                                                                   *
+	 *															CONSTRUCTOR BEGIN		                                 *
+	 *                                                                                   *
+	 *************************************************************************************/
+
+	soa_vector() LLVM_MSTL_NOEXCEPT = default;
+
+	//<--- `__n` value-initialized rows
+	explicit soa_vector( size_type __n ) { resize( __n ); }
+
+	soa_vector( const soa_vector& __x ) {
+		if ( __x.__size == 0 ) return;
+		soa_vector __tmp;
+		__tmp.__allocate( __x.__size );
+		[ & ]< size_t... _Is >( __tuple_indices< _Is... > ) {
+			size_type __built = 0;
+			auto      __guard = __make_exception_guard( [ & ]() { __tmp.__destroy_columns( __built, 0, __x.__size ); } );
+			( ( __copy_column< _Is >( __x.template __column< _Is >(), __x.__size, __tmp.template __column< _Is >() ), ++__built ), ... );
+			__guard.__complete();
+		}( __indices() );
+		__tmp.__size = __x.__size;
+		swap( __tmp );
+	}
+
+	soa_vector( soa_vector&& __x ) LLVM_MSTL_NOEXCEPT { swap( __x ); }
+
+	auto operator=( const soa_vector& __x ) -> soa_vector& {
+		if ( this != core::addressof( __x ) ) {
+			soa_vector __tmp( __x );
+			swap( __tmp );
+		}
+		return *this;
+	}
+
+	auto operator=( soa_vector&& __x ) LLVM_MSTL_NOEXCEPT->soa_vector& {
+		soa_vector __tmp( core::move( __x ) );
+		swap( __tmp );
+		return *this;
+	}
+
+	~soa_vector() {
+		clear();
+		__deallocate();
+	}
+
+	/*************************************************************************************
+	 *                                                                                   *
+	 *																CONSTRUCTOR END			                               *
+	 *                                                                                   *
+	 *************************************************************************************/
+
+	/*************************************************************************************
+	 *                                                                                   *
+	 *															 	ELEMENT ACCESS BEGIN			                         *
+	 *                                                                                   *
+	 *************************************************************************************/
+
+	/**
+	* @brief The contiguous column of the field `_Ip`.
+	*/
+	template < size_t _Ip >
+	auto column() LLVM_MSTL_NOEXCEPT->core::span< column_type< _Ip > > {
+		return core::span< column_type< _Ip > >( __column< _Ip >(), __size );
+	}
+
+	template < size_t _Ip >
+	auto column() const LLVM_MSTL_NOEXCEPT->core::span< const column_type< _Ip > > {
+		return core::span< const column_type< _Ip > >( __column< _Ip >(), __size );
+	}
+
+	auto operator[]( size_type __i ) LLVM_MSTL_NOEXCEPT->reference { return __row( *this, __i ); }
+	auto operator[]( size_type __i ) const LLVM_MSTL_NOEXCEPT->const_reference { return __row( *this, __i ); }
+
+	/**
+	* @brief The fields of the row `__i`.
+	* @throws out_of_range If `__i >= size()`.
+	*/
+	auto at( size_type __i ) -> reference {
+		__check_index( __i );
+		return ( *this )[ __i ];
+	}
+
+	auto at( size_type __i ) const -> const_reference {
+		__check_index( __i );
+		return ( *this )[ __i ];
+	}
+
+	auto front() LLVM_MSTL_NOEXCEPT->reference { return ( *this )[ 0 ]; }
+	auto front() const LLVM_MSTL_NOEXCEPT->const_reference { return ( *this )[ 0 ]; }
+	auto back() LLVM_MSTL_NOEXCEPT->reference { return ( *this )[ __size - 1 ]; }
+	auto back() const LLVM_MSTL_NOEXCEPT->const_reference { return ( *this )[ __size - 1 ]; }
+
+	/*************************************************************************************
+	 *                                                                                   *
+	 *															 	ELEMENT ACCESS END			                           *
+	 *                                                                                   *
+	 *************************************************************************************/
+
+	/*************************************************************************************
+	 *                                                                                   *
+	 *															 	CAPACITY BEGIN			               	               *
+	 *                                                                                   *
+	 *************************************************************************************/
+
+	LLVM_MSTL_NODISCARD auto empty() const LLVM_MSTL_NOEXCEPT->bool { return __size == 0; }
+	auto size() const LLVM_MSTL_NOEXCEPT->size_type { return __size; }
+	auto capacity() const LLVM_MSTL_NOEXCEPT->size_type { return __cap; }
+
+	auto max_size() const LLVM_MSTL_NOEXCEPT->size_type {
+		//<--- one row, plus the padding of every column
+		return ( core::numeric_limits< size_type >::max() - __column_count * __column_align ) / ( sizeof( _Ts ) + ... );
+	}
+
+	auto reserve( size_type __n ) -> void {
+		if ( __n > __cap ) {
+			if ( __n > max_size() ) __throw_length_error();
+			__reallocate( __n );
+		}
+	}
+
+	auto shrink_to_fit() -> void {
+		if ( __size == __cap ) return;
+		if ( __size == 0 ) {
+			__deallocate();
+		} else {
+			__reallocate( __size );
+		}
+	}
+
+	/*************************************************************************************
+	 *                                                                                   *
+	 *															 		CAPACITY END			               	               *
+	 *                                                                                   *
+	 *************************************************************************************/
+
+	/*************************************************************************************
+	 *                                                                                   *
+	 *															 	MODIFIERS BEGIN			               	               *
+	 *                                                                                   *
+	 *************************************************************************************/
+
+	auto clear() LLVM_MSTL_NOEXCEPT->void {
+		__destroy_columns( __column_count, 0, __size );
+		__size = 0;
+	}
+
+	auto push_back( const _Ts&... __vs ) -> void { emplace_back( __vs... ); }
+	auto push_back( _Ts&&... __vs ) -> void { emplace_back( core::move( __vs )... ); }
+
+	/**
+	* @brief Appends a row whose field `I` is constructed from the argument `I`.
+	*/
+	template < typename... _Us >
+		requires( sizeof...( _Us ) == sizeof...( _Ts ) )
+	auto emplace_back( _Us&&... __us ) -> reference {
+		return __emplace_back( core::forward_as_tuple( core::forward< _Us >( __us ) )... );
+	}
+
+	/**
+	* @brief Appends a row whose field `I` is constructed from the elements of the tuple `I`.
+	*
+	* @code{.cc}
+	* __v.emplace_back( core::piecewise_construct, core::forward_as_tuple( 3, 'a' ), core::forward_as_tuple() );
+	* @endcode
+	*/
+	template < typename... _Tuples >
+		requires( sizeof...( _Tuples ) == sizeof...( _Ts ) )
+	auto emplace_back( core::piecewise_construct_t, _Tuples&&... __args ) -> reference {
+		return __emplace_back( core::forward< _Tuples >( __args )... );
+	}
+
+	auto pop_back() LLVM_MSTL_NOEXCEPT->void {
+		__destroy_columns( __column_count, __size - 1, __size );
+		--__size;
+	}
+
+	/**
+	* @brief Inserts a row in front of the row `__pos`, field `I` constructed from the argument `I`.
+	*
+	* @return `__pos`.
+	* @throws out_of_range If `__pos > size()`.
+	*/
+	template < typename... _Us >
+		requires( sizeof...( _Us ) == sizeof...( _Ts ) )
+	auto insert( size_type __pos, _Us&&... __us ) -> size_type;
+
+	/**
+	* @brief Erases the rows `[__first, __last)`.
+	*
+	* @return `__first`.
+	* @throws out_of_range If the range is not within `[0, size()]`.
+	*/
+	auto erase( size_type __first, size_type __last ) -> size_type;
+	auto erase( size_type __pos ) -> size_type { return erase( __pos, __pos + 1 ); }
+
+	/**
+	* @brief Resizes to `__n` rows, appending value-initialized ones.
+	*/
+	auto resize( size_type __n ) -> void {
+		if ( __n <= __size ) {
+			__destroy_columns( __column_count, __n, __size );
+			__size = __n;
+			return;
+		}
+		reserve( __n );
+		while ( __size < __n ) {
+			__construct_row( __size, ( (void) sizeof( _Ts ), core::tuple<>() )... );
+			++__size;
+		}
+	}
+
+	auto swap( soa_vector& __x ) LLVM_MSTL_NOEXCEPT->void {
+		core::swap( __data, __x.__data );
+		core::swap( __columns, __x.__columns );
+		core::swap( __size, __x.__size );
+		core::swap( __cap, __x.__cap );
+	}
+
+	friend auto swap( soa_vector& __x, soa_vector& __y ) LLVM_MSTL_NOEXCEPT->void { __x.swap( __y ); }
+
+	/*************************************************************************************
+	 *                                                                                   *
+	 *															 		MODIFIERS END			               	               *
+	 *                                                                                   *
+	 *************************************************************************************/
+
+	friend auto operator==( const soa_vector& __x, const soa_vector& __y ) -> bool {
+		if ( __x.size() != __y.size() ) return false;
+		return [ & ]< size_t... _Is >( __tuple_indices< _Is... > ) {
+			return ( core::equal( __x.template column< _Is >().begin(), __x.template column< _Is >().end(), __y.template column< _Is >().begin() ) && ... );
+		}( __indices() );
+	}
+
+private:
+	template < size_t _Ip >
+	auto __column() const LLVM_MSTL_NOEXCEPT->column_type< _Ip >* {
+		return core::get< _Ip >( __columns );
+	}
+
+	template < typename _Self >
+	static auto __row( _Self& __self, size_type __i ) LLVM_MSTL_NOEXCEPT {
+		return [ & ]< size_t... _Is >( __tuple_indices< _Is... > ) {
+			return core::conditional_t< core::is_const_v< _Self >, const_reference, reference >( __self.template __column< _Is >()[ __i ]... );
+		}( __indices() );
+	}
+
+	auto __check_index( size_type __i ) const -> void {
+		if ( __i >= __size ) {
+			spdlog::error( "soa_vector::at out of range, index[{}] size()[{}]", __i, __size );
+			nya::__throw_out_of_range( "soa_vector" );
+		}
+	}
+
+	LLVM_MSTL_NORETURN auto __throw_length_error() const {
+		nya::__throw_length_error( "soa_vector" );
+	}
+
+	auto __recommend( size_type __new_size ) const -> size_type {
+		const size_type __ms = max_size();
+		if ( __new_size > __ms ) __throw_length_error();
+		if ( __cap >= __ms / 2 ) return __ms;
+		return core::max< size_type >( 2 * __cap, __new_size );
+	}
+
+	//<--- the byte offset of the column `_Ip` in a block of `__cap` rows
+	template < size_t _Ip >
+	static auto __column_offset( size_type __cap ) LLVM_MSTL_NOEXCEPT->size_type {
+		return [ & ]< size_t... _Is >( __tuple_indices< _Is... > ) {
+			size_type __offset = 0;
+			( ( __offset += ( __cap * sizeof( column_type< _Is > ) + __column_align - 1 ) & ~( __column_align - 1 ) ), ... );
+			return __offset;
+		}( typename __make_tuple_indices< _Ip >::type() );
+	}
+
+	static auto __bytes_for( size_type __cap ) LLVM_MSTL_NOEXCEPT->size_type { return __column_offset< sizeof...( _Ts ) >( __cap ); }
+
+	//<--- takes a block of `__n` rows for an empty vector without storage
+	auto __allocate( size_type __n ) -> void {
+		__byte_allocator __a;
+		__data = __byte_traits::allocate( __a, __bytes_for( __n ) );
+		__cap  = __n;
+		[ & ]< size_t... _Is >( __tuple_indices< _Is... > ) {
+			( ( core::get< _Is >( __columns ) = reinterpret_cast< column_type< _Is >* >( __data + __column_offset< _Is >( __n ) ) ), ... );
+		}( __indices() );
+	}
+
+	auto __deallocate() LLVM_MSTL_NOEXCEPT->void {
+		if ( __data == nullptr ) return;
+		__byte_allocator __a;
+		__byte_traits::deallocate( __a, __data, __bytes_for( __cap ) );
+		__data    = nullptr;
+		__columns = {};
+		__cap     = 0;
+	}
+
+	//<--- destroys the rows `[__first, __last)` of the first `__count` columns
+	auto __destroy_columns( size_type __count, size_type __first, size_type __last ) LLVM_MSTL_NOEXCEPT->void {
+		[ & ]< size_t... _Is >( __tuple_indices< _Is... > ) {
+			( ( _Is < __count ? core::destroy( __column< _Is >() + __first, __column< _Is >() + __last ) : void() ), ... );
+		}( __indices() );
+	}
+
+	//<--- constructs the field `_Ip` of the row `__i` from the elements of `__args`
+	template < size_t _Ip, typename _Tuple >
+	auto __construct_field( size_type __i, _Tuple&& __args ) -> void {
+		core::apply(
+			[ & ]( auto&&... __a ) {
+				__column_allocator< _Ip > __alloc;
+				core::allocator_traits< __column_allocator< _Ip > >::construct( __alloc, __column< _Ip >() + __i, core::forward< decltype( __a ) >( __a )... );
+			},
+			core::forward< _Tuple >( __args ) );
+	}
+
+	//<--- constructs the row `__i` column by column, destroys the built fields if one throws
+	template < typename... _Tuples >
+	auto __construct_row( size_type __i, _Tuples&&... __args ) -> void {
+		[ & ]< size_t... _Is >( __tuple_indices< _Is... > ) {
+			size_type __built = 0;
+			auto      __guard = __make_exception_guard( [ & ]() { __destroy_columns( __built, __i, __i + 1 ); } );
+			( ( __construct_field< _Is >( __i, core::forward< _Tuples >( __args ) ), ++__built ), ... );
+			__guard.__complete();
+		}( __indices() );
+	}
+
+	template < size_t _Ip >
+	static auto __copy_column( const column_type< _Ip >* __from, size_type __n, column_type< _Ip >* __to ) -> void {
+		__column_allocator< _Ip > __alloc;
+		__uninitialized_allocator_copy( __alloc, __from, __from + __n, __to );
+	}
+
+	//<--- moves or copies the rows `[__first, __last)` of every column to the row `__to` of `__new`, all or nothing
+	auto __relocate_to( soa_vector& __new, size_type __first, size_type __last, size_type __to ) -> void {
+		[ & ]< size_t... _Is >( __tuple_indices< _Is... > ) {
+			size_type __built = 0;
+			auto      __guard = __make_exception_guard( [ & ]() { __new.__destroy_columns( __built, __to, __to + __last - __first ); } );
+			( ( __relocate_column< _Is >( __column< _Is >() + __first, __last - __first, __new.template __column< _Is >() + __to ), ++__built ), ... );
+			__guard.__complete();
+		}( __indices() );
+	}
+
+	template < size_t _Ip >
+	static auto __relocate_column( column_type< _Ip >* __from, size_type __n, column_type< _Ip >* __to ) -> void {
+		if constexpr ( __nothrow_relocate ) {
+			__column_allocator< _Ip > __alloc;
+			__uninitialized_allocator_copy( __alloc, core::make_move_iterator( __from ), core::make_move_iterator( __from + __n ), __to );
+		} else {
+			__copy_column< _Ip >( __from, __n, __to );
+		}
+	}
+
+	auto __reallocate( size_type __n ) -> void {
+		soa_vector __new;
+		__new.__allocate( __n );
+		__relocate_to( __new, 0, __size, 0 );
+		__new.__size = __size;
+		swap( __new );
+	}
+
+	template < typename... _Tuples >
+	auto __emplace_back( _Tuples&&... __args ) -> reference {
+		if ( __size == __cap ) {
+			//<--- the new row is built first, its arguments may refer to the old storage
+			soa_vector __new;
+			__new.__allocate( __recommend( __size + 1 ) );
+			__new.__construct_row( __size, core::forward< _Tuples >( __args )... );
+			auto __guard = __make_exception_guard( [ & ]() { __new.__destroy_columns( __column_count, __size, __size + 1 ); } );
+			__relocate_to( __new, 0, __size, 0 );
+			__guard.__complete();
+			__new.__size = __size + 1;
+			swap( __new );
+		} else {
+			__construct_row( __size, core::forward< _Tuples >( __args )... );
+			++__size;
+		}
+		return back();
+	}
+
+	core::byte*             __data = nullptr;//<--- the block holding all the columns
+	core::tuple< _Ts*... > __columns{};     //<--- the start of each column in the block
+	size_type               __size = 0;      //<--- the number of rows
+	size_type               __cap  = 0;      //<--- the number of rows the block holds
+};
+
+template < typename... _Ts >
+template < typename... _Us >
+	requires( sizeof...( _Us ) == sizeof...( _Ts ) )
+auto soa_vector< _Ts... >::insert( size_type __pos, _Us&&... __us ) -> size_type {
+	if ( __pos > __size ) {
+		spdlog::error( "soa_vector::insert out of range, pos[{}] size()[{}]", __pos, __size );
+		nya::__throw_out_of_range( "soa_vector" );
+	}
+	if ( __pos == __size ) {
+		emplace_back( core::forward< _Us >( __us )... );
+		return __pos;
+	}
+	if ( __size == __cap ) {
+		soa_vector __new;
+		__new.__allocate( __recommend( __size + 1 ) );
+		__new.__construct_row( __pos, core::forward_as_tuple( core::forward< _Us >( __us ) )... );
+		auto __guard = __make_exception_guard( [ & ]() { __new.__destroy_columns( __column_count, __pos, __pos + 1 ); } );
+		__relocate_to( __new, 0, __pos, 0 );
+		auto __prefix = __make_exception_guard( [ & ]() { __new.__destroy_columns( __column_count, 0, __pos ); } );
+		__relocate_to( __new, __pos, __size, __pos + 1 );
+		__prefix.__complete();
+		__guard.__complete();
+		__new.__size = __size + 1;
+		swap( __new );
+		return __pos;
+	}
+	//<--- the row is built aside first, its arguments may refer to the rows about to shift
+	value_type __tmp( core::forward< _Us >( __us )... );
+	[ & ]< size_t... _Is >( __tuple_indices< _Is... > ) {
+		size_type __built = 0;
+		auto      __guard = __make_exception_guard( [ & ]() { __destroy_columns( __built, __size, __size + 1 ); } );
+		( ( __construct_field< _Is >( __size, core::forward_as_tuple( core::move( __column< _Is >()[ __size - 1 ] ) ) ), ++__built ), ... );
+		__guard.__complete();
+	}( __indices() );
+	++__size;
+	[ & ]< size_t... _Is >( __tuple_indices< _Is... > ) {
+		( ( core::move_backward( __column< _Is >() + __pos, __column< _Is >() + __size - 2, __column< _Is >() + __size - 1 ),
+				__column< _Is >()[ __pos ] = core::move( core::get< _Is >( __tmp ) ) ),
+			... );
+	}( __indices() );
+	return __pos;
+}
+
+template < typename... _Ts >
+auto soa_vector< _Ts... >::erase( size_type __first, size_type __last ) -> size_type {
+	if ( __first > __last || __last > __size ) {
+		spdlog::error( "soa_vector::erase out of range, [{}, {}) size()[{}]", __first, __last, __size );
+		nya::__throw_out_of_range( "soa_vector" );
+	}
+	if ( __first == __last ) return __first;
+	[ & ]< size_t... _Is >( __tuple_indices< _Is... > ) {
+		( core::move( __column< _Is >() + __last, __column< _Is >() + __size, __column< _Is >() + __first ), ... );
+	}( __indices() );
+	const size_type __new_size = __size - ( __last - __first );
+	__destroy_columns( __column_count, __new_size, __size );
+	__size = __new_size;
+	return __first;
+}
+
+LLVM_MSTL_END_NAMESPACE_STD
+
+#endif//LLVM_MSTL_SOA_VECTOR_H
@@ -0,0 +1,228 @@
+#ifndef LLVM_MSTL_SPARSE_SET_H
+#define LLVM_MSTL_SPARSE_SET_H
+
+/**
+ * @file sparse_set.hpp
+ * @brief A set of small integers with O(1) insertion, erasure, lookup and clear, iterated densely.
+ */
+
+#include "__config.h"
+#include "__memory/default_init_allocator.h"
+#include "stdexcept.h"
+#include "vector.hpp"
+
+#include "spdlog/spdlog.h"
+
+#include <algorithm>
+#include <concepts>
+#include <cstddef>
+#include <initializer_list>
+#include <limits>
+#include <memory>
+#include <span>
+#include <type_traits>
+
+LLVM_MSTL_BEGIN_NAMESPACE_STD
+LLVM_MSTL_CORE_STD
+
+/**
+ * @brief A set of unsigned integers below a universe, after Briggs and Torczon.
+ *
+ * @ref https://dl.acm.org/doi/10.1145/176454.176484
+ *
+ * The members are kept densely in one `vector`, in no particular order, and a sparse `vector` indexed by member
+ * holds the position of each member in the dense one. `__k` is a member when `sparse[ __k ]` points into the dense
+ * array at `__k` itself, so a stale sparse slot is harmless:
+ * - `clear` only empties the dense array, O(1) whatever the universe;
+ * - `erase` moves the last member into the hole (swap-and-pop);
+ * - with `_Uninitialized`, growing the universe leaves the new sparse slots indeterminate, through a
+ *   @ref __default_init_allocator, rather than zeroing them.
+ *
+ * Reading an indeterminate value of any type but `unsigned char` or `core::byte` is undefined behaviour (erroneous
+ * behaviour since C++26). `_Uninitialized` relies on the supported compilers loading whatever the slot holds, which
+ * the check against the dense array then rejects; MSan and valgrind report those reads. `_Uninitialized = false`
+ * zeroes the sparse array as it grows and keeps to the standard.
+ *
+ * @code{.cc}
+ * nya::sparse_set< uint32_t > __dirty( __entity_count );
+ * __dirty.insert( __id );
+ * for ( uint32_t __id : __dirty ) flush( __id );
+ * __dirty.clear();
+ * @endcode
+ *
+ * @tparam _Index The unsigned member type.
+ * @tparam _Uninitialized Whether the sparse array grows without being zeroed.
+ * @tparam _Allocator The allocator of the members.
+ */
+template < typename _Index = uint32_t, bool _Uninitialized = true, typename _Allocator = core::allocator< _Index > >
+class LLVM_MSTL_TEMPLATE_VIS sparse_set {
+	static_assert( core::unsigned_integral< _Index >, "sparse_set: the members must be of an unsigned integer type" );
+
+	using __sparse_allocator =
+		core::conditional_t< _Uninitialized, __default_init_allocator< _Index, _Allocator >, _Allocator >;
+
+public:
+	using key_type        = _Index;
+	using value_type      = _Index;
+	using allocator_type  = _Allocator;
+	using size_type       = size_t;
+	using difference_type = ptrdiff_t;
+	using dense_type      = vector< value_type, allocator_type >;
+	using iterator        = typename dense_type::const_iterator;//<--- the members are not writable
+	using const_iterator  = typename dense_type::const_iterator;
+
+	/*************************************************************************************
+	 *                                                                                   *
+	 *															CONSTRUCTOR BEGIN		                                 *
+	 *                                                                                   *
+	 *************************************************************************************/
+
+	sparse_set() = default;
+
+	//<--- room for the members below `__universe`, none of them in yet
+	explicit sparse_set( size_type __universe, const allocator_type& __a = allocator_type() )
+			: __dense( __a ),
+				__sparse( __sparse_allocator( __a ) ) {
+		reserve_universe( __universe );
+	}
+
+	sparse_set( core::initializer_list< value_type > __il ) {
+		for ( value_type __k : __il ) insert( __k );
+	}
+
+	/*************************************************************************************
+	 *                                                                                   *
+	 *																CONSTRUCTOR END			                               *
+	 *                                                                                   *
+	 *************************************************************************************/
+
+	auto begin() const LLVM_MSTL_NOEXCEPT->const_iterator { return __dense.begin(); }
+	auto end() const LLVM_MSTL_NOEXCEPT->const_iterator { return __dense.end(); }
+	auto cbegin() const LLVM_MSTL_NOEXCEPT->const_iterator { return begin(); }
+	auto cend() const LLVM_MSTL_NOEXCEPT->const_iterator { return end(); }
+
+	//<--- the members, in no particular order
+	auto values() const LLVM_MSTL_NOEXCEPT->core::span< const value_type > {
+		return core::span< const value_type >( __dense.data(), __dense.size() );
+	}
+
+	/*************************************************************************************
+	 *                                                                                   *
+	 *																CAPACITY BEGIN			                               *
+	 *                                                                                   *
+	 *************************************************************************************/
+
+	LLVM_MSTL_NODISCARD auto empty() const LLVM_MSTL_NOEXCEPT->bool { return __dense.empty(); }
+	auto size() const LLVM_MSTL_NOEXCEPT->size_type { return __dense.size(); }
+	//<--- the members below it are looked up without growing the sparse array
+	auto universe() const LLVM_MSTL_NOEXCEPT->size_type { return __sparse.size(); }
+
+	auto max_size() const LLVM_MSTL_NOEXCEPT->size_type {
+		return core::min< size_type >( __sparse.max_size(), size_type( core::numeric_limits< value_type >::max() ) + 1 );
+	}
+
+	/**
+	* @brief Grows the universe to at least `__n` members.
+	* @throws length_error If `__n > max_size()`.
+	*/
+	auto reserve_universe( size_type __n ) -> void {
+		if ( __n <= universe() ) return;
+		if ( __n > max_size() ) {
+			spdlog::error( "sparse_set universe exceeds max_size(), __n[{}] max_size()[{}]", __n, max_size() );
+			nya::__throw_length_error( "sparse_set" );
+		}
+		__sparse.resize( __n );
+	}
+
+	//<--- room for `__n` members without reallocating the dense array
+	auto reserve( size_type __n ) -> void { __dense.reserve( __n ); }
+
+	/*************************************************************************************
+	 *                                                                                   *
+	 *																CAPACITY END			                                 *
+	 *                                                                                   *
+	 *************************************************************************************/
+
+	/*************************************************************************************
+	 *                                                                                   *
+	 *															 	LOOKUP BEGIN			                                 *
+	 *                                                                                   *
+	 *************************************************************************************/
+
+	auto contains( key_type __k ) const LLVM_MSTL_NOEXCEPT->bool {
+		if ( __k >= universe() ) return false;
+		const size_type __i = __sparse[ __k ];
+		return __i < __dense.size() && __dense[ __i ] == __k;
+	}
+
+	auto count( key_type __k ) const LLVM_MSTL_NOEXCEPT->size_type { return contains( __k ) ? 1 : 0; }
+
+	auto find( key_type __k ) const LLVM_MSTL_NOEXCEPT->const_iterator {
+		return contains( __k ) ? begin() + static_cast< difference_type >( __sparse[ __k ] ) : end();
+	}
+
+	/*************************************************************************************
+	 *                                                                                   *
+	 *															 	LOOKUP END			                                   *
+	 *                                                                                   *
+	 *************************************************************************************/
+
+	/*************************************************************************************
+	 *                                                                                   *
+	 *															 	MODIFIERS BEGIN			               	               *
+	 *                                                                                   *
+	 *************************************************************************************/
+
+	/**
+	* @brief Adds `__k`, growing the universe past it if need be.
+	* @return Whether `__k` was not a member yet.
+	*/
+	auto insert( key_type __k ) -> bool {
+		if ( __k >= universe() ) reserve_universe( core::min( core::max( 2 * universe(), size_type( __k ) + 1 ), max_size() ) );
+		else if ( contains( __k ) ) return false;
+		__dense.push_back( __k );
+		__sparse[ __k ] = static_cast< value_type >( __dense.size() - 1 );
+		return true;
+	}
+
+	//<--- removes `__k` if it is a member, returns the number of members removed
+	auto erase( key_type __k ) LLVM_MSTL_NOEXCEPT->size_type {
+		if ( !contains( __k ) ) return 0;
+		const value_type __i    = __sparse[ __k ];
+		const value_type __last = __dense.back();
+		__dense[ __i ]          = __last;
+		__sparse[ __last ]      = __i;
+		__dense.pop_back();
+		return 1;
+	}
+
+	//<--- O(1): the sparse array is left as it is, the dense one no longer vouches for it
+	auto clear() LLVM_MSTL_NOEXCEPT->void { __dense.clear(); }
+
+	auto swap( sparse_set& __x ) LLVM_MSTL_NOEXCEPT->void {
+		__dense.swap( __x.__dense );
+		__sparse.swap( __x.__sparse );
+	}
+
+	friend auto swap( sparse_set& __x, sparse_set& __y ) LLVM_MSTL_NOEXCEPT->void { __x.swap( __y ); }
+
+	/*************************************************************************************
+	 *                                                                                   *
+	 *															 		MODIFIERS END			               	               *
+	 *                                                                                   *
+	 *************************************************************************************/
+
+	//<--- the same members, in whatever order
+	friend auto operator==( const sparse_set& __x, const sparse_set& __y ) LLVM_MSTL_NOEXCEPT->bool {
+		if ( __x.size() != __y.size() ) return false;
+		return core::all_of( __x.begin(), __x.end(), [ & ]( value_type __k ) { return __y.contains( __k ); } );
+	}
+
+private:
+	dense_type                               __dense; //<--- the members
+	vector< value_type, __sparse_allocator > __sparse;//<--- the position of each member in `__dense`, anything for the others
+};
+
+LLVM_MSTL_END_NAMESPACE_STD
+
+#endif//LLVM_MSTL_SPARSE_SET_H
@@ -0,0 +1,230 @@
+#ifndef LLVM_MSTL_STATIC_BTREE_H
+#define LLVM_MSTL_STATIC_BTREE_H
+
+/**
+ * @file static_btree.hpp
+ * @brief A static search index over sorted keys as an implicit B-tree of cache line sized nodes (S-tree).
+ */
+
+#include "__config.h"
+#include "__memory/aligned_allocator.h"
+#include "stdexcept.h"
+#include "vector.hpp"
+
+#include "spdlog/spdlog.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <span>
+#include <type_traits>
+
+LLVM_MSTL_BEGIN_NAMESPACE_STD
+LLVM_MSTL_CORE_STD
+
+/**
+ * @brief The sorted keys of a table laid out as an implicit B-tree: nodes of `_Bp` keys and `_Bp + 1` children.
+ *
+ * @ref https://en.algorithmica.org/hpc/data-structures/s-tree/
+ *
+ * Node `__k` has the children `__k * ( _Bp + 1 ) + 1` to `__k * ( _Bp + 1 ) + _Bp + 1`, so there are no child
+ * pointers and a node is `_Bp` adjacent keys on a 64-byte boundary: 16 keys of 4 bytes are one cache line. A
+ * search reads one node per level, `log_{B+1}( n )` lines instead of the `log2( n )` of a binary search, and in each
+ * node counts the keys less than the query with a loop the compiler vectorizes, without a branch.
+ *
+ * As @ref eytzinger_index, the lookups answer ranks in the sorted order the tree was built from, and the batched
+ * `lower_bound` walks a group of searches down in lockstep. The last node is padded with copies of the greatest
+ * key, which come after all the real keys in the in-order walk and so are never a lower bound.
+ *
+ * @code{.cc}
+ * const nya::static_btree< uint32_t > __index( __sorted_keys );
+ * const size_t __rank = __index.lower_bound( __key );
+ * @endcode
+ *
+ * @tparam _Tp The key type.
+ * @tparam _Bp The number of keys of a node.
+ * @tparam _Compare The strict weak ordering the keys are sorted by.
+ */
+template < typename _Tp, size_t _Bp = 64 / sizeof( _Tp ), typename _Compare = core::less< _Tp > >
+class LLVM_MSTL_TEMPLATE_VIS static_btree {
+	static_assert( _Bp >= 2, "static_btree: a node needs at least two keys" );
+
+public:
+	using value_type    = _Tp;
+	using value_compare = _Compare;
+	using size_type     = size_t;
+	using rank_type     = uint32_t;
+
+	static LLVM_MSTL_CONSTEXPR size_type node_size = _Bp;
+	//<--- the number of searches a batched lookup runs in lockstep
+	static LLVM_MSTL_CONSTEXPR size_type batch = 16;
+
+private:
+	using __keys_type  = vector< value_type, __aligned_allocator< value_type, 64 > >;
+	using __ranks_type = vector< rank_type, core::allocator< rank_type > >;
+
+public:
+	/*************************************************************************************
+	 *                                                                                   *
+	 *															CONSTRUCTOR BEGIN		                                 *
+	 *                                                                                   *
+	 *************************************************************************************/
+
+	static_btree() = default;
+
+	/**
+	* @brief Lays out the keys from `__first` to `__last`, sorted by `__comp`.
+	* @throws length_error If there are more keys than `rank_type` ranks.
+	*/
+	template < typename _RandomAccessIterator >
+		requires core::random_access_iterator< _RandomAccessIterator >
+	static_btree( _RandomAccessIterator __first, _RandomAccessIterator __last, const value_compare& __comp = value_compare() )
+			: __compare( __comp ) {
+		__build( __first, static_cast< size_type >( __last - __first ) );
+	}
+
+	template < typename _Allocator >
+	explicit static_btree( const vector< value_type, _Allocator >& __sorted, const value_compare& __comp = value_compare() )
+			: static_btree( __sorted.begin(), __sorted.end(), __comp ) {}
+
+	/*************************************************************************************
+	 *                                                                                   *
+	 *																CONSTRUCTOR END			                               *
+	 *                                                                                   *
+	 *************************************************************************************/
+
+	LLVM_MSTL_NODISCARD auto empty() const LLVM_MSTL_NOEXCEPT->bool { return __n == 0; }
+	auto size() const LLVM_MSTL_NOEXCEPT->size_type { return __n; }
+	auto node_count() const LLVM_MSTL_NOEXCEPT->size_type { return __nodes; }
+
+	/**
+	* @brief The rank of the first key not less than `__x`, `size()` if there is none.
+	*/
+	auto lower_bound( const value_type& __x ) const -> size_type { return __rank_of( __lower_slot( __x ) ); }
+
+	auto contains( const value_type& __x ) const -> bool {
+		const size_type __s = __lower_slot( __x );
+		return __s != __no_slot && !__compare( __x, __keys[ __s ] );
+	}
+
+	/**
+	* @brief The `lower_bound` of every query to `__out`, `batch` searches at a time.
+	* @pre `__out.size() >= __queries.size()`.
+	*/
+	auto lower_bound( core::span< const value_type > __queries, core::span< size_type > __out ) const -> void;
+
+private:
+	static LLVM_MSTL_CONSTEXPR size_type __no_slot = core::numeric_limits< size_type >::max();
+
+	static LLVM_MSTL_CONSTEXPR auto __child( size_type __k, size_type __i ) LLVM_MSTL_NOEXCEPT->size_type { return __k * ( _Bp + 1 ) + __i + 1; }
+
+	//<--- the number of keys of the node `__k` less than `__x`, counted without a branch
+	auto __rank_in_node( size_type __k, const value_type& __x ) const -> size_type {
+		const value_type* __node = __keys.data() + __k * _Bp;
+		size_type         __i    = 0;
+		for ( size_type __j = 0; __j != _Bp; ++__j ) __i += static_cast< size_type >( static_cast< bool >( __compare( __node[ __j ], __x ) ) );
+		return __i;
+	}
+
+	//<--- a hint for the first child of the node `__k`, which may be past the end of the tree
+	auto __prefetch_children( size_type __k ) const LLVM_MSTL_NOEXCEPT->void {
+		LLVM_MSTL_PREFETCH( reinterpret_cast< const void* >(
+			reinterpret_cast< uintptr_t >( __keys.data() ) + __child( __k, _Bp / 2 ) * _Bp * sizeof( value_type ) ) );
+	}
+
+	//<--- one level down: the node `__k` narrows the lower bound to its slot `__i` if it has a key not less than `__x`
+	auto __step( size_type& __k, size_type& __slot, const value_type& __x ) const -> void {
+		const size_type __i = __rank_in_node( __k, __x );
+		__slot              = __i < _Bp ? __k * _Bp + __i : __slot;
+		__k                 = __child( __k, __i );
+	}
+
+	//<--- the slot of the lower bound of `__x`, `__no_slot` if there is none
+	auto __lower_slot( const value_type& __x ) const -> size_type {
+		size_type __slot = __no_slot;
+		for ( size_type __k = 0; __k < __nodes; ) {
+			__prefetch_children( __k );
+			__step( __k, __slot, __x );
+		}
+		return __slot;
+	}
+
+	auto __rank_of( size_type __slot ) const LLVM_MSTL_NOEXCEPT->size_type { return __slot == __no_slot ? __n : __ranks[ __slot ]; }
+
+	template < typename _RandomAccessIterator >
+	auto __build( _RandomAccessIterator __first, size_type __n_keys ) -> void;
+
+	template < typename _RandomAccessIterator >
+	auto __fill( _RandomAccessIterator __first, size_type& __r, size_type __k ) -> void;
+
+	__keys_type   __keys;      //<--- the nodes, `_Bp` keys each
+	__ranks_type  __ranks;     //<--- the sorted rank of each key slot, `size()` for the padding
+	size_type     __n     = 0; //<--- the number of keys
+	size_type     __nodes = 0; //<--- the number of nodes
+	value_compare __compare{}; //<--- the ordering of the keys
+};
+
+template < typename _Tp, size_t _Bp, typename _Compare >
+auto static_btree< _Tp, _Bp, _Compare >::lower_bound( core::span< const value_type > __queries, core::span< size_type > __out ) const
+	-> void {
+	const size_type __m = __queries.size();
+	size_type       __i = 0;
+	for ( ; __i + batch <= __m; __i += batch ) {
+		size_type __k[ batch ], __slot[ batch ];
+		for ( size_type __j = 0; __j != batch; ++__j ) {
+			__k[ __j ]    = 0;
+			__slot[ __j ] = __no_slot;
+		}
+		//<--- the walks end at different depths on a partial last level, the finished ones idle
+		for ( bool __more = __nodes != 0; __more; ) {
+			__more = false;
+			for ( size_type __j = 0; __j != batch; ++__j ) {
+				if ( __k[ __j ] >= __nodes ) continue;
+				__prefetch_children( __k[ __j ] );
+				__step( __k[ __j ], __slot[ __j ], __queries[ __i + __j ] );
+				__more = __more || __k[ __j ] < __nodes;
+			}
+		}
+		for ( size_type __j = 0; __j != batch; ++__j ) __out[ __i + __j ] = __rank_of( __slot[ __j ] );
+	}
+	for ( ; __i != __m; ++__i ) __out[ __i ] = lower_bound( __queries[ __i ] );
+}
+
+template < typename _Tp, size_t _Bp, typename _Compare >
+template < typename _RandomAccessIterator >
+auto static_btree< _Tp, _Bp, _Compare >::__build( _RandomAccessIterator __first, size_type __n_keys ) -> void {
+	if ( __n_keys >= core::numeric_limits< rank_type >::max() ) {
+		spdlog::error( "static_btree has more keys than ranks, __n[{}] max[{}]", __n_keys, core::numeric_limits< rank_type >::max() - 1 );
+		nya::__throw_length_error( "static_btree" );
+	}
+	if ( __n_keys == 0 ) return;
+	__n     = __n_keys;
+	__nodes = ( __n + _Bp - 1 ) / _Bp;
+	__keys.resize( __nodes * _Bp, __first[ static_cast< typename core::iterator_traits< _RandomAccessIterator >::difference_type >( __n - 1 ) ] );
+	__ranks.resize( __nodes * _Bp, static_cast< rank_type >( __n ) );
+	size_type __r = 0;
+	__fill( __first, __r, 0 );
+}
+
+//<--- an in-order walk of the implicit tree hands out the keys in sorted order, the padding after them
+template < typename _Tp, size_t _Bp, typename _Compare >
+template < typename _RandomAccessIterator >
+auto static_btree< _Tp, _Bp, _Compare >::__fill( _RandomAccessIterator __first, size_type& __r, size_type __k ) -> void {
+	if ( __k >= __nodes ) return;
+	for ( size_type __i = 0; __i != _Bp; ++__i ) {
+		__fill( __first, __r, __child( __k, __i ) );
+		if ( __r < __n ) {
+			__keys[ __k * _Bp + __i ]  = __first[ static_cast< typename core::iterator_traits< _RandomAccessIterator >::difference_type >( __r ) ];
+			__ranks[ __k * _Bp + __i ] = static_cast< rank_type >( __r );
+			++__r;
+		}
+	}
+	__fill( __first, __r, __child( __k, _Bp ) );
+}
+
+LLVM_MSTL_END_NAMESPACE_STD
+
+#endif//LLVM_MSTL_STATIC_BTREE_H
@@ -8,6 +8,7 @@
 #include "__config.h"
 
 #include <cstdlib>
+#include <new>
 #include <stdexcept>
 
 LLVM_MSTL_BEGIN_NAMESPACE_STD
@@ -24,6 +25,11 @@ LLVM_MSTL_NORETURN LLVM_MSTL_INLINE void __throw_out_of_range( const char* __msg
 	core::abort();
 }
 
+LLVM_MSTL_NORETURN LLVM_MSTL_INLINE void __throw_bad_alloc() {
+	throw core::bad_alloc();
+	core::abort();
+}
+
 LLVM_MSTL_END_NAMESPACE_STD
 
 #endif//LLVM_MSTL_STDEXCEPT_H
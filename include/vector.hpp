@@ -12,14 +12,23 @@
  * 
  */
 
+#include "__algorithm/remove_if.h"
+#include "__algorithm/simd_compact.h"
+#include "__algorithm/simd_search.h"
 #include "__config.h"
 #include "__iterator/iterator_traits.h"
 #include "__iterator/wrap_iter.h"
 #include "__memory/allocate_at_least.h"
+#include "__memory/calloc_allocator.h"
 #include "__memory/compress_pair.h"
+#include "__memory/swap_allocator.h"
+#include "__memory/temp_value.h"
 #include "__memory/uninitialized_algorithms.h"
+#include "__ranges/container_compatible_range.h"
+#include "__ranges/from_range.h"
 #include "__split_buffer.h"
 #include "__type_traits/is_allocator.h"
+#include "__type_traits/is_trivially_relocatable.h"
 #include "__type_traits/noexcept_move_assign_container.h"
 #include "__utility/exception_guard.h"
 // #include "__utility/logger.h"
@@ -29,10 +38,12 @@
 
 
 #include <algorithm>
+#include <cstring>
 #include <initializer_list>
 #include <iterator>
 #include <limits>
 #include <memory>
+#include <ranges>
 #include <stdio.h>
 #include <type_traits>
 
@@ -519,6 +530,28 @@ public:
 	*/
 	LLVM_MSTL_CONSTEXPR_SINCE_CXX20 vector( core::initializer_list< value_type > __il, const allocator_type& __a );
 
+	/**
+	* @brief Constructs a vector from a range.
+	*
+	* @ref (11) Constructs the container with the contents of the range rg. (C++23)
+	*			 https://en.cppreference.com/w/cpp/container/vector/vector
+	*
+	* When the size of the range is known up front (`sized_range` or `forward_range`), exactly one allocation of
+	* the right size is made. This also covers C++20 views such as `views::transform` over a sized range, whose
+	* iterators only advertise `input_iterator_tag` and would otherwise be taken for single pass iterators.
+	* Contiguous ranges of trivially copyable `value_type` are copied in bulk.
+	*
+	* @code{cc}
+	* nya::vector< int, core::allocator< int > > __v( nya::from_range, __w | core::views::transform( __f ) );
+	* @endcode
+	*
+	* @tparam _Range A range whose reference type is convertible to `value_type`.
+	* @param __range The range to copy the elements from.
+	* @param __a The allocator to be used for the new vector.
+	*/
+	template < _ContainerCompatibleRange< _Tp > _Range >
+	LLVM_MSTL_CONSTEXPR_SINCE_CXX20 vector( from_range_t, _Range&& __range, const allocator_type& __a = allocator_type() );
+
 	/**
 	* @brief Move constructor for vector.
 	*
@@ -717,6 +750,8 @@ public:
 	LLVM_MSTL_CONSTEXPR_SINCE_CXX20 auto data() LLVM_MSTL_NOEXCEPT->value_type*;
 	LLVM_MSTL_CONSTEXPR_SINCE_CXX20 auto data() const LLVM_MSTL_NOEXCEPT->const value_type*;
 
+	LLVM_MSTL_CONSTEXPR_SINCE_CXX20 auto get_allocator() const LLVM_MSTL_NOEXCEPT->allocator_type { return __alloc(); }
+
 	/*************************************************************************************		
 	 *                                                                                   *
 	 *															 ELEMENT ACCESS END		               	               *
@@ -865,12 +900,110 @@ public:
 	LLVM_MSTL_CONSTEXPR_SINCE_CXX20 auto insert( const_iterator __position, _ForwardIterator __fist, _ForwardIterator __last ) -> iterator;
 	LLVM_MSTL_CONSTEXPR_SINCE_CXX20 auto insert( const_iterator __position, core::initializer_list< value_type > __il ) -> iterator;
 
+	/**
+	* @brief Inserts a batch of values at several positions of the vector in a single pass.
+	*
+	* The range [__first, __last) holds pair-like `(position, value)` entries sorted by position in non-decreasing order.
+	* Every position is an index into the vector *before* the call: a value with position `p` ends up in front of the
+	* element that was at index `p` (`p == size()` appends). Values sharing the same position keep their relative order.
+	*
+	* Calling `insert` once per value moves the tail of the vector for every call, which is O(n * k). This function instead
+	* grows the storage at most once via `__recommend( size() + k )` and merges the old elements and the new values from
+	* back to front, so every existing element is moved at most once: O(n + k).
+	*
+	* @code{cc}
+	* nya::vector< int, core::allocator< int > > __v{ 10, 20, 30 };
+	* core::pair< size_t, int > __ins[] = { { 0, 5 }, { 2, 25 }, { 3, 35 } };
+	* __v.insert_sorted_positions( core::begin( __ins ), core::end( __ins ) );// 5 10 20 25 30 35
+	* @endcode
+	*
+	* @tparam _BidirectionalIterator An iterator over pair-like entries with `first` convertible to `size_type`
+	*                                and `second` usable to construct a `value_type`.
+	* @param __first The beginning of the sorted `(position, value)` range.
+	* @param __last The end of the sorted `(position, value)` range.
+	* @throws out_of_range If a position is greater than `size()` or the positions are not sorted.
+	*/
+	template <
+		typename _BidirectionalIterator,
+		core::enable_if_t<
+			__is_cpp17_bidirectional_iterator< _BidirectionalIterator >::value,
+			int > = 0 >
+	LLVM_MSTL_CONSTEXPR_SINCE_CXX20 auto insert_sorted_positions( _BidirectionalIterator __first, _BidirectionalIterator __last );
+
+	/**
+	* @brief Constructs an element in place in front of `__position`.
+	*
+	* @ref https://en.cppreference.com/w/cpp/container/vector/emplace
+	*
+	* When there is spare capacity, the tail is shifted by one and the element is constructed directly in the hole,
+	* so no temporary is built and moved. This requires the construction to be `noexcept` (the hole must never stay
+	* empty) and the arguments to not refer into the vector (they would be shifted under our feet), see
+	* `__can_construct_in_hole`. Otherwise the element is built in a temporary first and move-assigned into the hole.
+	*
+	* @tparam _Args The types of the arguments to construct the element from.
+	* @param __position The position to construct in front of.
+	* @param __args The arguments forwarded to the constructor of the element.
+	* @return An iterator to the new element.
+	*/
 	template < typename... _Args >
-	LLVM_MSTL_CONSTEXPR_SINCE_CXX20 auto emplace( const_iterator __position, _Args&&... __args );
+	LLVM_MSTL_CONSTEXPR_SINCE_CXX20 auto emplace( const_iterator __position, _Args&&... __args ) -> iterator;
 
 	LLVM_MSTL_CONSTEXPR_SINCE_CXX20 auto erase( const_iterator __position ) -> iterator;
 	LLVM_MSTL_CONSTEXPR_SINCE_CXX20 auto erase( const_iterator __fist, const_iterator __last ) -> iterator;
 
+	/**
+	* @brief Erases the elements at a set of indices in a single compaction pass.
+	*
+	* The range [__first, __last) holds indices into the vector sorted in non-decreasing order, duplicates are ignored.
+	* The surviving elements between two erased indices are moved down as one run (a `memmove` for trivially copyable types),
+	* so every surviving element is moved at most once, and the erased tail is destroyed by one `__base_destruct_at_end` sweep.
+	* For arithmetic types the indices clear a mask of the kept elements instead, and the dispatched kernels of
+	* @ref __simd_compact_blocks move them.
+	*
+	* @code{cc}
+	* nya::vector< int, core::allocator< int > > __v{ 0, 1, 2, 3, 4, 5 };
+	* size_t __idx[] = { 1, 3, 4 };
+	* __v.erase_indices( core::begin( __idx ), core::end( __idx ) );// 0 2 5
+	* @endcode
+	*
+	* @tparam _ForwardIterator An iterator over values convertible to `size_type`.
+	* @param __first The beginning of the sorted index range.
+	* @param __last The end of the sorted index range.
+	* @return The number of erased elements.
+	* @throws out_of_range If an index is not less than `size()` or the indices are not sorted, the vector is left unchanged.
+	*/
+	template <
+		typename _ForwardIterator,
+		core::enable_if_t<
+			__is_cpp17_forward_iterator< _ForwardIterator >::value,
+			int > = 0 >
+	LLVM_MSTL_CONSTEXPR_SINCE_CXX20 auto erase_indices( _ForwardIterator __first, _ForwardIterator __last ) -> size_type;
+
+	/**
+	* @brief Erases the element at `__position` without preserving the order of the remaining elements.
+	*
+	* The hole is filled with the last element, so no tail is shifted: O(1) instead of O(size() - position).
+	* For a trivially relocatable type the erased element is destroyed and the bytes of the last one copied over it,
+	* with no move assignment and no destruction of the source.
+	*
+	* @param __position The element to erase.
+	* @return An iterator to the element now occupying `__position`, or `end()` if the last element was erased.
+	*/
+	LLVM_MSTL_CONSTEXPR_SINCE_CXX20 auto erase_unordered( const_iterator __position ) -> iterator;
+
+	/**
+	* @brief Erases the range [__first, __last) without preserving the order of the remaining elements.
+	*
+	* The hole is filled with at most `__last - __first` elements taken from the end of the vector,
+	* then the now unused tail is destroyed by one `__base_destruct_at_end` sweep.
+	* The cost is O(__last - __first) regardless of where the range is.
+	*
+	* @param __first The beginning of the range to erase.
+	* @param __last The end of the range to erase.
+	* @return An iterator to the element now occupying `__first`, or `end()` if nothing follows it.
+	*/
+	LLVM_MSTL_CONSTEXPR_SINCE_CXX20 auto erase_unordered( const_iterator __first, const_iterator __last ) -> iterator;
+
 	LLVM_MSTL_CONSTEXPR_SINCE_CXX20 auto push_back( const_reference __x );
 	LLVM_MSTL_CONSTEXPR_SINCE_CXX20 auto push_back( value_type&& __x );
 
@@ -904,6 +1037,48 @@ public:
 			int > = 0 >
 	LLVM_MSTL_CONSTEXPR_SINCE_CXX20 auto assign( _ForwardIterator __first, _ForwardIterator __last );
 
+	/**
+	* @brief Appends the elements of a range to the end of the vector. (C++23)
+	*
+	* @ref https://en.cppreference.com/w/cpp/container/vector/append_range
+	*
+	* If the size of the range is known, the storage grows at most once, to `__recommend( size() + n )`.
+	*
+	* @tparam _Range A range whose reference type is convertible to `value_type`.
+	* @param __range The range to append.
+	*/
+	template < _ContainerCompatibleRange< _Tp > _Range >
+	LLVM_MSTL_CONSTEXPR_SINCE_CXX20 auto append_range( _Range&& __range );
+
+	/**
+	* @brief Inserts the elements of a range in front of `__position`. (C++23)
+	*
+	* @ref https://en.cppreference.com/w/cpp/container/vector/insert_range
+	*
+	* If the size of the range is known, the storage grows at most once, to `__recommend( size() + n )`.
+	*
+	* @tparam _Range A range whose reference type is convertible to `value_type`.
+	* @param __position The position to insert in front of.
+	* @param __range The range to insert.
+	* @return An iterator to the first inserted element, or `__position` if the range is empty.
+	*/
+	template < _ContainerCompatibleRange< _Tp > _Range >
+	LLVM_MSTL_CONSTEXPR_SINCE_CXX20 auto insert_range( const_iterator __position, _Range&& __range ) -> iterator;
+
+	/**
+	* @brief Replaces the contents of the vector with the elements of a range. (C++23)
+	*
+	* @ref https://en.cppreference.com/w/cpp/container/vector/assign_range
+	*
+	* The existing elements are assigned over. If the size of the range is known and exceeds the capacity,
+	* the old storage is released and exactly one new allocation of `__recommend( n )` elements is made.
+	*
+	* @tparam _Range A range whose reference type is convertible to `value_type`.
+	* @param __range The range to assign from.
+	*/
+	template < _ContainerCompatibleRange< _Tp > _Range >
+	LLVM_MSTL_CONSTEXPR_SINCE_CXX20 auto assign_range( _Range&& __range );
+
 	LLVM_MSTL_CONSTEXPR_SINCE_CXX20 auto swap( vector& ) LLVM_MSTL_NOEXCEPT;
 
 	/*************************************************************************************		
@@ -932,6 +1107,21 @@ private:
 	*/
 	LLVM_MSTL_CONSTEXPR_SINCE_CXX20 auto __vallocate( size_type __n ) -> void;
 
+	/**
+	* @brief `__vallocate( __n )` then `__construct_at_end( __n )`, on a vector without storage.
+	*
+	* When the allocator has `allocate_zeroed` and value-initialization is the zero bytes, the storage comes zeroed
+	* and nothing is written: with `calloc` or a fresh `mmap` the pages are only committed when the elements are.
+	*
+	* @param __n The number of value-initialized elements.
+	*/
+	LLVM_MSTL_CONSTEXPR_SINCE_CXX20 auto __vallocate_value_init( size_type __n ) -> void;
+
+	//<--- whether `__vallocate_value_init` takes zeroed storage from the allocator, writing nothing
+	static LLVM_MSTL_CONSTEXPR bool __zeroed_value_init =
+		core::is_pointer_v< pointer > && __has_allocate_zeroed< allocator_type >::value &&
+		__is_zero_initializable< value_type >::value && __allocator_has_trivial_value_construct< allocator_type, value_type >::value;
+
 	LLVM_MSTL_CONSTEXPR_SINCE_CXX20 auto __vdeallocate() LLVM_MSTL_NOEXCEPT;
 
 	/**
@@ -1033,6 +1223,75 @@ private:
 			int > = 0 >
 	LLVM_MSTL_CONSTEXPR_SINCE_CXX20 auto __construct_at_end( _ForwardIterator __first, _ForwardIterator __last, size_type __n );
 
+	/**
+	* @brief `true` if the elements of `_Range` can be copied into the vector with a single `memmove`.
+	*
+	* A contiguous range of (cv-qualified) `value_type` can hand out raw pointers with `ranges::data`,
+	* which selects the trivially copyable overload of `__uninitialized_allocator_copy`.
+	*/
+	template < typename _Range >
+	static LLVM_MSTL_CONSTEXPR bool __is_bulk_copyable_range =
+		core::ranges::contiguous_range< _Range > &&
+		core::is_same_v< core::remove_cvref_t< core::ranges::range_reference_t< _Range > >, value_type > &&
+		core::is_trivially_copyable_v< value_type > &&
+		core::is_same_v< pointer, value_type* >;
+
+	/**
+	* @brief `true` if an element can be moved to another slot by copying its bytes, the source being dropped.
+	*
+	* As `__split_buffer::__relocate_by_memmove`: see @ref __is_trivially_relocatable.
+	*/
+	static LLVM_MSTL_CONSTEXPR bool __relocate_by_memmove =
+		__is_trivially_relocatable< value_type >::value && core::is_pointer_v< pointer > &&
+		__allocator_has_trivial_copy_construct< allocator_type, value_type >::value;
+
+	/**
+	* @brief Returns the number of elements of a range whose size is known up front.
+	*
+	* Uses `ranges::size` for sized ranges (O(1), even for single pass ranges) and `ranges::distance` otherwise.
+	*/
+	template < typename _Range >
+	static LLVM_MSTL_CONSTEXPR_SINCE_CXX20 auto __range_size( _Range& __range ) -> size_type {
+		if constexpr ( core::ranges::sized_range< _Range > ) {
+			return static_cast< size_type >( core::ranges::size( __range ) );
+		} else {
+			return static_cast< size_type >( core::ranges::distance( __range ) );
+		}
+	}
+
+	/**
+	* @brief Calls `__f( __first, __last, __n )` with the iterators of a range whose size is known up front.
+	*
+	* Ranges eligible for the bulk copy are passed as raw `const value_type*` pointers.
+	*/
+	template < typename _Range, typename _Func >
+	static LLVM_MSTL_CONSTEXPR_SINCE_CXX20 decltype( auto ) __with_sized_range( _Range& __range, _Func&& __f ) {
+		const size_type __n = __range_size( __range );
+		if constexpr ( __is_bulk_copyable_range< _Range > ) {
+			const value_type* __p = core::ranges::data( __range );
+			return __f( __p, __p + __n, __n );
+		} else {
+			return __f( core::ranges::begin( __range ), core::ranges::end( __range ), __n );
+		}
+	}
+
+	/**
+	* @brief Constructs `__n` elements copied from [__first, __last) at the end of the vector, the capacity must suffice.
+	*
+	* Unlike `__construct_at_end( __first, __last, __n )` this accepts any C++20 iterator/sentinel pair.
+	*/
+	template < typename _Iterator, typename _Sentinel >
+	LLVM_MSTL_CONSTEXPR_SINCE_CXX20 auto __construct_at_end_with_size( _Iterator __first, _Sentinel __last, size_type __n );
+
+	template < typename _Iterator, typename _Sentinel >
+	LLVM_MSTL_CONSTEXPR_SINCE_CXX20 auto __append_with_size( _Iterator __first, _Sentinel __last, size_type __n );
+
+	template < typename _Iterator, typename _Sentinel >
+	LLVM_MSTL_CONSTEXPR_SINCE_CXX20 auto __insert_with_size( const_iterator __position, _Iterator __first, _Sentinel __last, size_type __n ) -> iterator;
+
+	template < typename _Iterator, typename _Sentinel >
+	LLVM_MSTL_CONSTEXPR_SINCE_CXX20 auto __assign_with_size( _Iterator __first, _Sentinel __last, size_type __n );
+
 	template < typename... _Args >
 	LLVM_MSTL_TEMPLATE_INLINE LLVM_MSTL_CONSTEXPR_SINCE_CXX20 auto __emplace_back_slow_path( _Args&&... __args );
 
@@ -1104,6 +1363,39 @@ private:
 		++__tx.__pos;
 	}
 
+	/**
+	* @brief `true` if an argument of this type can only reach into the vector through its own address.
+	*
+	* Scalars and `value_type` itself carry no handle (pointer, iterator, view) into the storage of other objects,
+	* so checking `core::addressof( __arg )` against the live elements is enough to rule out aliasing.
+	*/
+	template < typename _Arg >
+	static LLVM_MSTL_CONSTEXPR bool __is_self_contained_arg =
+		core::is_arithmetic_v< core::remove_cvref_t< _Arg > > ||
+		core::is_enum_v< core::remove_cvref_t< _Arg > > ||
+		core::is_same_v< core::remove_cvref_t< _Arg >, value_type >;
+
+	/**
+	* @brief Whether `emplace` may construct the new element directly in the hole left by `__move_range`.
+	*
+	* @tparam _Args The argument types of `emplace` as deduced there, they must be passed explicitly.
+	* @param __args The arguments of `emplace`, none of them may live inside [__begin, __end).
+	* @return `true` if the construction can not throw and no argument aliases an element.
+	*/
+	template < class... _Args >
+	LLVM_MSTL_CONSTEXPR_SINCE_CXX20 auto __can_construct_in_hole( const _Args&... __args ) const LLVM_MSTL_NOEXCEPT->bool {
+		if constexpr ( core::is_nothrow_constructible_v< value_type, _Args... > && ( __is_self_contained_arg< _Args > && ... ) ) {
+			//<--- unrelated pointers can not be ordered during constant evaluation
+			if ( core::is_constant_evaluated() ) return false;
+			const void*               __lo = core::to_address( this->__begin );
+			const void*               __hi = core::to_address( this->__end );
+			core::less< const void* > __less;
+			return ( ( __less( core::addressof( __args ), __lo ) || !__less( core::addressof( __args ), __hi ) ) && ... );
+		} else {
+			return false;
+		}
+	}
+
 	/**
 	 * @brief get the allocator object for vector
 	 * 
@@ -1164,6 +1456,13 @@ private:
 	}
 
 	LLVM_MSTL_CONSTEXPR_SINCE_CXX20 auto __move_range( pointer __from_s, pointer __from_e, pointer __to );
+
+	/**
+	* @brief Appends `__n` value-initialized (or `__x` copy) elements, growing to `__recommend( size() + __n )` if needed.
+	*/
+	LLVM_MSTL_CONSTEXPR_SINCE_CXX20 auto __append( size_type __n );
+	LLVM_MSTL_CONSTEXPR_SINCE_CXX20 auto __append( size_type __n, const_reference __x );
+
 	LLVM_MSTL_CONSTEXPR_SINCE_CXX20 auto __move_assign( vector& __c, core::true_type )
 		LLVM_MSTL_NOEXCEPT_V( core::is_nothrow_move_assignable_v< allocator_type > ) -> void;
 	LLVM_MSTL_CONSTEXPR_SINCE_CXX20 auto __move_assign( vector& __c, core::false_type )
@@ -1191,6 +1490,8 @@ private:
 		__alloc() = __c.__alloc();
 	}
 
+	LLVM_MSTL_CONSTEXPR_SINCE_CXX20 auto __copy_assign_alloc( const vector&, core::false_type ) {}
+
 	LLVM_MSTL_NORETURN auto __throw_length_error() const {
 		nya::__throw_length_error( "vector" );
 	}
@@ -1225,10 +1526,9 @@ LLVM_MSTL_CONSTEXPR_SINCE_CXX20 vector< _Tp, _Allocator >::vector( size_type __n
 	// if `exception happend`, cause a non-normal exit, it will automatic drop by calling `__destroy_vector`
 	auto __guard = __make_exception_guard( __destroy_vector( *this ) );
 	if ( __n > 0 ) {
-		__vallocate( __n );       //<--- allocate a memmory and set `__begin`、`__end` and `__end_capm`.
-															//<--- it just allocate the memory, doesn't update the `__end`
-		__construct_at_end( __n );//!<--- `__vallocate` dosen't make `__end` point the last position
-															//!<--- `__construct_at_end` really make `__end` point the right position(the last ather the last one)
+		//<--- allocate a memmory and set `__begin`、`__end` and `__end_capm`, then
+		//!<--- really make `__end` point the right position(the last ather the last one)
+		__vallocate_value_init( __n );
 	}
 	__guard.__complete();
 }
@@ -1238,8 +1538,7 @@ LLVM_MSTL_CONSTEXPR_SINCE_CXX20 vector< _Tp, _Allocator >::vector( size_type __n
 		: __end_capm( nullptr, __a ) {
 	auto __guard = __make_exception_guard( __destroy_vector( *this ) );
 	if ( __n > 0 ) {
-		__vallocate( __n );
-		__construct_at_end( __n );
+		__vallocate_value_init( __n );
 	}
 	__guard.__complete();
 }
@@ -1376,6 +1675,28 @@ LLVM_MSTL_CONSTEXPR_SINCE_CXX20 vector< _Tp, _Allocator >::vector(
 	__guard.__complete();
 }
 
+template < typename _Tp, typename _Allocator >
+template < _ContainerCompatibleRange< _Tp > _Range >
+LLVM_MSTL_CONSTEXPR_SINCE_CXX20 vector< _Tp, _Allocator >::vector(
+	from_range_t, _Range&& __range, const allocator_type& __a )
+		: __end_capm( nullptr, __a ) {
+	auto __guard = __make_exception_guard( __destroy_vector( *this ) );
+	if constexpr ( core::ranges::sized_range< _Range > || core::ranges::forward_range< _Range > ) {
+		__with_sized_range( __range, [ this ]( auto __first, auto __last, size_type __n ) {
+			if ( __n > 0 ) {
+				__vallocate( __n );
+				__construct_at_end_with_size( core::move( __first ), core::move( __last ), __n );
+			}
+		} );
+	} else {
+		//<--- single pass and unsized, the length is unknown so grow as we go
+		for ( auto&& __x : __range ) {
+			emplace_back( core::forward< decltype( __x ) >( __x ) );
+		}
+	}
+	__guard.__complete();
+}
+
 template < typename _Tp, typename _Allocator >
 LLVM_MSTL_CONSTEXPR_SINCE_CXX20 LLVM_MSTL_TEMPLATE_INLINE
 vector< _Tp, _Allocator >::vector( vector&& __x ) LLVM_MSTL_NOEXCEPT
@@ -1482,8 +1803,8 @@ LLVM_MSTL_CONSTEXPR_SINCE_CXX20 LLVM_MSTL_TEMPLATE_INLINE
  * @return `true` if the vectors are equal, `false` otherwise.
  *
  * @remark The operator compares the sizes of the vectors using their `size()` member functions. 
- * If the sizes are not equal, it returns `false`. Otherwise, it uses the `core::equal()` function to 
- * compare the elements of the vectors. The `core::equal()` function compares the elements of 
+ * If the sizes are not equal, it returns `false`. Otherwise, it uses the `nya::equal()` function to 
+ * compare the elements of the vectors, `memcmp` or vector compares for arithmetic elements. It compares the elements of 
  * the ranges [__x.begin(), __x.end()) and [__y.begin(), __y.end()) for equality. 
  * If all corresponding elements are equal, the operator returns `true`; otherwise, it returns `false`.
  */
@@ -1493,7 +1814,7 @@ LLVM_MSTL_CONSTEXPR_SINCE_CXX20
 	operator==( const vector< _Tp, _Allocator >& __x, const vector< _Tp, _Allocator >& __y ) {
 	const typename vector< _Tp, _Allocator >::size_type __sz = __x.size();
 	return __sz == __y.size() &&
-				 core::equal( __x.begin(), __x.end(), __y.begin() );
+				 nya::equal( __x.data(), __x.data() + __sz, __y.data() );
 }
 
 /**
@@ -1527,8 +1848,8 @@ LLVM_MSTL_CONSTEXPR_SINCE_CXX20
  * @param __y The second vector to compare.
  * @return `true` if `__x` is lexicographically less than `__y`, `false` otherwise.
  *
- * @remark The operator uses the `core::lexicographical_compare()` function to 
- * perform the lexicographical comparison between the elements of the vectors. 
+ * @remark The operator uses the `nya::lexicographical_compare()` function to 
+ * perform the lexicographical comparison between the elements of the vectors, vectorized for arithmetic elements. 
  * It compares the ranges [__x.begin(), __x.end()) and [__y.begin(), __y.end()). 
  * If __x is lexicographically less than __y, it returns `true`; otherwise, it returns `false`.
  */
@@ -1536,7 +1857,7 @@ template < typename _Tp, typename _Allocator >
 LLVM_MSTL_CONSTEXPR_SINCE_CXX20
 	LLVM_MSTL_TEMPLATE_INLINE bool
 	operator<( const vector< _Tp, _Allocator >& __x, const vector< _Tp, _Allocator >& __y ) {
-	return core::lexicographical_compare( __x.begin(), __x.end(), __y.begin(), __y.end() );
+	return nya::lexicographical_compare( __x.data(), __x.data() + __x.size(), __y.data(), __y.data() + __y.size() );
 }
 
 /**
@@ -1934,10 +2255,8 @@ vector< _Tp, _Allocator >::insert( const_iterator __position, size_type __n, con
 			if ( __n > 0 ) {
 				__move_range( __p, __old_last, __p + __old_n );
 				const_pointer __xr = core::pointer_traits< const_pointer >::pointer_to( __x );
-				if ( __p <= __xr && __xr < this->__end ) {
-					__xr += __old_n;
-					core::fill_n( __p, __n, *__xr );
-				}
+				if ( __p <= __xr && __xr < this->__end ) __xr += __old_n;//<--- `__x` was moved along with the tail
+				__fill_n( __p, __n, *__xr );
 			}
 		} else {
 			allocator_type&                               __a = this->__alloc();
@@ -2034,6 +2353,381 @@ vector< _Tp, _Allocator >::insert( const_iterator __position, core::initializer_
 	return insert( __position, __il.begin(), __il.end() );
 }
 
+template < typename _Tp, typename _Allocator >
+template < typename... _Args >
+LLVM_MSTL_CONSTEXPR_SINCE_CXX20 auto
+vector< _Tp, _Allocator >::emplace( const_iterator __position, _Args&&... __args )
+	-> typename vector< _Tp, _Allocator >::iterator {
+	pointer         __p = this->__begin + ( __position - begin() );
+	allocator_type& __a = this->__alloc();
+	if ( this->__end < this->__end_cap() ) {
+		if ( __p == this->__end ) {
+			__construct_one_at_end( core::forward< _Args >( __args )... );
+		} else if ( __can_construct_in_hole< _Args... >( __args... ) ) {
+			__move_range( __p, this->__end, __p + 1 );
+			//<--- the hole holds a moved-from element, replace it, the construction can not throw
+			__alloc_traits::destroy( __a, core::to_address( __p ) );
+			__alloc_traits::construct( __a, core::to_address( __p ), core::forward< _Args >( __args )... );
+		} else {
+			//<--- the arguments may refer to an element, build the value before anything is shifted
+			__temp_value< value_type, allocator_type > __tmp( __a, core::forward< _Args >( __args )... );
+			__move_range( __p, this->__end, __p + 1 );
+			*__p = core::move( __tmp.get() );
+		}
+	} else {
+		__split_buffer< value_type, allocator_type& > __v(
+			__recommend( size() + 1 ), static_cast< size_type >( __p - this->__begin ), __a );
+		__alloc_traits::construct( __a, core::to_address( __v.__end ), core::forward< _Args >( __args )... );
+		++__v.__end;
+		__p = __swap_out_circular_buffer( __v, __p );
+	}
+	return __make_iter( __p );
+}
+
+template < typename _Tp, typename _Allocator >
+template <
+	typename _BidirectionalIterator,
+	core::enable_if_t<
+		__is_cpp17_bidirectional_iterator< _BidirectionalIterator >::value,
+		int > >
+LLVM_MSTL_CONSTEXPR_SINCE_CXX20 auto
+vector< _Tp, _Allocator >::insert_sorted_positions( _BidirectionalIterator __first, _BidirectionalIterator __last ) {
+	//<--- one cheap pass over the batch: count the values and validate the positions
+	const size_type __old_size = size();
+	size_type       __k        = 0;
+	size_type       __prev     = 0;
+	for ( _BidirectionalIterator __i = __first; __i != __last; ++__i, (void) ++__k ) {
+		const size_type __pos = static_cast< size_type >( ( *__i ).first );
+		if ( __pos > __old_size || __pos < __prev ) {
+			spdlog::error( "vector::insert_sorted_positions bad position, __pos[{}], prev[{}], size()[{}]", __pos, __prev, __old_size );
+			__throw_out_of_range();
+		}
+		__prev = __pos;
+	}
+	if ( __k == 0 ) return;
+
+	if ( __k <= static_cast< size_type >( this->__end_cap() - this->__end ) ) {
+		//<--- merge from back to front: `__r` is one past the last old element still in its old slot,
+		//<--- `__w` is one past the last slot still to be written, `__j` is one past the last pending value
+		pointer                __old_last = this->__end;
+		pointer                __new_last = __old_last + __k;
+		pointer                __r        = __old_last;
+		pointer                __w        = __new_last;
+		_BidirectionalIterator __j        = __last;
+		{
+			//<--- the slots in [__old_last, __new_last) are raw memory, so they must be constructed.
+			//<--- If a construction throws, the already constructed slots [__w, __new_last) are destroyed again
+			auto __guard = __make_exception_guard(
+				_AllocatorDestroyRangeReverse< allocator_type, pointer >( __alloc(), __w, __new_last ) );
+			while ( __w != __old_last ) {
+				if ( __j != __first && static_cast< size_type >( ( *core::prev( __j ) ).first ) >= static_cast< size_type >( __r - this->__begin ) ) {
+					--__j;
+					__alloc_traits::construct( __alloc(), core::to_address( __w - 1 ), ( *__j ).second );
+				} else {
+					--__r;
+					__alloc_traits::construct( __alloc(), core::to_address( __w - 1 ), core::move( *__r ) );
+				}
+				--__w;
+			}
+			__guard.__complete();
+		}
+		this->__end = __new_last;
+		//<--- the remaining slots are live elements, they are only assigned.
+		//<--- Once every value is placed, [__begin, __r) is already where it belongs
+		while ( __j != __first ) {
+			if ( static_cast< size_type >( ( *core::prev( __j ) ).first ) >= static_cast< size_type >( __r - this->__begin ) ) {
+				--__j;
+				*( __w - 1 ) = ( *__j ).second;
+			} else {
+				--__r;
+				*( __w - 1 ) = core::move( *__r );
+			}
+			--__w;
+		}
+	} else {
+		//<--- grow exactly once, then lay out the old elements and the new values front to back
+		allocator_type&                               __a = this->__alloc();
+		__split_buffer< value_type, allocator_type& > __v( __recommend( __old_size + __k ), 0, __a );
+		pointer                                       __r = this->__begin;
+		for ( ; __first != __last; ++__first ) {
+			pointer __stop = this->__begin + static_cast< size_type >( ( *__first ).first );
+			for ( ; __r != __stop; ++__r, (void) ++__v.__end )
+				__alloc_traits::construct( __a, core::to_address( __v.__end ), core::move_if_noexcept( *__r ) );
+			__alloc_traits::construct( __a, core::to_address( __v.__end ), ( *__first ).second );
+			++__v.__end;
+		}
+		for ( ; __r != this->__end; ++__r, (void) ++__v.__end )
+			__alloc_traits::construct( __a, core::to_address( __v.__end ), core::move_if_noexcept( *__r ) );
+
+		//<--- every element is in `__v`: the old ones are destroyed, so the swap has nothing left to move
+		__clear();
+		__swap_out_circular_buffer( __v );
+	}
+}
+
+template < typename _Tp, typename _Allocator >
+LLVM_MSTL_CONSTEXPR_SINCE_CXX20 auto
+vector< _Tp, _Allocator >::erase( const_iterator __position )
+	-> typename vector< _Tp, _Allocator >::iterator {
+	pointer __p = this->__begin + ( __position - begin() );
+	__base_destruct_at_end( core::move( __p + 1, this->__end, __p ) );
+	return __make_iter( __p );
+}
+
+template < typename _Tp, typename _Allocator >
+LLVM_MSTL_CONSTEXPR_SINCE_CXX20 auto
+vector< _Tp, _Allocator >::erase( const_iterator __first, const_iterator __last )
+	-> typename vector< _Tp, _Allocator >::iterator {
+	pointer __p = this->__begin + ( __first - begin() );
+	if ( __first != __last ) {
+		__base_destruct_at_end( core::move( __p + ( __last - __first ), this->__end, __p ) );
+	}
+	return __make_iter( __p );
+}
+
+template < typename _Tp, typename _Allocator >
+LLVM_MSTL_CONSTEXPR_SINCE_CXX20 auto
+vector< _Tp, _Allocator >::erase_unordered( const_iterator __position )
+	-> typename vector< _Tp, _Allocator >::iterator {
+	pointer __p    = this->__begin + ( __position - begin() );
+	pointer __back = this->__end - 1;
+	if constexpr ( __relocate_by_memmove ) {
+		if ( !core::is_constant_evaluated() && __p != __back ) {
+			__alloc_traits::destroy( __alloc(), core::to_address( __p ) );
+			core::memcpy( static_cast< void* >( __p ), static_cast< const void* >( __back ), sizeof( value_type ) );
+			this->__end = __back;//<--- the bytes of the last element now live in `*__p`
+			return __make_iter( __p );
+		}
+	}
+	if ( __p != __back ) *__p = core::move( *__back );
+	__base_destruct_at_end( __back );
+	return __make_iter( __p );
+}
+
+template < typename _Tp, typename _Allocator >
+LLVM_MSTL_CONSTEXPR_SINCE_CXX20 auto
+vector< _Tp, _Allocator >::erase_unordered( const_iterator __first, const_iterator __last )
+	-> typename vector< _Tp, _Allocator >::iterator {
+	pointer         __p = this->__begin + ( __first - begin() );
+	difference_type __n = __last - __first;
+	if ( __n > 0 ) {
+		//<--- only the elements behind the range can fill the hole, and never more than the hole needs.
+		//<--- Source and destination never overlap: the source starts at or after `__last`
+		difference_type __tail = this->__end - ( __p + __n );
+		difference_type __fill = core::min( __n, __tail );
+		if constexpr ( __relocate_by_memmove ) {
+			if ( !core::is_constant_evaluated() ) {
+				for ( pointer __i = __p; __i != __p + __n; ++__i ) __alloc_traits::destroy( __alloc(), core::to_address( __i ) );
+				if ( __fill != 0 )
+					core::memcpy( static_cast< void* >( __p ), static_cast< const void* >( this->__end - __fill ), static_cast< size_t >( __fill ) * sizeof( value_type ) );
+				this->__end -= __n;//<--- the slots left behind were destroyed or had their bytes copied out
+				return __make_iter( __p );
+			}
+		}
+		core::move( this->__end - __fill, this->__end, __p );
+		__base_destruct_at_end( this->__end - __n );
+	}
+	return __make_iter( __p );
+}
+
+template < typename _Tp, typename _Allocator >
+template <
+	typename _ForwardIterator,
+	core::enable_if_t<
+		__is_cpp17_forward_iterator< _ForwardIterator >::value,
+		int > >
+LLVM_MSTL_CONSTEXPR_SINCE_CXX20 auto
+vector< _Tp, _Allocator >::erase_indices( _ForwardIterator __first, _ForwardIterator __last )
+	-> typename vector< _Tp, _Allocator >::size_type {
+	//<--- validate before touching anything, so a bad index range leaves the vector unchanged
+	const size_type __old_size = size();
+	size_type       __prev     = 0;
+	for ( _ForwardIterator __i = __first; __i != __last; ++__i ) {
+		const size_type __idx = static_cast< size_type >( *__i );
+		if ( __idx >= __old_size || __idx < __prev ) {
+			spdlog::error( "vector::erase_indices bad index, __idx[{}], prev[{}], size()[{}]", __idx, __prev, __old_size );
+			__throw_out_of_range();
+		}
+		__prev = __idx;
+	}
+	if ( __first == __last ) return 0;
+
+	if constexpr ( __simd_scalar< _Tp > ) {
+		if ( !core::is_constant_evaluated() ) {
+			//<--- a mask of the kept elements a block at a time, cleared at the indices, for the dispatched kernels
+			const size_type __from = static_cast< size_type >( *__first );
+			_Tp* const      __p    = core::to_address( this->__begin ) + __from;
+			auto            __mask = [ & ]( size_t __base, size_t __len, uint64_t* __keep ) {
+				core::fill_n( __keep, ( __len + 63 ) / 64, ~uint64_t( 0 ) );
+				for ( ; __first != __last; ++__first ) {
+					const size_t __i = static_cast< size_t >( *__first ) - __from - __base;//<--- a duplicate is not below `__base`
+					if ( __i >= __len ) break;
+					__keep[ __i / 64 ] &= ~( uint64_t( 1 ) << ( __i % 64 ) );
+				}
+			};
+			const size_t __kept = __simd_compact_blocks( __p, __p, __old_size - __from, __mask );
+			__base_destruct_at_end( this->__begin + static_cast< difference_type >( __from + __kept ) );
+			return __old_size - size();
+		}
+	}
+
+	//<--- `__r` is the next surviving element to keep, `__w` is where it goes
+	pointer __w = this->__begin + static_cast< size_type >( *__first );
+	pointer __r = __w;
+	for ( ; __first != __last; ++__first ) {
+		pointer __hole = this->__begin + static_cast< size_type >( *__first );
+		if ( __hole < __r ) continue;//<--- duplicate index
+		__w = core::move( __r, __hole, __w );
+		__r = __hole + 1;
+	}
+	__w = core::move( __r, this->__end, __w );
+	__base_destruct_at_end( __w );
+	return __old_size - size();
+}
+
+template < typename _Tp, typename _Allocator >
+template < _ContainerCompatibleRange< _Tp > _Range >
+LLVM_MSTL_CONSTEXPR_SINCE_CXX20 auto vector< _Tp, _Allocator >::append_range( _Range&& __range ) {
+	if constexpr ( core::ranges::sized_range< _Range > || core::ranges::forward_range< _Range > ) {
+		__with_sized_range( __range, [ this ]( auto __first, auto __last, size_type __n ) {
+			__append_with_size( core::move( __first ), core::move( __last ), __n );
+		} );
+	} else {
+		for ( auto&& __x : __range ) {
+			emplace_back( core::forward< decltype( __x ) >( __x ) );
+		}
+	}
+}
+
+template < typename _Tp, typename _Allocator >
+template < _ContainerCompatibleRange< _Tp > _Range >
+LLVM_MSTL_CONSTEXPR_SINCE_CXX20 auto
+vector< _Tp, _Allocator >::insert_range( const_iterator __position, _Range&& __range )
+	-> typename vector< _Tp, _Allocator >::iterator {
+	if constexpr ( core::ranges::sized_range< _Range > || core::ranges::forward_range< _Range > ) {
+		return __with_sized_range( __range, [ this, __position ]( auto __first, auto __last, size_type __n ) {
+			return __insert_with_size( __position, core::move( __first ), core::move( __last ), __n );
+		} );
+	} else {
+		//<--- append behind the old elements, then rotate them into place
+		const size_type __off      = static_cast< size_type >( __position - begin() );
+		const size_type __old_size = size();
+		for ( auto&& __x : __range ) {
+			emplace_back( core::forward< decltype( __x ) >( __x ) );
+		}
+		core::rotate( this->__begin + __off, this->__begin + __old_size, this->__end );
+		return begin() + static_cast< difference_type >( __off );
+	}
+}
+
+template < typename _Tp, typename _Allocator >
+template < _ContainerCompatibleRange< _Tp > _Range >
+LLVM_MSTL_CONSTEXPR_SINCE_CXX20 auto vector< _Tp, _Allocator >::assign_range( _Range&& __range ) {
+	if constexpr ( core::ranges::sized_range< _Range > || core::ranges::forward_range< _Range > ) {
+		__with_sized_range( __range, [ this ]( auto __first, auto __last, size_type __n ) {
+			__assign_with_size( core::move( __first ), core::move( __last ), __n );
+		} );
+	} else {
+		clear();
+		for ( auto&& __x : __range ) {
+			emplace_back( core::forward< decltype( __x ) >( __x ) );
+		}
+	}
+}
+
+template < typename _Tp, typename _Allocator >
+LLVM_MSTL_CONSTEXPR_SINCE_CXX20 LLVM_MSTL_TEMPLATE_INLINE auto vector< _Tp, _Allocator >::push_back( const_reference __x ) {
+	emplace_back( __x );
+}
+
+template < typename _Tp, typename _Allocator >
+LLVM_MSTL_CONSTEXPR_SINCE_CXX20 LLVM_MSTL_TEMPLATE_INLINE auto vector< _Tp, _Allocator >::push_back( value_type&& __x ) {
+	emplace_back( core::move( __x ) );
+}
+
+template < typename _Tp, typename _Allocator >
+LLVM_MSTL_CONSTEXPR_SINCE_CXX20 LLVM_MSTL_TEMPLATE_INLINE auto vector< _Tp, _Allocator >::pop_back() {
+	__base_destruct_at_end( this->__end - 1 );
+}
+
+template < typename _Tp, typename _Allocator >
+LLVM_MSTL_CONSTEXPR_SINCE_CXX20 auto vector< _Tp, _Allocator >::resize( size_type __sz ) {
+	size_type __cs = size();
+	if ( __cs < __sz )
+		__append( __sz - __cs );
+	else if ( __cs > __sz )
+		__base_destruct_at_end( this->__begin + __sz );
+}
+
+template < typename _Tp, typename _Allocator >
+LLVM_MSTL_CONSTEXPR_SINCE_CXX20 auto vector< _Tp, _Allocator >::resize( size_type __sz, const_reference __x ) {
+	size_type __cs = size();
+	if ( __cs < __sz )
+		__append( __sz - __cs, __x );
+	else if ( __cs > __sz )
+		__base_destruct_at_end( this->__begin + __sz );
+}
+
+template < typename _Tp, typename _Allocator >
+LLVM_MSTL_CONSTEXPR_SINCE_CXX20 auto vector< _Tp, _Allocator >::assign( size_type __n, const_reference __u ) {
+	if ( __n <= capacity() ) {
+		size_type __s = size();
+		__fill_n( this->__begin, core::min( __n, __s ), __u );
+		if ( __n > __s )
+			__construct_at_end( __n - __s, __u );
+		else
+			__base_destruct_at_end( this->__begin + __n );
+	} else {
+		__vdeallocate();
+		__vallocate( __recommend( __n ) );
+		__construct_at_end( __n, __u );
+	}
+}
+
+template < typename _Tp, typename _Allocator >
+LLVM_MSTL_CONSTEXPR_SINCE_CXX20 LLVM_MSTL_TEMPLATE_INLINE auto
+vector< _Tp, _Allocator >::assign( core::initializer_list< value_type > __il ) {
+	assign( __il.begin(), __il.end() );
+}
+
+template < typename _Tp, typename _Allocator >
+template <
+	typename _InputIterator,
+	core::enable_if_t<
+		__is_exactly_cpp17_input_iterator< _InputIterator >::value &&
+			core::is_constructible_v<
+				_Tp,
+				typename core::iterator_traits< _InputIterator >::reference >,
+		int > >
+LLVM_MSTL_CONSTEXPR_SINCE_CXX20 auto vector< _Tp, _Allocator >::assign( _InputIterator __first, _InputIterator __last ) {
+	clear();
+	for ( ; __first != __last; ++__first ) {
+		emplace_back( *__first );
+	}
+}
+
+template < typename _Tp, typename _Allocator >
+template <
+	typename _ForwardIterator,
+	core::enable_if_t<
+		__is_cpp17_forward_iterator< _ForwardIterator >::value &&
+			core::is_constructible_v<
+				_Tp,
+				typename core::iterator_traits< _ForwardIterator >::reference >,
+		int > >
+LLVM_MSTL_CONSTEXPR_SINCE_CXX20 auto vector< _Tp, _Allocator >::assign( _ForwardIterator __first, _ForwardIterator __last ) {
+	__assign_with_size( __first, __last, static_cast< size_type >( core::distance( __first, __last ) ) );
+}
+
+template < typename _Tp, typename _Allocator >
+LLVM_MSTL_CONSTEXPR_SINCE_CXX20 auto vector< _Tp, _Allocator >::swap( vector& __x ) LLVM_MSTL_NOEXCEPT {
+	core::swap( this->__begin, __x.__begin );
+	core::swap( this->__end, __x.__end );
+	core::swap( this->__end_cap(), __x.__end_cap() );
+	__swap_allocator(
+		this->__alloc(), __x.__alloc(), core::integral_constant< bool, __alloc_traits::propagate_on_container_swap::value >() );
+}
+
 /*************************************************************************************		
  *                                                                                   *
  *															  	MODIFIERS END			               	               *
@@ -2072,6 +2766,27 @@ LLVM_MSTL_CONSTEXPR_SINCE_CXX20 auto vector< _Tp, _Allocator >::__vallocate( siz
 	__annotate_new( 0 );
 }
 
+template < typename _Tp, typename _Allocator >
+LLVM_MSTL_CONSTEXPR_SINCE_CXX20 auto vector< _Tp, _Allocator >::__vallocate_value_init( size_type __n ) -> void {
+	if constexpr ( __zeroed_value_init ) {
+		if ( !core::is_constant_evaluated() ) {
+			if ( __n > max_size() ) {
+				__throw_length_error();
+			}
+			auto __allocation = __allocate_zeroed_at_least( __alloc(), __n );
+			__begin           = __allocation.ptr;
+			__end             = __allocation.ptr;
+			__end_cap()       = __begin + __allocation.count;
+			__annotate_new( 0 );
+			_ConstructTransaction __tx( *this, __n );
+			__tx.__pos = __begin + __n;//<--- the zero bytes are the elements already
+			return;
+		}
+	}
+	__vallocate( __n );
+	__construct_at_end( __n );
+}
+
 template < typename _Tp, typename _Allocator >
 LLVM_MSTL_CONSTEXPR_SINCE_CXX20 auto vector< _Tp, _Allocator >::__vdeallocate() LLVM_MSTL_NOEXCEPT {
 	if ( this->__begin != nullptr ) {
@@ -2133,13 +2848,18 @@ LLVM_MSTL_CONSTEXPR_SINCE_CXX20 auto vector< _Tp, _Allocator >::__swap_out_circu
 template < typename _Tp, typename _Allocator >
 LLVM_MSTL_CONSTEXPR_SINCE_CXX20 auto vector< _Tp, _Allocator >::__construct_at_end( size_type __n ) {
 	_ConstructTransaction __tx( *this, __n );
-	const_pointer         __new_end = __tx.__new_end;//<--- get the really pointer, which point the `end position`
-	for ( pointer __pos = __tx.__pos; __pos != __new_end; __tx.__pos = ++__pos ) {
-		//<--- `std::to_address` to gain the origin pointer which obtained the pointer or smart pointer
-		//<--- `static constexpr void construct( Alloc& a, T* p, Args&&... args )`
-		//<--- `p` pointer to the uninitialized storage on which a T object will be constructed
-		//!<--- so, here is actually constructed `pointer` by `pointer`
-		__alloc_traits::construct( this->__alloc(), core::to_address( __pos ) );
+	if constexpr ( requires { __uninitialized_allocator_value_construct_n( this->__alloc(), __tx.__pos, __n ); } ) {
+		//<--- zero bytes, and the allocator adds nothing: one `memset`
+		__tx.__pos = __uninitialized_allocator_value_construct_n( this->__alloc(), __tx.__pos, __n );
+	} else {
+		const_pointer __new_end = __tx.__new_end;//<--- get the really pointer, which point the `end position`
+		for ( pointer __pos = __tx.__pos; __pos != __new_end; __tx.__pos = ++__pos ) {
+			//<--- `std::to_address` to gain the origin pointer which obtained the pointer or smart pointer
+			//<--- `static constexpr void construct( Alloc& a, T* p, Args&&... args )`
+			//<--- `p` pointer to the uninitialized storage on which a T object will be constructed
+			//!<--- so, here is actually constructed `pointer` by `pointer`
+			__alloc_traits::construct( this->__alloc(), core::to_address( __pos ) );
+		}
 	}
 	//! When the `__tx` drop the block, it will call `__tx.~_ConstructTransaction`.
 	//! Then, execute this statement `__v.__end = __pos` to update the right `__end` point to the right position
@@ -2150,10 +2870,15 @@ LLVM_MSTL_INLINE
 	LLVM_MSTL_CONSTEXPR_SINCE_CXX20 auto
 	vector< _Tp, _Allocator >::__construct_at_end( size_type __n, const_reference __x ) {
 	_ConstructTransaction __tx( *this, __n );
-	const_pointer         __new_end = __tx.__new_end;
-	for ( pointer __pos = __tx.__pos; __pos != __new_end; __tx.__pos = ++__pos ) {
-		//<--- this `construct` use the `__x` to initialize when alloc the `__pos`
-		__alloc_traits::construct( this->__alloc(), core::to_address( __pos ), __x );
+	if constexpr ( requires { __uninitialized_allocator_fill_n( this->__alloc(), __tx.__pos, __n, __x ); } ) {
+		//<--- a copy of the bytes, and the allocator adds nothing: a broadcast store
+		__tx.__pos = __uninitialized_allocator_fill_n( this->__alloc(), __tx.__pos, __n, __x );
+	} else {
+		const_pointer __new_end = __tx.__new_end;
+		for ( pointer __pos = __tx.__pos; __pos != __new_end; __tx.__pos = ++__pos ) {
+			//<--- this `construct` use the `__x` to initialize when alloc the `__pos`
+			__alloc_traits::construct( this->__alloc(), core::to_address( __pos ), __x );
+		}
 	}
 	//! When the `__tx` drop the block, it will call `__tx.~_ConstructTransaction`.
 	//! Then, execute this statement `__v.__end = __pos` to update the right `__end` point to the right position
@@ -2170,6 +2895,92 @@ vector< _Tp, _Allocator >::__construct_at_end( _ForwardIterator __first, _Forwar
 	__tx.__pos = __uninitialized_allocator_copy( __alloc(), __first, __last, __tx.__pos );
 }
 
+template < typename _Tp, typename _Allocator >
+template < typename _Iterator, typename _Sentinel >
+LLVM_MSTL_CONSTEXPR_SINCE_CXX20 auto
+vector< _Tp, _Allocator >::__construct_at_end_with_size( _Iterator __first, _Sentinel __last, size_type __n ) {
+	_ConstructTransaction __tx( *this, __n );
+	__tx.__pos = __uninitialized_allocator_copy( __alloc(), core::move( __first ), core::move( __last ), __tx.__pos );
+}
+
+template < typename _Tp, typename _Allocator >
+template < typename _Iterator, typename _Sentinel >
+LLVM_MSTL_CONSTEXPR_SINCE_CXX20 auto
+vector< _Tp, _Allocator >::__append_with_size( _Iterator __first, _Sentinel __last, size_type __n ) {
+	if ( __n <= static_cast< size_type >( this->__end_cap() - this->__end ) ) {
+		__construct_at_end_with_size( core::move( __first ), core::move( __last ), __n );
+	} else {
+		allocator_type&                               __a = this->__alloc();
+		__split_buffer< value_type, allocator_type& > __v( __recommend( size() + __n ), size(), __a );
+		__v.__end = __uninitialized_allocator_copy( __a, core::move( __first ), core::move( __last ), __v.__end );
+		__swap_out_circular_buffer( __v );
+	}
+}
+
+template < typename _Tp, typename _Allocator >
+template < typename _Iterator, typename _Sentinel >
+LLVM_MSTL_CONSTEXPR_SINCE_CXX20 auto vector< _Tp, _Allocator >::__insert_with_size(
+	const_iterator __position, _Iterator __first, _Sentinel __last, size_type __n )
+	-> typename vector< _Tp, _Allocator >::iterator {
+	pointer __p = this->__begin + ( __position - begin() );
+	if ( __n == 0 ) return __make_iter( __p );
+
+	if constexpr ( !core::forward_iterator< _Iterator > ) {
+		//<--- single pass, the source can not be read twice, so append it once and rotate it into place
+		const difference_type __off      = __p - this->__begin;
+		const difference_type __old_size = this->__end - this->__begin;
+		__append_with_size( core::move( __first ), core::move( __last ), __n );
+		__p = this->__begin + __off;
+		core::rotate( __p, this->__begin + __old_size, this->__end );
+	} else if ( __n <= static_cast< size_type >( this->__end_cap() - this->__end ) ) {
+		pointer         __old_last = this->__end;
+		difference_type __dx       = this->__end - __p;
+		if ( static_cast< difference_type >( __n ) > __dx ) {
+			//<--- the tail of the range lands in raw memory behind `__end`
+			_Iterator __m = core::ranges::next( __first, __dx );
+			__construct_at_end_with_size( __m, core::move( __last ), __n - static_cast< size_type >( __dx ) );
+			if ( __dx > 0 ) {
+				__move_range( __p, __old_last, __p + __n );
+				core::ranges::copy( __first, __m, __p );
+			}
+		} else {
+			__move_range( __p, __old_last, __p + __n );
+			core::ranges::copy_n( core::move( __first ), static_cast< difference_type >( __n ), __p );
+		}
+	} else {
+		allocator_type&                               __a = this->__alloc();
+		__split_buffer< value_type, allocator_type& > __v(
+			__recommend( size() + __n ), static_cast< size_type >( __p - this->__begin ), __a );
+		__v.__end = __uninitialized_allocator_copy( __a, core::move( __first ), core::move( __last ), __v.__end );
+		__p       = __swap_out_circular_buffer( __v, __p );
+	}
+	return __make_iter( __p );
+}
+
+template < typename _Tp, typename _Allocator >
+template < typename _Iterator, typename _Sentinel >
+LLVM_MSTL_CONSTEXPR_SINCE_CXX20 auto
+vector< _Tp, _Allocator >::__assign_with_size( _Iterator __first, _Sentinel __last, size_type __n ) {
+	if ( __n <= capacity() ) {
+		const size_type __old_size = size();
+		if ( __n > __old_size ) {
+			//<--- assign over the live elements, construct the rest in place
+			auto __mid =
+				core::ranges::copy_n( core::move( __first ), static_cast< difference_type >( __old_size ), this->__begin ).in;
+			__construct_at_end_with_size( core::move( __mid ), core::move( __last ), __n - __old_size );
+		} else {
+			pointer __new_end =
+				core::ranges::copy_n( core::move( __first ), static_cast< difference_type >( __n ), this->__begin ).out;
+			__base_destruct_at_end( __new_end );
+		}
+	} else {
+		//<--- the old elements would be thrown away anyway, release them before allocating
+		__vdeallocate();
+		__vallocate( __recommend( __n ) );
+		__construct_at_end_with_size( core::move( __first ), core::move( __last ), __n );
+	}
+}
+
 template < typename _Tp, typename _Allocator >
 template < typename... _Args >
 LLVM_MSTL_CONSTEXPR_SINCE_CXX20 auto vector< _Tp, _Allocator >::__emplace_back_slow_path( _Args&&... __args ) {
@@ -2195,6 +3006,64 @@ vector< _Tp, _Allocator >::__move_range( pointer __from_s, pointer __from_e, poi
 	core::move_backward( __from_s, __from_s + __n, __old_last );
 }
 
+template < typename _Tp, typename _Allocator >
+LLVM_MSTL_CONSTEXPR_SINCE_CXX20 auto vector< _Tp, _Allocator >::__append( size_type __n ) {
+	if ( static_cast< size_type >( this->__end_cap() - this->__end ) >= __n ) {
+		__construct_at_end( __n );
+	} else if ( __zeroed_value_init && this->__begin == nullptr && !core::is_constant_evaluated() ) {
+		__vallocate_value_init( __n );//<--- `resize` of a vector without storage: `__recommend( __n )` is `__n`
+	} else {
+		allocator_type&                               __a = this->__alloc();
+		__split_buffer< value_type, allocator_type& > __v( __recommend( size() + __n ), size(), __a );
+		__v.__construct_at_end( __n );
+		__swap_out_circular_buffer( __v );
+	}
+}
+
+template < typename _Tp, typename _Allocator >
+LLVM_MSTL_CONSTEXPR_SINCE_CXX20 auto vector< _Tp, _Allocator >::__append( size_type __n, const_reference __x ) {
+	if ( static_cast< size_type >( this->__end_cap() - this->__end ) >= __n ) {
+		__construct_at_end( __n, __x );
+	} else {
+		allocator_type&                               __a = this->__alloc();
+		__split_buffer< value_type, allocator_type& > __v( __recommend( size() + __n ), size(), __a );
+		__v.__construct_at_end( __n, __x );
+		__swap_out_circular_buffer( __v );
+	}
+}
+
+template < typename _Tp, typename _Allocator >
+LLVM_MSTL_CONSTEXPR_SINCE_CXX20 auto vector< _Tp, _Allocator >::__move_assign( vector& __c, core::true_type )
+	LLVM_MSTL_NOEXCEPT_V( core::is_nothrow_move_assignable_v< allocator_type > ) -> void {
+	__vdeallocate();
+	__move_assign_alloc( __c );
+	this->__begin     = __c.__begin;
+	this->__end       = __c.__end;
+	this->__end_cap() = __c.__end_cap();
+	__c.__begin = __c.__end = __c.__end_cap() = nullptr;
+}
+
+template < typename _Tp, typename _Allocator >
+LLVM_MSTL_CONSTEXPR_SINCE_CXX20 auto vector< _Tp, _Allocator >::__move_assign( vector& __c, core::false_type )
+	LLVM_MSTL_NOEXCEPT_V( core::is_nothrow_move_assignable_v< allocator_type > ) -> void {
+	if ( __alloc() != __c.__alloc() ) {
+		//<--- the storage can not change hands, move the elements one by one
+		assign( core::make_move_iterator( __c.begin() ), core::make_move_iterator( __c.end() ) );
+	} else {
+		__move_assign( __c, core::true_type() );
+	}
+}
+
+template < typename _Tp, typename _Allocator >
+LLVM_MSTL_CONSTEXPR_SINCE_CXX20 auto vector< _Tp, _Allocator >::__move_assign_alloc( vector& __c )
+	LLVM_MSTL_NOEXCEPT_V(
+		!__alloc_traits::propagate_on_container_move_assignment::value ||
+		core::is_nothrow_move_assignable_v< allocator_type > ) {
+	if constexpr ( __alloc_traits::propagate_on_container_move_assignment::value ) {
+		__alloc() = core::move( __c.__alloc() );
+	}
+}
+
 template < typename _Tp, typename _Allocator >
 template < typename... _Args >
 LLVM_MSTL_TEMPLATE_INLINE
@@ -2209,6 +3078,56 @@ LLVM_MSTL_TEMPLATE_INLINE
 	return this->back();
 }
 
+/**
+ * @brief Erases all elements satisfying the predicate from the vector.
+ *
+ * @ref https://en.cppreference.com/w/cpp/container/vector/erase2
+ *
+ * The surviving elements are compacted in a single pass and the removed tail is destroyed by one
+ * `__base_destruct_at_end` sweep. For trivially copyable element types the compaction is branchless
+ * (see `__remove_if`), which keeps the cost flat no matter how the removed elements are scattered. For
+ * arithmetic ones the predicate fills a mask of the kept elements, a block at a time, and the dispatched
+ * kernels of @ref __simd_compact_blocks move them.
+ *
+ * @tparam _Tp The value type of the vector.
+ * @tparam _Allocator The allocator type used for memory management.
+ * @tparam _Predicate The unary predicate type.
+ * @param __c The vector to erase from.
+ * @param __pred The predicate, `true` means the element is erased.
+ * @return The number of erased elements.
+ */
+template < typename _Tp, typename _Allocator, typename _Predicate >
+LLVM_MSTL_CONSTEXPR_SINCE_CXX20 auto erase_if( vector< _Tp, _Allocator >& __c, _Predicate __pred )
+	-> typename vector< _Tp, _Allocator >::size_type {
+	const auto __old_size = __c.size();
+	_Tp*       __data     = __c.data();
+	if constexpr ( __simd_scalar< _Tp > ) {
+		if ( !core::is_constant_evaluated() ) {
+			//<--- the prefix in front of the first erased element is already in place
+			_Tp* const __hole = core::find_if( __data, __data + __old_size, __pred );
+			if ( __hole == __data + __old_size ) return 0;
+			_Tp* const __from = __hole + 1;
+			auto       __mask = [ __from, &__pred ]( size_t __base, size_t __len, uint64_t* __keep ) {
+				for ( size_t __j = 0; __j < __len; __j += 64 ) {
+					const size_t __e    = core::min< size_t >( 64, __len - __j );
+					uint64_t     __word = 0;
+					for ( size_t __k = 0; __k != __e; ++__k )
+						__word |= uint64_t( !static_cast< bool >( __pred( __from[ __base + __j + __k ] ) ) ) << __k;
+					__keep[ __j / 64 ] = __word;
+				}
+			};
+			const size_t __kept = __simd_compact_blocks( __hole, __from, static_cast< size_t >( __data + __old_size - __from ), __mask );
+			__c.erase( __c.begin() + ( __hole - __data ) + static_cast< ptrdiff_t >( __kept ), __c.end() );
+			return __old_size - __c.size();
+		}
+	}
+	_Tp* __new_last = nya::__remove_if( __data, __data + __old_size, __pred );
+	__c.erase( __c.begin() + ( __new_last - __data ), __c.end() );
+	return __old_size - __c.size();
+}
+
 LLVM_MSTL_END_NAMESPACE_STD
 
+#include "__vector_bool.h"
+
 #endif//LLVM_MSTL_VECTOR_H
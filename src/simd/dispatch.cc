@@ -0,0 +1,151 @@
+#include "simd/kernels.h"
+
+#include <atomic>
+#include <cstdlib>
+#include <cstring>
+
+LLVM_MSTL_BEGIN_NAMESPACE_STD
+
+namespace {
+
+	auto __kernels_of( simd_isa __isa ) LLVM_MSTL_NOEXCEPT->const __simd_kernel_set* {
+		switch ( __isa ) {
+			case simd_isa::baseline: return __simd_kernels_baseline;
+			case simd_isa::avx2: return __simd_kernels_avx2;
+			case simd_isa::avx512: return __simd_kernels_avx512;
+			default: return nullptr;
+		}
+	}
+
+	auto __host_supports( simd_isa __isa ) LLVM_MSTL_NOEXCEPT->bool {
+#if defined( __x86_64__ ) && ( defined( __GNUC__ ) || defined( __clang__ ) )
+		//<--- from CPUID, and XGETBV for the OS saving the registers
+		switch ( __isa ) {
+			case simd_isa::baseline: return true;
+			case simd_isa::avx2: return __builtin_cpu_supports( "avx2" );
+			case simd_isa::avx512:
+				return __builtin_cpu_supports( "avx512f" ) && __builtin_cpu_supports( "avx512bw" ) && __builtin_cpu_supports( "avx512vl" );
+			default: return false;
+		}
+#else
+		return __isa == simd_isa::baseline;
+#endif
+	}
+
+	//<--- the best supported ISA, at most the one of `LLVM_MSTL_FORCE_ISA`
+	auto __startup_isa() LLVM_MSTL_NOEXCEPT->simd_isa {
+		auto        __cap    = simd_isa::avx512;
+		const char* __forced = core::getenv( "LLVM_MSTL_FORCE_ISA" );
+		for ( auto __isa : { simd_isa::baseline, simd_isa::avx2, simd_isa::avx512 } ) {
+			if ( __forced && core::strcmp( __forced, simd_isa_name( __isa ) ) == 0 ) __cap = __isa;
+		}
+		auto __isa = __cap;
+		while ( !simd_isa_supported( __isa ) ) __isa = static_cast< simd_isa >( static_cast< uint8_t >( __isa ) - 1 );
+		return __isa;
+	}
+
+	auto __resolve() LLVM_MSTL_NOEXCEPT->const __simd_kernel_set&;
+
+	//<--- the stubs of the table before the startup binding: they bind it, then forward the call
+	template < size_t _Wp >
+	auto __find_stub( const void* __first, size_t __n, uint64_t __v ) LLVM_MSTL_NOEXCEPT->size_t {
+		return __resolve().__find[ _Wp ]( __first, __n, __v );
+	}
+
+	template < size_t _Wp >
+	auto __count_stub( const void* __first, size_t __n, uint64_t __v ) LLVM_MSTL_NOEXCEPT->size_t {
+		return __resolve().__count[ _Wp ]( __first, __n, __v );
+	}
+
+	template < size_t _Wp >
+	auto __mismatch_stub( const void* __first1, const void* __first2, size_t __n ) LLVM_MSTL_NOEXCEPT->size_t {
+		return __resolve().__mismatch[ _Wp ]( __first1, __first2, __n );
+	}
+
+	template < size_t _Wp >
+	auto __fill_stub( void* __first, size_t __n, uint64_t __v ) LLVM_MSTL_NOEXCEPT->void {
+		__resolve().__fill[ _Wp ]( __first, __n, __v );
+	}
+
+	template < size_t _Wp >
+	auto __compact_stub( void* __out, const void* __first, size_t __n, const uint64_t* __keep ) LLVM_MSTL_NOEXCEPT->size_t {
+		return __resolve().__compact[ _Wp ]( __out, __first, __n, __keep );
+	}
+
+	template < size_t _Ip >
+	auto __min_element_stub( const void* __first, size_t __n ) LLVM_MSTL_NOEXCEPT->size_t {
+		return __resolve().__min_element[ _Ip ]( __first, __n );
+	}
+
+	template < size_t _Ip >
+	auto __max_element_stub( const void* __first, size_t __n ) LLVM_MSTL_NOEXCEPT->size_t {
+		return __resolve().__max_element[ _Ip ]( __first, __n );
+	}
+
+	template < size_t _Ip >
+	auto __minmax_element_stub( const void* __first, size_t __n ) LLVM_MSTL_NOEXCEPT->core::pair< size_t, size_t > {
+		return __resolve().__minmax_element[ _Ip ]( __first, __n );
+	}
+
+	auto __popcount_stub( const uint64_t* __p, size_t __n, uint64_t __flip ) LLVM_MSTL_NOEXCEPT->size_t {
+		return __resolve().__popcount( __p, __n, __flip );
+	}
+
+	template < size_t _Ip >
+	auto __combine_words_stub( uint64_t* __dst, const uint64_t* __src, size_t __n ) LLVM_MSTL_NOEXCEPT->void {
+		__resolve().__combine_words[ _Ip ]( __dst, __src, __n );
+	}
+
+	LLVM_MSTL_CONSTEXPR __simd_kernel_set __stubs{
+		simd_isa::baseline,
+		{ __find_stub< 0 >, __find_stub< 1 >, __find_stub< 2 >, __find_stub< 3 >, __find_stub< 4 >, __find_stub< 5 > },
+		{ __count_stub< 0 >, __count_stub< 1 >, __count_stub< 2 >, __count_stub< 3 >, __count_stub< 4 >, __count_stub< 5 > },
+		{ __mismatch_stub< 0 >, __mismatch_stub< 1 >, __mismatch_stub< 2 >, __mismatch_stub< 3 >, __mismatch_stub< 4 >, __mismatch_stub< 5 > },
+		{ __fill_stub< 0 >, __fill_stub< 1 >, __fill_stub< 2 >, __fill_stub< 3 > },
+		{ __compact_stub< 0 >, __compact_stub< 1 >, __compact_stub< 2 >, __compact_stub< 3 > },
+		{ __min_element_stub< 0 >, __min_element_stub< 1 >, __min_element_stub< 2 >, __min_element_stub< 3 >,
+		  __min_element_stub< 4 >, __min_element_stub< 5 >, __min_element_stub< 6 >, __min_element_stub< 7 > },
+		{ __max_element_stub< 0 >, __max_element_stub< 1 >, __max_element_stub< 2 >, __max_element_stub< 3 >,
+		  __max_element_stub< 4 >, __max_element_stub< 5 >, __max_element_stub< 6 >, __max_element_stub< 7 > },
+		{ __minmax_element_stub< 0 >, __minmax_element_stub< 1 >, __minmax_element_stub< 2 >, __minmax_element_stub< 3 >,
+		  __minmax_element_stub< 4 >, __minmax_element_stub< 5 >, __minmax_element_stub< 6 >, __minmax_element_stub< 7 > },
+		__popcount_stub,
+		{ __combine_words_stub< 0 >, __combine_words_stub< 1 >, __combine_words_stub< 2 >, __combine_words_stub< 3 > },
+	};
+
+	auto __resolve() LLVM_MSTL_NOEXCEPT->const __simd_kernel_set& {
+		static const __simd_kernel_set* const __startup  = __kernels_of( __startup_isa() );
+		const __simd_kernel_set*              __expected = &__stubs;
+		//<--- unless a test selected an ISA in the meantime
+		__simd_active_kernels.compare_exchange_strong( __expected, __startup, core::memory_order_relaxed );
+		return __simd_kernels();
+	}
+
+}// namespace
+
+constinit core::atomic< const __simd_kernel_set* > __simd_active_kernels{ &__stubs };
+
+//<--- the binding at startup, the stubs only cover the calls from the static constructors that run before it
+[[maybe_unused]] static const bool __simd_bound = ( __resolve(), true );
+
+auto simd_isa_supported( simd_isa __isa ) LLVM_MSTL_NOEXCEPT->bool { return __kernels_of( __isa ) != nullptr && __host_supports( __isa ); }
+
+auto simd_active_isa() LLVM_MSTL_NOEXCEPT->simd_isa { return __resolve().__isa; }
+
+auto simd_select_isa( simd_isa __isa ) LLVM_MSTL_NOEXCEPT->bool {
+	if ( !simd_isa_supported( __isa ) ) return false;
+	__resolve();
+	__simd_active_kernels.store( __kernels_of( __isa ), core::memory_order_relaxed );
+	return true;
+}
+
+auto simd_isa_name( simd_isa __isa ) LLVM_MSTL_NOEXCEPT->const char* {
+	switch ( __isa ) {
+		case simd_isa::baseline: return "baseline";
+		case simd_isa::avx2: return "avx2";
+		case simd_isa::avx512: return "avx512";
+		default: return "unknown";
+	}
+}
+
+LLVM_MSTL_END_NAMESPACE_STD
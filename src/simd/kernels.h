@@ -0,0 +1,123 @@
+#ifndef LLVM_MSTL_SRC_SIMD_KERNELS_H
+#define LLVM_MSTL_SRC_SIMD_KERNELS_H
+
+#include "__algorithm/simd_compact.h"
+#include "__algorithm/simd_dispatch.h"
+#include "__algorithm/simd_fill.h"
+#include "__algorithm/simd_search.h"
+#include "__algorithm/simd_words.h"
+#include "__config.h"
+
+#include <cstddef>
+#include <cstdint>
+
+LLVM_MSTL_BEGIN_NAMESPACE_STD
+LLVM_MSTL_CORE_STD
+
+/**
+ * @brief The kernels of `simd_search.h`, `simd_fill.h`, `simd_compact.h` and `simd_words.h` for one ISA, erased to the entries of a
+ * @ref __simd_kernel_set.
+ *
+ * Each `kernels_<isa>.cc` instantiates it with a tag of its own, built with the flags of its ISA, so the
+ * instantiations of two ISAs never merge into one symbol the linker could pick for the wrong host.
+ *
+ * Where the compiler cannot vectorize a kernel of the headers, the tag may carry one written with the intrinsics
+ * of its ISA: `_Isa::__compress< _Up >( __out, __first, __n, __keep )` replaces @ref __simd_compact for the widths it
+ * takes, `_Isa::__popcount( __p, __n, __flip )` replaces @ref __simd_popcount.
+ *
+ * @tparam _Isa The tag of the ISA.
+ */
+template < typename _Isa >
+struct __simd_kernels_of {
+	template < typename _Up >
+	static auto __find( const void* __first, size_t __n, uint64_t __v ) LLVM_MSTL_NOEXCEPT->size_t {
+		const auto* __p = static_cast< const _Up* >( __first );
+		return static_cast< size_t >( __simd_find< _Up, _Isa >( __p, __p + __n, __simd_from_bits< _Up >( __v ) ) - __p );
+	}
+
+	template < typename _Up >
+	static auto __count( const void* __first, size_t __n, uint64_t __v ) LLVM_MSTL_NOEXCEPT->size_t {
+		const auto* __p = static_cast< const _Up* >( __first );
+		return __simd_count< _Up, _Isa >( __p, __p + __n, __simd_from_bits< _Up >( __v ) );
+	}
+
+	template < typename _Up >
+	static auto __mismatch( const void* __first1, const void* __first2, size_t __n ) LLVM_MSTL_NOEXCEPT->size_t {
+		return __simd_mismatch_index< _Up, _Isa >( static_cast< const _Up* >( __first1 ), static_cast< const _Up* >( __first2 ), __n );
+	}
+
+	template < typename _Up >
+	static auto __fill( void* __first, size_t __n, uint64_t __v ) LLVM_MSTL_NOEXCEPT->void {
+		__simd_fill< _Up, _Isa >( static_cast< _Up* >( __first ), __n, static_cast< _Up >( __v ) );
+	}
+
+	template < typename _Up >
+	static auto __compact( void* __out, const void* __first, size_t __n, const uint64_t* __keep ) LLVM_MSTL_NOEXCEPT->size_t {
+		auto*       __o = static_cast< _Up* >( __out );
+		const auto* __p = static_cast< const _Up* >( __first );
+		if constexpr ( requires { _Isa::template __compress< _Up >( __o, __p, __n, __keep ); } )
+			return _Isa::template __compress< _Up >( __o, __p, __n, __keep );
+		else
+			return __simd_compact< _Up, _Isa >( __o, __p, __n, __keep );
+	}
+
+	template < typename _Up >
+	static auto __min_element( const void* __first, size_t __n ) LLVM_MSTL_NOEXCEPT->size_t {
+		const auto* __p = static_cast< const _Up* >( __first );
+		return static_cast< size_t >( __simd_min_element< _Up, _Isa >( __p, __p + __n ) - __p );
+	}
+
+	template < typename _Up >
+	static auto __max_element( const void* __first, size_t __n ) LLVM_MSTL_NOEXCEPT->size_t {
+		const auto* __p = static_cast< const _Up* >( __first );
+		return static_cast< size_t >( __simd_max_element< _Up, _Isa >( __p, __p + __n ) - __p );
+	}
+
+	template < typename _Up >
+	static auto __minmax_element( const void* __first, size_t __n ) LLVM_MSTL_NOEXCEPT->core::pair< size_t, size_t > {
+		const auto* __p           = static_cast< const _Up* >( __first );
+		const auto [ __lo, __hi ] = __simd_minmax_element< _Up, _Isa >( __p, __p + __n );
+		return { static_cast< size_t >( __lo - __p ), static_cast< size_t >( __hi - __p ) };
+	}
+
+	static auto __popcount( const uint64_t* __p, size_t __n, uint64_t __flip ) LLVM_MSTL_NOEXCEPT->size_t {
+		if constexpr ( requires { _Isa::__popcount( __p, __n, __flip ); } )
+			return _Isa::__popcount( __p, __n, __flip );
+		else
+			return __simd_popcount< _Isa >( __p, __n, __flip );
+	}
+
+	template < __simd_word_op _Op >
+	static auto __combine_words( uint64_t* __dst, const uint64_t* __src, size_t __n ) LLVM_MSTL_NOEXCEPT->void {
+		__simd_combine_words< _Op, _Isa >( __dst, __src, __n );
+	}
+
+	static LLVM_MSTL_CONSTEXPR auto __make( simd_isa __isa ) LLVM_MSTL_NOEXCEPT->__simd_kernel_set {
+		return __simd_kernel_set{
+			__isa,
+			{ __find< uint8_t >, __find< uint16_t >, __find< uint32_t >, __find< uint64_t >, __find< float >, __find< double > },
+			{ __count< uint8_t >, __count< uint16_t >, __count< uint32_t >, __count< uint64_t >, __count< float >, __count< double > },
+			{ __mismatch< uint8_t >, __mismatch< uint16_t >, __mismatch< uint32_t >, __mismatch< uint64_t >, __mismatch< float >, __mismatch< double > },
+			{ __fill< uint8_t >, __fill< uint16_t >, __fill< uint32_t >, __fill< uint64_t > },
+			{ __compact< uint8_t >, __compact< uint16_t >, __compact< uint32_t >, __compact< uint64_t > },
+			{ __min_element< uint8_t >, __min_element< uint16_t >, __min_element< uint32_t >, __min_element< uint64_t >,
+			  __min_element< int8_t >, __min_element< int16_t >, __min_element< int32_t >, __min_element< int64_t > },
+			{ __max_element< uint8_t >, __max_element< uint16_t >, __max_element< uint32_t >, __max_element< uint64_t >,
+			  __max_element< int8_t >, __max_element< int16_t >, __max_element< int32_t >, __max_element< int64_t > },
+			{ __minmax_element< uint8_t >, __minmax_element< uint16_t >, __minmax_element< uint32_t >, __minmax_element< uint64_t >,
+			  __minmax_element< int8_t >, __minmax_element< int16_t >, __minmax_element< int32_t >, __minmax_element< int64_t > },
+			__popcount,
+			{ __combine_words< __simd_word_op::__and >, __combine_words< __simd_word_op::__or >, __combine_words< __simd_word_op::__xor >,
+			  __combine_words< __simd_word_op::__andnot > },
+		};
+	}
+};
+
+//<--- the kernels of each ISA, null where the library is not built for it
+extern const __simd_kernel_set* const __simd_kernels_baseline;
+extern const __simd_kernel_set* const __simd_kernels_avx2;
+extern const __simd_kernel_set* const __simd_kernels_avx512;
+
+LLVM_MSTL_END_NAMESPACE_STD
+
+#endif//LLVM_MSTL_SRC_SIMD_KERNELS_H
@@ -0,0 +1,85 @@
+// built with -mavx2 on x86-64, see the CMakeLists.txt of the project
+#include "simd/kernels.h"
+
+#ifdef __AVX2__
+#include <array>
+#include <immintrin.h>
+#endif
+
+LLVM_MSTL_BEGIN_NAMESPACE_STD
+
+#ifdef __AVX2__
+namespace {
+	/**
+	 * @brief For each mask of the kept elements of a register, the 32-bit lanes to gather in front, as bytes.
+	 *
+	 * An element of `_Split` lanes moves as `_Split` consecutive lanes. The lanes past the kept ones are 0: they are
+	 * stored as well, but only over elements already read.
+	 */
+	template < size_t _Elems, size_t _Split >
+	LLVM_MSTL_CONSTEXPR auto __compress_permutations() LLVM_MSTL_NOEXCEPT->core::array< uint64_t, size_t( 1 ) << _Elems > {
+		core::array< uint64_t, size_t( 1 ) << _Elems > __t{};
+		for ( size_t __m = 0; __m != __t.size(); ++__m ) {
+			size_t __o = 0;
+			for ( size_t __k = 0; __k != _Elems; ++__k ) {
+				if ( ( ( __m >> __k ) & 1 ) == 0 ) continue;
+				for ( size_t __s = 0; __s != _Split; ++__s ) __t[ __m ] |= uint64_t( __k * _Split + __s ) << ( 8 * __o++ );
+			}
+		}
+		return __t;
+	}
+
+	struct __simd_avx2 {
+		//<--- `__simd_compact` by registers: the kept elements are permuted to the front and the whole register stored
+		template < typename _Up >
+			requires( sizeof( _Up ) == 4 || sizeof( _Up ) == 8 )
+		static auto __compress( _Up* __out, const _Up* __p, size_t __n, const uint64_t* __keep ) LLVM_MSTL_NOEXCEPT->size_t {
+			LLVM_MSTL_CONSTEXPR size_t             __elems = 32 / sizeof( _Up );
+			static LLVM_MSTL_CONSTEXPR const auto __perm  = __compress_permutations< __elems, sizeof( _Up ) / 4 >();
+
+			size_t __i = 0, __w = 0;
+			for ( ; __n - __i >= __elems; __i += __elems ) {
+				//<--- a register never straddles two words of the mask
+				const auto    __k   = static_cast< unsigned >( ( __keep[ __i / 64 ] >> ( __i % 64 ) ) & ( ( 1u << __elems ) - 1 ) );
+				const __m256i __x   = _mm256_loadu_si256( reinterpret_cast< const __m256i* >( __p + __i ) );
+				const __m256i __idx = _mm256_cvtepu8_epi32( _mm_cvtsi64_si128( static_cast< long long >( __perm[ __k ] ) ) );
+				_mm256_storeu_si256( reinterpret_cast< __m256i* >( __out + __w ), _mm256_permutevar8x32_epi32( __x, __idx ) );
+				__w += static_cast< size_t >( __builtin_popcount( __k ) );
+			}
+			for ( ; __i != __n; ++__i ) {
+				__out[ __w ] = __p[ __i ];
+				__w += static_cast< size_t >( ( __keep[ __i / 64 ] >> ( __i % 64 ) ) & 1 );
+			}
+			return __w;
+		}
+
+		//<--- `__simd_popcount` by registers: the count of each nibble from a 16-entry table, summed by `vpsadbw`
+		static auto __popcount( const uint64_t* __p, size_t __n, uint64_t __flip ) LLVM_MSTL_NOEXCEPT->size_t {
+			const __m256i __lut = _mm256_setr_epi8( 0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4, 0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4 );
+			const __m256i __low = _mm256_set1_epi8( 0x0f );
+			const __m256i __f   = _mm256_set1_epi64x( static_cast< long long >( __flip ) );
+			__m256i       __acc = _mm256_setzero_si256();
+			size_t        __i   = 0;
+			for ( ; __n - __i >= 4; __i += 4 ) {
+				const __m256i __x = _mm256_xor_si256( _mm256_loadu_si256( reinterpret_cast< const __m256i* >( __p + __i ) ), __f );
+				const __m256i __c = _mm256_add_epi8( _mm256_shuffle_epi8( __lut, _mm256_and_si256( __x, __low ) ),
+				                                     _mm256_shuffle_epi8( __lut, _mm256_and_si256( _mm256_srli_epi16( __x, 4 ), __low ) ) );
+				__acc             = _mm256_add_epi64( __acc, _mm256_sad_epu8( __c, _mm256_setzero_si256() ) );
+			}
+			alignas( 32 ) uint64_t __lanes[ 4 ];
+			_mm256_store_si256( reinterpret_cast< __m256i* >( __lanes ), __acc );
+			size_t __r = static_cast< size_t >( __lanes[ 0 ] + __lanes[ 1 ] + __lanes[ 2 ] + __lanes[ 3 ] );
+			for ( ; __i != __n; ++__i ) __r += static_cast< size_t >( core::popcount( __p[ __i ] ^ __flip ) );
+			return __r;
+		}
+	};
+
+	LLVM_MSTL_CONSTEXPR __simd_kernel_set __kernels = __simd_kernels_of< __simd_avx2 >::__make( simd_isa::avx2 );
+}// namespace
+
+const __simd_kernel_set* const __simd_kernels_avx2 = &__kernels;
+#else
+const __simd_kernel_set* const __simd_kernels_avx2 = nullptr;
+#endif
+
+LLVM_MSTL_END_NAMESPACE_STD
@@ -0,0 +1,63 @@
+// built with -mavx512f -mavx512bw -mavx512vl on x86-64, see the CMakeLists.txt of the project
+#include "simd/kernels.h"
+
+#if defined( __AVX512F__ ) && defined( __AVX512BW__ ) && defined( __AVX512VL__ )
+#include <immintrin.h>
+#endif
+
+LLVM_MSTL_BEGIN_NAMESPACE_STD
+
+#if defined( __AVX512F__ ) && defined( __AVX512BW__ ) && defined( __AVX512VL__ )
+namespace {
+	struct __simd_avx512 {
+		//<--- `__simd_compact` by registers, with the compress of AVX-512 F; the bytes and words would need VBMI2
+		template < typename _Up >
+			requires( sizeof( _Up ) == 4 || sizeof( _Up ) == 8 )
+		static auto __compress( _Up* __out, const _Up* __p, size_t __n, const uint64_t* __keep ) LLVM_MSTL_NOEXCEPT->size_t {
+			LLVM_MSTL_CONSTEXPR size_t __elems = 64 / sizeof( _Up );
+
+			size_t __i = 0, __w = 0;
+			for ( ; __n - __i >= __elems; __i += __elems ) {
+				const auto    __k = static_cast< unsigned >( ( __keep[ __i / 64 ] >> ( __i % 64 ) ) & ( ( 1u << __elems ) - 1 ) );
+				const __m512i __x = _mm512_loadu_si512( __p + __i );
+				if constexpr ( sizeof( _Up ) == 4 )
+					_mm512_storeu_si512( __out + __w, _mm512_maskz_compress_epi32( static_cast< __mmask16 >( __k ), __x ) );
+				else
+					_mm512_storeu_si512( __out + __w, _mm512_maskz_compress_epi64( static_cast< __mmask8 >( __k ), __x ) );
+				__w += static_cast< size_t >( __builtin_popcount( __k ) );
+			}
+			for ( ; __i != __n; ++__i ) {
+				__out[ __w ] = __p[ __i ];
+				__w += static_cast< size_t >( ( __keep[ __i / 64 ] >> ( __i % 64 ) ) & 1 );
+			}
+			return __w;
+		}
+
+		//<--- `__simd_popcount` by registers, the nibble table of AVX2 with the byte shuffles of AVX-512 BW
+		static auto __popcount( const uint64_t* __p, size_t __n, uint64_t __flip ) LLVM_MSTL_NOEXCEPT->size_t {
+			const __m512i __lut = _mm512_broadcast_i32x4( _mm_setr_epi8( 0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4 ) );
+			const __m512i __low = _mm512_set1_epi8( 0x0f );
+			const __m512i __f   = _mm512_set1_epi64( static_cast< long long >( __flip ) );
+			__m512i       __acc = _mm512_setzero_si512();
+			size_t        __i   = 0;
+			for ( ; __n - __i >= 8; __i += 8 ) {
+				const __m512i __x = _mm512_xor_si512( _mm512_loadu_si512( __p + __i ), __f );
+				const __m512i __c = _mm512_add_epi8( _mm512_shuffle_epi8( __lut, _mm512_and_si512( __x, __low ) ),
+				                                     _mm512_shuffle_epi8( __lut, _mm512_and_si512( _mm512_srli_epi16( __x, 4 ), __low ) ) );
+				__acc             = _mm512_add_epi64( __acc, _mm512_sad_epu8( __c, _mm512_setzero_si512() ) );
+			}
+			size_t __r = static_cast< size_t >( _mm512_reduce_add_epi64( __acc ) );
+			for ( ; __i != __n; ++__i ) __r += static_cast< size_t >( core::popcount( __p[ __i ] ^ __flip ) );
+			return __r;
+		}
+	};
+
+	LLVM_MSTL_CONSTEXPR __simd_kernel_set __kernels = __simd_kernels_of< __simd_avx512 >::__make( simd_isa::avx512 );
+}// namespace
+
+const __simd_kernel_set* const __simd_kernels_avx512 = &__kernels;
+#else
+const __simd_kernel_set* const __simd_kernels_avx512 = nullptr;
+#endif
+
+LLVM_MSTL_END_NAMESPACE_STD
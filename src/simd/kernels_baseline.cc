@@ -0,0 +1,13 @@
+#include "simd/kernels.h"
+
+LLVM_MSTL_BEGIN_NAMESPACE_STD
+
+namespace {
+	struct __simd_baseline {};
+
+	LLVM_MSTL_CONSTEXPR __simd_kernel_set __kernels = __simd_kernels_of< __simd_baseline >::__make( simd_isa::baseline );
+}// namespace
+
+const __simd_kernel_set* const __simd_kernels_baseline = &__kernels;
+
+LLVM_MSTL_END_NAMESPACE_STD
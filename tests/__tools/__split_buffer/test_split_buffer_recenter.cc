@@ -0,0 +1,149 @@
+#include "__split_buffer.h"
+#include "gtest/gtest.h"
+
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <random>
+
+static core::random_device                       rd;
+static core::mt19937                             generator( rd() );
+static core::uniform_int_distribution< int64_t > distribution( 0 );
+
+//<--- counts every element it is moved or copied into, so a test can bound the work of the relayouts
+struct __counted {
+	static inline size_t __moves = 0;
+
+	int64_t __v = 0;
+
+	__counted( int64_t __x )
+			: __v( __x ) {}
+	__counted( const __counted& __x )
+			: __v( __x.__v ) { ++__moves; }
+	__counted( __counted&& __x ) noexcept
+			: __v( __x.__v ) { ++__moves; }
+	auto operator=( const __counted& __x ) -> __counted& {
+		__v = __x.__v;
+		++__moves;
+		return *this;
+	}
+	auto operator=( __counted&& __x ) noexcept -> __counted& {
+		__v = __x.__v;
+		++__moves;
+		return *this;
+	}
+};
+
+static_assert( !nya::__split_buffer< __counted >::__relocate_by_memmove );
+static_assert( nya::__split_buffer< int64_t >::__relocate_by_memmove );
+
+static auto __value( const __counted& __x ) -> int64_t { return __x.__v; }
+static auto __value( int64_t __x ) -> int64_t { return __x; }
+
+template < typename _Buffer >
+static auto __same( const core::deque< int64_t >& __expect, const _Buffer& __buffer ) -> bool {
+	if ( __expect.size() != __buffer.size() ) return false;
+	for ( size_t i = 0; i < __expect.size(); i++ ) {
+		if ( __value( __buffer.__begin[ i ] ) != __expect[ i ] ) return false;
+	}
+	return true;
+}
+
+//<--- one push at each end in turn: every relayout must buy a number of pushes proportional to the size
+TEST( SPLIT_BUFFER_RECENTER, adversarial_alternating_pushes ) {
+	const size_t                     __pushes = 200000;
+	nya::__split_buffer< __counted > __buffer;
+	core::deque< int64_t >           __expect;
+
+	__counted::__moves = 0;
+	for ( size_t i = 0; i < __pushes; i++ ) {
+		const auto __x = static_cast< int64_t >( i );
+		if ( i % 2 == 0 ) {
+			__buffer.push_front( __counted( __x ) );
+			__expect.push_front( __x );
+		} else {
+			__buffer.push_back( __counted( __x ) );
+			__expect.push_back( __x );
+		}
+	}
+	//<--- one move to put each pushed temporary in place, the rest is the relayouts
+	EXPECT_LE( __counted::__moves, 24 * __pushes );
+	EXPECT_TRUE( __same( __expect, __buffer ) );
+}
+
+//<--- pushes at one end until the buffer lays itself out again, then at the other end, and so on
+TEST( SPLIT_BUFFER_RECENTER, adversarial_ping_pong_bursts ) {
+	const size_t                     __pushes = 200000;
+	nya::__split_buffer< __counted > __buffer;
+	core::deque< int64_t >           __expect;
+	for ( int64_t i = 0; i < 1024; i++ ) {
+		__buffer.push_back( __counted( i ) );
+		__expect.push_back( i );
+	}
+
+	__counted::__moves = 0;
+	bool __at_front    = true;
+	for ( size_t i = 0; i < __pushes; i++ ) {
+		const auto __x = static_cast< int64_t >( i );
+		if ( __at_front ) {
+			const bool __full = __buffer.__front_spare() == 0;
+			__buffer.push_front( __counted( __x ) );
+			__expect.push_front( __x );
+			if ( __full ) __at_front = false;
+		} else {
+			const bool __full = __buffer.__back_spare() == 0;
+			__buffer.push_back( __counted( __x ) );
+			__expect.push_back( __x );
+			if ( __full ) __at_front = true;
+		}
+	}
+	EXPECT_LE( __counted::__moves, 24 * __pushes );
+	EXPECT_TRUE( __same( __expect, __buffer ) );
+}
+
+//<--- a queue turning the other way round, the pops keep handing back the slots the pushes need
+TEST( SPLIT_BUFFER_RECENTER, queue_keeps_capacity ) {
+	nya::__split_buffer< int64_t > __buffer;
+	core::deque< int64_t >         __expect;
+	for ( int64_t i = 0; i < 100; i++ ) {
+		__buffer.push_back( i );
+		__expect.push_back( i );
+	}
+
+	size_t __cap = 0;
+	for ( int64_t i = 0; i < 1000000; i++ ) {
+		const auto __x = distribution( generator );
+		__buffer.push_front( __x );
+		__expect.push_front( __x );
+		__buffer.pop_back();
+		__expect.pop_back();
+		if ( i == 1000 ) __cap = __buffer.capacity();
+	}
+	EXPECT_EQ( __cap, __buffer.capacity() );
+	EXPECT_TRUE( __same( __expect, __buffer ) );
+}
+
+TEST( SPLIT_BUFFER_RECENTER, memmove_keeps_order ) {
+	nya::__split_buffer< int64_t > __buffer;
+	core::deque< int64_t >         __expect;
+	for ( size_t i = 0; i < 100000; i++ ) {
+		const auto __x = distribution( generator );
+		switch ( __x % 4 ) {
+			case 0:
+				__buffer.push_front( __x );
+				__expect.push_front( __x );
+				break;
+			case 1:
+				if ( !__expect.empty() ) {
+					__buffer.pop_back();
+					__expect.pop_back();
+				}
+				break;
+			default:
+				__buffer.emplace_back( __x );
+				__expect.push_back( __x );
+				break;
+		}
+	}
+	EXPECT_TRUE( __same( __expect, __buffer ) );
+}
@@ -0,0 +1,140 @@
+#include "algorithm.hpp"
+#include "dynamic_bitset.hpp"
+#include "vector.hpp"
+#include "gtest/gtest.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <random>
+#include <vector>
+
+namespace core = std;
+
+static core::random_device rd;
+static core::mt19937_64    generator( rd() );
+
+static const nya::simd_isa __all_isas[] = { nya::simd_isa::baseline, nya::simd_isa::avx2, nya::simd_isa::avx512 };
+
+//<--- the dispatched kernels of one element width against `core`, on both sides of the block boundaries
+template < typename _Tp >
+static auto __against_std( nya::simd_isa __isa ) -> void {
+	for ( size_t __n : { 0, 1, 31, 32, 33, 64, 100, 1000, 4097 } ) {
+		core::vector< _Tp > __v( __n );
+		for ( auto& __x : __v ) __x = static_cast< _Tp >( generator() % 11 );
+		for ( int __k = -1; __k != 12; ++__k ) {
+			const auto __x = static_cast< _Tp >( __k );
+			ASSERT_EQ( nya::find( __v.begin(), __v.end(), __x ), core::find( __v.begin(), __v.end(), __x ) ) << nya::simd_isa_name( __isa ) << " n " << __n;
+			ASSERT_EQ( nya::count( __v.begin(), __v.end(), __x ), core::count( __v.begin(), __v.end(), __x ) ) << nya::simd_isa_name( __isa ) << " n " << __n;
+
+			auto __expect = __v;
+			__expect.erase( core::remove( __expect.begin(), __expect.end(), __x ), __expect.end() );
+			nya::vector< _Tp, core::allocator< _Tp > > __r( __v.begin(), __v.end() );
+			nya::erase_if( __r, [ __x ]( _Tp __e ) { return __e == __x; } );
+			ASSERT_TRUE( core::equal( __r.begin(), __r.end(), __expect.begin(), __expect.end() ) ) << nya::simd_isa_name( __isa ) << " n " << __n;
+
+			core::vector< size_t > __idx;
+			for ( size_t __i = 0; __i != __n; ++__i ) {
+				if ( __v[ __i ] == __x ) __idx.insert( __idx.end(), 1 + __i % 2, __i );
+			}
+			nya::vector< _Tp, core::allocator< _Tp > > __s( __v.begin(), __v.end() );
+			__s.erase_indices( __idx.begin(), __idx.end() );
+			ASSERT_TRUE( core::equal( __s.begin(), __s.end(), __expect.begin(), __expect.end() ) ) << nya::simd_isa_name( __isa ) << " n " << __n;
+		}
+		for ( size_t __i = 0; __i < __n; __i += 1 + __n / 7 ) {
+			auto __w   = __v;
+			__w[ __i ] = static_cast< _Tp >( __w[ __i ] ^ 0x40 );
+			ASSERT_EQ( nya::mismatch( __v.begin(), __v.end(), __w.begin() ), core::mismatch( __v.begin(), __v.end(), __w.begin() ) )
+				<< nya::simd_isa_name( __isa ) << " n " << __n;
+			ASSERT_EQ( nya::lexicographical_compare( __v.begin(), __v.end(), __w.begin(), __w.end() ),
+			           core::lexicographical_compare( __v.begin(), __v.end(), __w.begin(), __w.end() ) );
+		}
+		ASSERT_EQ( nya::min_element( __v.begin(), __v.end() ), core::min_element( __v.begin(), __v.end() ) ) << nya::simd_isa_name( __isa ) << " n " << __n;
+		ASSERT_EQ( nya::max_element( __v.begin(), __v.end() ), core::max_element( __v.begin(), __v.end() ) ) << nya::simd_isa_name( __isa ) << " n " << __n;
+		ASSERT_EQ( nya::minmax_element( __v.begin(), __v.end() ), core::minmax_element( __v.begin(), __v.end() ) );
+	}
+}
+
+//<--- the searches of the floats keep `==`: `-0.0` finds `0.0`, a NaN finds nothing and never matches itself
+template < typename _Tp >
+static auto __reals_against_std( nya::simd_isa __isa ) -> void {
+	const _Tp __nan = core::numeric_limits< _Tp >::quiet_NaN();
+	for ( size_t __n : { 0, 1, 31, 32, 33, 100, 1000 } ) {
+		core::vector< _Tp > __v( __n );
+		for ( auto& __x : __v ) __x = static_cast< _Tp >( generator() % 11 ) - _Tp( 5 );
+		for ( size_t __i = 0; __i < __n; __i += 7 ) __v[ __i ] = __i % 2 ? __nan : _Tp( -0.0 );
+		for ( const _Tp __x : { _Tp( 0 ), _Tp( 3 ), _Tp( -5 ), _Tp( 9 ), __nan } ) {
+			ASSERT_EQ( nya::find( __v.begin(), __v.end(), __x ), core::find( __v.begin(), __v.end(), __x ) ) << nya::simd_isa_name( __isa ) << " n " << __n;
+			ASSERT_EQ( nya::count( __v.begin(), __v.end(), __x ), core::count( __v.begin(), __v.end(), __x ) ) << nya::simd_isa_name( __isa ) << " n " << __n;
+		}
+		const auto __w = __v;
+		ASSERT_EQ( nya::mismatch( __v.begin(), __v.end(), __w.begin() ), core::mismatch( __v.begin(), __v.end(), __w.begin() ) )
+			<< nya::simd_isa_name( __isa ) << " n " << __n;
+	}
+}
+
+//<--- the word kernels of the bitsets and of vector<bool> against a bit by bit model, on both sides of a register of words
+static auto __words_against_bits( nya::simd_isa __isa ) -> void {
+	for ( size_t __n : { 0, 1, 63, 64, 65, 255, 256, 257, 511, 512, 513, 10007 } ) {
+		core::vector< bool > __xa( __n ), __xb( __n );
+		nya::dynamic_bitset<> __a( __n ), __b( __n );
+		for ( size_t __i = 0; __i != __n; ++__i ) {
+			__xa[ __i ] = generator() % 3 == 0;
+			__xb[ __i ] = generator() % 2 == 0;
+			__a.set( __i, __xa[ __i ] );
+			__b.set( __i, __xb[ __i ] );
+		}
+		ASSERT_EQ( static_cast< size_t >( core::count( __xa.begin(), __xa.end(), true ) ), __a.count() ) << nya::simd_isa_name( __isa ) << " n " << __n;
+		//<--- vector<bool> counts from an unaligned start, so the kernel sees the whole words between two partial ones
+		const nya::vector< bool, core::allocator< bool > > __v( __xa.begin(), __xa.end() );
+		for ( size_t __off : { 0, 1, 63 } ) {
+			if ( __off > __n ) continue;
+			for ( bool __value : { true, false } ) {
+				ASSERT_EQ( core::count( __xa.begin() + __off, __xa.end(), __value ), nya::count( __v.begin() + __off, __v.end(), __value ) )
+					<< nya::simd_isa_name( __isa ) << " n " << __n << " off " << __off;
+			}
+		}
+		const nya::dynamic_bitset<> __and = __a & __b, __or = __a | __b, __xor = __a ^ __b, __diff = __a - __b;
+		for ( size_t __i = 0; __i != __n; ++__i ) {
+			ASSERT_EQ( __xa[ __i ] && __xb[ __i ], __and.test( __i ) ) << nya::simd_isa_name( __isa ) << " n " << __n;
+			ASSERT_EQ( __xa[ __i ] || __xb[ __i ], __or.test( __i ) ) << nya::simd_isa_name( __isa ) << " n " << __n;
+			ASSERT_EQ( __xa[ __i ] != __xb[ __i ], __xor.test( __i ) ) << nya::simd_isa_name( __isa ) << " n " << __n;
+			ASSERT_EQ( __xa[ __i ] && !__xb[ __i ], __diff.test( __i ) ) << nya::simd_isa_name( __isa ) << " n " << __n;
+		}
+	}
+}
+
+TEST( SIMD_DISPATCH, every_supported_isa ) {
+	const nya::simd_isa __startup = nya::simd_active_isa();
+	EXPECT_TRUE( nya::simd_isa_supported( __startup ) );
+	EXPECT_TRUE( nya::simd_isa_supported( nya::simd_isa::baseline ) );
+	//<--- the startup binding is the best ISA, unless `LLVM_MSTL_FORCE_ISA` caps it
+	if ( core::getenv( "LLVM_MSTL_FORCE_ISA" ) == nullptr ) {
+		for ( auto __isa : __all_isas ) {
+			if ( nya::simd_isa_supported( __isa ) ) {
+				EXPECT_GE( static_cast< int >( __startup ), static_cast< int >( __isa ) );
+			}
+		}
+	}
+
+	for ( auto __isa : __all_isas ) {
+		if ( !nya::simd_isa_supported( __isa ) ) {
+			EXPECT_FALSE( nya::simd_select_isa( __isa ) );
+			continue;
+		}
+		ASSERT_TRUE( nya::simd_select_isa( __isa ) );
+		ASSERT_EQ( nya::simd_active_isa(), __isa );
+		__against_std< uint8_t >( __isa );
+		__against_std< int8_t >( __isa );
+		__against_std< int16_t >( __isa );
+		__against_std< uint16_t >( __isa );
+		__against_std< int32_t >( __isa );
+		__against_std< uint32_t >( __isa );
+		__against_std< int64_t >( __isa );
+		__against_std< uint64_t >( __isa );
+		__reals_against_std< float >( __isa );
+		__reals_against_std< double >( __isa );
+		__words_against_bits( __isa );
+	}
+	EXPECT_TRUE( nya::simd_select_isa( __startup ) );
+}
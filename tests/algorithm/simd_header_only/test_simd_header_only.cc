@@ -0,0 +1,55 @@
+//<--- the whole binary is header-only: no translation unit of it calls the kernels of the library
+#define LLVM_MSTL_HEADER_ONLY
+
+#include "algorithm.hpp"
+#include "vector.hpp"
+#include "gtest/gtest.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+namespace core = std;
+
+static core::random_device rd;
+static core::mt19937_64    generator( rd() );
+
+static_assert( !nya::__simd_dispatched );
+
+//<--- the native kernels of one element width against `core`, on both sides of the block boundaries
+template < typename _Tp >
+static auto __against_std() -> void {
+	for ( size_t __n : { 0, 1, 31, 32, 33, 64, 100, 1000, 4097 } ) {
+		core::vector< _Tp > __v( __n );
+		for ( auto& __x : __v ) __x = static_cast< _Tp >( generator() % 11 );
+		for ( int __k = -1; __k != 12; ++__k ) {
+			const auto __x = static_cast< _Tp >( __k );
+			ASSERT_EQ( nya::find( __v.begin(), __v.end(), __x ), core::find( __v.begin(), __v.end(), __x ) ) << "n " << __n;
+			ASSERT_EQ( nya::count( __v.begin(), __v.end(), __x ), core::count( __v.begin(), __v.end(), __x ) ) << "n " << __n;
+
+			auto __expect = __v;
+			__expect.erase( core::remove( __expect.begin(), __expect.end(), __x ), __expect.end() );
+			nya::vector< _Tp, core::allocator< _Tp > > __r( __v.begin(), __v.end() );
+			nya::erase_if( __r, [ __x ]( _Tp __e ) { return __e == __x; } );
+			ASSERT_TRUE( core::equal( __r.begin(), __r.end(), __expect.begin(), __expect.end() ) ) << "n " << __n;
+		}
+		for ( size_t __i = 0; __i < __n; __i += 1 + __n / 7 ) {
+			auto __w   = __v;
+			__w[ __i ] = static_cast< _Tp >( __w[ __i ] ^ 0x40 );
+			ASSERT_EQ( nya::mismatch( __v.begin(), __v.end(), __w.begin() ), core::mismatch( __v.begin(), __v.end(), __w.begin() ) ) << "n " << __n;
+		}
+
+		const _Tp                             __x = static_cast< _Tp >( generator() );
+		nya::vector< _Tp, core::allocator< _Tp > > __f( __n, __x );
+		ASSERT_EQ( __f.size(), __n );
+		for ( size_t __i = 0; __i != __n; ++__i ) ASSERT_EQ( __f[ __i ], __x ) << "n " << __n << " at " << __i;
+	}
+}
+
+TEST( SIMD_HEADER_ONLY, native_kernels ) {
+	__against_std< uint8_t >();
+	__against_std< int16_t >();
+	__against_std< uint32_t >();
+	__against_std< int64_t >();
+}
@@ -0,0 +1,111 @@
+#include "algorithm.hpp"
+#include "gtest/gtest.h"
+#include "vector.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <random>
+#include <span>
+#include <vector>
+
+namespace core = std;
+
+static core::random_device rd;
+static core::mt19937_64    generator( rd() );
+
+//<--- every kernel against its `core` algorithm on one element width, over the block boundaries and past them
+template < typename _Tp >
+static auto __against_std() -> void {
+	for ( size_t __n : { 0, 1, 7, 63, 64, 65, 200, 1000 } ) {
+		core::vector< _Tp > __v( __n );
+		//<--- few distinct values, so every search hits somewhere, often more than once
+		for ( auto& __x : __v ) __x = static_cast< _Tp >( generator() % 13 );
+		const core::span< const _Tp > __s( __v );
+
+		for ( int __k = 0; __k != 14; ++__k ) {
+			const auto __x = static_cast< _Tp >( __k );
+			EXPECT_EQ( nya::find( __s.begin(), __s.end(), __x ), core::find( __s.begin(), __s.end(), __x ) ) << __n;
+			EXPECT_EQ( nya::count( __v.begin(), __v.end(), __x ), core::count( __v.begin(), __v.end(), __x ) ) << __n;
+		}
+		EXPECT_EQ( nya::min_element( __v.begin(), __v.end() ), core::min_element( __v.begin(), __v.end() ) );
+		EXPECT_EQ( nya::max_element( __v.begin(), __v.end() ), core::max_element( __v.begin(), __v.end() ) );
+		EXPECT_EQ( nya::minmax_element( __v.begin(), __v.end() ), core::minmax_element( __v.begin(), __v.end() ) );
+
+		auto __w = __v;
+		EXPECT_TRUE( nya::equal( __v.begin(), __v.end(), __w.begin() ) );
+		EXPECT_FALSE( nya::lexicographical_compare( __v.begin(), __v.end(), __w.begin(), __w.end() ) );
+		for ( size_t __i : { size_t( 0 ), __n / 2, __n - 1 } ) {
+			if ( __n == 0 ) break;
+			__w = __v;
+			__w[ __i ] = static_cast< _Tp >( __w[ __i ] + 1 );
+			EXPECT_EQ( nya::mismatch( __v.begin(), __v.end(), __w.begin() ), core::mismatch( __v.begin(), __v.end(), __w.begin() ) );
+			EXPECT_FALSE( nya::equal( __v.begin(), __v.end(), __w.begin(), __w.end() ) );
+			EXPECT_TRUE( nya::lexicographical_compare( __v.begin(), __v.end(), __w.begin(), __w.end() ) );
+			EXPECT_FALSE( nya::lexicographical_compare( __w.begin(), __w.end(), __v.begin(), __v.end() ) );
+		}
+		//<--- a prefix is less
+		EXPECT_EQ( nya::lexicographical_compare( __v.begin(), __v.begin() + static_cast< core::ptrdiff_t >( __n / 2 ), __v.begin(), __v.end() ), __n / 2 != __n );
+	}
+}
+
+TEST( SIMD_SEARCH, element_widths ) {
+	__against_std< uint8_t >();
+	__against_std< int8_t >();
+	__against_std< char >();
+	__against_std< int16_t >();
+	__against_std< uint16_t >();
+	__against_std< int32_t >();
+	__against_std< uint32_t >();
+	__against_std< int64_t >();
+	__against_std< uint64_t >();
+	__against_std< float >();
+	__against_std< double >();
+}
+
+TEST( SIMD_SEARCH, signed_order_and_float_semantics ) {
+	//<--- `memcmp` would order -1 after 1
+	const core::vector< int8_t > __a{ 1, -1 }, __b{ 1, 1 };
+	EXPECT_TRUE( nya::lexicographical_compare( __a.begin(), __a.end(), __b.begin(), __b.end() ) );
+
+	const double           __nan = core::numeric_limits< double >::quiet_NaN();
+	core::vector< double > __d( 100, 1.0 );
+	__d[ 70 ] = -0.0;
+	__d[ 80 ] = __nan;
+	EXPECT_EQ( nya::find( __d.begin(), __d.end(), 0.0 ) - __d.begin(), 70 );//<--- -0.0 == 0.0
+	EXPECT_EQ( nya::find( __d.begin(), __d.end(), __nan ), __d.end() );
+	EXPECT_EQ( nya::count( __d.begin(), __d.end(), 1.0 ), 98 );
+
+	auto __e = __d;
+	__e[ 70 ] = 0.0;
+	EXPECT_FALSE( nya::equal( __d.begin(), __d.end(), __e.begin() ) );//<--- the NaN
+	EXPECT_EQ( nya::mismatch( __d.begin(), __d.end(), __e.begin() ).first - __d.begin(), 80 );
+	//<--- the NaNs are equivalent, the compare goes on past them to the last element
+	__e[ 99 ] = 2.0;
+	EXPECT_TRUE( nya::lexicographical_compare( __d.begin(), __d.end(), __e.begin(), __e.end() ) );
+	EXPECT_EQ( core::lexicographical_compare( __d.begin(), __d.end(), __e.begin(), __e.end() ), true );
+}
+
+TEST( SIMD_SEARCH, vector_comparisons ) {
+	using __bytes = nya::vector< uint8_t, core::allocator< uint8_t > >;
+	using __reals = nya::vector< double, core::allocator< double > >;
+
+	__bytes __a( 300, 7 ), __b( 300, 7 );
+	EXPECT_TRUE( __a == __b );
+	EXPECT_FALSE( __a < __b );
+	__b[ 299 ] = 8;
+	EXPECT_TRUE( __a != __b );
+	EXPECT_TRUE( __a < __b );
+	EXPECT_TRUE( __b > __a );
+	__b.pop_back();
+	EXPECT_TRUE( __b < __a );//<--- a prefix
+	EXPECT_TRUE( __bytes() == __bytes() );
+	EXPECT_TRUE( __bytes() < __a );
+
+	__reals __x( 100, 0.0 ), __y( 100, -0.0 );
+	EXPECT_TRUE( __x == __y );
+	__x[ 50 ] = core::numeric_limits< double >::quiet_NaN();
+	EXPECT_FALSE( __x == __x );
+	EXPECT_FALSE( __x < __x );
+}
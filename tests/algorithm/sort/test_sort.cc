@@ -0,0 +1,151 @@
+#include "algorithm.hpp"
+#include "gtest/gtest.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <memory>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace core = std;
+
+static core::random_device rd;
+static core::mt19937_64    generator( rd() );
+
+using __values = nya::vector< uint64_t, core::allocator< uint64_t > >;
+
+//<--- the distributions of the keys: uniform, a few hot values, sorted, reversed and sorted with a few swaps
+static auto __distributions( size_t __n ) -> core::vector< core::vector< uint64_t > > {
+	core::vector< core::vector< uint64_t > > __out( 5, core::vector< uint64_t >( __n ) );
+	core::geometric_distribution< uint64_t > __skew( 0.2 );
+	for ( size_t __i = 0; __i != __n; ++__i ) {
+		__out[ 0 ][ __i ] = generator();
+		__out[ 1 ][ __i ] = __skew( generator ) << 40;
+		__out[ 2 ][ __i ] = __i;
+		__out[ 3 ][ __i ] = __n - __i;
+		__out[ 4 ][ __i ] = __i * 3;
+	}
+	for ( size_t __i = 0; __i + 1 < __n; __i += 97 ) core::swap( __out[ 4 ][ __i ], __out[ 4 ][ __i + 1 ] );
+	return __out;
+}
+
+template < size_t _DigitBits >
+static auto __radix_against_std( size_t __n ) -> void {
+	for ( auto& __keys : __distributions( __n ) ) {
+		__values __v( __keys.begin(), __keys.end() );
+		nya::radix_sort< _DigitBits >( __v );
+		core::sort( __keys.begin(), __keys.end() );
+		ASSERT_TRUE( core::equal( __keys.begin(), __keys.end(), __v.begin(), __v.end() ) ) << "n " << __n << " digit " << _DigitBits;
+	}
+}
+
+TEST( SORT, radix_sort_distributions ) {
+	for ( size_t __n : { 0, 1, 2, 63, 64, 1000, 100000 } ) {
+		__radix_against_std< 8 >( __n );
+		__radix_against_std< 11 >( __n );
+		__radix_against_std< 16 >( __n );
+	}
+}
+
+TEST( SORT, radix_sort_signed_and_float_keys ) {
+	core::uniform_int_distribution< int32_t > __ints( core::numeric_limits< int32_t >::min(), core::numeric_limits< int32_t >::max() );
+	core::normal_distribution< double >       __reals( 0, 1e6 );
+
+	core::vector< int32_t > __i( 5000 );
+	for ( auto& __x : __i ) __x = __ints( generator );
+	__i[ 0 ] = core::numeric_limits< int32_t >::min();
+	__i[ 1 ] = core::numeric_limits< int32_t >::max();
+	auto __i_expect = __i;
+	nya::radix_sort( __i.begin(), __i.end() );
+	core::sort( __i_expect.begin(), __i_expect.end() );
+	EXPECT_EQ( __i, __i_expect );
+
+	core::vector< double > __d( 5000 );
+	for ( auto& __x : __d ) __x = __reals( generator );
+	__d[ 0 ] = -0.0;
+	__d[ 1 ] = core::numeric_limits< double >::infinity();
+	__d[ 2 ] = -core::numeric_limits< double >::infinity();
+	__d[ 3 ] = core::numeric_limits< double >::denorm_min();
+	auto __d_expect = __d;
+	nya::radix_sort< 11 >( __d.begin(), __d.end() );
+	core::sort( __d_expect.begin(), __d_expect.end() );
+	EXPECT_EQ( __d, __d_expect );
+}
+
+struct __record {
+	int32_t      __key;
+	size_t       __seq;
+	core::string __name;
+};
+
+TEST( SORT, radix_sort_key_extractor_is_stable ) {
+	core::uniform_int_distribution< int32_t > __keys( -50, 50 );
+	for ( size_t __n : { 10, 5000 } ) {
+		nya::vector< __record, core::allocator< __record > > __v;
+		for ( size_t __s = 0; __s != __n; ++__s ) {
+			const int32_t __k = __keys( generator );
+			__v.push_back( __record{ __k, __s, "record " + core::to_string( __k ) + " with a name past the small buffer" } );
+		}
+		nya::radix_sort( __v, &__record::__key );
+		for ( size_t __s = 0; __s != __n; ++__s ) EXPECT_EQ( __v[ __s ].__name, "record " + core::to_string( __v[ __s ].__key ) + " with a name past the small buffer" );
+		for ( size_t __s = 1; __s < __n; ++__s ) {
+			ASSERT_LE( __v[ __s - 1 ].__key, __v[ __s ].__key );
+			if ( __v[ __s - 1 ].__key == __v[ __s ].__key ) {
+				ASSERT_LT( __v[ __s - 1 ].__seq, __v[ __s ].__seq );
+			}
+		}
+	}
+
+	//<--- a key by value, descending
+	core::vector< uint32_t > __d( 1000 );
+	for ( auto& __x : __d ) __x = static_cast< uint32_t >( generator() );
+	nya::radix_sort( __d.begin(), __d.end(), []( uint32_t __x ) { return ~__x; } );
+	EXPECT_TRUE( core::is_sorted( __d.begin(), __d.end(), core::greater<>() ) );
+}
+
+TEST( SORT, parallel_sort_distributions ) {
+	for ( size_t __n : { 0, 1, 1000, 100000 } ) {
+		for ( size_t __jobs : { 0, 1, 3, 4 } ) {
+			for ( auto& __keys : __distributions( __n ) ) {
+				__values __v( __keys.begin(), __keys.end() );
+				nya::sort( nya::execution::par.with_jobs( __jobs ), __v );
+				core::sort( __keys.begin(), __keys.end() );
+				ASSERT_TRUE( core::equal( __keys.begin(), __keys.end(), __v.begin(), __v.end() ) ) << "n " << __n << " jobs " << __jobs;
+			}
+		}
+	}
+
+	//<--- non trivial elements, a comparator, plain iterators
+	core::vector< core::string > __s( 50000 );
+	for ( auto& __x : __s ) __x = core::to_string( generator() % 100000 ) + " padded past the small buffer";
+	auto __expect = __s;
+	nya::sort( nya::execution::par.with_jobs( 4 ), __s.begin(), __s.end(), core::greater<>() );
+	core::sort( __expect.begin(), __expect.end(), core::greater<>() );
+	EXPECT_EQ( __s, __expect );
+
+	__values __v{ 3, 1, 2 };
+	nya::sort( nya::execution::seq, __v );
+	EXPECT_TRUE( core::is_sorted( __v.begin(), __v.end() ) );
+}
+
+//<--- the comparator throws in the scatter, the strings moved to the scratch buffer so far are freed (asan)
+TEST( SORT, parallel_sort_comparator_throws ) {
+	core::vector< core::string > __s( 50000 );
+	for ( auto& __x : __s ) __x = core::to_string( generator() ) + " padded past the small buffer";
+	__s[ 1 ] = "poison";//<--- not a sample: the count of the buckets compares it 3 times, the scatter again
+
+	core::atomic< size_t > __poisoned{ 0 };
+	const auto             __comp = [ & ]( const core::string& __a, const core::string& __b ) {
+		if ( ( __a == "poison" || __b == "poison" ) && ++__poisoned > 3 ) throw core::runtime_error( "comparator" );
+		return __a < __b;
+	};
+	EXPECT_THROW( nya::sort( nya::execution::par.with_jobs( 4 ), __s.begin(), __s.end(), __comp ), core::runtime_error );
+	EXPECT_EQ( __poisoned.load(), 4 );
+	EXPECT_EQ( __s.size(), 50000 );
+}
@@ -0,0 +1,173 @@
+#include "flat_map.hpp"
+#include "gtest/gtest.h"
+
+#include <algorithm>
+#include <map>
+#include <memory>
+#include <random>
+#include <stdint.h>
+#include <string>
+#include <vector>
+
+using __map = nya::flat_map< int64_t, core::string >;
+
+static core::random_device                       rd;
+static core::mt19937                             generator( rd() );
+static core::uniform_int_distribution< int64_t > distribution( 0, 100000 );
+
+static auto __same( const core::map< int64_t, core::string >& __expect, const __map& __m ) -> bool {
+	if ( __expect.size() != __m.size() ) return false;
+	auto __it = __m.begin();
+	for ( const auto& [ __k, __v ] : __expect ) {
+		if ( __it->first != __k || __it->second != __v ) return false;
+		++__it;
+	}
+	return __it == __m.end();
+}
+
+TEST( FLAT_MAP, construct ) {
+	__map __e;
+	ASSERT_TRUE( __e.empty() );
+	ASSERT_EQ( __e.begin(), __e.end() );
+
+	__map __m{ { 3, "c" }, { 1, "a" }, { 2, "b" }, { 1, "x" } };
+	ASSERT_EQ( 3, __m.size() );
+	ASSERT_EQ( "a", __m.at( 1 ) );//<--- the first of the equivalent keys wins
+	ASSERT_TRUE( core::is_sorted( __m.keys().begin(), __m.keys().end() ) );
+	ASSERT_THROW( __m.at( 4 ), core::out_of_range );
+
+	__map::key_container_type    __keys{ 5, 4, 9, 4 };
+	__map::mapped_container_type __values{ "five", "four", "nine", "four again" };
+	__map                        __c( core::move( __keys ), core::move( __values ) );
+	ASSERT_EQ( 3, __c.size() );
+	ASSERT_EQ( "four", __c.at( 4 ) );
+	ASSERT_EQ( 9, __c.rbegin()->first );
+
+	__map::key_container_type    __bad_keys{ 1, 2 };
+	__map::mapped_container_type __bad_values{ "one" };
+	ASSERT_THROW( __map( core::move( __bad_keys ), core::move( __bad_values ) ), core::length_error );
+
+	__map __s( nya::sorted_unique, { { 1, "a" }, { 2, "b" } } );
+	ASSERT_EQ( 2, __s.size() );
+	core::vector< core::pair< int64_t, core::string > > __src{ { 7, "g" }, { 6, "f" } };
+	__map                                               __r( nya::from_range, __src );
+	ASSERT_EQ( 6, __r.begin()->first );
+}
+
+TEST( FLAT_MAP, insert_and_lookup ) {
+	__map                              __m;
+	core::map< int64_t, core::string > __expect;
+	for ( int i = 0; i < 3000; i++ ) {
+		const int64_t __k = distribution( generator );
+		const auto    __v = core::to_string( i );
+		switch ( i % 4 ) {
+			case 0: ASSERT_EQ( __expect.emplace( __k, __v ).second, __m.emplace( __k, __v ).second ); break;
+			case 1: ASSERT_EQ( __expect.try_emplace( __k, __v ).second, __m.try_emplace( __k, __v ).second ); break;
+			case 2: ASSERT_EQ( __expect.insert_or_assign( __k, __v ).second, __m.insert_or_assign( __k, __v ).second ); break;
+			default: __expect[ __k ] = __v, __m[ __k ] = __v;
+		}
+	}
+	ASSERT_TRUE( __same( __expect, __m ) );
+
+	for ( int i = 0; i < 3000; i++ ) {
+		const int64_t __k = distribution( generator );
+		ASSERT_EQ( __expect.count( __k ), __m.count( __k ) );
+		ASSERT_EQ( __expect.contains( __k ), __m.contains( __k ) );
+		auto __lb = __expect.lower_bound( __k );
+		auto __ub = __expect.upper_bound( __k );
+		ASSERT_EQ( core::distance( __expect.begin(), __lb ), __m.lower_bound( __k ) - __m.begin() );
+		ASSERT_EQ( core::distance( __expect.begin(), __ub ), __m.upper_bound( __k ) - __m.begin() );
+		auto [ __first, __last ] = __m.equal_range( __k );
+		ASSERT_EQ( (long) __expect.count( __k ), __last - __first );
+		if ( __m.contains( __k ) ) ASSERT_EQ( __expect.at( __k ), __m.find( __k )->second );
+		else
+			ASSERT_EQ( __m.end(), __m.find( __k ) );
+	}
+
+	//<--- the hint is taken when it is right and ignored when it is not
+	__map __h;
+	for ( int64_t i = 0; i < 100; i++ ) __h.emplace_hint( __h.end(), i, "v" );
+	__h.emplace_hint( __h.begin(), 1000, "w" );
+	__h.insert( __h.begin(), { -1, "m" } );
+	ASSERT_EQ( 102, __h.size() );
+	ASSERT_EQ( -1, __h.begin()->first );
+	ASSERT_EQ( 1000, __h.rbegin()->first );
+}
+
+TEST( FLAT_MAP, batch_insert ) {
+	__map                              __m;
+	core::map< int64_t, core::string > __expect;
+	for ( int __round = 0; __round < 20; __round++ ) {
+		core::vector< core::pair< int64_t, core::string > > __batch;
+		for ( int i = 0; i < 500; i++ ) __batch.emplace_back( distribution( generator ), core::to_string( __round ) );
+		for ( const auto& __p : __batch ) __expect.insert( __p );
+		if ( __round % 2 ) {
+			__m.insert( __batch.begin(), __batch.end() );
+		} else {
+			core::map< int64_t, core::string > __sorted( __batch.begin(), __batch.end() );
+			__m.insert( nya::sorted_unique, __sorted.begin(), __sorted.end() );
+		}
+		ASSERT_TRUE( __same( __expect, __m ) ) << "round " << __round;
+	}
+
+	//<--- move iterators move the elements out of the batch
+	core::vector< core::pair< int64_t, core::string > > __batch{ { -5, "moved" } };
+	__m.insert( core::make_move_iterator( __batch.begin() ), core::make_move_iterator( __batch.end() ) );
+	ASSERT_EQ( "moved", __m.begin()->second );
+	ASSERT_TRUE( __batch[ 0 ].second.empty() );
+
+	__m.insert_range( __batch );
+	__m.insert( { { -7, "a" }, { -6, "b" } } );
+	ASSERT_EQ( -7, __m.begin()->first );
+}
+
+TEST( FLAT_MAP, erase ) {
+	__map                              __m;
+	core::map< int64_t, core::string > __expect;
+	for ( int i = 0; i < 2000; i++ ) {
+		const int64_t __k = distribution( generator );
+		__m.try_emplace( __k, "v" );
+		__expect.try_emplace( __k, "v" );
+	}
+	for ( int i = 0; i < 500; i++ ) {
+		const int64_t __k = distribution( generator );
+		ASSERT_EQ( __expect.erase( __k ), __m.erase( __k ) );
+	}
+	ASSERT_TRUE( __same( __expect, __m ) );
+
+	auto __it = __m.erase( __m.begin() + 10 );
+	__expect.erase( core::next( __expect.begin(), 10 ) );
+	ASSERT_EQ( core::next( __expect.begin(), 10 )->first, __it->first );
+	__m.erase( __m.cbegin() + 5, __m.cbegin() + 50 );
+	__expect.erase( core::next( __expect.begin(), 5 ), core::next( __expect.begin(), 50 ) );
+	ASSERT_TRUE( __same( __expect, __m ) );
+
+	const auto __n = __m.size();
+	const auto __e = nya::erase_if( __m, []( const auto& __p ) { return __p.first % 2 == 0; } );
+	core::erase_if( __expect, []( const auto& __p ) { return __p.first % 2 == 0; } );
+	ASSERT_EQ( __n - __expect.size(), __e );
+	ASSERT_TRUE( __same( __expect, __m ) );
+
+	auto __containers = core::move( __m ).extract();
+	ASSERT_TRUE( __m.empty() );
+	ASSERT_EQ( __expect.size(), __containers.keys.size() );
+	__m.replace( core::move( __containers.keys ), core::move( __containers.values ) );
+	ASSERT_TRUE( __same( __expect, __m ) );
+
+	__map __copy( __m );
+	ASSERT_TRUE( __copy == __m );
+	__copy.begin()->second = "changed";
+	ASSERT_FALSE( __copy == __m );
+	__copy.clear();
+	__copy.swap( __m );
+	ASSERT_TRUE( __m.empty() );
+	ASSERT_EQ( __expect.size(), __copy.size() );
+}
+
+TEST( FLAT_MAP, transparent_lookup ) {
+	nya::flat_map< core::string, int, core::less<> > __m{ { "one", 1 }, { "two", 2 }, { "three", 3 } };
+	ASSERT_TRUE( __m.contains( "two" ) );
+	ASSERT_EQ( 3, __m.find( core::string_view( "three" ) )->second );
+	ASSERT_EQ( 0, __m.count( "four" ) );
+	ASSERT_EQ( "one", __m.lower_bound( "o" )->first );
+}
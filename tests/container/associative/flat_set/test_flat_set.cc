@@ -0,0 +1,121 @@
+#include "flat_set.hpp"
+#include "gtest/gtest.h"
+
+#include <algorithm>
+#include <random>
+#include <set>
+#include <stdint.h>
+#include <string>
+#include <vector>
+
+using __set = nya::flat_set< int64_t >;
+
+static core::random_device                       rd;
+static core::mt19937                             generator( rd() );
+static core::uniform_int_distribution< int64_t > distribution( 0, 100000 );
+
+static auto __same( const core::set< int64_t >& __expect, const __set& __s ) -> bool {
+	return core::equal( __expect.begin(), __expect.end(), __s.begin(), __s.end() );
+}
+
+TEST( FLAT_SET, construct ) {
+	__set __e;
+	ASSERT_TRUE( __e.empty() );
+
+	__set __s{ 5, 3, 9, 3, 1 };
+	ASSERT_EQ( 4, __s.size() );
+	ASSERT_TRUE( core::is_sorted( __s.begin(), __s.end() ) );
+
+	__set __c( __set::container_type{ 4, 2, 2, 8 } );
+	ASSERT_EQ( 3, __c.size() );
+	ASSERT_EQ( 2, *__c.begin() );
+
+	__set __u( nya::sorted_unique, { 1, 2, 3 } );
+	ASSERT_EQ( 3, __u.size() );
+
+	core::vector< int64_t > __src{ 3, 2, 1, 2 };
+	__set                   __r( nya::from_range, __src );
+	ASSERT_EQ( 3, __r.size() );
+	ASSERT_EQ( 3, *__r.rbegin() );
+}
+
+TEST( FLAT_SET, insert_and_lookup ) {
+	__set                 __s;
+	core::set< int64_t > __expect;
+	for ( int i = 0; i < 3000; i++ ) {
+		const int64_t __k = distribution( generator );
+		ASSERT_EQ( __expect.insert( __k ).second, __s.insert( __k ).second );
+	}
+	ASSERT_TRUE( __same( __expect, __s ) );
+
+	for ( int i = 0; i < 3000; i++ ) {
+		const int64_t __k = distribution( generator );
+		ASSERT_EQ( __expect.count( __k ), __s.count( __k ) );
+		ASSERT_EQ( core::distance( __expect.begin(), __expect.lower_bound( __k ) ), __s.lower_bound( __k ) - __s.begin() );
+		ASSERT_EQ( core::distance( __expect.begin(), __expect.upper_bound( __k ) ), __s.upper_bound( __k ) - __s.begin() );
+		auto [ __first, __last ] = __s.equal_range( __k );
+		ASSERT_EQ( (long) __expect.count( __k ), __last - __first );
+		ASSERT_EQ( __expect.contains( __k ), __s.find( __k ) != __s.end() );
+	}
+
+	__set __h;
+	for ( int64_t i = 0; i < 100; i++ ) __h.emplace_hint( __h.end(), i );
+	__h.insert( __h.begin(), 1000 );
+	ASSERT_EQ( 101, __h.size() );
+	ASSERT_EQ( 1000, *__h.rbegin() );
+}
+
+TEST( FLAT_SET, batch_insert ) {
+	__set                 __s;
+	core::set< int64_t > __expect;
+	for ( int __round = 0; __round < 20; __round++ ) {
+		core::vector< int64_t > __batch;
+		for ( int i = 0; i < 500; i++ ) __batch.push_back( distribution( generator ) );
+		__expect.insert( __batch.begin(), __batch.end() );
+		switch ( __round % 3 ) {
+			case 0: __s.insert( __batch.begin(), __batch.end() ); break;
+			case 1: __s.insert_range( __batch ); break;
+			default: {
+				core::set< int64_t > __sorted( __batch.begin(), __batch.end() );
+				__s.insert( nya::sorted_unique, __sorted.begin(), __sorted.end() );
+			}
+		}
+		ASSERT_TRUE( __same( __expect, __s ) ) << "round " << __round;
+	}
+
+	nya::flat_set< core::string > __strings{ "b", "a" };
+	core::vector< core::string >  __batch{ "c", "a", "d" };
+	__strings.insert( core::make_move_iterator( __batch.begin() ), core::make_move_iterator( __batch.end() ) );
+	ASSERT_EQ( 4, __strings.size() );
+	ASSERT_TRUE( __batch[ 0 ].empty() );
+}
+
+TEST( FLAT_SET, erase ) {
+	__set                 __s;
+	core::set< int64_t > __expect;
+	for ( int i = 0; i < 2000; i++ ) {
+		const int64_t __k = distribution( generator );
+		__s.insert( __k );
+		__expect.insert( __k );
+	}
+	for ( int i = 0; i < 500; i++ ) {
+		const int64_t __k = distribution( generator );
+		ASSERT_EQ( __expect.erase( __k ), __s.erase( __k ) );
+	}
+	__s.erase( __s.begin() + 3, __s.begin() + 30 );
+	__expect.erase( core::next( __expect.begin(), 3 ), core::next( __expect.begin(), 30 ) );
+	ASSERT_TRUE( __same( __expect, __s ) );
+
+	const auto __e = nya::erase_if( __s, []( int64_t __k ) { return __k % 3 == 0; } );
+	ASSERT_EQ( core::erase_if( __expect, []( int64_t __k ) { return __k % 3 == 0; } ), __e );
+	ASSERT_TRUE( __same( __expect, __s ) );
+
+	auto __keys = core::move( __s ).extract();
+	ASSERT_TRUE( __s.empty() );
+	__s.replace( core::move( __keys ) );
+	ASSERT_TRUE( __same( __expect, __s ) );
+
+	nya::flat_set< core::string, core::less<> > __t{ "x", "y" };
+	ASSERT_TRUE( __t.contains( "x" ) );
+	ASSERT_EQ( 0, __t.count( core::string_view( "z" ) ) );
+}
@@ -0,0 +1,156 @@
+#include "dynamic_bitset.hpp"
+#include "gtest/gtest.h"
+
+#include <algorithm>
+#include <random>
+#include <stdint.h>
+#include <vector>
+
+using __bitset = nya::dynamic_bitset<>;
+
+static core::random_device                   rd;
+static core::mt19937                         generator( rd() );
+static core::uniform_int_distribution< int > distribution( 0, 1 );
+
+static auto __random_bits( size_t __n ) -> core::vector< bool > {
+	core::vector< bool > __bits( __n );
+	for ( size_t i = 0; i < __n; i++ ) __bits[ i ] = distribution( generator );
+	return __bits;
+}
+
+static auto __make( const core::vector< bool >& __bits ) -> __bitset {
+	__bitset __b( __bits.size() );
+	for ( size_t i = 0; i < __bits.size(); i++ ) __b.set( i, __bits[ i ] );
+	return __b;
+}
+
+static auto __same( const core::vector< bool >& __expect, const __bitset& __b ) -> bool {
+	if ( __expect.size() != __b.size() ) return false;
+	for ( size_t i = 0; i < __expect.size(); i++ ) {
+		if ( __expect[ i ] != __b[ i ] ) return false;
+	}
+	return true;
+}
+
+TEST( DYNAMIC_BITSET, construct_and_access ) {
+	__bitset __e{};
+	ASSERT_TRUE( __e.empty() );
+	ASSERT_EQ( 0, __e.num_blocks() );
+	ASSERT_TRUE( __e.all() );
+	ASSERT_TRUE( __e.none() );
+	ASSERT_EQ( __bitset::npos, __e.find_first() );
+
+	__bitset __b( 130, true );
+	ASSERT_EQ( 130, __b.size() );
+	ASSERT_EQ( 3, __b.num_blocks() );
+	ASSERT_EQ( 130, __b.count() );
+	ASSERT_TRUE( __b.all() );
+	ASSERT_EQ( 0b11u, __b.data()[ 2 ] );//<--- the bits past size() stay zero
+	ASSERT_EQ( 0u, reinterpret_cast< uintptr_t >( __b.data() ) % 64 );
+
+	__b.reset( 64 ).flip( 0 );
+	ASSERT_FALSE( __b.test( 0 ) );
+	ASSERT_FALSE( __b[ 64 ] );
+	ASSERT_TRUE( __b.test( 129 ) );
+	ASSERT_FALSE( __b.all() );
+	ASSERT_EQ( 128, __b.count() );
+	ASSERT_THROW( __b.test( 130 ), core::out_of_range );
+	ASSERT_THROW( __b.set( 130 ), core::out_of_range );
+
+	__b.flip();
+	ASSERT_EQ( 2, __b.count() );
+	ASSERT_EQ( 0u, __b.data()[ 2 ] );
+	__b.set();
+	ASSERT_TRUE( __b.all() );
+	__b.reset();
+	ASSERT_TRUE( __b.none() );
+}
+
+TEST( DYNAMIC_BITSET, resize_and_push_back ) {
+	core::vector< bool > __expect;
+	__bitset             __b;
+	auto                 __bits = __random_bits( 1000 );
+	for ( bool __x : __bits ) {
+		__b.push_back( __x );
+		__expect.push_back( __x );
+	}
+	ASSERT_TRUE( __same( __expect, __b ) );
+
+	for ( size_t __n : { 1001UL, 1024UL, 63UL, 64UL, 65UL, 0UL, 200UL } ) {
+		const bool __x = distribution( generator );
+		__b.resize( __n, __x );
+		__expect.resize( __n, __x );
+		ASSERT_TRUE( __same( __expect, __b ) ) << "resize " << __n;
+		ASSERT_EQ( (size_t) core::count( __expect.begin(), __expect.end(), true ), __b.count() );
+	}
+
+	__b.clear();
+	ASSERT_TRUE( __b.empty() );
+	ASSERT_EQ( 0, __b.num_blocks() );
+}
+
+TEST( DYNAMIC_BITSET, set_operations ) {
+	const size_t __n  = 100003;
+	auto         __xa = __random_bits( __n );
+	auto         __xb = __random_bits( __n );
+	auto         __xc = __random_bits( __n );
+	__bitset     __a  = __make( __xa );
+	__bitset     __b  = __make( __xb );
+	__bitset     __c  = __make( __xc );
+
+	core::vector< bool > __and( __n ), __or( __n ), __xor( __n ), __diff( __n ), __not( __n ), __fused( __n );
+	for ( size_t i = 0; i < __n; i++ ) {
+		__and[ i ]   = __xa[ i ] && __xb[ i ];
+		__or[ i ]    = __xa[ i ] || __xb[ i ];
+		__xor[ i ]   = __xa[ i ] != __xb[ i ];
+		__diff[ i ]  = __xa[ i ] && !__xb[ i ];
+		__not[ i ]   = !__xa[ i ];
+		__fused[ i ] = __xa[ i ] && __xb[ i ] && !__xc[ i ];
+	}
+	ASSERT_TRUE( __same( __and, __a & __b ) );
+	ASSERT_TRUE( __same( __or, __a | __b ) );
+	ASSERT_TRUE( __same( __xor, __a ^ __b ) );
+	ASSERT_TRUE( __same( __diff, __a - __b ) );
+	ASSERT_TRUE( __same( __not, ~__a ) );
+	ASSERT_EQ( 0u, ( ~__a ).data()[ __a.num_blocks() - 1 ] >> ( __n % 64 ) );
+
+	__bitset __r( __a );
+	__r.combine( []( auto __x, auto __y, auto __z ) { return __x & __y & ~__z; }, __b, __c );
+	ASSERT_TRUE( __same( __fused, __r ) );
+	ASSERT_TRUE( __r == ( __a & __b ) - __c );
+
+	ASSERT_TRUE( __r.is_subset_of( __a ) );
+	ASSERT_TRUE( __r.is_subset_of( __b ) );
+	ASSERT_FALSE( __a.is_subset_of( __r ) );
+	ASSERT_TRUE( __a.intersects( __b ) );
+	ASSERT_FALSE( __r.intersects( __c ) );
+
+	__bitset __short( 10 );
+	ASSERT_THROW( __a &= __short, core::length_error );
+	ASSERT_THROW( __a.intersects( __short ), core::length_error );
+}
+
+TEST( DYNAMIC_BITSET, search ) {
+	const size_t __n    = 70000;
+	auto         __bits = __random_bits( __n );
+	__bitset     __b    = __make( __bits );
+
+	core::vector< size_t > __expect, __walked, __found;
+	for ( size_t i = 0; i < __n; i++ ) {
+		if ( __bits[ i ] ) __expect.push_back( i );
+	}
+	__b.for_each_set( [ & ]( size_t __pos ) { __walked.push_back( __pos ); } );
+	for ( size_t __pos = __b.find_first(); __pos != __bitset::npos; __pos = __b.find_next( __pos ) ) __found.push_back( __pos );
+	ASSERT_EQ( __expect, __walked );
+	ASSERT_EQ( __expect, __found );
+	ASSERT_EQ( __expect.size(), __b.count() );
+
+	__bitset __sparse( __n );
+	ASSERT_EQ( __bitset::npos, __sparse.find_first() );
+	__sparse.set( 5 ).set( 64 ).set( __n - 1 );
+	ASSERT_EQ( 5, __sparse.find_first() );
+	ASSERT_EQ( 64, __sparse.find_next( 5 ) );
+	ASSERT_EQ( __n - 1, __sparse.find_next( 64 ) );
+	ASSERT_EQ( __bitset::npos, __sparse.find_next( __n - 1 ) );
+	ASSERT_EQ( __bitset::npos, __sparse.find_next( __n + 10 ) );
+}
@@ -0,0 +1,56 @@
+#include "eytzinger_index.hpp"
+#include "gtest/gtest.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <functional>
+#include <random>
+#include <vector>
+
+namespace core = std;
+
+static core::random_device                        rd;
+static core::mt19937                              generator( rd() );
+static core::uniform_int_distribution< uint32_t > distribution( 0, 100000 );
+
+//<--- every lookup, single and batched, against `std::lower_bound` on the sorted keys
+template < typename _Compare >
+static auto __against_lower_bound( size_t __n, uint32_t __range ) -> void {
+	core::vector< uint32_t > __sorted( __n );
+	for ( auto& __x : __sorted ) __x = distribution( generator ) % __range;
+	core::sort( __sorted.begin(), __sorted.end(), _Compare() );
+	const nya::eytzinger_index< uint32_t, _Compare > __index( __sorted.begin(), __sorted.end() );
+	ASSERT_EQ( __n, __index.size() );
+
+	core::vector< uint32_t > __queries( 1000 );
+	for ( auto& __q : __queries ) __q = distribution( generator ) % ( __range + 2 );
+	core::vector< size_t > __ranks( __queries.size() );
+	__index.lower_bound( __queries, __ranks );
+	for ( size_t i = 0; i < __queries.size(); i++ ) {
+		const auto __expect = static_cast< size_t >( core::lower_bound( __sorted.begin(), __sorted.end(), __queries[ i ], _Compare() ) - __sorted.begin() );
+		ASSERT_EQ( __expect, __index.lower_bound( __queries[ i ] ) ) << "n " << __n << " query " << __queries[ i ];
+		ASSERT_EQ( __expect, __ranks[ i ] ) << "n " << __n << " query " << __queries[ i ];
+		ASSERT_EQ( core::binary_search( __sorted.begin(), __sorted.end(), __queries[ i ], _Compare() ), __index.contains( __queries[ i ] ) );
+	}
+}
+
+TEST( EYTZINGER_INDEX, against_lower_bound ) {
+	for ( size_t __n : { 0, 1, 2, 3, 7, 8, 15, 16, 17, 100, 1023, 1024, 1025, 5000, 100000 } ) {
+		__against_lower_bound< core::less< uint32_t > >( __n, 100000 );
+		__against_lower_bound< core::less< uint32_t > >( __n, 50 );//<--- runs of duplicates
+	}
+}
+
+TEST( EYTZINGER_INDEX, descending_keys ) {
+	for ( size_t __n : { 1, 5, 31, 32, 33, 4096, 9999 } ) __against_lower_bound< core::greater< uint32_t > >( __n, 100000 );
+}
+
+TEST( EYTZINGER_INDEX, layout ) {
+	nya::vector< uint32_t, core::allocator< uint32_t > > __sorted{ 1, 2, 3, 4, 5, 6, 7 };
+	const nya::eytzinger_index< uint32_t >               __index( __sorted );
+	const auto                                           __keys = __index.keys();
+	EXPECT_TRUE( core::equal( __keys.begin(), __keys.end(), core::vector< uint32_t >{ 4, 2, 6, 1, 3, 5, 7 }.begin() ) );
+	EXPECT_EQ( 0u, __index.lower_bound( 0 ) );
+	EXPECT_EQ( 3u, __index.lower_bound( 4 ) );
+	EXPECT_EQ( 7u, __index.lower_bound( 8 ) );
+}
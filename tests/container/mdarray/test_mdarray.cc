@@ -0,0 +1,125 @@
+#include "mdarray.hpp"
+#include "gtest/gtest.h"
+
+#include <cstdint>
+#include <random>
+#include <set>
+#include <stdexcept>
+#include <vector>
+
+namespace core = std;
+
+using __matrix = nya::dextents< size_t, 2 >;
+
+static core::random_device                   rd;
+static core::mt19937                         generator( rd() );
+static core::uniform_int_distribution< int > distribution( -100, 100 );
+
+//<--- every index maps inside the required span, to a distinct offset
+template < typename _Mapping >
+static auto __is_injective( const _Mapping& __m ) -> bool {
+	core::set< size_t > __seen;
+	for ( size_t i = 0; i < __m.extents().extent( 0 ); i++ ) {
+		for ( size_t j = 0; j < __m.extents().extent( 1 ); j++ ) {
+			const auto __off = static_cast< size_t >( __m( i, j ) );
+			if ( __off >= static_cast< size_t >( __m.required_span_size() ) || !__seen.insert( __off ).second ) return false;
+		}
+	}
+	return true;
+}
+
+TEST( MDARRAY, extents_and_layouts ) {
+	constexpr nya::extents< int, 3, nya::dynamic_extent, 4 > __e( 5 );
+	static_assert( __e.rank() == 3 && __e.rank_dynamic() == 1 );
+	static_assert( __e.extent( 0 ) == 3 && __e.extent( 1 ) == 5 && __e.extent( 2 ) == 4 );
+	static_assert( nya::layout_right::mapping< decltype( __e ) >( __e )( 1, 2, 3 ) == 1 * 20 + 2 * 4 + 3 );
+	static_assert( nya::layout_left::mapping< decltype( __e ) >( __e )( 1, 2, 3 ) == 1 + 2 * 3 + 3 * 15 );
+
+	const __matrix                                          __m( 7, 13 );
+	const nya::layout_right::mapping< __matrix >            __right( __m );
+	const nya::layout_left::mapping< __matrix >             __left( __m );
+	const nya::layout_right_padded< 8 >::mapping< __matrix > __padded( __m );
+	const nya::layout_tiled< 4, 4 >::mapping< __matrix >    __tiled( __m );
+	ASSERT_TRUE( __is_injective( __right ) );
+	ASSERT_TRUE( __is_injective( __left ) );
+	ASSERT_TRUE( __is_injective( __padded ) );
+	ASSERT_TRUE( __is_injective( __tiled ) );
+	ASSERT_EQ( 7 * 13, __right.required_span_size() );
+	ASSERT_EQ( 7 * 16, __padded.required_span_size() );
+	ASSERT_EQ( 16, __padded.stride( 0 ) );
+	ASSERT_FALSE( __padded.is_exhaustive() );
+	ASSERT_EQ( 8 * 16, __tiled.required_span_size() );
+	ASSERT_EQ( 16, __tiled( 0, 4 ) );//<--- the first element of the second tile
+	ASSERT_EQ( 20, __tiled( 1, 4 ) );
+}
+
+TEST( MDARRAY, access_and_views ) {
+	nya::mdarray< double, __matrix, nya::layout_right_padded< 8 > > __a( 5, 11 );
+	ASSERT_EQ( 55, __a.size() );
+	ASSERT_EQ( 5 * 16, __a.container_size() );
+	for ( size_t i = 0; i < 5; i++ ) {
+		ASSERT_EQ( 0, reinterpret_cast< uintptr_t >( &__a( i, 0 ) ) % 64 );//<--- every row is aligned
+		for ( size_t j = 0; j < 11; j++ ) __a( i, j ) = static_cast< double >( i * 100 + j );
+	}
+	ASSERT_EQ( 304, ( __a[ core::array< size_t, 2 >{ 3, 4 } ] ) );
+
+	auto __v = __a.view();
+	__v( 2, 2 ) = -1;
+	ASSERT_EQ( -1, __a( 2, 2 ) );
+	nya::mdspan< const double, __matrix, nya::layout_right_padded< 8 > > __cv = __a;
+	ASSERT_EQ( 11, __cv.extent( 1 ) );
+	ASSERT_EQ( 16, __cv.stride( 0 ) );
+
+	//<--- a copy into another layout keeps the elements
+	nya::mdarray< double, __matrix, nya::layout_left > __l( __cv );
+	ASSERT_EQ( 55, __l.container_size() );
+	for ( size_t i = 0; i < 5; i++ ) {
+		for ( size_t j = 0; j < 11; j++ ) ASSERT_EQ( __a( i, j ), __l( i, j ) );
+	}
+	nya::mdarray< double, __matrix, nya::layout_right_padded< 8 > > __b( __l.view() );
+	ASSERT_EQ( __a, __b );
+	__b( 4, 10 ) = 0;
+	ASSERT_FALSE( __a == __b );
+
+	int  __raw[ 6 ] = { 1, 2, 3, 4, 5, 6 };
+	auto __s        = nya::mdspan( __raw, 2, 3 );
+	ASSERT_EQ( 6, __s( 1, 2 ) );
+	ASSERT_EQ( 6, __s.size() );
+}
+
+template < typename _Layout >
+static auto __check_transpose_and_product() -> void {
+	const size_t                                    __m = 45, __k = 37, __n = 29;
+	nya::mdarray< int64_t, __matrix, _Layout >      __a( __m, __k ), __b( __k, __n ), __c( __m, __n ), __t( __k, __m );
+	core::vector< int64_t >                         __expect( __m * __n, 0 );
+	for ( size_t i = 0; i < __m; i++ ) {
+		for ( size_t j = 0; j < __k; j++ ) __a( i, j ) = distribution( generator );
+	}
+	for ( size_t i = 0; i < __k; i++ ) {
+		for ( size_t j = 0; j < __n; j++ ) __b( i, j ) = distribution( generator );
+	}
+	for ( size_t i = 0; i < __m; i++ ) {
+		for ( size_t p = 0; p < __k; p++ ) {
+			for ( size_t j = 0; j < __n; j++ ) __expect[ i * __n + j ] += __a( i, p ) * __b( p, j );
+		}
+	}
+
+	nya::transpose( __a.view(), __t.view() );
+	for ( size_t i = 0; i < __m; i++ ) {
+		for ( size_t j = 0; j < __k; j++ ) ASSERT_EQ( __a( i, j ), __t( j, i ) );
+	}
+	nya::matrix_product( __a.view(), __b.view(), __c.view() );
+	for ( size_t i = 0; i < __m; i++ ) {
+		for ( size_t j = 0; j < __n; j++ ) ASSERT_EQ( __expect[ i * __n + j ], __c( i, j ) );
+	}
+	ASSERT_THROW( nya::transpose( __a.view(), __c.view() ), core::length_error );
+	ASSERT_THROW( nya::matrix_product( __a.view(), __a.view(), __c.view() ), core::length_error );
+}
+
+TEST( MDARRAY, transpose_and_product ) {
+	__check_transpose_and_product< nya::layout_right >();
+	__check_transpose_and_product< nya::layout_left >();
+	__check_transpose_and_product< nya::layout_right_padded< 8 > >();
+	__check_transpose_and_product< nya::layout_tiled< 8, 8 > >();
+	__check_transpose_and_product< nya::layout_tiled< 16, 4 > >();
+}
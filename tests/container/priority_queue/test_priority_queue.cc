@@ -0,0 +1,160 @@
+#include "priority_queue.hpp"
+#include "gtest/gtest.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <queue>
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+namespace core = std;
+
+static core::random_device                       rd;
+static core::mt19937                             generator( rd() );
+static core::uniform_int_distribution< int64_t > distribution( 0, 100000 );
+
+//<--- pushes, batches, pops and replaced tops against `std::priority_queue`
+template < size_t _Arity, typename _Compare >
+static auto __against_std() -> void {
+	nya::priority_queue< int64_t, _Compare, _Arity >                   __queue;
+	core::priority_queue< int64_t, core::vector< int64_t >, _Compare > __expect;
+	for ( int i = 0; i < 5000; i++ ) {
+		switch ( distribution( generator ) % 6 ) {
+			case 0: {
+				core::vector< int64_t > __batch( static_cast< size_t >( distribution( generator ) % ( i % 50 == 0 ? 2000 : 8 ) ) );
+				for ( auto& __x : __batch ) {
+					__x = distribution( generator );
+					__expect.push( __x );
+				}
+				__queue.push_range( __batch );
+				break;
+			}
+			case 1:
+			case 2:
+				if ( !__expect.empty() ) {
+					__queue.pop();
+					__expect.pop();
+				}
+				break;
+			case 3:
+				if ( !__expect.empty() ) {
+					const auto __x = distribution( generator );
+					__queue.pop_push( __x );
+					__expect.pop();
+					__expect.push( __x );
+				}
+				break;
+			default: {
+				const auto __x = distribution( generator );
+				__queue.push( __x );
+				__expect.push( __x );
+				break;
+			}
+		}
+		ASSERT_EQ( __expect.size(), __queue.size() );
+		if ( !__expect.empty() ) {
+			ASSERT_EQ( __expect.top(), __queue.top() );
+		}
+	}
+	while ( !__expect.empty() ) {
+		ASSERT_EQ( __expect.top(), __queue.top() );
+		__queue.pop();
+		__expect.pop();
+	}
+	EXPECT_TRUE( __queue.empty() );
+}
+
+TEST( PRIORITY_QUEUE, binary_against_std ) { __against_std< 2, core::less< int64_t > >(); }
+TEST( PRIORITY_QUEUE, quaternary_against_std ) { __against_std< 4, core::greater< int64_t > >(); }
+TEST( PRIORITY_QUEUE, octonary_against_std ) { __against_std< 8, core::less< int64_t > >(); }
+
+TEST( PRIORITY_QUEUE, heapify_on_construction ) {
+	core::vector< int64_t > __in( 10000 );
+	for ( auto& __x : __in ) __x = distribution( generator );
+	nya::priority_queue< int64_t > __queue( __in.begin(), __in.end() );
+	core::sort( __in.begin(), __in.end(), core::greater<>() );
+	for ( int64_t __x : __in ) {
+		ASSERT_EQ( __x, __queue.top() );
+		__queue.pop();
+	}
+
+	nya::priority_queue< int64_t, core::greater< int64_t >, 8 > __min{ 5, 3, 9, 1 };
+	EXPECT_EQ( 1, __min.top() );
+	nya::priority_queue< int64_t, core::less< int64_t >, 3 > __ranged( nya::from_range, __in );
+	EXPECT_EQ( __in.size(), __ranged.size() );
+	EXPECT_EQ( __in.front(), __ranged.top() );
+}
+
+struct __item {
+	int64_t __prio;
+	size_t  __id;
+};
+
+//<--- a min-queue on `__prio`
+struct __by_prio {
+	auto operator()( const __item& __x, const __item& __y ) const -> bool { return __x.__prio > __y.__prio; }
+};
+
+//<--- records where each item is, by id
+struct __track {
+	core::vector< size_t >* __where = nullptr;
+
+	auto operator()( const __item& __x, size_t __pos ) const -> void { ( *__where )[ __x.__id ] = __pos; }
+};
+
+//<--- Dijkstra-like decrease-keys through the positions the hook reports
+TEST( PRIORITY_QUEUE, decrease_key_through_hook ) {
+	const size_t                                         __n = 3000;
+	core::vector< size_t >                               __where( __n );
+	core::vector< int64_t >                              __prio( __n );
+	nya::priority_queue< __item, __by_prio, 4, __track > __queue( __by_prio(), __track{ &__where } );
+
+	core::vector< __item > __batch;
+	for ( size_t i = 0; i < __n; i++ ) {
+		__prio[ i ] = distribution( generator ) + 100000;
+		__batch.push_back( { __prio[ i ], i } );
+	}
+	__queue.push_range( __batch );
+	for ( size_t i = 0; i < __n; i++ ) ASSERT_EQ( i, __queue[ __where[ i ] ].__id );
+
+	core::vector< bool > __popped( __n );
+	for ( int i = 0; i < 4000; i++ ) {
+		const size_t __id = static_cast< size_t >( distribution( generator ) ) % __n;
+		if ( __popped[ __id ] ) continue;
+		switch ( i % 4 ) {
+			case 0:
+				__prio[ __id ] -= distribution( generator );//<--- decrease-key
+				__queue.update( __where[ __id ], { __prio[ __id ], __id } );
+				break;
+			case 1:
+				__prio[ __id ] += distribution( generator );
+				__queue.update( __where[ __id ], { __prio[ __id ], __id } );
+				break;
+			case 2: {
+				const auto __top = __queue.top();
+				EXPECT_EQ( __top.__prio, __prio[ __top.__id ] );
+				__popped[ __top.__id ] = true;
+				__queue.pop();
+				break;
+			}
+			default:
+				__queue.erase( __where[ __id ] );
+				__popped[ __id ] = true;
+				break;
+		}
+		for ( size_t j = 0; j < __queue.size(); j++ ) ASSERT_EQ( j, __where[ __queue[ j ].__id ] );
+	}
+	EXPECT_THROW( __queue.update( __queue.size(), { 0, 0 } ), core::out_of_range );
+
+	int64_t __last = core::numeric_limits< int64_t >::min();
+	while ( !__queue.empty() ) {
+		const auto __top = __queue.top();
+		EXPECT_LE( __last, __top.__prio );
+		EXPECT_EQ( __prio[ __top.__id ], __top.__prio );
+		__last = __top.__prio;
+		__queue.pop();
+	}
+}
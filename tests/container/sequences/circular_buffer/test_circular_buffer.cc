@@ -0,0 +1,216 @@
+#include "circular_buffer.hpp"
+#include "gtest/gtest.h"
+
+#include <cstdint>
+#include <deque>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace core = std;
+
+static core::random_device                       rd;
+static core::mt19937                             generator( rd() );
+static core::uniform_int_distribution< int64_t > distribution( 0, 100000 );
+
+template < typename _Buffer, typename _Deque >
+static auto __same( const _Deque& __expect, const _Buffer& __buffer ) -> bool {
+	if ( __expect.size() != __buffer.size() ) return false;
+	for ( size_t i = 0; i < __expect.size(); i++ ) {
+		if ( !( __buffer[ i ] == __expect[ i ] ) ) return false;
+	}
+	//<--- the two segments hold the same elements, front to back
+	size_t __i = 0;
+	for ( const auto& __s : __buffer.as_spans() ) {
+		for ( const auto& __e : __s ) {
+			if ( !( __e == __expect[ __i++ ] ) ) return false;
+		}
+	}
+	return __i == __expect.size();
+}
+
+//<--- a queue and a deque at once, against `std::deque`
+TEST( CIRCULAR_BUFFER, grow_as_deque ) {
+	nya::circular_buffer< core::string > __buffer;
+	core::deque< core::string >          __expect;
+	EXPECT_EQ( nya::circular_buffer_policy::grow, __buffer.policy() );
+	for ( int i = 0; i < 20000; i++ ) {
+		const auto __x = core::to_string( distribution( generator ) );
+		switch ( distribution( generator ) % 6 ) {
+			case 0:
+				__buffer.push_front( __x );
+				__expect.push_front( __x );
+				break;
+			case 1:
+				if ( !__expect.empty() ) {
+					__buffer.pop_front();
+					__expect.pop_front();
+				}
+				break;
+			case 2:
+				if ( !__expect.empty() ) {
+					__buffer.pop_back();
+					__expect.pop_back();
+				}
+				break;
+			default:
+				__buffer.emplace_back( __x );
+				__expect.emplace_back( __x );
+				break;
+		}
+		ASSERT_TRUE( __same( __expect, __buffer ) );
+	}
+	EXPECT_TRUE( core::equal( __buffer.begin(), __buffer.end(), __expect.begin(), __expect.end() ) );
+	EXPECT_TRUE( core::equal( __buffer.rbegin(), __buffer.rend(), __expect.rbegin(), __expect.rend() ) );
+	EXPECT_THROW( __buffer.at( __buffer.size() ), core::out_of_range );
+
+	//<--- an argument aliasing an element survives the reallocation it triggers
+	__buffer.shrink_to_fit();
+	__buffer.push_back( __buffer.front() );
+	__expect.push_back( __expect.front() );
+	__buffer.shrink_to_fit();
+	__buffer.push_front( __buffer.back() );
+	__expect.push_front( __expect.back() );
+	EXPECT_TRUE( __same( __expect, __buffer ) );
+
+	nya::circular_buffer< core::string > __copy( __buffer );
+	EXPECT_TRUE( __copy == __buffer );
+	nya::circular_buffer< core::string > __moved( core::move( __copy ) );
+	EXPECT_TRUE( __copy.empty() );
+	__copy = __moved;
+	__copy.swap( __buffer );
+	EXPECT_TRUE( __same( __expect, __copy ) );
+}
+
+TEST( CIRCULAR_BUFFER, overwrite_keeps_latest ) {
+	nya::circular_buffer< int64_t > __buffer( 100 );
+	core::deque< int64_t >          __expect;
+	for ( int64_t i = 0; i < 1000; i++ ) {
+		__buffer.push_back( i );
+		__expect.push_back( i );
+		if ( __expect.size() > 100 ) __expect.pop_front();
+		ASSERT_TRUE( __same( __expect, __buffer ) );
+	}
+	EXPECT_EQ( 100u, __buffer.capacity() );
+	EXPECT_TRUE( __buffer.full() );
+
+	__buffer.push_front( -1 );
+	__expect.pop_back();
+	__expect.push_front( -1 );
+	EXPECT_TRUE( __same( __expect, __buffer ) );
+
+	//<--- bulk pushes wrap around and drop the oldest, a range longer than the capacity keeps its tail
+	for ( int i = 0; i < 200; i++ ) {
+		core::vector< int64_t > __in( static_cast< size_t >( distribution( generator ) % 250 ) );
+		for ( auto& __e : __in ) __e = distribution( generator );
+		__buffer.push_n( __in.data(), __in.size() );
+		for ( auto __e : __in ) {
+			__expect.push_back( __e );
+			if ( __expect.size() > 100 ) __expect.pop_front();
+		}
+		ASSERT_TRUE( __same( __expect, __buffer ) );
+	}
+
+	nya::circular_buffer< int64_t > __fixed( 4, nya::circular_buffer_policy::fixed );
+	for ( int64_t i = 0; i < 4; i++ ) __fixed.push_back( i );
+	EXPECT_THROW( __fixed.push_back( 4 ), core::length_error );
+	EXPECT_THROW( __fixed.push_n( __expect.begin(), 1 ), core::length_error );
+	__fixed.set_policy( nya::circular_buffer_policy::grow );
+	__fixed.push_back( 4 );
+	EXPECT_EQ( 5u, __fixed.size() );
+	__fixed.set_capacity( 2 );
+	EXPECT_EQ( 3, __fixed.front() );
+	EXPECT_EQ( 4, __fixed.back() );
+}
+
+TEST( CIRCULAR_BUFFER, pop_n_and_linearize ) {
+	nya::circular_buffer< core::string > __buffer( 64, nya::circular_buffer_policy::fixed );
+	core::deque< core::string >          __expect;
+	for ( int i = 0; i < 2000; i++ ) {
+		const size_t __n = static_cast< size_t >( distribution( generator ) ) % 20;
+		if ( distribution( generator ) % 2 == 0 ) {
+			core::vector< core::string > __in;
+			for ( size_t j = 0; j < core::min( __n, __buffer.capacity() - __buffer.size() ); j++ )
+				__in.push_back( core::to_string( distribution( generator ) ) );
+			__buffer.push_n( __in.begin(), __in.size() );
+			__expect.insert( __expect.end(), __in.begin(), __in.end() );
+		} else {
+			core::vector< core::string > __out;
+			__buffer.pop_n( core::back_inserter( __out ), __n );
+			const size_t __popped = core::min( __n, __expect.size() );
+			ASSERT_EQ( __popped, __out.size() );
+			EXPECT_TRUE( core::equal( __out.begin(), __out.end(), __expect.begin() ) );
+			__expect.erase( __expect.begin(), __expect.begin() + static_cast< ptrdiff_t >( __popped ) );
+		}
+		ASSERT_TRUE( __same( __expect, __buffer ) );
+
+		if ( i % 7 == 0 ) {
+			const auto __line = __buffer.linearize();
+			ASSERT_EQ( __expect.size(), __line.size() );
+			EXPECT_TRUE( core::equal( __line.begin(), __line.end(), __expect.begin() ) );
+			EXPECT_TRUE( __buffer.as_spans()[ 1 ].empty() );
+			ASSERT_TRUE( __same( __expect, __buffer ) );
+		}
+	}
+	EXPECT_EQ( 64u, __buffer.capacity() );
+}
+
+//<--- throws on the copy number `__countdown`, its move is not noexcept so relocation copies
+struct __throwing {
+	static inline int __countdown = -1;
+
+	int __v = 0;
+
+	__throwing( int __x )
+			: __v( __x ) {}
+	__throwing( const __throwing& __x )
+			: __v( __x.__v ) {
+		if ( __countdown >= 0 && __countdown-- == 0 ) throw core::runtime_error( "copy" );
+	}
+	__throwing( __throwing&& __x )
+			: __v( __x.__v ) {}
+	auto operator=( const __throwing& ) -> __throwing& = default;
+	auto operator=( __throwing&& ) -> __throwing&      = default;
+	auto operator==( const __throwing& __x ) const -> bool { return __v == __x.__v; }
+};
+
+TEST( CIRCULAR_BUFFER, strong_guarantee_on_growth ) {
+	nya::circular_buffer< __throwing > __buffer( 8, nya::circular_buffer_policy::grow );
+	for ( int i = 0; i < 12; i++ ) __buffer.push_back( __throwing( i ) );
+	__buffer.set_capacity( 12 );
+	for ( int i = 0; i < 5; i++ ) {
+		__buffer.pop_front();
+		__buffer.push_back( __throwing( 12 + i ) );//<--- wrapped around
+	}
+	const nya::circular_buffer< __throwing > __before( __buffer );
+	EXPECT_FALSE( __buffer.as_spans()[ 1 ].empty() );
+
+	__throwing::__countdown = 9;
+	EXPECT_THROW( __buffer.push_back( __throwing( -1 ) ), core::runtime_error );
+	__throwing::__countdown = -1;
+	EXPECT_TRUE( __buffer == __before );
+
+	__throwing::__countdown = 3;
+	EXPECT_THROW( __buffer.push_front( __throwing( -1 ) ), core::runtime_error );
+	__throwing::__countdown = -1;
+	EXPECT_TRUE( __buffer == __before );
+}
+
+TEST( CIRCULAR_BUFFER, assignment_takes_policy ) {
+	nya::circular_buffer< int64_t > __fixed( 4, nya::circular_buffer_policy::fixed );
+	nya::circular_buffer< int64_t > __buffer( 2 );
+	__buffer = __fixed;
+	EXPECT_EQ( nya::circular_buffer_policy::fixed, __buffer.policy() );
+	EXPECT_EQ( 4u, __buffer.capacity() );
+
+	nya::circular_buffer< int64_t > __grow( 3, nya::circular_buffer_policy::grow );
+	__buffer = core::move( __grow );
+	EXPECT_EQ( nya::circular_buffer_policy::grow, __buffer.policy() );
+
+	//<--- a growth past max_size() throws instead of wrapping around
+	__buffer.push_back( 1 );
+	const int64_t __e = 0;
+	EXPECT_THROW( __buffer.push_n( &__e, __buffer.max_size() ), core::length_error );
+	EXPECT_EQ( 1u, __buffer.size() );
+}
@@ -0,0 +1,173 @@
+#include "devector.hpp"
+#include "gtest/gtest.h"
+
+#include <cstdint>
+#include <deque>
+#include <random>
+#include <stdexcept>
+#include <string>
+
+namespace core = std;
+
+static core::random_device                       rd;
+static core::mt19937                             generator( rd() );
+static core::uniform_int_distribution< int64_t > distribution( 0, 100000 );
+
+template < typename _Devector, typename _Deque >
+static auto __same( const _Deque& __expect, const _Devector& __v ) -> bool {
+	if ( __expect.size() != __v.size() ) return false;
+	for ( size_t i = 0; i < __expect.size(); i++ ) {
+		if ( !( __v[ i ] == __expect[ i ] ) ) return false;
+	}
+	return true;
+}
+
+TEST( DEVECTOR, push_pop_both_ends ) {
+	nya::devector< core::string > __v;
+	core::deque< core::string >   __expect;
+	EXPECT_TRUE( __v.empty() );
+	for ( int i = 0; i < 1000; i++ ) {
+		if ( i % 3 == 0 ) {
+			__v.push_front( core::to_string( i ) );
+			__expect.push_front( core::to_string( i ) );
+		} else {
+			__v.emplace_back( core::to_string( i ) );
+			__expect.emplace_back( core::to_string( i ) );
+		}
+	}
+	EXPECT_TRUE( __same( __expect, __v ) );
+	EXPECT_EQ( __v.span().data(), __v.data() );
+	EXPECT_EQ( __v.span().size(), __v.size() );
+	EXPECT_EQ( &__v.front(), __v.data() );
+	EXPECT_EQ( &__v.back(), __v.data() + __v.size() - 1 );
+
+	//<--- an argument aliasing an element survives the reallocation it triggers
+	__v.shrink_to_fit();
+	EXPECT_EQ( 0u, __v.front_free_capacity() );
+	EXPECT_EQ( 0u, __v.back_free_capacity() );
+	__v.push_front( __v.back() );
+	__expect.push_front( __expect.back() );
+	__v.shrink_to_fit();
+	__v.push_back( __v.front() );
+	__expect.push_back( __expect.front() );
+	EXPECT_TRUE( __same( __expect, __v ) );
+
+	while ( !__expect.empty() ) {
+		if ( __expect.size() % 2 == 0 ) {
+			__v.pop_front();
+			__expect.pop_front();
+		} else {
+			__v.pop_back();
+			__expect.pop_back();
+		}
+		ASSERT_TRUE( __same( __expect, __v ) );
+	}
+	EXPECT_TRUE( __v.empty() );
+	EXPECT_THROW( __v.at( 0 ), core::out_of_range );
+
+	__v.reserve_front( 10 );
+	EXPECT_GE( __v.front_free_capacity(), 10u );
+	__v.reserve_back( 100 );
+	EXPECT_GE( __v.front_free_capacity(), 10u );
+	EXPECT_GE( __v.back_free_capacity(), 100u );
+}
+
+TEST( DEVECTOR, insert_erase_middle ) {
+	nya::devector< int64_t > __v{ 1, 2, 3 };
+	core::deque< int64_t >   __expect{ 1, 2, 3 };
+	for ( int i = 0; i < 2000; i++ ) {
+		const size_t __pos = static_cast< size_t >( distribution( generator ) ) % ( __expect.size() + 1 );
+		const auto   __x   = distribution( generator );
+		switch ( distribution( generator ) % 5 ) {
+			case 0:
+				EXPECT_EQ( __x, *__v.insert( __v.begin() + __pos, __x ) );
+				__expect.insert( __expect.begin() + __pos, __x );
+				break;
+			case 1:
+				__v.insert( __v.begin() + __pos, 3, __x );
+				__expect.insert( __expect.begin() + __pos, 3, __x );
+				break;
+			case 2:
+				__v.insert( __v.begin() + __pos, { __x, __x + 1, __x + 2, __x + 3 } );
+				__expect.insert( __expect.begin() + __pos, { __x, __x + 1, __x + 2, __x + 3 } );
+				break;
+			default:
+				if ( __pos < __expect.size() ) {
+					const size_t __n = core::min< size_t >( __expect.size() - __pos, 3 );
+					__v.erase( __v.begin() + __pos, __v.begin() + __pos + __n );
+					__expect.erase( __expect.begin() + __pos, __expect.begin() + __pos + __n );
+				}
+				break;
+		}
+		ASSERT_TRUE( __same( __expect, __v ) );
+	}
+
+	nya::devector< int64_t > __copy( __v );
+	EXPECT_TRUE( __copy == __v );
+	const auto __erased = nya::erase_if( __copy, []( int64_t __e ) { return __e % 2 == 0; } );
+	EXPECT_EQ( __v.size(), __copy.size() + __erased );
+	for ( int64_t __e : __copy ) EXPECT_EQ( 1, __e % 2 );
+
+	nya::devector< int64_t > __moved( core::move( __copy ) );
+	EXPECT_TRUE( __copy.empty() );
+	__copy = __moved;
+	EXPECT_TRUE( __copy == __moved );
+	__copy.swap( __v );
+	EXPECT_TRUE( __same( __expect, __copy ) );
+}
+
+TEST( DEVECTOR, sliding_window_keeps_capacity ) {
+	nya::devector< int64_t, core::allocator< int64_t >, nya::devector_growth< 0 > > __window;
+	core::deque< int64_t >                                                           __expect;
+	for ( int64_t i = 0; i < 64; i++ ) {
+		__window.push_back( i );
+		__expect.push_back( i );
+	}
+	size_t __cap = 0;
+	for ( int64_t i = 64; i < 100000; i++ ) {
+		__window.push_back( i );
+		__window.pop_front();
+		__expect.push_back( i );
+		__expect.pop_front();
+		if ( i == 1000 ) __cap = __window.capacity();//<--- the growth settles once the window fits in half of it
+	}
+	EXPECT_EQ( __cap, __window.capacity() );
+	EXPECT_TRUE( __same( __expect, __window ) );
+	EXPECT_EQ( 99999, __window.span().back() );
+}
+
+//<--- throws on the copy number `__countdown`, its move is not noexcept so relocation copies
+struct __throwing {
+	static inline int __countdown = -1;
+
+	int __v = 0;
+
+	__throwing( int __x )
+			: __v( __x ) {}
+	__throwing( const __throwing& __x )
+			: __v( __x.__v ) {
+		if ( __countdown >= 0 && __countdown-- == 0 ) throw core::runtime_error( "copy" );
+	}
+	__throwing( __throwing&& __x )
+			: __v( __x.__v ) {}
+	auto operator=( const __throwing& ) -> __throwing& = default;
+	auto operator=( __throwing&& ) -> __throwing&      = default;
+	auto operator==( const __throwing& __x ) const -> bool { return __v == __x.__v; }
+};
+
+TEST( DEVECTOR, strong_guarantee_on_growth ) {
+	nya::devector< __throwing > __v;
+	for ( int i = 0; i < 8; i++ ) __v.push_back( __throwing( i ) );
+	__v.shrink_to_fit();
+	const nya::devector< __throwing > __before( __v );
+
+	__throwing::__countdown = 3;
+	EXPECT_THROW( __v.push_front( __throwing( -1 ) ), core::runtime_error );
+	__throwing::__countdown = -1;
+	EXPECT_TRUE( __v == __before );
+
+	__throwing::__countdown = 5;
+	EXPECT_THROW( __v.push_back( __throwing( 8 ) ), core::runtime_error );
+	__throwing::__countdown = -1;
+	EXPECT_TRUE( __v == __before );
+}
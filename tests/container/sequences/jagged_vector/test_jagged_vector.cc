@@ -0,0 +1,117 @@
+#include "jagged_vector.hpp"
+#include "gtest/gtest.h"
+
+#include <algorithm>
+#include <random>
+#include <stdexcept>
+#include <stdint.h>
+#include <utility>
+#include <vector>
+
+namespace core = std;
+
+using __jagged = nya::jagged_vector< uint32_t >;
+using __nested = core::vector< core::vector< uint32_t > >;
+
+static core::random_device                        rd;
+static core::mt19937                              generator( rd() );
+static core::uniform_int_distribution< uint32_t > distribution( 0, 100000 );
+
+static auto __same( const __nested& __expect, const __jagged& __j ) -> bool {
+	if ( __expect.size() != __j.rows() ) return false;
+	for ( size_t __r = 0; __r < __expect.size(); __r++ ) {
+		if ( !core::ranges::equal( __expect[ __r ], __j[ __r ] ) ) return false;
+	}
+	return true;
+}
+
+TEST( JAGGED_VECTOR, push_rows ) {
+	__jagged __e;
+	ASSERT_TRUE( __e.empty() );
+	ASSERT_EQ( 0, __e.size() );
+	ASSERT_EQ( __e, __jagged( 0 ) );
+
+	__jagged __j{ { 1, 2 }, {}, { 3 } };
+	ASSERT_EQ( 3, __j.rows() );
+	ASSERT_EQ( 3, __j.size() );
+	ASSERT_EQ( 0, __j.row_size( 1 ) );
+	ASSERT_EQ( 3, __j.at( 2 )[ 0 ] );
+	ASSERT_THROW( __j.at( 3 ), core::out_of_range );
+
+	__nested __expect{ { 1, 2 }, {}, { 3 } };
+	for ( int i = 0; i < 2000; i++ ) {
+		const uint32_t __x = distribution( generator );
+		switch ( __x % 4 ) {
+			case 0: {
+				core::vector< uint32_t > __row( __x % 7, __x );
+				__j.push_row( __row );
+				__expect.push_back( __row );
+				break;
+			}
+			case 1:
+				__j.push_row();
+				__expect.emplace_back();
+				break;
+			case 2:
+				__j.push_back( __x );
+				__expect.back().push_back( __x );
+				break;
+			default:
+				if ( __j.rows() > 1 ) {
+					__j.pop_row();
+					__expect.pop_back();
+				}
+		}
+	}
+	ASSERT_TRUE( __same( __expect, __j ) );
+	ASSERT_EQ( __j.offsets().back(), __j.size() );
+
+	for ( auto& __v : __j.back() ) __v = 7;
+	ASSERT_TRUE( core::ranges::all_of( __j.back(), []( uint32_t __v ) { return __v == 7; } ) );
+
+	__jagged __c( __j );
+	ASSERT_EQ( __j, __c );
+	__c.clear();
+	ASSERT_TRUE( __c.empty() );
+	__c.swap( __j );
+	ASSERT_TRUE( __j.empty() );
+}
+
+TEST( JAGGED_VECTOR, from_pairs ) {
+	const uint32_t                                   __rows = 500;
+	core::vector< core::pair< uint32_t, uint32_t > > __edges;
+	__nested                                         __expect( __rows );
+	for ( int i = 0; i < 20000; i++ ) {
+		const uint32_t __from = distribution( generator ) % __rows;
+		const uint32_t __to   = distribution( generator );
+		__edges.emplace_back( __from, __to );
+		__expect[ __from ].push_back( __to );//<--- the order of the pairs is kept
+	}
+
+	for ( size_t __jobs : { 1, 3, 0 } ) {
+		const auto __j = __jagged::from_pairs( __rows, __edges.begin(), __edges.end(), __jobs );
+		ASSERT_TRUE( __same( __expect, __j ) ) << "jobs " << __jobs;
+	}
+
+	__edges.emplace_back( __rows, 0 );
+	ASSERT_THROW( __jagged::from_pairs( __rows, __edges.begin(), __edges.end(), 4 ), core::out_of_range );
+	ASSERT_TRUE( __jagged::from_pairs( 0, __edges.end(), __edges.end() ).empty() );
+}
+
+TEST( JAGGED_VECTOR, build ) {
+	const size_t __rows = 1000;
+	__nested     __expect( __rows );
+	for ( size_t __r = 0; __r < __rows; __r++ ) {
+		for ( size_t i = 0; i < __r % 13; i++ ) __expect[ __r ].push_back( static_cast< uint32_t >( __r * 100 + i ) );
+	}
+	for ( size_t __jobs : { 1, 4 } ) {
+		const auto __j = __jagged::build(
+			__rows,
+			[]( size_t __r ) { return __r % 13; },
+			[]( size_t __r, core::span< uint32_t > __row ) {
+				for ( size_t i = 0; i < __row.size(); i++ ) __row[ i ] = static_cast< uint32_t >( __r * 100 + i );
+			},
+			__jobs );
+		ASSERT_TRUE( __same( __expect, __j ) ) << "jobs " << __jobs;
+	}
+}
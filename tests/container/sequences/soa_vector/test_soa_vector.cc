@@ -0,0 +1,155 @@
+#include "soa_vector.hpp"
+#include "gtest/gtest.h"
+
+#include <cstdint>
+#include <numeric>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <tuple>
+#include <vector>
+
+namespace core = std;
+
+using __soa = nya::soa_vector< int64_t, double, core::string >;
+
+static core::random_device                       rd;
+static core::mt19937                             generator( rd() );
+static core::uniform_int_distribution< int64_t > distribution( 0, 100000 );
+
+static auto __same( const core::vector< core::tuple< int64_t, double, core::string > >& __expect, const __soa& __v ) -> bool {
+	if ( __expect.size() != __v.size() ) return false;
+	for ( size_t i = 0; i < __expect.size(); i++ ) {
+		if ( __v[ i ] != __expect[ i ] ) return false;
+	}
+	return true;
+}
+
+//<--- throws on the copy number `__countdown`, its move is not noexcept so relocation copies
+struct __throwing {
+	static inline int __countdown = -1;
+
+	int __v = 0;
+
+	__throwing( int __x )
+			: __v( __x ) {}
+	__throwing( const __throwing& __x )
+			: __v( __x.__v ) {
+		if ( __countdown >= 0 && __countdown-- == 0 ) throw core::runtime_error( "copy" );
+	}
+	__throwing( __throwing&& __x )
+			: __throwing( static_cast< const __throwing& >( __x ) ) {}
+	auto operator=( const __throwing& ) -> __throwing& = default;
+	auto operator==( const __throwing& ) const -> bool  = default;
+};
+
+TEST( SOA_VECTOR, push_and_columns ) {
+	__soa                                                        __v;
+	core::vector< core::tuple< int64_t, double, core::string > > __expect;
+	for ( int i = 0; i < 1000; i++ ) {
+		const int64_t __k = distribution( generator );
+		switch ( i % 3 ) {
+			case 0: __v.push_back( __k, 0.5 * static_cast< double >( __k ), core::to_string( __k ) ); break;
+			case 1: __v.emplace_back( __k, 0.5 * static_cast< double >( __k ), core::to_string( __k ) ); break;
+			default:
+				__v.emplace_back(
+					core::piecewise_construct,
+					core::forward_as_tuple( __k ),
+					core::forward_as_tuple( 0.5 * static_cast< double >( __k ) ),
+					core::forward_as_tuple( core::to_string( __k ) ) );
+		}
+		__expect.emplace_back( __k, 0.5 * static_cast< double >( __k ), core::to_string( __k ) );
+	}
+	ASSERT_TRUE( __same( __expect, __v ) );
+	ASSERT_THROW( __v.at( __v.size() ), core::out_of_range );
+
+	//<--- each column is contiguous and cache line aligned
+	ASSERT_EQ( 0, reinterpret_cast< uintptr_t >( __v.column< 0 >().data() ) % 64 );
+	ASSERT_EQ( 0, reinterpret_cast< uintptr_t >( __v.column< 1 >().data() ) % 64 );
+	ASSERT_EQ( 0, reinterpret_cast< uintptr_t >( __v.column< 2 >().data() ) % 64 );
+	const auto __keys = __v.column< 0 >();
+	ASSERT_EQ( core::accumulate( __expect.begin(), __expect.end(), int64_t( 0 ), []( int64_t __s, const auto& __r ) { return __s + core::get< 0 >( __r ); } ),
+						 core::accumulate( __keys.begin(), __keys.end(), int64_t( 0 ) ) );
+
+	for ( double& __d : __v.column< 1 >() ) __d = -__d;
+	core::get< 2 >( __v[ 3 ] ) = "three";
+	ASSERT_EQ( "three", core::get< 2 >( __v.at( 3 ) ) );
+	ASSERT_EQ( -0.5 * static_cast< double >( core::get< 0 >( __v.back() ) ), core::get< 1 >( __v.back() ) );
+
+	//<--- the argument refers to the storage that is reallocated
+	__soa __a;
+	__a.emplace_back( 1, 1.0, "a long string that does not fit inline" );
+	__a.shrink_to_fit();
+	__a.push_back( core::get< 0 >( __a[ 0 ] ), core::get< 1 >( __a[ 0 ] ), core::get< 2 >( __a[ 0 ] ) );
+	ASSERT_EQ( __a[ 0 ], __a[ 1 ] );
+}
+
+TEST( SOA_VECTOR, insert_erase ) {
+	__soa                                                        __v;
+	core::vector< core::tuple< int64_t, double, core::string > > __expect;
+	for ( int i = 0; i < 2000; i++ ) {
+		const int64_t __k = distribution( generator );
+		if ( __expect.empty() || i % 3 ) {
+			const size_t __pos = static_cast< size_t >( __k ) % ( __expect.size() + 1 );
+			__v.insert( __pos, __k, 1.0, core::to_string( __k ) );
+			__expect.emplace( __expect.begin() + static_cast< ptrdiff_t >( __pos ), __k, 1.0, core::to_string( __k ) );
+		} else {
+			const size_t __pos = static_cast< size_t >( __k ) % __expect.size();
+			__v.erase( __pos );
+			__expect.erase( __expect.begin() + static_cast< ptrdiff_t >( __pos ) );
+		}
+	}
+	ASSERT_TRUE( __same( __expect, __v ) );
+
+	__v.erase( 10, 100 );
+	__expect.erase( __expect.begin() + 10, __expect.begin() + 100 );
+	ASSERT_TRUE( __same( __expect, __v ) );
+	ASSERT_THROW( __v.erase( 5, __v.size() + 1 ), core::out_of_range );
+	ASSERT_THROW( __v.insert( __v.size() + 1, 0, 0.0, "" ), core::out_of_range );
+
+	__soa __c( __v );
+	ASSERT_EQ( __v, __c );
+	__c.pop_back();
+	ASSERT_FALSE( __v == __c );
+	__c = __v;
+	ASSERT_EQ( __v, __c );
+	__soa __m( core::move( __c ) );
+	ASSERT_TRUE( __c.empty() );
+	ASSERT_EQ( __v, __m );
+
+	__m.resize( 5 );
+	ASSERT_EQ( 5, __m.size() );
+	__m.resize( 8 );
+	ASSERT_EQ( ( core::tuple< int64_t, double, core::string >{} ), __m[ 7 ] );
+	__m.clear();
+	ASSERT_TRUE( __m.empty() );
+	__m.shrink_to_fit();
+	ASSERT_EQ( 0, __m.capacity() );
+}
+
+TEST( SOA_VECTOR, strong_guarantee ) {
+	nya::soa_vector< core::string, __throwing > __v;
+	for ( int i = 0; i < 4; i++ ) __v.emplace_back( core::to_string( i ), i );
+	__v.shrink_to_fit();
+
+	//<--- the growth copies the rows, the third copy throws
+	__throwing::__countdown = 2;
+	ASSERT_THROW( __v.push_back( "x", __throwing( 9 ) ), core::runtime_error );
+	__throwing::__countdown = -1;
+	ASSERT_EQ( 4, __v.size() );
+	ASSERT_EQ( 4, __v.capacity() );
+	for ( int i = 0; i < 4; i++ ) {
+		ASSERT_EQ( core::to_string( i ), core::get< 0 >( __v[ static_cast< size_t >( i ) ] ) );
+		ASSERT_EQ( i, core::get< 1 >( __v[ static_cast< size_t >( i ) ] ).__v );
+	}
+
+	//<--- the second field of the new row throws, the first one is destroyed
+	__v.reserve( 8 );
+	const __throwing __t( 5 );
+	__throwing::__countdown = 0;
+	ASSERT_THROW( __v.push_back( "y", __t ), core::runtime_error );
+	__throwing::__countdown = -1;
+	ASSERT_EQ( 4, __v.size() );
+	__v.push_back( "y", __t );
+	ASSERT_EQ( 5, core::get< 1 >( __v.back() ).__v );
+}
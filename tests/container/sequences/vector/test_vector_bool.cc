@@ -0,0 +1,257 @@
+#include "vector.hpp"
+#include "gtest/gtest.h"
+
+#include <algorithm>
+#include <memory>
+#include <random>
+#include <ranges>
+#include <stdexcept>
+#include <stdint.h>
+#include <vector>
+
+using __bit_vector = nya::vector< bool, core::allocator< bool > >;
+
+static core::random_device                    rd;
+static core::mt19937                          generator( rd() );
+static core::uniform_int_distribution< int >  distribution( 0, 1 );
+static core::uniform_int_distribution< long > position( 0, 1 << 20 );
+
+static_assert( core::random_access_iterator< __bit_vector::iterator > );
+static_assert( core::random_access_iterator< __bit_vector::const_iterator > );
+static_assert( core::ranges::random_access_range< __bit_vector > );
+
+static auto __random_bits( size_t __n ) -> core::vector< bool > {
+	core::vector< bool > __bits( __n );
+	for ( size_t i = 0; i < __n; i++ ) __bits[ i ] = distribution( generator );
+	return __bits;
+}
+
+namespace {
+
+inline long __live_words = 0;
+
+//<--- counts the storage not yet given back
+template < typename _Tp >
+struct __live_allocator : core::allocator< _Tp > {
+	template < typename _Up >
+	struct rebind {
+		using other = __live_allocator< _Up >;
+	};
+
+	__live_allocator() = default;
+
+	template < typename _Up >
+	__live_allocator( const __live_allocator< _Up >& ) {}
+
+	auto allocate( size_t __n ) -> _Tp* {
+		__live_words += static_cast< long >( __n );
+		return core::allocator< _Tp >::allocate( __n );
+	}
+
+	auto deallocate( _Tp* __p, size_t __n ) -> void {
+		__live_words -= static_cast< long >( __n );
+		core::allocator< _Tp >::deallocate( __p, __n );
+	}
+};
+
+//<--- converts to `true`, or throws
+struct __poisoned_bit {
+	bool __ok;
+
+	operator bool() const {
+		if ( !__ok ) throw core::runtime_error( "poisoned bit" );
+		return true;
+	}
+};
+
+}// namespace
+
+static auto __same( const core::vector< bool >& __expect, const __bit_vector& __v ) -> bool {
+	return __expect.size() == __v.size() && core::equal( __expect.begin(), __expect.end(), __v.begin() );
+}
+
+TEST( VECTOR_BOOL, construct ) {
+	__bit_vector __v{};
+	ASSERT_EQ( 0, __v.size() );
+	ASSERT_EQ( 0, __v.capacity() );
+
+	size_t       __v_size = 1000000;
+	__bit_vector __w( __v_size, true );
+	ASSERT_EQ( __v_size, __w.size() );
+	ASSERT_GE( __w.capacity(), __v_size );
+	ASSERT_LT( __w.capacity(), __v_size + 64 );//<--- one bit per flag
+	ASSERT_EQ( (long) __v_size, nya::count( __w.begin(), __w.end(), true ) );
+
+	auto         __bits = __random_bits( __v_size );
+	__bit_vector __x( __bits.begin(), __bits.end() );
+	ASSERT_TRUE( __same( __bits, __x ) );
+
+	__bit_vector __y( __x );
+	ASSERT_TRUE( __x == __y );
+	__bit_vector __z( core::move( __y ) );
+	ASSERT_TRUE( __x == __z );
+	ASSERT_EQ( 0, __y.size() );
+
+	__bit_vector __il{ true, false, true };
+	ASSERT_EQ( 3, __il.size() );
+	ASSERT_TRUE( __il[ 0 ] );
+	ASSERT_FALSE( __il[ 1 ] );
+	ASSERT_TRUE( __il.at( 2 ) );
+	ASSERT_THROW( __il.at( 3 ), core::out_of_range );
+
+	__bit_vector __r( nya::from_range, __bits | core::views::take( 100 ) );
+	ASSERT_TRUE( core::equal( __bits.begin(), __bits.begin() + 100, __r.begin(), __r.end() ) );
+}
+
+TEST( VECTOR_BOOL, push_back_and_resize ) {
+	size_t               __v_size = 100000;
+	auto                 __bits   = __random_bits( __v_size );
+	__bit_vector         __v;
+	core::vector< bool > __expect;
+	for ( size_t i = 0; i < __v_size; i++ ) {
+		__v.push_back( __bits[ i ] );
+		__expect.push_back( __bits[ i ] );
+	}
+	ASSERT_TRUE( __same( __expect, __v ) );
+
+	__v.resize( 100, true );
+	__expect.resize( 100, true );
+	ASSERT_TRUE( __same( __expect, __v ) );
+	__v.resize( 1000, true );
+	__expect.resize( 1000, true );
+	ASSERT_TRUE( __same( __expect, __v ) );
+
+	__v.pop_back();
+	__expect.pop_back();
+	ASSERT_TRUE( __same( __expect, __v ) );
+
+	__v.shrink_to_fit();
+	ASSERT_LT( __v.capacity(), __v.size() + 64 );
+	ASSERT_TRUE( __same( __expect, __v ) );
+}
+
+TEST( VECTOR_BOOL, insert_erase ) {
+	auto                 __bits = __random_bits( 5000 );
+	__bit_vector         __v( __bits.begin(), __bits.end() );
+	core::vector< bool > __expect( __bits );
+
+	for ( int __round = 0; __round < 200; __round++ ) {
+		const long   __pos = position( generator ) % ( (long) __expect.size() + 1 );
+		const long   __n   = position( generator ) % 150;
+		const bool   __x   = distribution( generator );
+		auto         __src = __random_bits( (size_t) __n );
+		__bit_vector __in( __src.begin(), __src.end() );
+		switch ( __round % 4 ) {
+			case 0:
+				__v.insert( __v.cbegin() + __pos, __x );
+				__expect.insert( __expect.begin() + __pos, __x );
+				break;
+			case 1:
+				__v.insert( __v.cbegin() + __pos, (size_t) __n, __x );
+				__expect.insert( __expect.begin() + __pos, (size_t) __n, __x );
+				break;
+			case 2:
+				//<--- bit iterators as the source, unaligned word copies
+				__v.insert( __v.cbegin() + __pos, __in.begin(), __in.end() );
+				__expect.insert( __expect.begin() + __pos, __src.begin(), __src.end() );
+				break;
+			default: {
+				const long __last = core::min< long >( __pos + __n, (long) __expect.size() );
+				__v.erase( __v.cbegin() + __pos, __v.cbegin() + __last );
+				__expect.erase( __expect.begin() + __pos, __expect.begin() + __last );
+			}
+		}
+		ASSERT_TRUE( __same( __expect, __v ) ) << "round " << __round;
+	}
+
+	__v.erase( __v.cbegin() + 7 );
+	__expect.erase( __expect.begin() + 7 );
+	ASSERT_TRUE( __same( __expect, __v ) );
+}
+
+TEST( VECTOR_BOOL, word_algorithms ) {
+	size_t       __v_size = 1000003;
+	auto         __bits   = __random_bits( __v_size );
+	__bit_vector __v( __bits.begin(), __bits.end() );
+
+	for ( long __first : { 0L, 1L, 63L, 64L, 65L, 1000L } ) {
+		for ( long __last : { 1000L, 1001L, 1024L, 200000L, (long) __v_size } ) {
+			ASSERT_EQ(
+				core::count( __bits.begin() + __first, __bits.begin() + __last, true ),
+				nya::count( __v.cbegin() + __first, __v.cbegin() + __last, true ) );
+			ASSERT_EQ(
+				core::count( __bits.begin() + __first, __bits.begin() + __last, false ),
+				nya::count( __v.begin() + __first, __v.begin() + __last, false ) );
+		}
+	}
+
+	//<--- find
+	__bit_vector __zeros( 100000, false );
+	ASSERT_EQ( __zeros.end(), nya::find( __zeros.begin(), __zeros.end(), true ) );
+	__zeros[ 77777 ] = true;
+	ASSERT_EQ( __zeros.begin() + 77777, nya::find( __zeros.begin(), __zeros.end(), true ) );
+	ASSERT_EQ( __zeros.end(), nya::find( __zeros.begin() + 77778, __zeros.end(), true ) );
+	ASSERT_EQ( __zeros.begin() + 77777, nya::find( __zeros.cbegin() + 70, __zeros.cbegin() + 77778, true ) );
+	ASSERT_EQ( __zeros.begin() + 5, nya::find( __zeros.begin() + 5, __zeros.end(), false ) );
+
+	//<--- fill
+	nya::fill( __v.begin() + 3, __v.begin() + 300000, true );
+	core::fill( __bits.begin() + 3, __bits.begin() + 300000, true );
+	ASSERT_TRUE( __same( __bits, __v ) );
+
+	//<--- copy, unaligned source and destination
+	__bit_vector __w( __v_size, false );
+	nya::copy( __v.cbegin() + 5, __v.cbegin() + 900005, __w.begin() + 17 );
+	ASSERT_TRUE( core::equal( __bits.begin() + 5, __bits.begin() + 900005, __w.begin() + 17 ) );
+	ASSERT_FALSE( __w[ 16 ] );
+	ASSERT_TRUE( nya::equal( __v.cbegin() + 5, __v.cbegin() + 900005, __w.cbegin() + 17 ) );
+	__w[ 500000 ] = !__w[ 500000 ];
+	ASSERT_FALSE( nya::equal( __v.cbegin() + 5, __v.cbegin() + 900005, __w.cbegin() + 17 ) );
+
+	//<--- flip and equality
+	__bit_vector __f( __v );
+	ASSERT_TRUE( __f == __v );
+	__f.flip();
+	ASSERT_FALSE( __f == __v );
+	ASSERT_EQ( (long) __v_size - nya::count( __v.begin(), __v.end(), true ), nya::count( __f.begin(), __f.end(), true ) );
+	__f.flip();
+	ASSERT_TRUE( __f == __v );
+	__f.back() = !__f.back();
+	ASSERT_TRUE( __f != __v );
+}
+
+TEST( VECTOR_BOOL, reference ) {
+	__bit_vector __v( 10, false );
+	__v[ 1 ] = true;
+	__v[ 2 ] = __v[ 1 ];
+	__v[ 3 ].flip();
+	ASSERT_TRUE( __v[ 2 ] );
+	ASSERT_TRUE( __v[ 3 ] );
+	ASSERT_FALSE( ~__v[ 3 ] );
+
+	__bit_vector::swap( __v[ 0 ], __v[ 1 ] );
+	ASSERT_TRUE( __v[ 0 ] );
+	ASSERT_FALSE( __v[ 1 ] );
+
+	//<--- proxies satisfy the ranges algorithms
+	core::ranges::fill( __v, true );
+	ASSERT_EQ( 10, nya::count( __v.begin(), __v.end(), true ) );
+}
+
+TEST( VECTOR_BOOL, construct_throws ) {
+	//<--- the storage is given back when an element throws while the words are written
+	using __live_vector = nya::vector< bool, __live_allocator< bool > >;
+	core::vector< __poisoned_bit > __bits( 1000, __poisoned_bit{ true } );
+	__bits[ 700 ].__ok = false;
+
+	ASSERT_THROW( __live_vector( __bits.begin(), __bits.end() ), core::runtime_error );
+	ASSERT_EQ( __live_words, 0 );
+	ASSERT_THROW( __live_vector( nya::from_range, __bits ), core::runtime_error );
+	ASSERT_EQ( __live_words, 0 );
+
+	__bits[ 700 ].__ok = true;
+	__live_vector __v( __bits.begin(), __bits.end() );
+	ASSERT_EQ( __v.size(), 1000u );
+	ASSERT_EQ( nya::count( __v.begin(), __v.end(), true ), 1000 );
+	ASSERT_GT( __live_words, 0 );
+}
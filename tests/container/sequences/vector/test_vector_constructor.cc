@@ -7,6 +7,9 @@
 #include <initializer_list>
 #include <memory>
 #include <random>
+#include <ranges>
+#include <span>
+#include <sstream>
 #include <stdint.h>
 
 static core::random_device                       rd;
@@ -358,6 +361,43 @@ TEST( VECTOR_CONSTRUCTOR, move_construct_with_allocator ) {
 	}
 }
 
+TEST( VECTOR_CONSTRUCTOR, range_construct ) {
+	size_t                        __v_size = 1000000;
+	core::unique_ptr< int64_t[] > __v_range( new int64_t[ __v_size ]{} );
+
+	for ( size_t i = 0; i < __v_size; i++ ) {
+		__v_range[ i ] = distribution( generator );
+	}
+
+	//<--- contiguous range, copied in bulk
+	core::span< const int64_t > __span( __v_range.get(), __v_size );
+	nya::vector< int64_t, core::allocator< int64_t > > __v( nya::from_range, __span );
+	ASSERT_EQ( __v_size, __v.size() );
+	ASSERT_EQ( __v_size, __v.capacity() );
+	ASSERT_TRUE( core::equal( __v.begin(), __v.end(), __v_range.get() ) );
+
+	//<--- sized view with input iterators, still a single allocation of the exact size
+	auto __twice = __span | core::views::transform( []( int64_t __x ) { return __x / 2; } );
+	nya::vector< int64_t, core::allocator< int64_t > > __w( nya::from_range, __twice, core::allocator< int64_t >() );
+	ASSERT_EQ( __v_size, __w.size() );
+	ASSERT_EQ( __v_size, __w.capacity() );
+	for ( size_t i = 0; i < __v_size; i++ ) {
+		ASSERT_EQ( __v_range[ i ] / 2, __w[ i ] );
+	}
+
+	//<--- single pass, unsized
+	core::istringstream                                __in( "1 2 3 4 5" );
+	nya::vector< int64_t, core::allocator< int64_t > > __x( nya::from_range, core::views::istream< int64_t >( __in ) );
+	ASSERT_EQ( 5, __x.size() );
+	for ( size_t i = 0; i < __x.size(); i++ ) {
+		ASSERT_EQ( static_cast< int64_t >( i + 1 ), __x[ i ] );
+	}
+
+	nya::vector< int64_t, core::allocator< int64_t > > __y( nya::from_range, core::views::empty< int64_t > );
+	ASSERT_EQ( 0, __y.size() );
+	ASSERT_EQ( 0, __y.capacity() );
+}
+
 GTEST_API_ int main( int argc, char* argv[] ) {
 	LLVM_MSTL_LOGGER_FORMAT_INIT();
 	testing::InitGoogleTest( &argc, argv );
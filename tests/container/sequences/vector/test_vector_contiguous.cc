@@ -0,0 +1,167 @@
+#include "vector.hpp"
+#include "gtest/gtest.h"
+
+#include <array>
+#include <cstdint>
+#include <deque>
+#include <iterator>
+#include <list>
+#include <memory>
+#include <numeric>
+#include <span>
+#include <string>
+#include <vector>
+
+namespace core = std;
+
+template < typename _Tp >
+using __vec = nya::vector< _Tp, core::allocator< _Tp > >;
+
+static_assert( core::contiguous_iterator< __vec< int >::iterator > );
+static_assert( core::contiguous_iterator< __vec< int >::const_iterator > );
+static_assert( core::ranges::contiguous_range< __vec< int > > );
+
+//<--- the sources copied as the `const _Type*` range of their addresses
+using __alloc = core::allocator< int >;
+static_assert( nya::__is_contiguous_copy_source< __alloc, __vec< int >::iterator, __vec< int >::iterator, int* > );
+static_assert( nya::__is_contiguous_copy_source< __alloc, __vec< int >::const_iterator, __vec< int >::const_iterator, int* > );
+static_assert( nya::__is_contiguous_copy_source< __alloc, int*, int*, int* > );
+static_assert( nya::__is_contiguous_copy_source< __alloc, core::span< const int >::iterator, core::span< const int >::iterator, int* > );
+static_assert( nya::__is_contiguous_copy_source< __alloc, core::vector< int >::iterator, core::vector< int >::iterator, int* > );
+static_assert( nya::__is_contiguous_copy_source< __alloc, core::move_iterator< int* >, core::move_iterator< int* >, int* > );
+static_assert( !nya::__is_contiguous_copy_source< __alloc, const int*, const int*, int* > );//<--- already the fast overload
+static_assert( !nya::__is_contiguous_copy_source< __alloc, core::deque< int >::iterator, core::deque< int >::iterator, int* > );
+static_assert( !nya::__is_contiguous_copy_source< __alloc, core::list< int >::iterator, core::list< int >::iterator, int* > );
+static_assert( !nya::__is_contiguous_copy_source< __alloc, const long*, const long*, int* > );
+static_assert( !nya::__is_contiguous_copy_source< core::allocator< core::string >, core::string*, core::string*, core::string* > );
+
+namespace {
+
+//<--- counts the copies it constructs itself
+template < typename _Tp >
+struct __counting_allocator : core::allocator< _Tp > {
+	template < typename _Up >
+	struct rebind {
+		using other = __counting_allocator< _Up >;
+	};
+
+	__counting_allocator() = default;
+
+	template < typename _Up >
+	__counting_allocator( const __counting_allocator< _Up >& __a )
+			: core::allocator< _Tp >( __a )
+			, __constructed( __a.__constructed ) {}
+
+	template < typename _Up, typename... _Args >
+	auto construct( _Up* __p, _Args&&... __args ) -> void {
+		::new ( static_cast< void* >( __p ) ) _Up( core::forward< _Args >( __args )... );
+		++*__constructed;
+	}
+
+	core::shared_ptr< size_t > __constructed = core::make_shared< size_t >( 0 );
+};
+
+struct __move_only {
+	int __v;
+
+	explicit __move_only( int __x )
+			: __v( __x ) {}
+	__move_only( __move_only&& )      = default;
+	__move_only( const __move_only& ) = delete;
+};
+
+//<--- a copy of its own, the move of the bytes: a `move_iterator` has to move it
+struct __counted_copy {
+	int __v;
+
+	static inline size_t __copies = 0;
+
+	explicit __counted_copy( int __x )
+			: __v( __x ) {}
+	__counted_copy( __counted_copy&& ) = default;
+	__counted_copy( const __counted_copy& __o )
+			: __v( __o.__v ) {
+		++__copies;
+	}
+};
+
+}// namespace
+
+static_assert( !nya::__is_contiguous_copy_source< core::allocator< __move_only >, core::move_iterator< __move_only* >, core::move_iterator< __move_only* >, __move_only* > );
+static_assert( !nya::__is_contiguous_copy_source< core::allocator< __counted_copy >, core::move_iterator< __counted_copy* >, core::move_iterator< __counted_copy* >, __counted_copy* > );
+
+TEST( VECTOR_CONTIGUOUS, copy_and_range_constructors ) {
+	for ( size_t __n : { 0, 1, 31, 1000, 1 << 20 } ) {
+		core::vector< int64_t > __expect( __n );
+		core::iota( __expect.begin(), __expect.end(), -7 );
+
+		__vec< int64_t > __a( __expect.begin(), __expect.end() );//<--- from the iterators of `core::vector`
+		ASSERT_TRUE( core::equal( __a.data(), __a.data() + __a.size(), __expect.begin(), __expect.end() ) ) << "n " << __n;
+
+		__vec< int64_t > __b( __a );//<--- the copy constructor
+		ASSERT_TRUE( core::equal( __b.data(), __b.data() + __b.size(), __expect.begin(), __expect.end() ) ) << "n " << __n;
+
+		const __vec< int64_t >& __ca = __a;
+		__vec< int64_t >        __c( __ca.begin(), __ca.end() );//<--- from `const_iterator`
+		ASSERT_TRUE( core::equal( __c.data(), __c.data() + __c.size(), __expect.begin(), __expect.end() ) ) << "n " << __n;
+
+		core::span< const int64_t > __s( __expect );
+		__vec< int64_t >            __d( __s.begin(), __s.end() );
+		ASSERT_TRUE( core::equal( __d.data(), __d.data() + __d.size(), __expect.begin(), __expect.end() ) ) << "n " << __n;
+
+		__vec< int64_t > __e( core::make_move_iterator( __b.begin() ), core::make_move_iterator( __b.end() ) );
+		ASSERT_TRUE( core::equal( __e.data(), __e.data() + __e.size(), __expect.begin(), __expect.end() ) ) << "n " << __n;
+	}
+}
+
+TEST( VECTOR_CONTIGUOUS, insert_and_assign_from_contiguous ) {
+	const core::array< int32_t, 5 > __src{ 10, 20, 30, 40, 50 };
+	__vec< int32_t >                __v;
+	for ( int32_t __i = 0; __i != 8; ++__i ) __v.push_back( __i );
+	core::vector< int32_t > __expect( __v.data(), __v.data() + __v.size() );
+
+	//<--- into a new buffer, then into the spare capacity
+	__v.insert( __v.begin() + 3, __src.begin(), __src.end() );
+	__expect.insert( __expect.begin() + 3, __src.begin(), __src.end() );
+	__v.reserve( 64 );
+	__v.insert( __v.end() - 1, __src.begin(), __src.end() );
+	__expect.insert( __expect.end() - 1, __src.begin(), __src.end() );
+	ASSERT_TRUE( core::equal( __v.data(), __v.data() + __v.size(), __expect.begin(), __expect.end() ) );
+
+	__vec< int32_t > __w;
+	__w.assign( __v.begin(), __v.end() );
+	ASSERT_TRUE( core::equal( __w.data(), __w.data() + __w.size(), __expect.begin(), __expect.end() ) );
+}
+
+TEST( VECTOR_CONTIGUOUS, element_wise_where_needed ) {
+	//<--- not trivially copyable: each element is copied
+	__vec< core::string > __a;
+	for ( int __i = 0; __i != 100; ++__i ) __a.push_back( core::string( 40, static_cast< char >( 'a' + __i % 26 ) ) );
+	__vec< core::string > __b( __a.begin(), __a.end() );
+	__vec< core::string > __c( __a );
+	ASSERT_EQ( __b.size(), __a.size() );
+	ASSERT_EQ( __c.size(), __a.size() );
+	for ( size_t __i = 0; __i != __a.size(); ++__i ) {
+		ASSERT_EQ( __b[ __i ], __a[ __i ] );
+		ASSERT_EQ( __c[ __i ], __a[ __i ] );
+	}
+
+	//<--- an allocator with its own `construct` still constructs every element
+	const core::vector< int32_t >                         __src( 1000, 3 );
+	nya::vector< int32_t, __counting_allocator< int32_t > > __v( __src.begin(), __src.end() );
+	ASSERT_EQ( *__v.get_allocator().__constructed, 1000u );
+	for ( size_t __i = 0; __i != __v.size(); ++__i ) ASSERT_EQ( __v[ __i ], 3 );
+}
+
+TEST( VECTOR_CONTIGUOUS, move_iterator_moves ) {
+	__move_only __a[] = { __move_only( 1 ), __move_only( 2 ), __move_only( 3 ) };
+	nya::vector< __move_only, core::allocator< __move_only > > __v( core::make_move_iterator( __a ), core::make_move_iterator( __a + 3 ) );
+	ASSERT_EQ( __v.size(), 3u );
+	for ( size_t __i = 0; __i != __v.size(); ++__i ) ASSERT_EQ( __v[ __i ].__v, static_cast< int >( __i ) + 1 );
+
+	__counted_copy __b[] = { __counted_copy( 4 ), __counted_copy( 5 ), __counted_copy( 6 ) };
+	__counted_copy::__copies = 0;
+	nya::vector< __counted_copy, core::allocator< __counted_copy > > __w( core::make_move_iterator( __b ), core::make_move_iterator( __b + 3 ) );
+	ASSERT_EQ( __counted_copy::__copies, 0u );
+	for ( size_t __i = 0; __i != __w.size(); ++__i ) ASSERT_EQ( __w[ __i ].__v, static_cast< int >( __i ) + 4 );
+}
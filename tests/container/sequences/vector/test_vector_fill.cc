@@ -0,0 +1,165 @@
+#include "__algorithm/simd_dispatch.h"
+#include "__memory/default_init_allocator.h"
+#include "vector.hpp"
+#include "gtest/gtest.h"
+
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <random>
+#include <vector>
+
+namespace core = std;
+
+static core::random_device rd;
+static core::mt19937_64    generator( rd() );
+
+static const nya::simd_isa __all_isas[] = { nya::simd_isa::baseline, nya::simd_isa::avx2, nya::simd_isa::avx512 };
+static const size_t        __sizes[]    = { 0, 1, 7, 31, 32, 33, 64, 100, 1000, 4097 };
+
+namespace {
+
+enum class __color : int16_t { red = 3, green, blue };
+
+struct __pair16 {//<--- four bytes, aligned on two: filled element by element
+	int16_t __a;
+	int16_t __b;
+
+	auto operator==( const __pair16& ) const -> bool = default;
+};
+
+template < typename _Tp >
+using __vec = nya::vector< _Tp, core::allocator< _Tp > >;
+
+//<--- counts the elements it value-initializes itself
+template < typename _Tp >
+struct __counting_allocator : core::allocator< _Tp > {
+	template < typename _Up >
+	struct rebind {
+		using other = __counting_allocator< _Up >;
+	};
+
+	__counting_allocator() = default;
+
+	template < typename _Up >
+	__counting_allocator( const __counting_allocator< _Up >& __a )
+			: core::allocator< _Tp >( __a )
+			, __constructed( __a.__constructed ) {}
+
+	template < typename _Up >
+	auto construct( _Up* __p ) -> void {
+		::new ( static_cast< void* >( __p ) ) _Up( 42 );
+		++*__constructed;
+	}
+
+	core::shared_ptr< size_t > __constructed = core::make_shared< size_t >( 0 );
+};
+
+}// namespace
+
+template < typename _Tp >
+static auto __value_init_is_zero() -> void {
+	for ( size_t __n : __sizes ) {
+		__vec< _Tp > __v( __n );
+		ASSERT_EQ( __v.size(), __n );
+		for ( size_t __i = 0; __i != __n; ++__i ) ASSERT_EQ( __v[ __i ], _Tp() ) << "n " << __n << " at " << __i;
+		__v.resize( __n + 65 );
+		for ( size_t __i = 0; __i != __v.size(); ++__i ) ASSERT_EQ( __v[ __i ], _Tp() ) << "n " << __n << " at " << __i;
+	}
+}
+
+template < typename _Tp >
+static auto __fill_against_std( nya::simd_isa __isa, _Tp __x ) -> void {
+	for ( size_t __n : __sizes ) {
+		__vec< _Tp > __v( __n, __x );
+		ASSERT_EQ( __v.size(), __n );
+		for ( size_t __i = 0; __i != __n; ++__i ) ASSERT_EQ( __v[ __i ], __x ) << nya::simd_isa_name( __isa ) << " n " << __n << " at " << __i;
+
+		//<--- both paths of `insert`: into the spare capacity, and into a new buffer
+		for ( size_t __pos : { size_t( 0 ), __n / 2, __n } ) {
+			for ( size_t __k : { size_t( 1 ), size_t( 33 ), __n + 70 } ) {
+				core::vector< _Tp > __expect( __n );
+				__vec< _Tp >        __w;
+				__w.reserve( __n + 100 );
+				for ( size_t __i = 0; __i != __n; ++__i ) {
+					core::memset( static_cast< void* >( &__expect[ __i ] ), static_cast< int >( __i ), sizeof( _Tp ) );
+					__w.push_back( __expect[ __i ] );
+				}
+				__expect.insert( __expect.begin() + static_cast< ptrdiff_t >( __pos ), __k, __x );
+				__w.insert( __w.begin() + static_cast< ptrdiff_t >( __pos ), __k, __x );
+				ASSERT_EQ( __w.size(), __expect.size() );
+				ASSERT_EQ( 0, core::memcmp( __w.data(), __expect.data(), __w.size() * sizeof( _Tp ) ) )
+					<< nya::simd_isa_name( __isa ) << " n " << __n << " pos " << __pos << " k " << __k;
+			}
+		}
+
+		__v.assign( __n / 2, _Tp() );
+		__v.assign( __n, __x );
+		for ( size_t __i = 0; __i != __n; ++__i ) ASSERT_EQ( __v[ __i ], __x ) << nya::simd_isa_name( __isa ) << " n " << __n << " at " << __i;
+	}
+}
+
+TEST( VECTOR_FILL, value_init_is_zero ) {
+	__value_init_is_zero< int8_t >();
+	__value_init_is_zero< uint16_t >();
+	__value_init_is_zero< int32_t >();
+	__value_init_is_zero< int64_t >();
+	__value_init_is_zero< float >();
+	__value_init_is_zero< double >();
+	__value_init_is_zero< int* >();
+	__value_init_is_zero< __color >();
+	__value_init_is_zero< __pair16 >();
+}
+
+TEST( VECTOR_FILL, fill_every_supported_isa ) {
+	const nya::simd_isa __startup = nya::simd_active_isa();
+	for ( auto __isa : __all_isas ) {
+		if ( !nya::simd_select_isa( __isa ) ) continue;
+		__fill_against_std< uint8_t >( __isa, static_cast< uint8_t >( generator() ) );
+		__fill_against_std< int16_t >( __isa, static_cast< int16_t >( generator() ) );
+		__fill_against_std< int32_t >( __isa, static_cast< int32_t >( generator() ) );
+		__fill_against_std< int64_t >( __isa, static_cast< int64_t >( generator() ) );
+		__fill_against_std< float >( __isa, -1.5f );
+		__fill_against_std< double >( __isa, 3.25 );
+		__fill_against_std< __color >( __isa, __color::blue );
+		__fill_against_std< __pair16 >( __isa, __pair16{ 7, -9 } );
+	}
+	EXPECT_TRUE( nya::simd_select_isa( __startup ) );
+}
+
+TEST( VECTOR_FILL, fill_from_own_element ) {
+	//<--- the value is copied before the elements move, even when it is one of them
+	__vec< int32_t > __v;
+	__v.reserve( 64 );
+	for ( int32_t __i = 0; __i != 10; ++__i ) __v.push_back( __i );
+	__v.insert( __v.begin() + 2, 5, __v[ 4 ] );
+	const int32_t __expect[] = { 0, 1, 4, 4, 4, 4, 4, 2, 3, 4, 5, 6, 7, 8, 9 };
+	ASSERT_EQ( __v.size(), core::size( __expect ) );
+	for ( size_t __i = 0; __i != __v.size(); ++__i ) ASSERT_EQ( __v[ __i ], __expect[ __i ] );
+}
+
+TEST( VECTOR_FILL, allocator_construct_is_kept ) {
+	//<--- an allocator with its own `construct` still constructs every element
+	nya::vector< int32_t, __counting_allocator< int32_t > > __v( 1000 );
+	ASSERT_EQ( *__v.get_allocator().__constructed, 1000u );
+	for ( size_t __i = 0; __i != __v.size(); ++__i ) ASSERT_EQ( __v[ __i ], 42 );
+
+	nya::vector< int32_t, nya::__default_init_allocator< int32_t > > __w( 1000, 5 );
+	__w.resize( 2000 );
+	ASSERT_EQ( __w.size(), 2000u );
+	for ( size_t __i = 0; __i != 1000; ++__i ) ASSERT_EQ( __w[ __i ], 5 );
+}
+
+TEST( VECTOR_FILL, large ) {
+	//<--- a large value-initialized and filled vector, the sizes the fast paths are for
+	const size_t      __n = size_t( 1 ) << 24;
+	__vec< double >   __v( __n );
+	__vec< uint32_t > __w( __n, 0xdeadbeefu );
+	ASSERT_EQ( __v.size(), __n );
+	for ( size_t __i = 0; __i < __n; __i += 4099 ) {
+		ASSERT_EQ( __v[ __i ], 0.0 );
+		ASSERT_EQ( __w[ __i ], 0xdeadbeefu );
+	}
+	ASSERT_EQ( __v[ __n - 1 ], 0.0 );
+	ASSERT_EQ( __w[ __n - 1 ], 0xdeadbeefu );
+}
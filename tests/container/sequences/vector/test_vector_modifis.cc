@@ -8,7 +8,12 @@
 #include <limits>
 #include <memory>
 #include <random>
+#include <ranges>
+#include <sstream>
 #include <stdint.h>
+#include <string>
+#include <utility>
+#include <vector>
 
 
 static core::random_device                       rd;
@@ -196,3 +201,527 @@ TEST( VECTOR_MODIFIES, forward_insert ) {
 		ASSERT_EQ( __v_ins[ i ], __v[ (uint64_t) __insert_pos + i ] );
 	}
 }
+
+TEST( VECTOR_MODIFIES, insert_sorted_positions ) {
+	size_t                                    __v_size     = 1000000;
+	size_t                                    __v_size_ins = 5000;
+	core::uniform_int_distribution< int64_t > __dis( 0, (int64_t) __v_size );
+	core::unique_ptr< int64_t[] >             __v_range( new int64_t[ __v_size ]{} );
+
+	for ( size_t i = 0; i < __v_size; i++ ) {
+		__v_range[ i ] = distribution( generator );
+	}
+
+	core::vector< core::pair< size_t, int64_t > > __ins( __v_size_ins );
+	for ( auto& __e : __ins ) {
+		__e = { (size_t) __dis( generator ), distribution( generator ) };
+	}
+	core::stable_sort( __ins.begin(), __ins.end(), []( const auto& __x, const auto& __y ) { return __x.first < __y.first; } );
+
+	core::vector< int64_t > __expect( __v_range.get(), __v_range.get() + __v_size );
+	for ( size_t i = __ins.size(); i-- > 0; ) {
+		__expect.insert( __expect.begin() + (int64_t) __ins[ i ].first, __ins[ i ].second );
+	}
+
+	//<--- no spare capacity, grows once
+	nya::vector< int64_t, core::allocator< int64_t > > __v( __v_range.get(), __v_range.get() + __v_size );
+	__v.insert_sorted_positions( __ins.begin(), __ins.end() );
+	ASSERT_EQ( __v_size + __v_size_ins, __v.size() );
+	ASSERT_EQ( __v_size * 2, __v.capacity() );
+	for ( size_t i = 0; i < __expect.size(); i++ ) {
+		ASSERT_EQ( __expect[ i ], __v[ i ] );
+	}
+
+	//<--- enough spare capacity, merges in place
+	nya::vector< int64_t, core::allocator< int64_t > > __w( __v_range.get(), __v_range.get() + __v_size );
+	__w.reserve( __v_size + __v_size_ins );
+	__w.insert_sorted_positions( __ins.begin(), __ins.end() );
+	ASSERT_EQ( __v_size + __v_size_ins, __w.size() );
+	ASSERT_EQ( __v_size + __v_size_ins, __w.capacity() );
+	for ( size_t i = 0; i < __expect.size(); i++ ) {
+		ASSERT_EQ( __expect[ i ], __w[ i ] );
+	}
+}
+
+TEST( VECTOR_MODIFIES, insert_sorted_positions_non_trivial ) {
+	core::string                                                __init[] = { "a", "b", "c", "d" };
+	nya::vector< core::string, core::allocator< core::string > > __v( core::begin( __init ), core::end( __init ) );
+	__v.reserve( 16 );
+
+	core::pair< size_t, core::string > __ins[] = { { 0, "x" }, { 0, "y" }, { 2, "z" }, { 4, "w" } };
+	__v.insert_sorted_positions( core::begin( __ins ), core::end( __ins ) );
+	core::string __expect[] = { "x", "y", "a", "b", "z", "c", "d", "w" };
+	ASSERT_EQ( 8, __v.size() );
+	for ( size_t i = 0; i < __v.size(); i++ ) {
+		ASSERT_EQ( __expect[ i ], __v[ i ] );
+	}
+
+	core::pair< size_t, core::string > __bad[] = { { 3, "x" }, { 1, "y" } };
+	ASSERT_THROW( __v.insert_sorted_positions( core::begin( __bad ), core::end( __bad ) ), core::out_of_range );
+	ASSERT_EQ( 8, __v.size() );
+}
+
+TEST( VECTOR_MODIFIES, erase ) {
+	int64_t                                            __init[] = { 0, 1, 2, 3, 4, 5, 6, 7 };
+	nya::vector< int64_t, core::allocator< int64_t > > __v( core::begin( __init ), core::end( __init ) );
+
+	auto __it = __v.erase( __v.begin() + 2 );
+	ASSERT_EQ( 7, __v.size() );
+	ASSERT_EQ( 8, __v.capacity() );
+	ASSERT_EQ( 3, *__it );
+
+	__it = __v.erase( __v.begin() + 1, __v.begin() + 4 );
+	ASSERT_EQ( 4, __v.size() );
+	ASSERT_EQ( 5, *__it );
+	int64_t __expect[] = { 0, 5, 6, 7 };
+	for ( size_t i = 0; i < __v.size(); i++ ) {
+		ASSERT_EQ( __expect[ i ], __v[ i ] );
+	}
+
+	__it = __v.erase( __v.begin(), __v.begin() );
+	ASSERT_EQ( 4, __v.size() );
+	ASSERT_EQ( 0, *__it );
+}
+
+TEST( VECTOR_MODIFIES, erase_indices ) {
+	size_t                                   __v_size = 1000000;
+	core::uniform_int_distribution< size_t > __dis( 0, __v_size - 1 );
+	core::unique_ptr< int64_t[] >            __v_range( new int64_t[ __v_size ]{} );
+
+	for ( size_t i = 0; i < __v_size; i++ ) {
+		__v_range[ i ] = distribution( generator );
+	}
+
+	core::vector< size_t > __idx( __v_size / 5 );
+	for ( auto& __i : __idx ) __i = __dis( generator );
+	core::sort( __idx.begin(), __idx.end() );
+
+	core::vector< bool > __drop( __v_size );
+	for ( auto __i : __idx ) __drop[ __i ] = true;
+	core::vector< int64_t > __expect;
+	for ( size_t i = 0; i < __v_size; i++ ) {
+		if ( !__drop[ i ] ) __expect.push_back( __v_range[ i ] );
+	}
+
+	nya::vector< int64_t, core::allocator< int64_t > > __v( __v_range.get(), __v_range.get() + __v_size );
+	ASSERT_EQ( __v_size - __expect.size(), __v.erase_indices( __idx.begin(), __idx.end() ) );
+	ASSERT_EQ( __expect.size(), __v.size() );
+	ASSERT_EQ( __v_size, __v.capacity() );
+	for ( size_t i = 0; i < __expect.size(); i++ ) {
+		ASSERT_EQ( __expect[ i ], __v[ i ] );
+	}
+
+	size_t __bad[] = { 1, 0 };
+	ASSERT_THROW( __v.erase_indices( core::begin( __bad ), core::end( __bad ) ), core::out_of_range );
+	size_t __oob[] = { __v.size() };
+	ASSERT_THROW( __v.erase_indices( core::begin( __oob ), core::end( __oob ) ), core::out_of_range );
+	ASSERT_EQ( __expect.size(), __v.size() );
+}
+
+TEST( VECTOR_MODIFIES, erase_if ) {
+	size_t                        __v_size = 1000000;
+	core::unique_ptr< int64_t[] > __v_range( new int64_t[ __v_size ]{} );
+
+	for ( size_t i = 0; i < __v_size; i++ ) {
+		__v_range[ i ] = distribution( generator );
+	}
+
+	auto                    __pred = []( int64_t __x ) { return __x % 7 == 0; };
+	core::vector< int64_t > __expect( __v_range.get(), __v_range.get() + __v_size );
+	__expect.erase( core::remove_if( __expect.begin(), __expect.end(), __pred ), __expect.end() );
+
+	nya::vector< int64_t, core::allocator< int64_t > > __v( __v_range.get(), __v_range.get() + __v_size );
+	ASSERT_EQ( __v_size - __expect.size(), nya::erase_if( __v, __pred ) );
+	ASSERT_EQ( __expect.size(), __v.size() );
+	for ( size_t i = 0; i < __expect.size(); i++ ) {
+		ASSERT_EQ( __expect[ i ], __v[ i ] );
+	}
+
+	core::string                                                __init[] = { "a", "bb", "c", "dd", "ee", "f" };
+	nya::vector< core::string, core::allocator< core::string > > __s( core::begin( __init ), core::end( __init ) );
+	ASSERT_EQ( 3, nya::erase_if( __s, []( const core::string& __x ) { return __x.size() == 2; } ) );
+	ASSERT_EQ( 3, __s.size() );
+	ASSERT_EQ( "a", __s[ 0 ] );
+	ASSERT_EQ( "c", __s[ 1 ] );
+	ASSERT_EQ( "f", __s[ 2 ] );
+}
+
+TEST( VECTOR_MODIFIES, erase_if_scattered ) {
+	//<--- a scattered few percent of the elements, through the compaction kernels, across many mask blocks
+	size_t                  __v_size = 1000003;
+	core::vector< int32_t > __init( __v_size );
+	for ( size_t i = 0; i < __v_size; i++ ) __init[ i ] = static_cast< int32_t >( distribution( generator ) % 20 );
+	core::vector< int32_t > __expect( __init );
+	__expect.erase( core::remove( __expect.begin(), __expect.end(), 3 ), __expect.end() );
+
+	nya::vector< int32_t, core::allocator< int32_t > > __v( __init.begin(), __init.end() );
+	ASSERT_EQ( __v_size - __expect.size(), nya::erase_if( __v, []( int32_t __x ) { return __x == 3; } ) );
+	ASSERT_EQ( __expect.size(), __v.size() );
+	for ( size_t i = 0; i < __expect.size(); i++ ) {
+		ASSERT_EQ( __expect[ i ], __v[ i ] );
+	}
+	ASSERT_EQ( 0, nya::erase_if( __v, []( int32_t __x ) { return __x == 3; } ) );
+
+	core::vector< size_t > __idx;
+	for ( size_t i = 0; i < __v_size; i++ ) {
+		if ( __init[ i ] == 3 ) __idx.push_back( i );
+	}
+	nya::vector< double, core::allocator< double > > __d( __init.begin(), __init.end() );
+	ASSERT_EQ( __idx.size(), __d.erase_indices( __idx.begin(), __idx.end() ) );
+	ASSERT_EQ( __expect.size(), __d.size() );
+	for ( size_t i = 0; i < __expect.size(); i++ ) {
+		ASSERT_EQ( __expect[ i ], __d[ i ] );
+	}
+
+	//<--- no kernel has the width of a `long double`, the header compacts it
+	nya::vector< long double, core::allocator< long double > > __l( __init.begin(), __init.begin() + 10000 );
+	const auto __three = static_cast< size_t >( core::count( __init.begin(), __init.begin() + 10000, 3 ) );
+	ASSERT_EQ( __three, nya::erase_if( __l, []( long double __x ) { return __x == 3; } ) );
+	ASSERT_EQ( 10000 - __three, __l.size() );
+	ASSERT_EQ( __l.end(), core::find( __l.begin(), __l.end(), 3.0L ) );
+}
+
+TEST( VECTOR_MODIFIES, erase_unordered ) {
+	size_t                                    __v_size = 1000000;
+	core::uniform_int_distribution< int64_t > __dis( 0, (int64_t) __v_size - 1 );
+	core::unique_ptr< int64_t[] >             __v_range( new int64_t[ __v_size ]{} );
+
+	for ( size_t i = 0; i < __v_size; i++ ) {
+		__v_range[ i ] = (int64_t) i;
+	}
+
+	nya::vector< int64_t, core::allocator< int64_t > > __v( __v_range.get(), __v_range.get() + __v_size );
+	int64_t                                            __erase_pos = __dis( generator );
+	int64_t                                            __back      = __v[ __v_size - 1 ];
+	auto                                               __it        = __v.erase_unordered( __v.begin() + __erase_pos );
+	ASSERT_EQ( __v_size - 1, __v.size() );
+	ASSERT_EQ( __v_size, __v.capacity() );
+	if ( (size_t) __erase_pos != __v_size - 1 ) {
+		ASSERT_EQ( __back, *__it );
+	} else {
+		ASSERT_EQ( __v.end(), __it );
+	}
+
+	__it = __v.erase_unordered( __v.end() - 1 );
+	ASSERT_EQ( __v_size - 2, __v.size() );
+	ASSERT_EQ( __v.end(), __it );
+
+	//<--- the remaining elements are a permutation of the survivors
+	core::vector< int64_t > __rest( __v.begin(), __v.end() );
+	core::sort( __rest.begin(), __rest.end() );
+	ASSERT_EQ( __rest.end(), core::adjacent_find( __rest.begin(), __rest.end() ) );
+	ASSERT_FALSE( core::binary_search( __rest.begin(), __rest.end(), __erase_pos ) );
+}
+
+TEST( VECTOR_MODIFIES, erase_unordered_range ) {
+	auto __check = []( size_t __size, size_t __first, size_t __last ) {
+		core::vector< core::string > __init;
+		for ( size_t i = 0; i < __size; i++ ) __init.push_back( core::to_string( i ) );
+
+		nya::vector< core::string, core::allocator< core::string > > __v( __init.begin(), __init.end() );
+		auto __it = __v.erase_unordered( __v.begin() + (int64_t) __first, __v.begin() + (int64_t) __last );
+		ASSERT_EQ( __size - ( __last - __first ), __v.size() );
+		ASSERT_EQ( __v.begin() + (int64_t) __first, __it );
+		for ( size_t i = 0; i < __first; i++ ) {
+			ASSERT_EQ( __init[ i ], __v[ i ] );
+		}
+
+		core::vector< core::string > __expect( __init.begin(), __init.begin() + (int64_t) __first );
+		__expect.insert( __expect.end(), __init.begin() + (int64_t) __last, __init.end() );
+		core::vector< core::string > __rest( __v.begin(), __v.end() );
+		core::sort( __expect.begin(), __expect.end() );
+		core::sort( __rest.begin(), __rest.end() );
+		ASSERT_EQ( __expect, __rest );
+	};
+
+	__check( 100, 10, 20 );//<--- long tail, only the last 10 elements move
+	__check( 100, 85, 95 );//<--- short tail, the 5 trailing elements move
+	__check( 100, 90, 100 );
+	__check( 100, 0, 100 );
+	__check( 100, 30, 30 );
+}
+
+namespace {
+
+//<--- owns its value and opts in to relocation: `erase_unordered` moves its bytes, never assigns it
+struct __relocatable_owner {
+	using __trivially_relocatable = __relocatable_owner;
+
+	static inline size_t __move_assigns = 0;
+
+	core::unique_ptr< int > __p;
+
+	explicit __relocatable_owner( int __x )
+			: __p( core::make_unique< int >( __x ) ) {}
+	__relocatable_owner( __relocatable_owner&& ) LLVM_MSTL_NOEXCEPT = default;
+	auto operator=( __relocatable_owner&& __o ) LLVM_MSTL_NOEXCEPT->__relocatable_owner& {
+		++__move_assigns;
+		__p = core::move( __o.__p );
+		return *this;
+	}
+};
+
+}// namespace
+
+TEST( VECTOR_MODIFIES, erase_unordered_relocates ) {
+	nya::vector< __relocatable_owner, core::allocator< __relocatable_owner > > __v;
+	for ( int i = 0; i < 100; i++ ) __v.emplace_back( i );
+	__relocatable_owner::__move_assigns = 0;
+
+	auto __it = __v.erase_unordered( __v.begin() + 10 );
+	ASSERT_EQ( 99u, __v.size() );
+	ASSERT_EQ( 99, *__it->__p );
+	__it = __v.erase_unordered( __v.end() - 1 );
+	ASSERT_EQ( __v.end(), __it );
+
+	__it = __v.erase_unordered( __v.begin() + 20, __v.begin() + 30 );//<--- long tail
+	ASSERT_EQ( 88u, __v.size() );
+	ASSERT_EQ( 88, *__it->__p );
+	__it = __v.erase_unordered( __v.begin() + 80, __v.begin() + 85 );//<--- short tail
+	ASSERT_EQ( 83u, __v.size() );
+	ASSERT_EQ( 0u, __relocatable_owner::__move_assigns );
+
+	//<--- the survivors, each owned exactly once
+	core::vector< int > __expect;
+	for ( int i = 0; i < 100; i++ )
+		if ( i != 10 && i != 98 && !( 20 <= i && i < 30 ) && !( 80 <= i && i < 85 ) ) __expect.push_back( i );
+	core::vector< int > __rest;
+	for ( size_t i = 0; i < __v.size(); i++ ) __rest.push_back( *__v[ i ].__p );
+	core::sort( __rest.begin(), __rest.end() );
+	ASSERT_EQ( __expect, __rest );
+}
+
+TEST( VECTOR_MODIFIES, append_range ) {
+	size_t                  __v_size = 1000000;
+	core::vector< int64_t > __init( __v_size );
+	for ( size_t i = 0; i < __v_size; i++ ) {
+		__init[ i ] = distribution( generator );
+	}
+
+	nya::vector< int64_t, core::allocator< int64_t > > __v;
+	__v.append_range( __init );
+	ASSERT_EQ( __v_size, __v.size() );
+	ASSERT_EQ( __v_size, __v.capacity() );//<--- one allocation of the exact size on an empty vector
+
+	auto __neg = __init | core::views::transform( []( int64_t __x ) { return -__x; } );
+	__v.append_range( __neg );
+	ASSERT_EQ( 2 * __v_size, __v.size() );
+	for ( size_t i = 0; i < __v_size; i++ ) {
+		ASSERT_EQ( __init[ i ], __v[ i ] );
+		ASSERT_EQ( -__init[ i ], __v[ __v_size + i ] );
+	}
+
+	core::istringstream __in( "1 2 3" );
+	__v.append_range( core::views::istream< int64_t >( __in ) );
+	ASSERT_EQ( 2 * __v_size + 3, __v.size() );
+	ASSERT_EQ( 3, __v.back() );
+
+	nya::vector< core::string, core::allocator< core::string > > __s;
+	__s.reserve( 8 );
+	__s.append_range( core::views::iota( 0, 4 ) | core::views::transform( []( int __i ) { return core::to_string( __i ); } ) );
+	ASSERT_EQ( 4, __s.size() );
+	ASSERT_EQ( 8, __s.capacity() );
+	ASSERT_EQ( "3", __s[ 3 ] );
+}
+
+TEST( VECTOR_MODIFIES, insert_range ) {
+	auto __check = [ & ]( size_t __size, size_t __cap, size_t __pos, size_t __n, auto __make ) {
+		core::vector< core::string > __expect;
+		for ( size_t i = 0; i < __size; i++ ) __expect.push_back( core::to_string( i ) );
+		nya::vector< core::string, core::allocator< core::string > > __v( __expect.begin(), __expect.end() );
+		__v.reserve( __cap );
+
+		core::vector< core::string > __src;
+		for ( size_t i = 0; i < __n; i++ ) __src.push_back( "x" + core::to_string( i ) );
+		__expect.insert( __expect.begin() + (int64_t) __pos, __src.begin(), __src.end() );
+
+		auto __it = __v.insert_range( __v.begin() + (int64_t) __pos, __make( __src ) );
+		ASSERT_EQ( __v.begin() + (int64_t) __pos, __it );
+		ASSERT_EQ( __expect.size(), __v.size() );
+		ASSERT_TRUE( core::equal( __expect.begin(), __expect.end(), __v.begin() ) );
+	};
+	auto __as_is  = []( core::vector< core::string >& __src ) -> auto& { return __src; };
+	auto __as_view = []( core::vector< core::string >& __src ) {
+		return __src | core::views::transform( []( const core::string& __x ) { return __x; } );
+	};
+	auto __as_list = []( core::vector< core::string >& __src ) {
+		return core::views::iota( size_t( 0 ), __src.size() ) |
+					 core::views::take_while( [ &__src ]( size_t __i ) { return __i < __src.size(); } ) |
+					 core::views::transform( [ &__src ]( size_t __i ) { return __src[ __i ]; } );
+	};
+
+	__check( 100, 100, 10, 20, __as_is ); //<--- reallocates
+	__check( 100, 200, 10, 20, __as_is ); //<--- in place, the range fits in front of the old tail
+	__check( 100, 200, 95, 20, __as_is ); //<--- in place, the range spills past the old end
+	__check( 100, 200, 100, 20, __as_is );//<--- in place, at the end
+	__check( 100, 200, 10, 0, __as_is );
+	__check( 100, 100, 50, 30, __as_view );
+	__check( 100, 200, 90, 30, __as_view );
+	__check( 100, 100, 50, 30, __as_list );
+	__check( 100, 200, 90, 30, __as_list );
+	__check( 0, 0, 0, 30, __as_list );
+
+	nya::vector< int64_t, core::allocator< int64_t > > __v{ 1, 2, 3 };
+	core::istringstream                                __in( "7 8" );
+	auto __it = __v.insert_range( __v.begin() + 1, core::views::istream< int64_t >( __in ) );
+	ASSERT_EQ( __v.begin() + 1, __it );
+	ASSERT_EQ( 5, __v.size() );
+	ASSERT_EQ( 1, __v[ 0 ] );
+	ASSERT_EQ( 7, __v[ 1 ] );
+	ASSERT_EQ( 8, __v[ 2 ] );
+	ASSERT_EQ( 2, __v[ 3 ] );
+	ASSERT_EQ( 3, __v[ 4 ] );
+}
+
+TEST( VECTOR_MODIFIES, assign_range ) {
+	size_t                  __v_size = 1000000;
+	core::vector< int64_t > __init( __v_size );
+	for ( size_t i = 0; i < __v_size; i++ ) {
+		__init[ i ] = distribution( generator );
+	}
+
+	nya::vector< int64_t, core::allocator< int64_t > > __v( 10, 1 );
+	__v.assign_range( __init );//<--- grows, one allocation
+	ASSERT_EQ( __v_size, __v.size() );
+	ASSERT_EQ( __init[ __v_size - 1 ], __v.back() );
+	ASSERT_TRUE( core::equal( __init.begin(), __init.end(), __v.begin() ) );
+
+	const size_t __cap = __v.capacity();
+	__v.assign_range( __init | core::views::take( 10 ) );//<--- shrinks, keeps the storage
+	ASSERT_EQ( 10, __v.size() );
+	ASSERT_EQ( __cap, __v.capacity() );
+	ASSERT_TRUE( core::equal( __init.begin(), __init.begin() + 10, __v.begin() ) );
+
+	__v.assign_range( __init | core::views::transform( []( int64_t __x ) { return __x / 3; } ) );
+	ASSERT_EQ( __v_size, __v.size() );
+	ASSERT_EQ( __cap, __v.capacity() );
+	for ( size_t i = 0; i < __v_size; i++ ) {
+		ASSERT_EQ( __init[ i ] / 3, __v[ i ] );
+	}
+
+	nya::vector< core::string, core::allocator< core::string > > __s( 3, core::string( "old" ) );
+	__s.reserve( 16 );
+	core::vector< core::string > __src{ "a", "b", "c", "d", "e" };
+	__s.assign_range( __src );
+	ASSERT_EQ( 5, __s.size() );
+	ASSERT_TRUE( core::equal( __src.begin(), __src.end(), __s.begin() ) );
+
+	core::istringstream __in( "4 5" );
+	__v.assign_range( core::views::istream< int64_t >( __in ) );
+	ASSERT_EQ( 2, __v.size() );
+	ASSERT_EQ( 4, __v[ 0 ] );
+	ASSERT_EQ( 5, __v[ 1 ] );
+}
+
+namespace {
+	struct __record {
+		static inline size_t __moves = 0;
+
+		int64_t __key;
+		int64_t __payload[ 31 ];
+
+		explicit __record( int64_t __k ) noexcept : __key( __k ), __payload{} {}
+		__record( const __record& )            = default;
+		__record& operator=( const __record& ) = default;
+		__record( __record&& __o ) noexcept : __key( __o.__key ), __payload{} { ++__moves; }
+		__record& operator=( __record&& __o ) noexcept {
+			__key = __o.__key;
+			++__moves;
+			return *this;
+		}
+	};
+}// namespace
+
+TEST( VECTOR_MODIFIES, emplace ) {
+	size_t                                               __v_size = 1000;
+	nya::vector< __record, core::allocator< __record > > __v;
+	__v.reserve( __v_size + 1 );
+	for ( size_t i = 0; i < __v_size; i++ ) __v.emplace_back( static_cast< int64_t >( i ) );
+
+	//<--- constructed directly in the hole, only the tail is shifted
+	__record::__moves = 0;
+	auto __it         = __v.emplace( __v.begin() + 10, int64_t( -1 ) );
+	ASSERT_EQ( __v_size - 10, __record::__moves );
+	ASSERT_EQ( __v.begin() + 10, __it );
+	ASSERT_EQ( __v_size + 1, __v.size() );
+	ASSERT_EQ( -1, __v[ 10 ].__key );
+	for ( size_t i = 0; i < 10; i++ ) {
+		ASSERT_EQ( (int64_t) i, __v[ i ].__key );
+	}
+	for ( size_t i = 11; i < __v.size(); i++ ) {
+		ASSERT_EQ( (int64_t) i - 1, __v[ i ].__key );
+	}
+
+	//<--- reallocates
+	__it = __v.emplace( __v.begin(), int64_t( -2 ) );
+	ASSERT_EQ( __v.begin(), __it );
+	ASSERT_EQ( __v_size + 2, __v.size() );
+	ASSERT_EQ( -2, __v[ 0 ].__key );
+	ASSERT_EQ( 0, __v[ 1 ].__key );
+	ASSERT_EQ( (int64_t) __v_size - 1, __v.back().__key );
+
+	__it = __v.emplace( __v.end(), int64_t( -3 ) );
+	ASSERT_EQ( __v.end() - 1, __it );
+	ASSERT_EQ( -3, __v.back().__key );
+}
+
+TEST( VECTOR_MODIFIES, emplace_aliasing ) {
+	nya::vector< int64_t, core::allocator< int64_t > > __v{ 0, 1, 2, 3, 4 };
+	__v.reserve( 16 );
+	//<--- the argument is an element which is shifted by the insertion
+	__v.emplace( __v.begin(), __v[ 2 ] );
+	ASSERT_EQ( 6, __v.size() );
+	ASSERT_EQ( 2, __v[ 0 ] );
+	ASSERT_EQ( 2, __v[ 3 ] );
+
+	__v.emplace( __v.begin() + 1, __v.back() );
+	ASSERT_EQ( 4, __v[ 1 ] );
+	ASSERT_EQ( 4, __v.back() );
+
+	nya::vector< core::string, core::allocator< core::string > > __s{ "a", "bb", "ccc" };
+	__s.reserve( 8 );
+	__s.emplace( __s.begin(), __s[ 1 ] );
+	__s.emplace( __s.begin() + 1, 3, 'x' );
+	__s.emplace( __s.begin(), core::move( __s.back() ) );
+	ASSERT_EQ( 6, __s.size() );
+	ASSERT_EQ( "ccc", __s[ 0 ] );
+	ASSERT_EQ( "bb", __s[ 1 ] );
+	ASSERT_EQ( "xxx", __s[ 2 ] );
+	ASSERT_EQ( "a", __s[ 3 ] );
+	ASSERT_EQ( "bb", __s[ 4 ] );
+}
+
+TEST( VECTOR_MODIFIES, resize_assign_swap ) {
+	nya::vector< core::string, core::allocator< core::string > > __v;
+	__v.push_back( "a" );
+	core::string __b( "b" );
+	__v.push_back( __b );
+	__v.resize( 5, "x" );
+	ASSERT_EQ( 5, __v.size() );
+	ASSERT_EQ( "b", __v[ 1 ] );
+	ASSERT_EQ( "x", __v[ 4 ] );
+	__v.resize( 1000 );
+	ASSERT_EQ( 1000, __v.size() );
+	ASSERT_TRUE( __v.back().empty() );
+	__v.resize( 2 );
+	__v.pop_back();
+	ASSERT_EQ( 1, __v.size() );
+	ASSERT_EQ( "a", __v.back() );
+
+	__v.assign( 3, "y" );
+	ASSERT_EQ( 3, __v.size() );
+	ASSERT_EQ( "y", __v[ 2 ] );
+	__v.assign( { "p", "q" } );
+	ASSERT_EQ( 2, __v.size() );
+	ASSERT_EQ( "q", __v[ 1 ] );
+
+	nya::vector< core::string, core::allocator< core::string > > __w( 7, "z" );
+	__v.swap( __w );
+	ASSERT_EQ( 7, __v.size() );
+	ASSERT_EQ( 2, __w.size() );
+	ASSERT_EQ( "p", __w[ 0 ] );
+
+	__v = core::move( __w );
+	ASSERT_EQ( 2, __v.size() );
+	ASSERT_EQ( "q", __v[ 1 ] );
+}
@@ -0,0 +1,93 @@
+#include "vector.hpp"
+#include "gtest/gtest.h"
+
+#include <cstdint>
+#include <memory>
+
+namespace core = std;
+
+namespace {
+
+//<--- counts its allocations, by kind
+template < typename _Tp >
+struct __counting_calloc_allocator : nya::__calloc_allocator< _Tp > {
+	template < typename _Up >
+	struct rebind {
+		using other = __counting_calloc_allocator< _Up >;
+	};
+
+	__counting_calloc_allocator() = default;
+
+	template < typename _Up >
+	__counting_calloc_allocator( const __counting_calloc_allocator< _Up >& __a )
+			: __allocated( __a.__allocated )
+			, __zeroed( __a.__zeroed ) {}
+
+	auto allocate( size_t __n ) -> _Tp* {
+		++*__allocated;
+		return nya::__calloc_allocator< _Tp >::allocate( __n );
+	}
+
+	auto allocate_zeroed( size_t __n ) -> _Tp* {
+		++*__zeroed;
+		return nya::__calloc_allocator< _Tp >::allocate_zeroed( __n );
+	}
+
+	core::shared_ptr< size_t > __allocated = core::make_shared< size_t >( 0 );
+	core::shared_ptr< size_t > __zeroed    = core::make_shared< size_t >( 0 );
+};
+
+struct __pair16 {
+	int16_t __a = 1;
+	int16_t __b = 2;
+};
+
+}// namespace
+
+static_assert( nya::__has_allocate_zeroed< nya::calloc_allocator< double > >::value );
+static_assert( !nya::__has_allocate_zeroed< core::allocator< double > >::value );
+
+TEST( VECTOR_ZEROED, value_init_from_zeroed_storage ) {
+	nya::vector< double, __counting_calloc_allocator< double > > __v( 10'000'000 );
+	ASSERT_EQ( __v.size(), 10'000'000u );
+	ASSERT_EQ( __v.capacity(), 10'000'000u );
+	EXPECT_EQ( *__v.get_allocator().__zeroed, 1u );
+	EXPECT_EQ( *__v.get_allocator().__allocated, 0u );
+	for ( size_t __i = 0; __i < __v.size(); __i += 4093 ) ASSERT_EQ( __v[ __i ], 0.0 );
+	ASSERT_EQ( __v[ __v.size() - 1 ], 0.0 );
+
+	//<--- grows as any other vector
+	__v.push_back( 1.5 );
+	EXPECT_EQ( *__v.get_allocator().__allocated, 1u );
+	ASSERT_EQ( __v.size(), 10'000'001u );
+	ASSERT_EQ( __v[ 10'000'000 ], 1.5 );
+	ASSERT_EQ( __v[ 9'999'999 ], 0.0 );
+}
+
+TEST( VECTOR_ZEROED, resize_of_empty_vector ) {
+	nya::vector< int64_t, __counting_calloc_allocator< int64_t > > __v;
+	__v.resize( 1 << 20 );
+	ASSERT_EQ( __v.size(), size_t( 1 ) << 20 );
+	EXPECT_EQ( *__v.get_allocator().__zeroed, 1u );
+	for ( size_t __i = 0; __i < __v.size(); __i += 257 ) ASSERT_EQ( __v[ __i ], 0 );
+
+	//<--- with storage, the new elements are written
+	__v.resize( 10 );
+	__v.resize( 100 );
+	EXPECT_EQ( *__v.get_allocator().__zeroed, 1u );
+	for ( size_t __i = 0; __i != __v.size(); ++__i ) ASSERT_EQ( __v[ __i ], 0 );
+}
+
+TEST( VECTOR_ZEROED, not_zero_initializable ) {
+	//<--- a class is constructed, whatever the storage
+	nya::vector< __pair16, __counting_calloc_allocator< __pair16 > > __v( 1000 );
+	EXPECT_EQ( *__v.get_allocator().__zeroed, 0u );
+	EXPECT_EQ( *__v.get_allocator().__allocated, 1u );
+	for ( size_t __i = 0; __i != __v.size(); ++__i ) {
+		ASSERT_EQ( __v[ __i ].__a, 1 );
+		ASSERT_EQ( __v[ __i ].__b, 2 );
+	}
+
+	nya::vector< double, nya::calloc_allocator< double > > __w( 1000, 2.5 );
+	for ( size_t __i = 0; __i != __w.size(); ++__i ) ASSERT_EQ( __w[ __i ], 2.5 );
+}
@@ -0,0 +1,128 @@
+#include "slot_map.hpp"
+#include "gtest/gtest.h"
+
+#include <cstdint>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace core = std;
+
+static core::random_device                       rd;
+static core::mt19937                             generator( rd() );
+static core::uniform_int_distribution< int64_t > distribution( 0, 100000 );
+
+//<--- random inserts and erases against `std::unordered_map< key, value >`, stale keys kept around
+TEST( SLOT_MAP, against_unordered_map ) {
+	nya::slot_map< core::string >                          __map;
+	core::unordered_map< nya::slot_map_key, core::string > __expect;
+	core::vector< nya::slot_map_key >                      __live, __stale;
+	for ( int i = 0; i < 20000; i++ ) {
+		if ( __live.empty() || distribution( generator ) % 3 != 0 ) {
+			const auto __x = core::to_string( distribution( generator ) );
+			const auto __k = __map.insert( __x );
+			EXPECT_FALSE( __expect.contains( __k ) );
+			__expect.emplace( __k, __x );
+			__live.push_back( __k );
+		} else {
+			const size_t __j = static_cast< size_t >( distribution( generator ) ) % __live.size();
+			const auto   __k = __live[ __j ];
+			EXPECT_EQ( 1u, __map.erase( __k ) );
+			EXPECT_EQ( 0u, __map.erase( __k ) );
+			__expect.erase( __k );
+			__live[ __j ] = __live.back();
+			__live.pop_back();
+			__stale.push_back( __k );
+		}
+		ASSERT_EQ( __expect.size(), __map.size() );
+	}
+
+	for ( const auto& [ __k, __v ] : __expect ) {
+		ASSERT_TRUE( __map.contains( __k ) );
+		EXPECT_EQ( __v, __map[ __k ] );
+		EXPECT_EQ( __v, *__map.get( __k ) );
+		EXPECT_EQ( __k, __map.key_of( __map.find( __k ) ) );
+	}
+	for ( const auto& __k : __stale ) {
+		EXPECT_FALSE( __map.contains( __k ) );
+		EXPECT_EQ( nullptr, __map.get( __k ) );
+		EXPECT_EQ( __map.end(), __map.find( __k ) );
+	}
+	EXPECT_THROW( __map.at( __stale.front() ), core::out_of_range );
+	//<--- the freed slots were recycled
+	EXPECT_LE( __map.slot_count(), __map.size() + __stale.size() );
+	EXPECT_LT( __map.slot_count(), 20000u );
+}
+
+//<--- the values are dense, every one of them reachable back through its key
+TEST( SLOT_MAP, dense_iteration ) {
+	nya::slot_map< int64_t >          __map;
+	core::vector< nya::slot_map_key > __keys;
+	for ( int64_t i = 0; i < 1000; i++ ) __keys.push_back( __map.insert( i ) );
+	for ( size_t i = 0; i < __keys.size(); i += 2 ) __map.erase( __keys[ i ] );
+	EXPECT_EQ( 500u, __map.size() );
+	EXPECT_EQ( static_cast< ptrdiff_t >( __map.size() ), __map.end() - __map.begin() );
+
+	int64_t __sum = 0;
+	for ( auto __it = __map.begin(); __it != __map.end(); ++__it ) {
+		EXPECT_EQ( 1, *__it % 2 );
+		EXPECT_EQ( *__it, __map[ __map.key_of( __it ) ] );
+		__sum += *__it;
+	}
+	EXPECT_EQ( 500 * 500, __sum );
+
+	//<--- erase by iterator while scanning: the last value moves into the hole
+	for ( auto __it = __map.begin(); __it != __map.end(); ) {
+		if ( *__it % 3 == 0 ) __it = __map.erase( __it );
+		else ++__it;
+	}
+	for ( int64_t __v : __map.values() ) EXPECT_NE( 0, __v % 3 );
+	for ( size_t i = 1; i < __keys.size(); i += 2 ) EXPECT_EQ( static_cast< int64_t >( i ) % 3 != 0, __map.contains( __keys[ i ] ) );
+
+	__map.clear();
+	EXPECT_TRUE( __map.empty() );
+	for ( const auto& __k : __keys ) EXPECT_FALSE( __map.contains( __k ) );
+	const auto __k = __map.insert( 7 );
+	EXPECT_LT( __k.index, 1000u );
+	EXPECT_EQ( 7, __map.at( __k ) );
+}
+
+//<--- throws on the copy number `__countdown`
+struct __throwing {
+	static inline int __countdown = -1;
+
+	int __v = 0;
+
+	__throwing( int __x )
+			: __v( __x ) {}
+	__throwing( const __throwing& __x )
+			: __v( __x.__v ) {
+		if ( __countdown >= 0 && __countdown-- == 0 ) throw core::runtime_error( "copy" );
+	}
+	__throwing( __throwing&& __x ) noexcept
+			: __v( __x.__v ) {}
+	auto operator=( const __throwing& ) -> __throwing& = default;
+	auto operator=( __throwing&& ) -> __throwing&      = default;
+};
+
+TEST( SLOT_MAP, strong_guarantee_on_insert ) {
+	nya::slot_map< __throwing > __map;
+	const auto                  __a = __map.insert( __throwing( 1 ) );
+	const auto                  __b = __map.insert( __throwing( 2 ) );
+	__map.erase( __a );
+
+	const __throwing __x( 3 );
+	__throwing::__countdown = 0;
+	EXPECT_THROW( __map.insert( __x ), core::runtime_error );
+	__throwing::__countdown = -1;
+	EXPECT_EQ( 1u, __map.size() );
+	EXPECT_EQ( 2, __map[ __b ].__v );
+
+	const auto __c = __map.insert( __x );
+	EXPECT_EQ( __a.index, __c.index );
+	EXPECT_NE( __a.generation, __c.generation );
+	EXPECT_FALSE( __map.contains( __a ) );
+	EXPECT_EQ( 3, __map[ __c ].__v );
+}
@@ -0,0 +1,107 @@
+#include "sparse_set.hpp"
+#include "gtest/gtest.h"
+
+#include <cstdint>
+#include <random>
+#include <stdexcept>
+#include <unordered_set>
+#include <vector>
+
+namespace core = std;
+
+static core::random_device                        rd;
+static core::mt19937                              generator( rd() );
+static core::uniform_int_distribution< uint32_t > distribution( 0, 4095 );
+
+template < typename _Set >
+static auto __same( const core::unordered_set< uint32_t >& __expect, const _Set& __set ) -> bool {
+	if ( __expect.size() != __set.size() ) return false;
+	for ( uint32_t __k : __set ) {
+		if ( !__expect.contains( __k ) ) return false;
+	}
+	return true;
+}
+
+//<--- random inserts, erases and clears against `std::unordered_set` and a `std::vector< bool >`
+template < typename _Set >
+static auto __against_models( _Set& __set ) -> void {
+	core::unordered_set< uint32_t > __expect;
+	core::vector< bool >            __bits( 4096 );
+	for ( int i = 0; i < 50000; i++ ) {
+		const uint32_t __k = distribution( generator );
+		switch ( __k % 7 ) {
+			case 0:
+			case 1:
+				EXPECT_EQ( __expect.erase( __k ), __set.erase( __k ) );
+				__bits[ __k ] = false;
+				break;
+			case 2:
+				if ( i % 100 == 0 ) {
+					__set.clear();
+					__expect.clear();
+					__bits.assign( __bits.size(), false );
+				}
+				break;
+			default:
+				EXPECT_EQ( __expect.insert( __k ).second, __set.insert( __k ) );
+				__bits[ __k ] = true;
+				break;
+		}
+		const uint32_t __probe = distribution( generator );
+		ASSERT_EQ( static_cast< bool >( __bits[ __probe ] ), __set.contains( __probe ) );
+		ASSERT_EQ( __set.contains( __probe ), __set.find( __probe ) != __set.end() );
+	}
+	EXPECT_TRUE( __same( __expect, __set ) );
+	for ( uint32_t __k = 0; __k < 4096; __k++ ) ASSERT_EQ( static_cast< bool >( __bits[ __k ] ), __set.contains( __k ) );
+}
+
+TEST( SPARSE_SET, uninitialized_against_models ) {
+	nya::sparse_set< uint32_t > __set( 4096 );
+	EXPECT_EQ( 4096u, __set.universe() );
+	__against_models( __set );
+}
+
+TEST( SPARSE_SET, zeroed_against_models ) {
+	nya::sparse_set< uint32_t, false > __set;
+	__against_models( __set );
+	EXPECT_GE( __set.universe(), 4096u );
+}
+
+TEST( SPARSE_SET, clear_and_universe ) {
+	nya::sparse_set< uint16_t > __set{ 3, 1, 4, 1, 5, 9, 2, 6 };
+	EXPECT_EQ( 7u, __set.size() );
+	EXPECT_FALSE( __set.contains( 7 ) );
+	EXPECT_FALSE( __set.contains( 60000 ) );
+	EXPECT_EQ( 65536u, __set.max_size() );
+	EXPECT_THROW( __set.reserve_universe( 65537 ), core::length_error );
+
+	//<--- the stale sparse slots do not bring the members back
+	const auto __universe = __set.universe();
+	__set.clear();
+	EXPECT_TRUE( __set.empty() );
+	EXPECT_EQ( __universe, __set.universe() );
+	for ( uint16_t __k = 0; __k < 10; __k++ ) EXPECT_FALSE( __set.contains( __k ) );
+	EXPECT_TRUE( __set.insert( 9 ) );
+	EXPECT_TRUE( __set.insert( 65535 ) );
+	EXPECT_FALSE( __set.contains( 3 ) );
+	EXPECT_EQ( 2u, __set.size() );
+
+	nya::sparse_set< uint16_t > __other{ 65535, 9 };
+	EXPECT_TRUE( __set == __other );
+	EXPECT_EQ( 1u, __other.erase( 65535 ) );
+	EXPECT_FALSE( __set == __other );
+	__set.swap( __other );
+	EXPECT_EQ( 1u, __set.size() );
+	EXPECT_TRUE( __set.contains( 9 ) );
+}
+
+TEST( SPARSE_SET, growth_clamped_to_max_size ) {
+	//<--- doubling past 130 would ask for 262 members of a 256 member universe
+	nya::sparse_set< uint8_t > __set;
+	EXPECT_TRUE( __set.insert( 130 ) );
+	EXPECT_EQ( 131u, __set.universe() );
+	EXPECT_TRUE( __set.insert( 140 ) );
+	EXPECT_EQ( 256u, __set.universe() );
+	EXPECT_TRUE( __set.insert( 255 ) );
+	EXPECT_EQ( 3u, __set.size() );
+}
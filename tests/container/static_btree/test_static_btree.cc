@@ -0,0 +1,52 @@
+#include "static_btree.hpp"
+#include "gtest/gtest.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <functional>
+#include <random>
+#include <vector>
+
+namespace core = std;
+
+static core::random_device                       rd;
+static core::mt19937                             generator( rd() );
+static core::uniform_int_distribution< int64_t > distribution( 0, 100000 );
+
+//<--- every lookup, single and batched, against `std::lower_bound` on the sorted keys
+template < typename _Tp, size_t _Bp, typename _Compare >
+static auto __against_lower_bound( size_t __n, int64_t __range ) -> void {
+	core::vector< _Tp > __sorted( __n );
+	for ( auto& __x : __sorted ) __x = static_cast< _Tp >( distribution( generator ) % __range );
+	core::sort( __sorted.begin(), __sorted.end(), _Compare() );
+	const nya::static_btree< _Tp, _Bp, _Compare > __index( __sorted.begin(), __sorted.end() );
+	ASSERT_EQ( __n, __index.size() );
+	ASSERT_EQ( ( __n + _Bp - 1 ) / _Bp, __index.node_count() );
+
+	core::vector< _Tp > __queries( 1000 );
+	for ( auto& __q : __queries ) __q = static_cast< _Tp >( distribution( generator ) % ( __range + 2 ) );
+	core::vector< size_t > __ranks( __queries.size() );
+	__index.lower_bound( __queries, __ranks );
+	for ( size_t i = 0; i < __queries.size(); i++ ) {
+		const auto __expect = static_cast< size_t >( core::lower_bound( __sorted.begin(), __sorted.end(), __queries[ i ], _Compare() ) - __sorted.begin() );
+		ASSERT_EQ( __expect, __index.lower_bound( __queries[ i ] ) ) << "n " << __n << " query " << __queries[ i ];
+		ASSERT_EQ( __expect, __ranks[ i ] ) << "n " << __n << " query " << __queries[ i ];
+		ASSERT_EQ( core::binary_search( __sorted.begin(), __sorted.end(), __queries[ i ], _Compare() ), __index.contains( __queries[ i ] ) );
+	}
+}
+
+TEST( STATIC_BTREE, cache_line_nodes ) {
+	static_assert( nya::static_btree< uint32_t >::node_size == 16 );
+	for ( size_t __n : { 0, 1, 2, 15, 16, 17, 271, 272, 273, 4913, 5000, 100000 } ) {
+		__against_lower_bound< uint32_t, 16, core::less< uint32_t > >( __n, 100000 );
+		__against_lower_bound< uint32_t, 16, core::less< uint32_t > >( __n, 40 );//<--- runs of duplicates
+	}
+}
+
+TEST( STATIC_BTREE, other_node_sizes ) {
+	for ( size_t __n : { 1, 3, 4, 5, 24, 25, 26, 1000, 33333 } ) {
+		__against_lower_bound< int64_t, 4, core::less< int64_t > >( __n, 100000 );
+		__against_lower_bound< int64_t, 8, core::greater< int64_t > >( __n, 100000 );
+		__against_lower_bound< int64_t, 3, core::less< int64_t > >( __n, 20 );
+	}
+}
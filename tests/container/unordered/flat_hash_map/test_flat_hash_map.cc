@@ -0,0 +1,174 @@
+#include "flat_hash_map.hpp"
+#include "gtest/gtest.h"
+
+#include <memory>
+#include <random>
+#include <stdint.h>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace core = std;
+
+using __map = nya::flat_hash_map< int64_t, core::string >;
+
+static core::random_device                       rd;
+static core::mt19937                             generator( rd() );
+static core::uniform_int_distribution< int64_t > distribution( 0, 100000 );
+
+static auto __same( const core::unordered_map< int64_t, core::string >& __expect, const __map& __m ) -> bool {
+	if ( __expect.size() != __m.size() ) return false;
+	size_t __n = 0;
+	for ( const auto& [ __k, __v ] : __m ) {
+		const auto __it = __expect.find( __k );
+		if ( __it == __expect.end() || __it->second != __v ) return false;
+		++__n;
+	}
+	return __n == __expect.size();
+}
+
+TEST( FLAT_HASH_MAP, construct ) {
+	__map __e;
+	ASSERT_TRUE( __e.empty() );
+	ASSERT_EQ( __e.begin(), __e.end() );
+	ASSERT_EQ( 0, __e.bucket_count() );
+	ASSERT_FALSE( __e.contains( 1 ) );
+
+	__map __m{ { 3, "c" }, { 1, "a" }, { 2, "b" }, { 1, "x" } };
+	ASSERT_EQ( 3, __m.size() );
+	ASSERT_EQ( "a", __m.at( 1 ) );//<--- the first of the equivalent keys wins
+	ASSERT_THROW( __m.at( 4 ), core::out_of_range );
+
+	__map __c( __m );
+	ASSERT_EQ( __m, __c );
+	__map __v( core::move( __c ) );
+	ASSERT_EQ( __m, __v );
+	ASSERT_TRUE( __c.empty() );
+
+	__c = __v;
+	__c[ 4 ] = "d";
+	ASSERT_FALSE( __c == __v );
+	__v = core::move( __c );
+	ASSERT_EQ( 4, __v.size() );
+	__c.swap( __v );
+	ASSERT_EQ( "d", __c.at( 4 ) );
+	ASSERT_TRUE( __v.empty() );
+
+	__map      __r( 100 );
+	const auto __buckets = __r.bucket_count();
+	for ( int64_t i = 0; i < 100; i++ ) __r.try_emplace( i );
+	ASSERT_EQ( __buckets, __r.bucket_count() );//<--- the room was reserved up front
+}
+
+TEST( FLAT_HASH_MAP, insert_and_lookup ) {
+	__map                                     __m;
+	core::unordered_map< int64_t, core::string > __expect;
+	for ( int i = 0; i < 5000; i++ ) {
+		const int64_t __k = distribution( generator );
+		const auto    __s = core::to_string( __k );
+		switch ( i % 4 ) {
+			case 0: ASSERT_EQ( __expect.emplace( __k, __s ).second, __m.emplace( __k, __s ).second ); break;
+			case 1: ASSERT_EQ( __expect.try_emplace( __k, __s ).second, __m.try_emplace( __k, __s ).second ); break;
+			case 2: ASSERT_EQ( __expect.insert( { __k, __s } ).second, __m.insert( { __k, __s } ).second ); break;
+			default: __expect[ __k ] = __s, __m[ __k ] = __s;
+		}
+		ASSERT_LE( __m.load_factor(), __m.max_load_factor() );
+	}
+	ASSERT_TRUE( __same( __expect, __m ) );
+
+	for ( int i = 0; i < 5000; i++ ) {
+		const int64_t __k = distribution( generator );
+		ASSERT_EQ( __expect.count( __k ), __m.count( __k ) );
+		const auto __it = __m.find( __k );
+		ASSERT_EQ( __expect.contains( __k ), __it != __m.end() );
+		if ( __it != __m.end() ) {
+			ASSERT_EQ( __expect.at( __k ), __it->second );
+		}
+	}
+
+	ASSERT_FALSE( __m.insert_or_assign( 7, "seven" ).first == __m.end() );
+	ASSERT_FALSE( __m.insert_or_assign( 7, "SEVEN" ).second );
+	ASSERT_EQ( "SEVEN", __m.at( 7 ) );
+
+	nya::flat_hash_map< core::string, core::unique_ptr< int > > __u;
+	__u.try_emplace( "a", new int( 1 ) );
+	auto __p = core::make_unique< int >( 2 );
+	ASSERT_FALSE( __u.try_emplace( "a", core::move( __p ) ).second );
+	ASSERT_NE( nullptr, __p );//<--- untouched when the key is present
+	for ( int i = 0; i < 100; i++ ) __u.try_emplace( core::to_string( i ), core::make_unique< int >( i ) );
+	ASSERT_EQ( 1, *__u.at( "a" ) );
+	ASSERT_EQ( 42, *__u.at( "42" ) );
+}
+
+TEST( FLAT_HASH_MAP, erase_churn ) {
+	__map                                     __m;
+	core::unordered_map< int64_t, core::string > __expect;
+	__m.reserve( 1000 );
+	const auto __buckets = __m.bucket_count();
+	core::uniform_int_distribution< int64_t > __small( 0, 2000 );
+	for ( int i = 0; i < 100000; i++ ) {
+		const int64_t __k = __small( generator );
+		if ( __expect.size() < 900 && ( i & 1 ) ) {
+			ASSERT_EQ( __expect.try_emplace( __k, core::to_string( __k ) ).second, __m.try_emplace( __k, core::to_string( __k ) ).second );
+		} else {
+			ASSERT_EQ( __expect.erase( __k ), __m.erase( __k ) );
+		}
+	}
+	ASSERT_EQ( __buckets, __m.bucket_count() );//<--- no tombstone, no rehash
+	ASSERT_TRUE( __same( __expect, __m ) );
+
+	for ( auto __it = __m.begin(); __it != __m.end(); ) {
+		if ( __it->first % 2 == 0 ) {
+			__expect.erase( __it->first );
+			__it = __m.erase( __it );
+		} else {
+			++__it;
+		}
+	}
+	ASSERT_TRUE( __same( __expect, __m ) );
+
+	const auto __e = nya::erase_if( __m, []( const auto& __p ) { return __p.first % 3 == 0; } );
+	ASSERT_EQ( core::erase_if( __expect, []( const auto& __p ) { return __p.first % 3 == 0; } ), __e );
+	ASSERT_TRUE( __same( __expect, __m ) );
+
+	__m.clear();
+	ASSERT_TRUE( __m.empty() );
+	ASSERT_EQ( __buckets, __m.bucket_count() );
+	__m.rehash( 0 );
+	ASSERT_EQ( 0, __m.bucket_count() );
+}
+
+namespace {
+
+struct __counted_key {
+	static inline int __copies = 0;
+
+	int64_t __k = 0;
+
+	explicit __counted_key( int64_t __x ) : __k( __x ) {}
+	__counted_key( const __counted_key& __x ) : __k( __x.__k ) { ++__copies; }
+	__counted_key( __counted_key&& __x ) noexcept : __k( __x.__k ) {}
+	auto operator=( const __counted_key& ) -> __counted_key& = default;
+	auto operator=( __counted_key&& ) noexcept -> __counted_key& = default;
+
+	auto operator==( const __counted_key& __x ) const -> bool { return __k == __x.__k; }
+};
+
+struct __counted_hash {
+	auto operator()( const __counted_key& __x ) const -> size_t { return core::hash< int64_t >()( __x.__k ); }
+};
+
+}// namespace
+
+TEST( FLAT_HASH_MAP, rehash_moves_keys ) {
+	nya::flat_hash_map< __counted_key, core::unique_ptr< int >, __counted_hash > __m;
+	for ( int64_t i = 0; i < 1000; i++ ) __m.try_emplace( __counted_key( i ), core::make_unique< int >( static_cast< int >( i ) ) );
+	for ( int64_t i = 0; i < 1000; i += 2 ) __m.erase( __counted_key( i ) );
+	ASSERT_EQ( 0, __counted_key::__copies );//<--- the growths and the backward shifts move the keys
+	ASSERT_EQ( 500, __m.size() );
+	for ( int64_t i = 1; i < 1000; i += 2 ) ASSERT_EQ( i, *__m.at( __counted_key( i ) ) );
+
+	decltype( __m ) __n( core::move( __m ), __m.get_allocator() );
+	ASSERT_EQ( 500, __n.size() );
+	ASSERT_EQ( 0, __counted_key::__copies );
+}
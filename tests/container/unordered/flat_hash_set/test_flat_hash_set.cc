@@ -0,0 +1,124 @@
+#include "flat_hash_set.hpp"
+#include "gtest/gtest.h"
+
+#include <random>
+#include <stdexcept>
+#include <stdint.h>
+#include <string>
+#include <unordered_set>
+#include <vector>
+
+namespace core = std;
+
+using __set = nya::flat_hash_set< int64_t >;
+
+static core::random_device                       rd;
+static core::mt19937                             generator( rd() );
+static core::uniform_int_distribution< int64_t > distribution( 0, 100000 );
+
+static auto __same( const core::unordered_set< int64_t >& __expect, const __set& __s ) -> bool {
+	if ( __expect.size() != __s.size() ) return false;
+	size_t __n = 0;
+	for ( const auto __k : __s ) {
+		if ( !__expect.contains( __k ) ) return false;
+		++__n;
+	}
+	return __n == __expect.size();
+}
+
+TEST( FLAT_HASH_SET, insert_and_lookup ) {
+	__set                          __s;
+	core::unordered_set< int64_t > __expect;
+	for ( int i = 0; i < 5000; i++ ) {
+		const int64_t __k = distribution( generator );
+		ASSERT_EQ( __expect.insert( __k ).second, __s.insert( __k ).second );
+	}
+	ASSERT_TRUE( __same( __expect, __s ) );
+	for ( int i = 0; i < 5000; i++ ) {
+		const int64_t __k = distribution( generator );
+		ASSERT_EQ( __expect.count( __k ), __s.count( __k ) );
+	}
+
+	core::vector< int64_t > __batch;
+	for ( int i = 0; i < 3000; i++ ) __batch.push_back( distribution( generator ) );
+	__expect.insert( __batch.begin(), __batch.end() );
+	__s.insert( __batch.begin(), __batch.end() );
+	ASSERT_TRUE( __same( __expect, __s ) );
+
+	__set __c( __s.begin(), __s.end() );
+	ASSERT_EQ( __s, __c );
+	__c.rehash( __c.bucket_count() * 4 );
+	ASSERT_EQ( __s, __c );
+
+	nya::flat_hash_set< core::string > __strings{ "b", "a", "b" };
+	ASSERT_EQ( 2, __strings.size() );
+	ASSERT_TRUE( __strings.emplace( 3, 'c' ).second );
+	ASSERT_TRUE( __strings.contains( "ccc" ) );
+}
+
+TEST( FLAT_HASH_SET, erase_churn ) {
+	__set                          __s;
+	core::unordered_set< int64_t > __expect;
+	core::uniform_int_distribution< int64_t > __small( 0, 300 );
+	for ( int i = 0; i < 50000; i++ ) {
+		const int64_t __k = __small( generator );
+		if ( i % 3 ) {
+			ASSERT_EQ( __expect.insert( __k ).second, __s.insert( __k ).second );
+		} else {
+			ASSERT_EQ( __expect.erase( __k ), __s.erase( __k ) );
+		}
+		ASSERT_EQ( __expect.contains( __k ), __s.contains( __k ) );
+	}
+	ASSERT_TRUE( __same( __expect, __s ) );
+
+	const auto __e = nya::erase_if( __s, []( int64_t __k ) { return __k % 2 == 0; } );
+	ASSERT_EQ( core::erase_if( __expect, []( int64_t __k ) { return __k % 2 == 0; } ), __e );
+	ASSERT_TRUE( __same( __expect, __s ) );
+}
+
+namespace {
+
+//<--- a key whose copies throw once `__budget` runs out, and whose move may throw so that a rehash copies
+struct __fragile {
+	static inline int __budget = -1;
+
+	int64_t __k = 0;
+
+	explicit __fragile( int64_t __x ) : __k( __x ) {}
+	__fragile( const __fragile& __x ) : __k( __x.__k ) {
+		if ( __budget == 0 ) throw core::runtime_error( "copy" );
+		if ( __budget > 0 ) --__budget;
+	}
+	__fragile( __fragile&& __x ) noexcept( false ) : __fragile( static_cast< const __fragile& >( __x ) ) {}
+	auto operator=( const __fragile& ) -> __fragile& = default;
+
+	auto operator==( const __fragile& __x ) const -> bool { return __k == __x.__k; }
+};
+
+struct __fragile_hash {
+	auto operator()( const __fragile& __x ) const -> size_t { return core::hash< int64_t >()( __x.__k ); }
+};
+
+}// namespace
+
+TEST( FLAT_HASH_SET, throwing_copies ) {
+	using __fragile_set = nya::flat_hash_set< __fragile, __fragile_hash >;
+	__fragile_set __s;
+	for ( int64_t i = 0; i < 14; i++ ) __s.emplace( i );
+	const auto __buckets = __s.bucket_count();
+
+	//<--- the growth copies every element, the fifth copy throws: the table is left as it was
+	__fragile::__budget = 4;
+	ASSERT_THROW( __s.emplace( 14 ), core::runtime_error );
+	__fragile::__budget = -1;
+	ASSERT_EQ( 14, __s.size() );
+	ASSERT_EQ( __buckets, __s.bucket_count() );
+	for ( int64_t i = 0; i < 14; i++ ) ASSERT_TRUE( __s.contains( __fragile( i ) ) );
+	ASSERT_FALSE( __s.contains( __fragile( 14 ) ) );
+
+	//<--- the copies built before the throw are released, the sanitizer would report them
+	__fragile::__budget = 4;
+	ASSERT_THROW( __fragile_set( __s, __s.get_allocator() ), core::runtime_error );
+	__fragile::__budget = -1;
+	ASSERT_EQ( 14, __s.size() );
+}